@@ -0,0 +1,131 @@
+/*
+*--------------------------------------------------------------------------
+* Copyright (c) 2019 Rene Lindsay
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*
+* Author: Rene Lindsay <rjklindsay@gmail.com>
+*
+*--------------------------------------------------------------------------
+*
+* This benchmark measures the cost of Vulkan function dispatch, by recording
+* 1 million vkCmd* calls into a command buffer, through two paths:
+*   Loader : vkGetInstanceProcAddr pointers. (loader trampoline -> driver)
+*   Direct : vkGetDeviceProcAddr pointers.   (straight into the driver)
+* No window is needed. Validation layers are disabled, so they don't dominate the timings.
+*
+* Run with "--null" to use the null driver, without a GPU. Both paths then reach the same no-op functions,
+* so only the dispatch overhead is measured. (Requires the USE_VULKAN_WRAPPER CMake option)
+*
+*/
+
+#include "WSIWindow.h"
+#include "CDevices.h"
+#include "NullDriver.h"
+#include <chrono>
+
+const uint32_t CALL_COUNT = 1000000;
+const uint32_t RUNS       = 5;
+
+struct CCmdFunctions {
+    PFN_vkCmdSetLineWidth        SetLineWidth;
+    PFN_vkCmdSetDepthBias        SetDepthBias;
+    PFN_vkCmdSetStencilReference SetStencilReference;
+    PFN_vkCmdSetBlendConstants   SetBlendConstants;
+    bool IsValid() { return SetLineWidth && SetDepthBias && SetStencilReference && SetBlendConstants; }
+};
+
+// Record CALL_COUNT commands, and return the time in milliseconds. (best of RUNS)
+double Record(VkCommandBuffer cmd, const CCmdFunctions& fn) {
+    const float blend[4] = {};
+    double best = 1e9;
+    repeat(RUNS) {
+        VkCommandBufferBeginInfo begin_info = {};
+        begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        VKERRCHECK(vkResetCommandBuffer(cmd, 0));
+        VKERRCHECK(vkBeginCommandBuffer(cmd, &begin_info));
+        auto start = std::chrono::high_resolution_clock::now();
+        for (uint32_t j = 0; j < CALL_COUNT; j += 4) {  // 4 calls per loop
+            fn.SetLineWidth(cmd, 1.0f);
+            fn.SetDepthBias(cmd, 0.0f, 0.0f, 0.0f);
+            fn.SetStencilReference(cmd, VK_STENCIL_FRONT_AND_BACK, j);
+            fn.SetBlendConstants(cmd, blend);
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        VKERRCHECK(vkEndCommandBuffer(cmd));
+        double ms = std::chrono::duration<double, std::milli>(end - start).count();
+        if (ms < best) best = ms;
+    }
+    return best;
+}
+
+int main(int argc, char *argv[]) {
+    setvbuf(stdout, NULL, _IONBF, 0);                      // Prevent printf buffering in QtCreator
+    for (int i = 1; i < argc; ++i) {
+        if (!strcmp(argv[i], "--null")) {                  // Measure dispatch overhead only: no GPU needed
+            if (!UseNullDriver()) return 0;
+        } else {
+            printf("Usage: DispatchBench [--null]\n");
+            return 0;
+        }
+    }
+    CInstance instance(false);                             // Create a Vulkan Instance, without validation
+    CPhysicalDevices gpus(instance);                       // Enumerate GPUs, and their properties
+    if (!gpus.Count()) { LOGE("No GPU found.\n"); return 0; }
+
+    CDevice device(gpus[0]);                                            // Logical device on the first gpu
+    device.extensions.Clear();                                          // No swapchain needed
+    CQueue* queue = device.RequestQueue(VK_QUEUE_GRAPHICS_BIT, 0, 1.0f);
+    if (!queue || !device.Create()) { LOGE("Failed to create device.\n"); return 0; }
+
+    VkCommandPoolCreateInfo pool_info = {};
+    pool_info.sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    pool_info.flags            = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    pool_info.queueFamilyIndex = queue->family;
+    VkCommandPool pool;
+    VKERRCHECK(vkCreateCommandPool(device, &pool_info, HostAllocator(), &pool));
+
+    VkCommandBufferAllocateInfo alloc_info = {};
+    alloc_info.sType              = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    alloc_info.commandPool        = pool;
+    alloc_info.level              = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    alloc_info.commandBufferCount = 1;
+    VkCommandBuffer cmd;
+    VKERRCHECK(vkAllocateCommandBuffers(device, &alloc_info, &cmd));
+
+    #define LOAD(GPA, HANDLE, NAME) (PFN_vk##NAME)GPA(HANDLE, "vk" #NAME)
+    CCmdFunctions loader = {LOAD(vkGetInstanceProcAddr, instance, CmdSetLineWidth),
+                            LOAD(vkGetInstanceProcAddr, instance, CmdSetDepthBias),
+                            LOAD(vkGetInstanceProcAddr, instance, CmdSetStencilReference),
+                            LOAD(vkGetInstanceProcAddr, instance, CmdSetBlendConstants)};
+    CCmdFunctions direct = {LOAD(vkGetDeviceProcAddr, (VkDevice)device, CmdSetLineWidth),
+                            LOAD(vkGetDeviceProcAddr, (VkDevice)device, CmdSetDepthBias),
+                            LOAD(vkGetDeviceProcAddr, (VkDevice)device, CmdSetStencilReference),
+                            LOAD(vkGetDeviceProcAddr, (VkDevice)device, CmdSetBlendConstants)};
+    #undef LOAD
+    if (!loader.IsValid() || !direct.IsValid()) { LOGE("Failed to load vkCmd* functions.\n"); return 0; }
+
+    Record(cmd, direct);  // warm up
+    double loader_ms = Record(cmd, loader);
+    double direct_ms = Record(cmd, direct);
+
+    printf("Recorded %d vkCmd* calls: (best of %d runs)\n", CALL_COUNT, RUNS);
+    printf("\tLoader trampoline : %7.2f ms  (%5.2f ns/call)\n", loader_ms, loader_ms * 1e6 / CALL_COUNT);
+    printf("\tDirect to driver  : %7.2f ms  (%5.2f ns/call)\n", direct_ms, direct_ms * 1e6 / CALL_COUNT);
+    print(eGREEN, "\tSaved             : %7.2f ms  (%5.1f%%)\n", loader_ms - direct_ms, 100.0 * (1.0 - direct_ms / loader_ms));
+
+    vkFreeCommandBuffers(device, pool, 1, &cmd);
+    vkDestroyCommandPool(device, pool, HostAllocator());
+    return 0;
+}
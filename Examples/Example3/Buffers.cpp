@@ -14,7 +14,7 @@ uint32_t findMemoryType(VkPhysicalDevice gpu, uint32_t typeFilter, VkMemoryPrope
     return 0;
 }
 
-void createImage(VkPhysicalDevice gpu, VkDevice device, uint32_t width, uint32_t height, VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage, VkMemoryPropertyFlags properties, VkImage& image, VkDeviceMemory& imageMemory) {
+void createImage(VkPhysicalDevice gpu, VkDevice device, const CDeviceTable* vk, uint32_t width, uint32_t height, VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage, VkMemoryPropertyFlags properties, VkImage& image, VkDeviceMemory& imageMemory) {
     VkImageCreateInfo imageInfo = {};
     imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
     imageInfo.imageType = VK_IMAGE_TYPE_2D;
@@ -29,20 +29,20 @@ void createImage(VkPhysicalDevice gpu, VkDevice device, uint32_t width, uint32_t
     imageInfo.queueFamilyIndexCount = 0;
     imageInfo.pQueueFamilyIndices = nullptr;
     imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-    VKERRCHECK(vkCreateImage(device, &imageInfo, nullptr, &image));
+    VKERRCHECK(vk->CreateImage(device, &imageInfo, HostAllocator(), &image));
 
     VkMemoryRequirements memRequirements;
-    vkGetImageMemoryRequirements(device, image, &memRequirements);
+    vk->GetImageMemoryRequirements(device, image, &memRequirements);
 
     VkMemoryAllocateInfo allocInfo = {};
     allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
     allocInfo.allocationSize = memRequirements.size;
     allocInfo.memoryTypeIndex = findMemoryType(gpu, memRequirements.memoryTypeBits, properties);
-    VKERRCHECK(vkAllocateMemory(device, &allocInfo, nullptr, &imageMemory));
-    VKERRCHECK(vkBindImageMemory(device, image, imageMemory, 0));
+    VKERRCHECK(vk->AllocateMemory(device, &allocInfo, HostAllocator(), &imageMemory));
+    VKERRCHECK(vk->BindImageMemory(device, image, imageMemory, 0));
 }
 
-VkImageView createImageView(VkDevice device, VkImage image, VkFormat format, VkImageAspectFlags aspectFlags) {
+VkImageView createImageView(VkDevice device, const CDeviceTable* vk, VkImage image, VkFormat format, VkImageAspectFlags aspectFlags) {
     VkImageViewCreateInfo viewInfo = {};
     viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
     viewInfo.image = image;
@@ -59,7 +59,7 @@ VkImageView createImageView(VkDevice device, VkImage image, VkFormat format, VkI
     viewInfo.subresourceRange.layerCount = 1;
 
     VkImageView imageView;
-    VKERRCHECK(vkCreateImageView(device, &viewInfo, nullptr, &imageView));
+    VKERRCHECK(vk->CreateImageView(device, &viewInfo, HostAllocator(), &imageView));
     return imageView;
 }
 
@@ -79,38 +79,77 @@ void SetLayout(){
     imageBarrier.subresourceRange.levelCount     = 1;
     imageBarrier.subresourceRange.baseArrayLayer = 0;
     imageBarrier.subresourceRange.layerCount     = 1;
-    vkCmdPipelineBarrier(command_buffer, 
-                         VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
-                         VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
-                         0,
-                         0, NULL,
-                         0, NULL,
-                         1, &imageBarrier);
+    vk->CmdPipelineBarrier(command_buffer, 
+                           VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                           VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                           0,
+                           0, NULL,
+                           0, NULL,
+                           1, &imageBarrier);
 
 }
 */
 
 //------------------------------------------------------------------------------------------------
 
-CDepthBuffer::CDepthBuffer() : gpu(0), device(0), format(), Image(0), ImageMemory(0), ImageView(0) {}
+CDepthBuffer::CDepthBuffer() : gpu(0), device(0), vk(0), format(), Image(0), ImageMemory(0), ImageView(0) {}
 CDepthBuffer::~CDepthBuffer() { Destroy(); }
 
-void CDepthBuffer::Create(VkPhysicalDevice gpu, VkDevice device, VkExtent2D extent, VkFormat format) {
+void CDepthBuffer::Create(VkPhysicalDevice gpu, VkDevice device, const CDeviceTable& vk, VkExtent2D extent, VkFormat format) {
     this->gpu    = gpu;
     this->device = device;
+    this->vk     = &vk;
     this->format = format;
     Resize(extent);
 }
 
 void CDepthBuffer::Destroy(){
-    if(ImageView)   vkDestroyImageView(device, ImageView, nullptr);
-    if(Image)       vkDestroyImage(device, Image, nullptr);
-    if(ImageMemory) vkFreeMemory(device, ImageMemory, nullptr);
+    if(ImageView)   vk->DestroyImageView(device, ImageView, HostAllocator());
+    if(Image)       vk->DestroyImage(device, Image, HostAllocator());
+    if(ImageMemory) vk->FreeMemory(device, ImageMemory, HostAllocator());
 }
 
 void CDepthBuffer::Resize(VkExtent2D extent){
     Destroy();
     if(format == VK_FORMAT_UNDEFINED) return;
-    createImage(gpu, device, extent.width, extent.height, format, VK_IMAGE_TILING_OPTIMAL, VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, Image, ImageMemory);
-    ImageView = createImageView(device, Image, format, VK_IMAGE_ASPECT_DEPTH_BIT);
-}
\ No newline at end of file
+    createImage(gpu, device, vk, extent.width, extent.height, format, VK_IMAGE_TILING_OPTIMAL, VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, Image, ImageMemory);
+    ImageView = createImageView(device, vk, Image, format, VK_IMAGE_ASPECT_DEPTH_BIT);
+
+    CDebugMarker marker(device, *vk);
+    marker.SetName(VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT,         (uint64_t)Image,       "Depth buffer");
+    marker.SetName(VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT, (uint64_t)ImageMemory, "Depth buffer memory");
+    marker.SetName(VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_VIEW_EXT,    (uint64_t)ImageView,   "Depth buffer view");
+}
+
+//------------------------------------------------------------------------------------------------
+
+CColorBuffer::CColorBuffer() : gpu(0), device(0), vk(0), format(), Image(0), ImageMemory(0), ImageView(0) {}
+CColorBuffer::~CColorBuffer() { Destroy(); }
+
+void CColorBuffer::Create(VkPhysicalDevice gpu, VkDevice device, const CDeviceTable& vk, VkExtent2D extent, VkFormat format) {
+    this->gpu    = gpu;
+    this->device = device;
+    this->vk     = &vk;
+    this->format = format;
+    Resize(extent);
+}
+
+void CColorBuffer::Destroy(){
+    if(ImageView)   vk->DestroyImageView(device, ImageView, HostAllocator());
+    if(Image)       vk->DestroyImage(device, Image, HostAllocator());
+    if(ImageMemory) vk->FreeMemory(device, ImageMemory, HostAllocator());
+    ImageView = 0;  Image = 0;  ImageMemory = 0;
+}
+
+void CColorBuffer::Resize(VkExtent2D extent){
+    Destroy();
+    if(format == VK_FORMAT_UNDEFINED) return;
+    createImage(gpu, device, vk, extent.width, extent.height, format, VK_IMAGE_TILING_OPTIMAL,
+                VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, Image, ImageMemory);
+    ImageView = createImageView(device, vk, Image, format, VK_IMAGE_ASPECT_COLOR_BIT);
+
+    CDebugMarker marker(device, *vk);
+    marker.SetName(VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT,         (uint64_t)Image,       "Color buffer");
+    marker.SetName(VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT, (uint64_t)ImageMemory, "Color buffer memory");
+    marker.SetName(VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_VIEW_EXT,    (uint64_t)ImageView,   "Color buffer view");
+}
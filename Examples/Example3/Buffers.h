@@ -3,16 +3,22 @@
 /*
 *  CSwapchain uses this class to allocate a depth buffer for the swapchain framebuffer.
 *  CSwapchain will automatically resize the depth buffer if the window gets resized.
+*
+*  CColorBuffer is an offscreen color attachment, which can also be copied from. (transfer source)
+*  CSwapchain renders to it, when dynamic resolution is enabled, and then upscales it into the swapchain image.
 */
 
 #ifndef BUFFERS_H
 #define BUFFERS_H
 
 #include "WSIWindow.h"
+#include "CDeviceTable.h"
+#include "DebugMarker.h"
 
 class CDepthBuffer {
     VkPhysicalDevice gpu;
     VkDevice device;
+    const CDeviceTable* vk;
 public:
     VkFormat       format;
     VkImage        Image;
@@ -21,7 +27,24 @@ public:
 
     CDepthBuffer();
     virtual ~CDepthBuffer();
-    void Create(VkPhysicalDevice gpu, VkDevice device, VkExtent2D extent, VkFormat format = VK_FORMAT_D32_SFLOAT);
+    void Create(VkPhysicalDevice gpu, VkDevice device, const CDeviceTable& vk, VkExtent2D extent, VkFormat format = VK_FORMAT_D32_SFLOAT);
+    void Destroy();
+    void Resize(VkExtent2D extent);
+};
+
+class CColorBuffer {
+    VkPhysicalDevice gpu;
+    VkDevice device;
+    const CDeviceTable* vk;
+public:
+    VkFormat       format;
+    VkImage        Image;
+    VkDeviceMemory ImageMemory;
+    VkImageView    ImageView;
+
+    CColorBuffer();
+    virtual ~CColorBuffer();
+    void Create(VkPhysicalDevice gpu, VkDevice device, const CDeviceTable& vk, VkExtent2D extent, VkFormat format);
     void Destroy();
     void Resize(VkExtent2D extent);
 };
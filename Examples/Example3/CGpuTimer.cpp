@@ -0,0 +1,142 @@
+// * Copyright (C) 2019 by Rene Lindsay
+
+#include "CGpuTimer.h"
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+
+//-----------------------------CTimeStats------------------------------
+const uint32_t CTimeStats::SAMPLE_COUNT;  // (std::min takes it by reference)
+
+float CTimeStats::Min() const {
+    uint32_t n = std::min(count, SAMPLE_COUNT);
+    if (!n) return 0;
+    return *std::min_element(samples, samples + n);
+}
+
+float CTimeStats::Avg() const {
+    uint32_t n = std::min(count, SAMPLE_COUNT);
+    if (!n) return 0;
+    double sum = 0;
+    repeat(n) sum += samples[i];
+    return (float)(sum / n);
+}
+
+float CTimeStats::P99() const {
+    uint32_t n = std::min(count, SAMPLE_COUNT);
+    if (!n) return 0;
+    float sorted[SAMPLE_COUNT];
+    std::copy(samples, samples + n, sorted);
+    uint32_t k = (n * 99) / 100;
+    std::nth_element(sorted, sorted + k, sorted + n);
+    return sorted[k];
+}
+//---------------------------------------------------------------------
+
+//------------------------------CGpuTimer------------------------------
+static uint64_t Now() {  // (ns)
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+CGpuTimer::CGpuTimer() : device(0), vk(0), period_ns(1), valid_mask(~0ull), cpu_frame(), last_frame(0) {
+    cpu_frame.name = "CPU frame";
+}
+
+bool CGpuTimer::Init(VkPhysicalDevice gpu, VkDevice device, const CDeviceTable& vk, uint32_t family) {
+    VkPhysicalDeviceProperties props;
+    vkGetPhysicalDeviceProperties(gpu, &props);
+    uint32_t count = 0;
+    vkGetPhysicalDeviceQueueFamilyProperties(gpu, &count, nullptr);
+    std::vector<VkQueueFamilyProperties> families(count);
+    vkGetPhysicalDeviceQueueFamilyProperties(gpu, &count, families.data());
+
+    uint32_t bits = (family < count) ? families[family].timestampValidBits : 0;
+    if (!bits || props.limits.timestampPeriod <= 0) {
+        LOGW("GPU timer: This queue family does not support timestamps.\n");
+        return false;
+    }
+    this->device = device;
+    this->vk     = &vk;
+    period_ns    = props.limits.timestampPeriod;
+    valid_mask   = (bits >= 64) ? ~0ull : ((1ull << bits) - 1);
+    regions.clear();
+    Region("Render pass");
+    return true;
+}
+
+uint32_t CGpuTimer::Region(const char* name) {
+    repeat(regions.size()) if (regions[i].name == name || !strcmp(regions[i].name, name)) return i;
+    CTimeStats stats = {};
+    stats.name = name;
+    regions.push_back(stats);
+    return (uint32_t)regions.size() - 1;
+}
+
+void CGpuTimer::Create(CGpuQueries& queries) {
+    VkQueryPoolCreateInfo info = {};
+    info.sType      = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+    info.queryType  = VK_QUERY_TYPE_TIMESTAMP;
+    info.queryCount = MAX_QUERIES;
+    VKERRCHECK(vk->CreateQueryPool(device, &info, HostAllocator(), &queries.pool));
+    queries.regions.clear();
+    queries.stack.clear();
+}
+
+void CGpuTimer::Destroy(CGpuQueries& queries) {
+    if (queries.pool) vk->DestroyQueryPool(device, queries.pool, HostAllocator());
+    queries.pool = VK_NULL_HANDLE;
+}
+
+void CGpuTimer::Reset(VkCommandBuffer cmd, CGpuQueries& queries) {
+    queries.regions.clear();
+    queries.stack.clear();
+    vk->CmdResetQueryPool(cmd, queries.pool, 0, MAX_QUERIES);
+}
+
+void CGpuTimer::Begin(VkCommandBuffer cmd, CGpuQueries& queries, const char* name) {
+    uint32_t pair = (uint32_t)queries.regions.size();
+    if (pair * 2 >= MAX_QUERIES) { queries.stack.push_back(~0u); return; }  // pool is full: skip this region
+    queries.regions.push_back(Region(name));
+    queries.stack.push_back(pair);
+    vk->CmdWriteTimestamp(cmd, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, queries.pool, pair * 2);
+}
+
+void CGpuTimer::End(VkCommandBuffer cmd, CGpuQueries& queries) {
+    if (queries.stack.empty()) { LOGW("GPU timer: End without Begin.\n"); return; }
+    uint32_t pair = queries.stack.back();
+    queries.stack.pop_back();
+    if (pair != ~0u) vk->CmdWriteTimestamp(cmd, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, queries.pool, pair * 2 + 1);
+}
+
+void CGpuTimer::Read(CGpuQueries& queries) {
+    uint32_t count = (uint32_t)queries.regions.size() * 2;
+    if (!count || !queries.stack.empty()) return;
+    uint64_t times[MAX_QUERIES];
+    VkResult result = vk->GetQueryPoolResults(device, queries.pool, 0, count, sizeof(times), times, sizeof(uint64_t), VK_QUERY_RESULT_64_BIT);
+    if (result != VK_SUCCESS) return;  // VK_NOT_READY: The GPU is not done yet. Skip this sample, rather than wait.
+    repeat(queries.regions.size()) {
+        uint64_t ticks = (times[i * 2 + 1] - times[i * 2]) & valid_mask;
+        regions[queries.regions[i]].Add((float)(ticks * period_ns / 1000000.0));
+    }
+}
+
+void CGpuTimer::CpuFrame() {
+    uint64_t now = Now();
+    if (last_frame) cpu_frame.Add((float)((now - last_frame) / 1000000.0));
+    last_frame = now;
+}
+
+void CGpuTimer::Print() {
+    LOG_FLUSH();
+    printf("Frame times (ms)              min      avg      p99\n");
+    auto row = [](const char* prefix, const CTimeStats& s) {
+        printf("  %-4s%-20s %8.3f %8.3f %8.3f\n", prefix, s.name, s.Min(), s.Avg(), s.P99());
+    };
+    row("", cpu_frame);
+    for (auto& region : regions) if (region.count) row("GPU ", region);
+    if (!regions.empty() && regions[0].count && cpu_frame.count) {
+        bool gpu_bound = regions[0].Avg() > cpu_frame.Avg() * 0.9f;  // GPU is busy for most of the frame
+        printf("  (%s)\n", gpu_bound ? "GPU-bound" : "Not GPU-bound: limited by the CPU, or by vsync");
+    }
+}
+//---------------------------------------------------------------------
@@ -0,0 +1,74 @@
+// * Copyright (C) 2019 by Rene Lindsay
+
+/*
+*  CSwapchain uses this class to measure GPU time, with timestamp queries.
+*
+*  Each swapchain image has its own query pool. (CGpuQueries)  The command buffer that renders to an image
+*  resets its pool, and writes a pair of timestamps around the render pass, and around each labeled region.
+*  The results are read back the next time the same image is acquired, (so a few frames later) without
+*  waiting: If the GPU is not done yet, that frame's sample is skipped.  Since the pools are per image,
+*  this also works for static (prerecorded) command buffers.
+*
+*  For each region, the last SAMPLE_COUNT times are kept, to report min / avg / p99, alongside the CPU frame
+*  time. (time between BeginFrame calls)  If the render pass takes about as long as the CPU frame, the app is GPU-bound.
+*
+*  WARNING: This unit is a work in progress.
+*  Interfaces are experimental and likely to change.
+*/
+
+#ifndef CGPUTIMER_H
+#define CGPUTIMER_H
+
+#include "WSIWindow.h"
+#include "CDeviceTable.h"
+#include <vector>
+
+struct CTimeStats {                          // rolling statistics of one region (milliseconds)
+    static const uint32_t SAMPLE_COUNT = 128;
+    const char* name;                        // must be a string literal
+    float       samples[SAMPLE_COUNT];
+    uint32_t    count;                       // total samples added
+
+    void  Add(float ms) { samples[count++ % SAMPLE_COUNT] = ms; }
+    float Min() const;
+    float Avg() const;
+    float P99() const;                       // 99th percentile
+};
+
+struct CGpuQueries {                         // per swapchain image
+    VkQueryPool           pool;
+    std::vector<uint32_t> regions;           // region index of each timestamp pair
+    std::vector<uint32_t> stack;             // open pairs (Begin without End)
+};
+
+class CGpuTimer {
+    VkDevice                device;
+    const CDeviceTable*     vk;
+    double                  period_ns;       // nanoseconds per timestamp tick
+    uint64_t                valid_mask;      // timestampValidBits of the queue family
+    std::vector<CTimeStats> regions;         // [0] = "Render pass"
+    CTimeStats              cpu_frame;
+    uint64_t                last_frame;      // time of the last CpuFrame() call (ns)
+
+    uint32_t Region(const char* name);
+  public:
+    static const uint32_t MAX_QUERIES = 64;  // timestamps per frame (32 regions)
+
+    CGpuTimer();
+    bool Init(VkPhysicalDevice gpu, VkDevice device, const CDeviceTable& vk, uint32_t family);  // false if not supported
+    bool IsEnabled() const { return !!vk; }
+
+    void Create (CGpuQueries& queries);
+    void Destroy(CGpuQueries& queries);
+    void Reset  (VkCommandBuffer cmd, CGpuQueries& queries);  // Start recording. (outside a render pass)
+    void Begin  (VkCommandBuffer cmd, CGpuQueries& queries, const char* name);
+    void End    (VkCommandBuffer cmd, CGpuQueries& queries);
+    void Read   (CGpuQueries& queries);                       // Collect results, if ready. (Doesn't wait.)
+    void CpuFrame();                                          // Call once per frame, to measure the CPU frame time.
+
+    const CTimeStats*              GetCpuFrame() const { return &cpu_frame; }
+    const std::vector<CTimeStats>& GetRegions()  const { return regions; }
+    void Print();
+};
+
+#endif
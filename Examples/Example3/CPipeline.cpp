@@ -2,17 +2,17 @@
 #include "CPipeline.h"
 #include "WSIWindow.h"
 
-CPipeline::CPipeline(VkDevice device, VkRenderPass renderpass) :
-    device(device), renderpass(renderpass), 
+CPipeline::CPipeline(const CDevice& device, VkRenderPass renderpass) :
+    device(device), vk(&device.vk), marker(device, device.vk), renderpass(renderpass), 
     vertShaderModule(), fragShaderModule(),
     pipelineLayout(), graphicsPipeline() {}
 
 CPipeline::~CPipeline(){
-    if (device) vkDeviceWaitIdle(device);
-    if (pipelineLayout)   vkDestroyPipelineLayout(device, pipelineLayout,   nullptr);
-    if (graphicsPipeline) vkDestroyPipeline      (device, graphicsPipeline, nullptr);
-    if (vertShaderModule) vkDestroyShaderModule  (device, vertShaderModule, nullptr);
-    if (fragShaderModule) vkDestroyShaderModule  (device, fragShaderModule, nullptr);
+    if (device) vk->DeviceWaitIdle(device);
+    if (pipelineLayout)   vk->DestroyPipelineLayout(device, pipelineLayout,   HostAllocator());
+    if (graphicsPipeline) vk->DestroyPipeline      (device, graphicsPipeline, HostAllocator());
+    if (vertShaderModule) vk->DestroyShaderModule  (device, vertShaderModule, HostAllocator());
+    if (fragShaderModule) vk->DestroyShaderModule  (device, fragShaderModule, HostAllocator());
 }
 
 // -- Shader modules ---
@@ -28,6 +28,7 @@ bool CPipeline::LoadFragShader(const char* filename) {
 
 VkShaderModule CPipeline::LoadShader(const char* filename) {
     // Read File
+    LOG_FLUSH();
     printf("Load Shader: %s... ", filename);
     FILE* file = fopen(filename, "rb");
     printf("%s\n", (file?"Found":"Not found"));
@@ -40,7 +41,9 @@ VkShaderModule CPipeline::LoadShader(const char* filename) {
     fread(buffer.data(), 1, file_size, file);
     fclose(file);
 
-    return CreateShaderModule(buffer); 
+    VkShaderModule module = CreateShaderModule(buffer);
+    marker.SetName(VK_DEBUG_REPORT_OBJECT_TYPE_SHADER_MODULE_EXT, (uint64_t)module, "%s", filename);
+    return module;
 }
 
 VkShaderModule CPipeline::CreateShaderModule(const std::vector<char>& code) {
@@ -53,7 +56,7 @@ VkShaderModule CPipeline::CreateShaderModule(const std::vector<char>& code) {
     createInfo.pCode = codeAligned.data();
 
     VkShaderModule shaderModule = 0;
-    VKERRCHECK(vkCreateShaderModule(device, &createInfo, nullptr, &shaderModule));
+    VKERRCHECK(vk->CreateShaderModule(device, &createInfo, HostAllocator(), &shaderModule));
     return shaderModule;
 }
 // ---------------------
@@ -108,6 +111,13 @@ VkPipeline CPipeline::CreateGraphicsPipeline(VkExtent2D extent) {
     viewportState.scissorCount = 1;
     viewportState.pScissors = &scissor;
 
+    // Viewport and scissor are set per frame, by CSwapchain, to match the (possibly scaled) render area.
+    VkDynamicState dynamicStates[] = {VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR};
+    VkPipelineDynamicStateCreateInfo dynamicState = {};
+    dynamicState.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
+    dynamicState.dynamicStateCount = 2;
+    dynamicState.pDynamicStates = dynamicStates;
+
     VkPipelineRasterizationStateCreateInfo rasterizer = {};
     rasterizer.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
     rasterizer.depthClampEnable = VK_FALSE;
@@ -158,7 +168,8 @@ VkPipeline CPipeline::CreateGraphicsPipeline(VkExtent2D extent) {
     pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
     pipelineLayoutInfo.setLayoutCount = 0;
     pipelineLayoutInfo.pushConstantRangeCount = 0;
-    VKERRCHECK(vkCreatePipelineLayout(device, &pipelineLayoutInfo, nullptr, &pipelineLayout));
+    VKERRCHECK(vk->CreatePipelineLayout(device, &pipelineLayoutInfo, HostAllocator(), &pipelineLayout));
+    marker.SetName(VK_DEBUG_REPORT_OBJECT_TYPE_PIPELINE_LAYOUT_EXT, (uint64_t)pipelineLayout, "Pipeline layout");
 
     VkGraphicsPipelineCreateInfo pipelineInfo = {};
     pipelineInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
@@ -172,13 +183,14 @@ VkPipeline CPipeline::CreateGraphicsPipeline(VkExtent2D extent) {
     pipelineInfo.pMultisampleState = &multisampling;
     pipelineInfo.pDepthStencilState = &depthStencilState;
     pipelineInfo.pColorBlendState = &colorBlending;
-    //pipelineInfo.pDynamicState = 0;
+    pipelineInfo.pDynamicState = &dynamicState;
     pipelineInfo.layout = pipelineLayout;
     pipelineInfo.renderPass = renderpass;
     pipelineInfo.subpass = 0;
     pipelineInfo.basePipelineHandle = VK_NULL_HANDLE;
     //pipelineInfo.basePipelineIndex = 0;
 
-    VKERRCHECK(vkCreateGraphicsPipelines(device, VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &graphicsPipeline));
+    VKERRCHECK(vk->CreateGraphicsPipelines(device, VK_NULL_HANDLE, 1, &pipelineInfo, HostAllocator(), &graphicsPipeline));
+    marker.SetName(VK_DEBUG_REPORT_OBJECT_TYPE_PIPELINE_EXT, (uint64_t)graphicsPipeline, "Graphics pipeline");
     return graphicsPipeline;
 }
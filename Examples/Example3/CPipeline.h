@@ -12,16 +12,18 @@ class CPipeline {
 
     VkShaderModule LoadShader(const char* filename);
     VkShaderModule CreateShaderModule(const std::vector<char>& code);
-    VkDevice     device;
-    VkRenderPass renderpass;
+    VkDevice            device;
+    const CDeviceTable* vk;
+    CDebugMarker        marker;
+    VkRenderPass        renderpass;
 
   public:
-    CPipeline(VkDevice device, VkRenderPass renderpass);
+    CPipeline(const CDevice& device, VkRenderPass renderpass);
     ~CPipeline();
     bool LoadVertShader(const char* filename);
     bool LoadFragShader(const char* filename);
 
-    VkPipeline CreateGraphicsPipeline(VkExtent2D extent = {64,64});
+    VkPipeline CreateGraphicsPipeline(VkExtent2D extent = {64,64});  // Viewport and scissor are dynamic state. (CSwapchain sets them.)
     operator VkPipeline() const { return graphicsPipeline; }
 };
 
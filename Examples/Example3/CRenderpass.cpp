@@ -64,7 +64,7 @@ void CRenderpass::CSubpass::InputAttachments(vector<uint32_t> attachment_indexes
 
 
 // ----------------------------------Renderpass---------------------------------
-CRenderpass::CRenderpass(VkDevice device) : device(device), renderpass() {}
+CRenderpass::CRenderpass(const CDevice& device) : device(device), vk(&device.vk), renderpass(), offscreen() {}
 CRenderpass::~CRenderpass() {Destroy();}
 
 uint32_t CRenderpass::AddColorAttachment(VkFormat format, VkClearColorValue clearVal, VkImageLayout final_layout) {
@@ -108,7 +108,21 @@ void CRenderpass::AddSubpassDependency(uint32_t srcSubpass, uint32_t dstSubpass)
 void CRenderpass::Create() {
     ASSERT(!renderpass, "Renderpass cannot be modified after its been linked to swapchain or pipeline.\n");
     if(renderpass) return;
+    renderpass = Build(attachments, "Renderpass");
+    LOGI("Renderpass created\n");
+}
 
+VkRenderPass CRenderpass::Offscreen() {
+    if(offscreen) return offscreen;
+    if(!renderpass) Create();
+    std::vector<VkAttachmentDescription> offscreen_attachments = attachments;
+    for(auto& attachment : offscreen_attachments)
+        if(attachment.finalLayout == VK_IMAGE_LAYOUT_PRESENT_SRC_KHR) attachment.finalLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+    offscreen = Build(offscreen_attachments, "Offscreen renderpass");
+    return offscreen;
+}
+
+VkRenderPass CRenderpass::Build(const std::vector<VkAttachmentDescription>& attachments, const char* name) {
     // Build subpass array
     std::vector<VkSubpassDescription> subs(subpasses.size());
     repeat(subpasses.size()) subs[i] = subpasses[i];
@@ -123,13 +137,17 @@ void CRenderpass::Create() {
     rp_info.pSubpasses      =           subs.data();
     rp_info.dependencyCount = (uint32_t)dependencies.size();
     rp_info.pDependencies   =           dependencies.data();
-    VKERRCHECK(vkCreateRenderPass(device, &rp_info, nullptr, &renderpass));
-    LOGI("Renderpass created\n");
+    VkRenderPass handle;
+    VKERRCHECK(vk->CreateRenderPass(device, &rp_info, HostAllocator(), &handle));
+    CDebugMarker(device, *vk).SetName(VK_DEBUG_REPORT_OBJECT_TYPE_RENDER_PASS_EXT, (uint64_t)handle, name);
+    return handle;
 }
 
 void CRenderpass::Destroy() {
+    if(offscreen) vk->DestroyRenderPass(device, offscreen, HostAllocator());
+    offscreen = 0;
     if(!renderpass) return;
-    vkDestroyRenderPass(device, renderpass, nullptr);
+    vk->DestroyRenderPass(device, renderpass, HostAllocator());
     renderpass = 0;
     LOGI("Renderpass destroyed\n");
 }
@@ -175,6 +193,6 @@ void CreateRenderPass(VkFormat swapchainImageFormat) {
     renderPassInfo.dependencyCount = 1;
     renderPassInfo.pDependencies = &dependency;
 
-    VKERRCHECK(vkCreateRenderPass(device, &renderPassInfo, nullptr, &renderpass));
+    VKERRCHECK(vk->CreateRenderPass(device, &renderPassInfo, HostAllocator(), &renderpass));
 }
 */
@@ -52,6 +52,8 @@
 #define CRENDERPASS_H
 
 #include "WSIWindow.h"
+#include "CDevices.h"
+#include "DebugMarker.h"
 
 class CRenderpass {
     class CSubpass {
@@ -70,9 +72,12 @@ class CRenderpass {
         void InputAttachments(vector<uint32_t> attachment_indexes = {});
     };
 
-    VkDevice     device;
-    VkRenderPass renderpass;
+    VkDevice            device;
+    const CDeviceTable* vk;
+    VkRenderPass        renderpass;
+    VkRenderPass        offscreen;   // copy of renderpass, for rendering to an offscreen image. (see Offscreen)
 
+    VkRenderPass Build(const std::vector<VkAttachmentDescription>& attachments, const char* name);
   public:
     // ---Used by CSwapchain ---
     VkFormat surface_format = VK_FORMAT_UNDEFINED;
@@ -84,7 +89,7 @@ class CRenderpass {
     std::vector<VkAttachmentDescription> attachments;
     std::vector<VkSubpassDependency>     dependencies;
 
-    CRenderpass(VkDevice device);
+    CRenderpass(const CDevice& device);
     ~CRenderpass();
 
     uint32_t AddColorAttachment(VkFormat format, VkClearColorValue clearVal = {}, VkImageLayout final_layout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR);
@@ -98,6 +103,10 @@ class CRenderpass {
         if(!renderpass) Create();
         return renderpass;
     }
+    // Same renderpass, but the surface color attachment ends in VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, instead of
+    // PRESENT_SRC, so it can be copied to the swapchain image. (see CSwapchain::SetDynamicResolution)
+    // Only the layouts differ, so it's compatible with the same pipelines and framebuffers.
+    VkRenderPass Offscreen();
 };
 
 #endif
@@ -1,46 +1,81 @@
 // * Copyright (C) 2017 by Rene Lindsay
 
 #include "CSwapchain.h"
+#include <algorithm>
+#include <math.h>
+#include <chrono>
+#include <thread>
 /*
 //---- Command Buffer (vkCmd*) ----
-void CCmd::BindPipeline(VkPipeline graphicsPipeline) { vkCmdBindPipeline(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, graphicsPipeline); }
-void CCmd::Draw(uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t  firstInstance) { vkCmdDraw(command_buffer,vertexCount, instanceCount, firstVertex, firstInstance); }
+void CCmd::BindPipeline(VkPipeline graphicsPipeline) { vk->CmdBindPipeline(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, graphicsPipeline); }
+void CCmd::Draw(uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t  firstInstance) { vk->CmdDraw(command_buffer,vertexCount, instanceCount, firstVertex, firstInstance); }
 //---------------------------------
 */
-CSwapchain::CSwapchain(const CQueue& present_queue, CRenderpass& renderpass) {
+CSwapchain::CSwapchain(const CQueue& present_queue, CRenderpass& renderpass) : CSwapchain(present_queue, present_queue, renderpass) {}
+
+CSwapchain::CSwapchain(const CQueue& graphics_queue, const CQueue& present_queue, CRenderpass& renderpass)
+    : CSwapchain(graphics_queue, present_queue, renderpass, nullptr) {}
+
+CSwapchain::CSwapchain(CQueueManager& queues, CRenderpass& renderpass)
+    : CSwapchain(*queues.Graphics(), *queues.Present(), renderpass, &queues) {}
+
+CSwapchain::CSwapchain(const CQueue& graphics_queue, const CQueue& present_queue, CRenderpass& renderpass, CQueueManager* queues) {
     const CQueue& q = present_queue;
     this->renderpass = &renderpass;
     if(!q.surface){ LOGE("This queue may not be presentable. (No surface attached.)"); }
+    if(!(graphics_queue.flags & VK_QUEUE_GRAPHICS_BIT)) LOGW("CSwapchain: The graphics queue does not support graphics.\n");
+    vk = q.vk;
+    marker = CDebugMarker(q.device, *vk);
+    queue               = graphics_queue.handle;
+    family              = graphics_queue.family;
+    this->present_queue = q.handle;
+    present_family      = q.family;
+    separate_present    = (family != present_family);
+    present_pool        = VK_NULL_HANDLE;
     Init(q.gpu, q.device, q.surface);
-    queue = q.handle;
-    CreateCommandPool(q.family);
+    batch         = queues ? queues->Batch(eQUEUE_GRAPHICS) : nullptr;
+    present_batch = queues ? queues->Batch(eQUEUE_PRESENT)  : nullptr;
+    timeline.Init(graphics_queue, batch);
+    if (separate_present) present_timeline.Init(q, present_batch);
+    CreateFrames(2);
+
+    //--Present CommandPool--  (for the ownership transfers, on the present queue)
+    if (separate_present) {
+        VkCommandPoolCreateInfo poolInfo = {};
+        poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        poolInfo.queueFamilyIndex = present_family;
+        VKERRCHECK(vk->CreateCommandPool(device, &poolInfo, HostAllocator(), &present_pool));
+        marker.SetName(VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_POOL_EXT, (uint64_t)present_pool, "Present command pool");
+        LOGI("CSwapchain: Rendering on queue family %d, and presenting on queue family %d.\n", family, present_family);
+    }
+    //-----------------------
 
-    // -- Create Semaphores --
-    VkSemaphoreCreateInfo semaphoreInfo = {};
-    semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
-    VKERRCHECK(vkCreateSemaphore(device, &semaphoreInfo, nullptr, &acquire_semaphore));
-    VKERRCHECK(vkCreateSemaphore(device, &semaphoreInfo, nullptr, &submit_semaphore));
-    // -----------------------
+    //--Static CommandPool--
+    VkCommandPoolCreateInfo poolInfo = {};
+    poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    poolInfo.queueFamilyIndex = family;
+    poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    VKERRCHECK(vk->CreateCommandPool(device, &poolInfo, HostAllocator(), &static_pool));
+    marker.SetName(VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_POOL_EXT, (uint64_t)static_pool, "Static command pool");
+    //----------------------
 
-    depth_buffer.Create(gpu, device, info.imageExtent, renderpass.depth_format);
+    depth_buffer.Create(gpu, device, *vk, info.imageExtent, renderpass.depth_format);
     Apply();
 }
 
 CSwapchain::~CSwapchain(){
-    if (device) vkDeviceWaitIdle(device);
-    if (command_pool)      vkDestroyCommandPool(device, command_pool,      nullptr);
-    if (acquire_semaphore) vkDestroySemaphore  (device, acquire_semaphore, nullptr);
-    if (submit_semaphore)  vkDestroySemaphore  (device, submit_semaphore,  nullptr);
+    if (device) vk->DeviceWaitIdle(device);
+    DestroyFrames();
 
     if (swapchain) {
-        for(auto& buf : buffers) {
-            vkDestroyFence(device, buf.fence, nullptr);
-            vkDestroyFramebuffer(device, buf.framebuffer, nullptr);
-            vkDestroyImageView(device, buf.view, nullptr);
-        }
-        vkDestroySwapchainKHR(device, swapchain, 0);
+        Retire();
+        DestroyRetired(true);
         LOGI("Swapchain destroyed\n");
     }
+    if (static_pool)  vk->DestroyCommandPool(device, static_pool,  HostAllocator());
+    if (present_pool) vk->DestroyCommandPool(device, present_pool, HostAllocator());
+    present_timeline.Destroy();
+    timeline.Destroy();
 }
 
 void CSwapchain::Init(VkPhysicalDevice gpu, VkDevice device, VkSurfaceKHR surface) {
@@ -49,9 +84,37 @@ void CSwapchain::Init(VkPhysicalDevice gpu, VkDevice device, VkSurfaceKHR surfac
     this->device  = device;
     swapchain     = 0;
     is_acquired   = false;
+    frame_count   = 0;
+    is_static      = false;
+    static_version = 1;
+    is_recording   = false;
+    subpass_contents = VK_SUBPASS_CONTENTS_INLINE;
+    has_timing     = (vk->GetRefreshCycleDurationGOOGLE && vk->GetPastPresentationTimingGOOGLE);
+    pacing         = false;
+    pacing_margin  = 1000000;
+    present_id     = 0;
+    timing         = {};
+    adapt_goal     = ADAPT_OFF;
+    adapt_frame    = 0;
+    adapt_mode     = VK_PRESENT_MODE_FIFO_KHR;
+    adapt_images   = 0;
+    record_start   = 0;
+    cpu_record     = {};
+    cpu_record.name = "CPU record";
+    scaling        = false;
+    render_scale   = 1.0f;
+    min_scale      = 0.5f;
+    scale_budget   = 0;
+    scale_gpu      = 0;
+    scale_samples  = 0;
+    scale_seen     = 0;
+    scale_skip     = 0;
+    scaled_framebuffer = VK_NULL_HANDLE;
+    render_extent  = {};
 
     //--- surface caps ---
-    VKERRCHECK(vkGetPhysicalDeviceSurfaceCapabilitiesKHR(gpu, surface, &surface_caps));
+    surface_info = &CSurfaceInfo::Get(gpu, surface);
+    surface_caps = surface_info->Capabilities();
     assert(surface_caps.supportedUsageFlags & VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT);
     //assert(surface_caps.supportedTransforms & surface_caps.currentTransform);
     assert(surface_caps.supportedTransforms & VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR);
@@ -76,26 +139,351 @@ void CSwapchain::Init(VkPhysicalDevice gpu, VkDevice device, VkSurfaceKHR surfac
     //info.oldSwapchain          = swapchain;
     info.compositeAlpha = (surface_caps.supportedCompositeAlpha & VK_COMPOSITE_ALPHA_INHERIT_BIT_KHR) ?
                            VK_COMPOSITE_ALPHA_INHERIT_BIT_KHR : VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR;
-    SetExtent();  // also initializes surface_caps
+    SetExtent();  // also refreshes surface_caps
     //SetFormat(VK_FORMAT_B8G8R8A8_UNORM);
     SetImageCount(2);
 }
 
-//----------------------------------CommandPool------------------------------------
-void CSwapchain::CreateCommandPool(uint32_t family) {
-    VkCommandPoolCreateInfo poolInfo = {};
-    poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
-    poolInfo.queueFamilyIndex = family;
-    poolInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
-    VKERRCHECK(vkCreateCommandPool(device, &poolInfo, nullptr, &command_pool));
+//-------------------------------Frames in flight---------------------------------
+void CSwapchain::CreateFrames(uint32_t count) {
+    frames.resize(count);
+    frame_index = 0;
+    repeat(count) {
+        CFrame& frame = frames[i];
+        //--CommandPool--  (one pool per frame, so the whole pool can be reset at once)
+        VkCommandPoolCreateInfo poolInfo = {};
+        poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        poolInfo.queueFamilyIndex = family;
+        poolInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+        VKERRCHECK(vk->CreateCommandPool(device, &poolInfo, HostAllocator(), &frame.command_pool));
+        //---------------
+        //--CommandBuffer--
+        VkCommandBufferAllocateInfo allocInfo = {};
+        allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocInfo.commandPool = frame.command_pool;
+        allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocInfo.commandBufferCount = 1;
+        VKERRCHECK(vk->AllocateCommandBuffers(device, &allocInfo, &frame.command_buffer));
+        //-----------------
+        frame.value = 0;  // not submitted yet
+        //---Semaphore---
+        VkSemaphoreCreateInfo semaphoreInfo = {};
+        semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        VKERRCHECK(vk->CreateSemaphore(device, &semaphoreInfo, HostAllocator(), &frame.acquire_semaphore));
+        //---------------
+        //---Names---
+        marker.SetName(VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_POOL_EXT,   (uint64_t)frame.command_pool,      "Frame command pool %d", i);
+        marker.SetName(VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT, (uint64_t)frame.command_buffer,    "Frame command buffer %d", i);
+        marker.SetName(VK_DEBUG_REPORT_OBJECT_TYPE_SEMAPHORE_EXT,      (uint64_t)frame.acquire_semaphore, "Acquire semaphore %d", i);
+        //-----------
+    }
+}
+
+void CSwapchain::DestroyFrames() {
+    for (auto& frame : frames) {
+        vk->DestroySemaphore  (device, frame.acquire_semaphore, HostAllocator());
+        vk->DestroyCommandPool(device, frame.command_pool,      HostAllocator());  // also frees the command buffer
+        for (auto& thread : frame.threads) vk->DestroyCommandPool(device, thread.pool, HostAllocator());
+    }
+    frames.clear();
+}
+
+void CSwapchain::SetFramesInFlight(uint32_t count) {
+    ASSERT(!is_acquired, "CSwapchain: Can't change frames-in-flight count between BeginFrame and EndFrame.\n");
+    if (count < 1) count = 1;
+    if (count == frames.size()) return;
+    timeline.WaitIdle();
+    present_timeline.WaitIdle();
+    DestroyRetired(true);  // all frames are done
+    DestroyFrames();
+    CreateFrames(count);
+}
+
+void CSwapchain::SetThreadCount(uint32_t count) {
+    ASSERT(!is_recording, "CSwapchain: Can't change thread count between BeginFrame and EndFrame.\n");
+    thread_pool.reset(new CThreadPool(count));  // Per-thread command pools are created by ExecuteParallel, as needed.
+}
+
+bool CSwapchain::EnableGpuTimer() {
+    if (gpu_timer.IsEnabled()) return true;
+    if (!gpu_timer.Init(gpu, device, *vk, family)) return false;
+    for (auto& buf : buffers) gpu_timer.Create(buf.queries);
+    Invalidate();  // Re-record static command buffers, with timestamps.
+    return true;
+}
+
+void CSwapchain::BeginRegion(VkCommandBuffer cmd, const char* name) {
+    if (gpu_timer.IsEnabled() && is_recording) gpu_timer.Begin(cmd, buffers[acquired_index].queries, name);
+}
+
+void CSwapchain::EndRegion(VkCommandBuffer cmd) {
+    if (gpu_timer.IsEnabled() && is_recording) gpu_timer.End(cmd, buffers[acquired_index].queries);
+}
+
+void CSwapchain::SetStatic(bool enable) {
+    is_static = enable;
+    Invalidate();
+}
+//---------------------------------------------------------------------------------
+
+//--------------------------------Present timing-----------------------------------
+static uint64_t Now() {  // (ns) on the steady_clock timeline, used for present times
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+bool CSwapchain::SetPacing(bool enable, uint32_t margin_us) {
+    if (enable && !has_timing) LOGW("Frame pacing requires VK_GOOGLE_display_timing, which is not enabled.\n");
+    pacing        = enable && has_timing;
+    pacing_margin = margin_us * 1000ull;
+    timing.target = 0;
+    return pacing;
+}
+
+void CSwapchain::UpdateTiming() {
+    VkPastPresentationTimingGOOGLE past[TIMING_HISTORY];
+    uint32_t count = TIMING_HISTORY;
+    VkResult result = VK_INCOMPLETE;
+    while (result == VK_INCOMPLETE) {  // read all results, oldest first
+        count  = TIMING_HISTORY;
+        result = vk->GetPastPresentationTimingGOOGLE(device, swapchain, &count, past);
+        repeat(count) {
+            auto& t = past[i];
+            if (t.actualPresentTime > timing.last_present) timing.last_present = t.actualPresentTime;
+            if (present_id - t.presentID >= TIMING_HISTORY) continue;  // too old: begin time was overwritten
+            uint64_t begin = begin_time[t.presentID % TIMING_HISTORY];
+            if (t.actualPresentTime < begin + t.presentMargin) continue;    // different timeline?
+            uint64_t latency = t.actualPresentTime - begin;
+            uint64_t work    = latency - t.presentMargin;                   // time until it could have been presented
+            timing.latency = timing.latency ? (timing.latency * 7 + latency) / 8 : latency;  // running average
+            timing.work    = timing.work    ? (timing.work    * 7 + work)    / 8 : work;
+        }
+    }
+}
+
+void CSwapchain::Pace() {
+    if (!has_timing || !swapchain) return;
+    UpdateTiming();
+    if (!pacing || !timing.refresh || !timing.last_present) { timing.target = 0; return; }
+    PROFILE_ZONE("Pace");
+
+    // Pick the first vblank that the frame can be ready for, but not one that a previous frame is already using.
+    uint64_t refresh  = timing.refresh;
+    uint64_t earliest = Now() + timing.work + pacing_margin;
+    uint64_t vblank   = timing.last_present + refresh;
+    if (earliest > vblank) vblank += (earliest - vblank + refresh - 1) / refresh * refresh;
+    if (timing.target && vblank < timing.target + refresh) vblank = timing.target + refresh;
+    timing.target = vblank;
+
+    // Sleep until the frame must start.
+    uint64_t start = vblank - timing.work - pacing_margin;
+    uint64_t now   = Now();
+    if (start > now) std::this_thread::sleep_for(std::chrono::nanoseconds(start - now));
+}
+//---------------------------------------------------------------------------------
+
+//------------------------------Adaptive present mode------------------------------
+void CSwapchain::SetAdaptive(eAdaptiveGoal goal) {
+    adapt_goal   = goal;
+    adapt_frame  = frame_count;
+    adapt_mode   = info.presentMode;
+    adapt_images = info.minImageCount;
+}
+
+void CSwapchain::Adapt() {
+    if (adapt_goal == ADAPT_OFF || frame_count < adapt_frame + ADAPT_INTERVAL) return;
+    adapt_frame = frame_count;
+
+    //-- Measure --
+    float refresh = timing.refresh ? timing.refresh / 1000000.0f : 1000.0f / 60;  // (ms)
+    float cost    = cpu_record.P99();
+    auto& gpu     = gpu_timer.GetRegions();
+    if (!gpu.empty() && gpu[0].count) cost = std::max(cost, gpu[0].P99());
+    auto& modes   = surface_info->PresentModes();
+    auto  has     = [&](VkPresentModeKHR m) { return std::find(modes.begin(), modes.end(), m) != modes.end(); };
+
+    //-- Choose --
+    VkPresentModeKHR mode = VK_PRESENT_MODE_FIFO_KHR;
+    uint32_t images = 2;
+    if (adapt_goal == ADAPT_LATENCY) {
+        if      (cost < refresh * 0.5f && has(VK_PRESENT_MODE_MAILBOX_KHR))       { mode = VK_PRESENT_MODE_MAILBOX_KHR;      images = 3; }
+        else if (cost > refresh * 0.9f && has(VK_PRESENT_MODE_FIFO_RELAXED_KHR))  { mode = VK_PRESENT_MODE_FIFO_RELAXED_KHR; images = 3; }
+    } else {  // ADAPT_POWER
+        if (cost > refresh * 0.8f) images = 3;
+    }
+    images = max(images, surface_caps.minImageCount);
+    if (surface_caps.maxImageCount > 0) images = min(images, surface_caps.maxImageCount);
+
+    //-- Apply --  (only if picked twice in a row, to avoid flip-flopping)
+    bool changed   = (mode != info.presentMode || images != info.minImageCount);
+    bool confirmed = (mode == adapt_mode && images == adapt_images);
+    adapt_mode   = mode;
+    adapt_images = images;
+    if (!changed || !confirmed) return;
+
+    const char* names[] = {"IMMEDIATE", "MAILBOX", "FIFO", "FIFO_RELAXED"};
+    LOGI("Adaptive swapchain: %s with %d images. (frame cost %.2f ms, refresh %.2f ms)\n", names[mode], images, cost, refresh);
+    info.presentMode   = mode;
+    info.minImageCount = images;
+    Apply();  // Recreate, without waiting for the device to go idle.
 }
 //---------------------------------------------------------------------------------
 
+//-------------------------------Dynamic resolution--------------------------------
+bool CSwapchain::SetDynamicResolution(bool enable, float budget_ms, float min_scale) {
+    ASSERT(!is_recording, "CSwapchain: Can't change dynamic resolution between BeginFrame and EndFrame.\n");
+    if (enable) {  // The swapchain images must be blit destinations, and the surface format must support linear blits.
+        VkFormatProperties props;
+        vkGetPhysicalDeviceFormatProperties(gpu, info.imageFormat, &props);
+        const VkFormatFeatureFlags blit = VK_FORMAT_FEATURE_BLIT_SRC_BIT | VK_FORMAT_FEATURE_BLIT_DST_BIT |
+                                          VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT;
+        if (!(surface_caps.supportedUsageFlags & VK_IMAGE_USAGE_TRANSFER_DST_BIT) || (props.optimalTilingFeatures & blit) != blit) {
+            LOGW("Dynamic resolution: Can't blit to the swapchain images, with this surface format.\n");
+            enable = false;
+        } else if (!EnableGpuTimer()) {
+            LOGW("Dynamic resolution: Requires timestamp queries.\n");
+            enable = false;
+        }
+    }
+    this->min_scale = std::min(std::max(min_scale, 0.1f), 1.0f);
+    scale_budget  = budget_ms;
+    scale_samples = 0;
+    scale_skip    = 0;
+    auto& regions = gpu_timer.GetRegions();
+    scale_seen    = regions.empty() ? 0 : regions[0].count;
+    if (enable == scaling) return enable;
+
+    scaling      = enable;
+    render_scale = 1.0f;
+    if (enable) info.imageUsage |= VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+    Apply();       // Recreate the swapchain, (without stalls) to create or retire the offscreen target.
+    Invalidate();  // Re-record static command buffers.
+    return enable;
+}
+
+void CSwapchain::CreateScaledTarget() {
+    color_buffer.Create(gpu, device, *vk, info.imageExtent, info.imageFormat);  // (Retire() took the previous one.)
+
+    std::vector<VkImageView> views;                                      // Same attachments as the swapchain framebuffers,
+    views.push_back(color_buffer.ImageView);                             // but with the offscreen color buffer.
+    if(depth_buffer.ImageView) views.push_back(depth_buffer.ImageView);
+
+    VkFramebufferCreateInfo fbCreateInfo = {};
+    fbCreateInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+    fbCreateInfo.renderPass      = renderpass->Offscreen();
+    fbCreateInfo.attachmentCount = (uint32_t)views.size();
+    fbCreateInfo.pAttachments    =           views.data();
+    fbCreateInfo.width  = info.imageExtent.width;
+    fbCreateInfo.height = info.imageExtent.height;
+    fbCreateInfo.layers = 1;
+    VKERRCHECK(vk->CreateFramebuffer(device, &fbCreateInfo, HostAllocator(), &scaled_framebuffer));
+    marker.SetName(VK_DEBUG_REPORT_OBJECT_TYPE_FRAMEBUFFER_EXT, (uint64_t)scaled_framebuffer, "Scaled framebuffer");
+}
+
+void CSwapchain::UpdateScale() {
+    auto& regions = gpu_timer.GetRegions();
+    if (!scaling || regions.empty()) return;
+    const CTimeStats& pass = regions[0];  // "Render pass"
+    for (uint32_t n = scale_seen; n < pass.count; ++n) {
+        if (scale_skip) { scale_skip--; continue; }  // recorded at the previous scale
+        float ms  = pass.samples[n % CTimeStats::SAMPLE_COUNT];
+        scale_gpu = scale_samples ? (scale_gpu * 3 + ms) / 4 : ms;  // running average
+        scale_samples++;
+    }
+    scale_seen = pass.count;
+    if (scale_samples < SCALE_INTERVAL) return;
+    scale_samples = 0;
+
+    float budget = scale_budget ? scale_budget : (timing.refresh ? timing.refresh / 1000000.0f : 1000.0f / 60) * 0.9f;
+    if (scale_gpu <= budget && (scale_gpu >= budget * 0.75f || render_scale >= 1.0f)) return;  // within budget
+
+    // GPU time is roughly proportional to the pixel count. (scale squared)  Aim for 85% of the budget,
+    // but drop by at most 25%, and rise by at most 10% per step, and snap to 1/64 steps.
+    float scale = render_scale * sqrtf(budget * 0.85f / std::max(scale_gpu, 0.001f));
+    scale = std::min(std::max(scale, render_scale * 0.75f), render_scale * 1.1f);
+    scale = std::min(std::max(scale, min_scale), 1.0f);
+    scale = floorf(scale * 64 + 0.5f) / 64;
+    if (scale == render_scale) return;
+
+    LOGI("Dynamic resolution: scale %.3f -> %.3f (render pass %.2f ms, budget %.2f ms)\n", render_scale, scale, scale_gpu, budget);
+    render_scale = scale;
+    scale_skip   = (uint32_t)buffers.size();  // Frames already recorded at the old scale have not been read back yet.
+    Invalidate();                             // Re-record static command buffers.
+}
+
+void CSwapchain::SetViewport(VkCommandBuffer cmd) {
+    VkViewport viewport = {0, 0, (float)render_extent.width, (float)render_extent.height, 0.0f, 1.0f};
+    VkRect2D   scissor  = {{0, 0}, render_extent};
+    vk->CmdSetViewport(cmd, 0, 1, &viewport);
+    vk->CmdSetScissor (cmd, 0, 1, &scissor);
+}
+
+void CSwapchain::Upscale(VkCommandBuffer cmd) {
+    CSwapchainBuffer& buf = buffers[acquired_index];
+    if (gpu_timer.IsEnabled()) gpu_timer.Begin(cmd, buf.queries, "Upscale");
+
+    VkImageMemoryBarrier barriers[2] = {};
+    repeat(2) {
+        barriers[i].sType               = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        barriers[i].srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barriers[i].dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barriers[i].subresourceRange    = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1};
+    }
+    VkImageMemoryBarrier& src = barriers[0];  // The render pass left the color buffer in TRANSFER_SRC layout.
+    src.srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+    src.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+    src.oldLayout     = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+    src.newLayout     = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+    src.image         = color_buffer.Image;
+    VkImageMemoryBarrier& dst = barriers[1];  // The swapchain image is fully overwritten.
+    dst.srcAccessMask = 0;
+    dst.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    dst.oldLayout     = VK_IMAGE_LAYOUT_UNDEFINED;
+    dst.newLayout     = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    dst.image         = buf.image;
+    // (COLOR_ATTACHMENT_OUTPUT is also the stage that waits for the acquire semaphore.)
+    vk->CmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0,
+                           0, nullptr, 0, nullptr, 2, barriers);
+
+    VkImageBlit blit = {};
+    blit.srcSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
+    blit.srcOffsets[1]  = {(int32_t)render_extent.width, (int32_t)render_extent.height, 1};
+    blit.dstSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
+    blit.dstOffsets[1]  = {(int32_t)buf.extent.width, (int32_t)buf.extent.height, 1};
+    vk->CmdBlitImage(cmd, color_buffer.Image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                     buf.image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &blit, VK_FILTER_LINEAR);
+
+    dst.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    dst.dstAccessMask = 0;
+    dst.oldLayout     = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    dst.newLayout     = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+    vk->CmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0,
+                           0, nullptr, 0, nullptr, 1, &dst);
+
+    if (gpu_timer.IsEnabled()) gpu_timer.End(cmd, buf.queries);
+}
+//---------------------------------------------------------------------------------
+
+void CSwapchain::ReleaseImage(VkCommandBuffer cmd) {  // (The present queue acquires it, with present_cmd.)
+    VkImageMemoryBarrier barrier = {};
+    barrier.sType               = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    barrier.srcAccessMask       = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;  // render pass, or upscale blit
+    barrier.dstAccessMask       = 0;
+    barrier.oldLayout           = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+    barrier.newLayout           = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+    barrier.srcQueueFamilyIndex = family;
+    barrier.dstQueueFamilyIndex = present_family;
+    barrier.image               = buffers[acquired_index].image;
+    barrier.subresourceRange    = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1};
+    vk->CmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT,
+                           VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+}
+
 int clamp(int val, int min, int max){ return (val < min ? min : val > max ? max : val); }
 
 //void CSwapchain::SetExtent(uint32_t width, uint32_t height) { //provide width,height, in case its not available from surface
 void CSwapchain::SetExtent() {  // Fit image extent to window size
-    VKERRCHECK(vkGetPhysicalDeviceSurfaceCapabilitiesKHR(gpu, surface, &surface_caps));
+    surface_info->Invalidate();                    // window was resized, or swapchain is out of date
+    surface_caps = surface_info->Capabilities();  // only re-query the caps
     VkExtent2D& curr = surface_caps.currentExtent;
     VkExtent2D& ext = info.imageExtent;
 
@@ -136,17 +524,6 @@ bool CSwapchain::SetImageCount(uint32_t image_count){  // set number of framebuf
     return (count == image_count);
 }
 
-// Returns the list of avialable present modes for this gpu + surface.
-std::vector<VkPresentModeKHR> GetPresentModes(VkPhysicalDevice gpu, VkSurfaceKHR surface){
-    uint32_t count = 0;
-    std::vector<VkPresentModeKHR> modes;
-    vkGetPhysicalDeviceSurfacePresentModesKHR(gpu, surface, &count, nullptr);
-    assert(count > 0);
-    modes.resize(count);
-    VKERRCHECK(vkGetPhysicalDeviceSurfacePresentModesKHR(gpu, surface, &count, modes.data()));
-    return modes;
-}
-
 // ---------------------------- Present Mode ----------------------------
 // no_tearing : TRUE = Wait for next vsync, to swap buffers.  FALSE = faster fps.
 // powersave  : TRUE = Limit framerate to vsync (60 fps).     FALSE = lower latency.
@@ -156,7 +533,7 @@ bool CSwapchain::PresentMode(bool no_tearing, bool powersave){
 
 bool CSwapchain::PresentMode(VkPresentModeKHR pref_mode){
     VkPresentModeKHR& mode = info.presentMode;
-    auto modes = GetPresentModes(gpu, surface);
+    auto& modes = surface_info->PresentModes();
     mode = VK_PRESENT_MODE_FIFO_KHR;                           // default to FIFO mode
     for (auto m : modes) if(m == pref_mode) mode = pref_mode;  // if prefered mode is available, select it.
     if (mode != pref_mode) LOGW("Requested present-mode is not supported. Reverting to FIFO mode.\n");
@@ -188,6 +565,7 @@ const char* FormatStr(VkFormat fmt) {
 }
 
 void CSwapchain::Print() {
+    LOG_FLUSH();
     printf("Swapchain:\n");
     printf("\tFormat  = %3d : %s\n", info.imageFormat,    FormatStr(info.imageFormat));
     printf("\tDepth   = %3d : %s\n", depth_buffer.format, FormatStr(depth_buffer.format));
@@ -195,8 +573,12 @@ void CSwapchain::Print() {
     VkExtent2D& extent = info.imageExtent;
     printf("\tExtent  = %d x %d\n", extent.width, extent.height);
     printf("\tBuffers = %d\n", (int)buffers.size());
+    printf("\tFrames in flight = %d (tracked with %s)\n", (int)frames.size(), timeline.IsTimeline() ? "a timeline semaphore" : "fences");
+    if (separate_present) printf("\tQueues  = graphics family %d, present family %d\n", family, present_family);
+    if (has_timing) printf("\tRefresh = %.2f ms (display timing)\n", timing.refresh / 1000000.0);
+    if (scaling)    printf("\tRender scale = %.3f (dynamic, min %.3f)\n", render_scale, min_scale);
 
-    auto modes = GetPresentModes(gpu, surface);
+    auto& modes = surface_info->PresentModes();
     printf("\tPresentMode:\n");
     const char* mode_names[] = {"VK_PRESENT_MODE_IMMEDIATE_KHR", "VK_PRESENT_MODE_MAILBOX_KHR",
                                 "VK_PRESENT_MODE_FIFO_KHR", "VK_PRESENT_MODE_FIFO_RELAXED_KHR"};
@@ -205,30 +587,29 @@ void CSwapchain::Print() {
 }
 
 void CSwapchain::Apply() {
-    info.oldSwapchain = swapchain;
-    VKERRCHECK(vkCreateSwapchainKHR(device, &info, nullptr, &swapchain));
-
-    //-- Delete old swapchain --
-    if (info.oldSwapchain) {
-        vkDeviceWaitIdle(device);
-        for(auto& buf : buffers) {
-            vkDestroyFence(device, buf.fence, nullptr);
-            vkDestroyFramebuffer(device, buf.framebuffer, nullptr);
-            vkDestroyImageView(device, buf.view, nullptr);
-        }
-        vkDestroySwapchainKHR(device, info.oldSwapchain, 0);
-    }
+    //-- Retire old swapchain --  (Frames in flight may still use it, so don't destroy it yet.)
+    info.oldSwapchain = VK_NULL_HANDLE;
+    if (swapchain) Retire();  // sets info.oldSwapchain
     //--------------------------
 
+    VKERRCHECK(vk->CreateSwapchainKHR(device, &info, HostAllocator(), &swapchain));
+    marker.SetName(VK_DEBUG_REPORT_OBJECT_TYPE_SWAPCHAIN_KHR_EXT, (uint64_t)swapchain, "Swapchain");
+    if (has_timing) {
+        VkRefreshCycleDurationGOOGLE refresh = {};
+        VKERRCHECK(vk->GetRefreshCycleDurationGOOGLE(device, swapchain, &refresh));
+        timing.refresh = refresh.refreshDuration;
+    }
+
     //-- Allocate array of images for swapchain--
     std::vector<VkImage> images;
     uint32_t count = 0;
-    VKERRCHECK(vkGetSwapchainImagesKHR(device, swapchain, &count, nullptr));
+    VKERRCHECK(vk->GetSwapchainImagesKHR(device, swapchain, &count, nullptr));
     images.resize(count);
-    VKERRCHECK(vkGetSwapchainImagesKHR(device, swapchain, &count, images.data()));
+    VKERRCHECK(vk->GetSwapchainImagesKHR(device, swapchain, &count, images.data()));
     //-------------------------------------------
 
     depth_buffer.Resize(info.imageExtent);  //resize depth buffer
+    if (scaling) CreateScaledTarget();      // offscreen color buffer, for dynamic resolution
 
     buffers.resize(count);
     repeat(count){
@@ -248,7 +629,7 @@ void CSwapchain::Apply() {
         ivCreateInfo.subresourceRange.levelCount     = 1;
         ivCreateInfo.subresourceRange.baseArrayLayer = 0;
         ivCreateInfo.subresourceRange.layerCount     = 1;
-        VKERRCHECK(vkCreateImageView(device, &ivCreateInfo, nullptr, &buf.view));
+        VKERRCHECK(vk->CreateImageView(device, &ivCreateInfo, HostAllocator(), &buf.view));
         //---------------
 
         // -- View list --
@@ -265,101 +646,342 @@ void CSwapchain::Apply() {
         fbCreateInfo.width  = info.imageExtent.width;
         fbCreateInfo.height = info.imageExtent.height;
         fbCreateInfo.layers = 1;
-        VKERRCHECK(vkCreateFramebuffer(device, &fbCreateInfo, NULL, &buf.framebuffer));
+        VKERRCHECK(vk->CreateFramebuffer(device, &fbCreateInfo, HostAllocator(), &buf.framebuffer));
         //---------------
-        //--CommandBuffer--
+        //---Semaphore---
+        VkSemaphoreCreateInfo semaphoreInfo = {};
+        semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        VKERRCHECK(vk->CreateSemaphore(device, &semaphoreInfo, HostAllocator(), &buf.render_semaphore));
+        //---------------
+        //--Static CommandBuffer--
         VkCommandBufferAllocateInfo allocInfo = {};
         allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
-        allocInfo.commandPool = command_pool;
+        allocInfo.commandPool = static_pool;
         allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
         allocInfo.commandBufferCount = 1;
-        VKERRCHECK(vkAllocateCommandBuffers(device, &allocInfo, &buf.command_buffer));
-        //-----------------
-        //---Fence---
-        VkFenceCreateInfo createInfo = {};
-        createInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
-        createInfo.flags = VK_FENCE_CREATE_SIGNALED_BIT;
-        vkCreateFence(device, &createInfo, nullptr, &buf.fence);
+        VKERRCHECK(vk->AllocateCommandBuffers(device, &allocInfo, &buf.static_cmd));
+        buf.static_version = 0;  // not recorded yet
+        buf.last_value     = 0;
+        //------------------------
+        //--GPU timer--
+        buf.queries = {};
+        if (gpu_timer.IsEnabled()) gpu_timer.Create(buf.queries);
+        //-------------
+        //--Ownership transfer--  (Acquire the image on the present queue, after the frame released it.)
+        buf.present_cmd         = VK_NULL_HANDLE;
+        buf.ownership_semaphore = VK_NULL_HANDLE;
+        if (separate_present) {
+            VKERRCHECK(vk->CreateSemaphore(device, &semaphoreInfo, HostAllocator(), &buf.ownership_semaphore));
+            allocInfo.commandPool = present_pool;
+            VKERRCHECK(vk->AllocateCommandBuffers(device, &allocInfo, &buf.present_cmd));
+            VkCommandBufferBeginInfo beginInfo = {};
+            beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+            beginInfo.flags = VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT;  // may be pending in more than one frame
+            VKERRCHECK(vk->BeginCommandBuffer(buf.present_cmd, &beginInfo));
+            VkImageMemoryBarrier barrier = {};
+            barrier.sType               = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+            barrier.srcAccessMask       = 0;
+            barrier.dstAccessMask       = 0;
+            barrier.oldLayout           = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+            barrier.newLayout           = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+            barrier.srcQueueFamilyIndex = family;
+            barrier.dstQueueFamilyIndex = present_family;
+            barrier.image               = buf.image;
+            barrier.subresourceRange    = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1};
+            vk->CmdPipelineBarrier(buf.present_cmd, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0,
+                                   0, nullptr, 0, nullptr, 1, &barrier);
+            VKERRCHECK(vk->EndCommandBuffer(buf.present_cmd));
+            marker.SetName(VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT, (uint64_t)buf.present_cmd,         "Present command buffer %d", i);
+            marker.SetName(VK_DEBUG_REPORT_OBJECT_TYPE_SEMAPHORE_EXT,      (uint64_t)buf.ownership_semaphore, "Ownership semaphore %d", i);
+        }
+        //----------------------
+        //---Names---
+        marker.SetName(VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT,       (uint64_t)buf.image,            "Swapchain image %d", i);
+        marker.SetName(VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_VIEW_EXT,  (uint64_t)buf.view,             "Swapchain view %d", i);
+        marker.SetName(VK_DEBUG_REPORT_OBJECT_TYPE_FRAMEBUFFER_EXT, (uint64_t)buf.framebuffer,      "Framebuffer %d", i);
+        marker.SetName(VK_DEBUG_REPORT_OBJECT_TYPE_SEMAPHORE_EXT,   (uint64_t)buf.render_semaphore, "Render semaphore %d", i);
+        marker.SetName(VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT, (uint64_t)buf.static_cmd,    "Static command buffer %d", i);
         //-----------
 
         //printf("---Extent = %d x %d\n", info.imageExtent.width, info.imageExtent.height);
     }
     if (!info.oldSwapchain) LOGI("Swapchain created\n");
 }
+
+void CSwapchain::Retire() {
+    CRetired old;
+    old.value        = timeline.Submitted();
+    old.present_value = present_timeline.Submitted();
+    old.swapchain    = swapchain;
+    old.buffers.swap(buffers);
+    old.depth_image  = depth_buffer.Image;        // Take the depth buffer too,
+    old.depth_memory = depth_buffer.ImageMemory;  // so Resize() creates a new one,
+    old.depth_view   = depth_buffer.ImageView;    // without destroying this one.
+    depth_buffer.Image       = 0;
+    depth_buffer.ImageMemory = 0;
+    depth_buffer.ImageView   = 0;
+    old.color_image  = color_buffer.Image;        // Same for the offscreen target.
+    old.color_memory = color_buffer.ImageMemory;
+    old.color_view   = color_buffer.ImageView;
+    old.scaled_framebuffer = scaled_framebuffer;
+    color_buffer.Image       = 0;
+    color_buffer.ImageMemory = 0;
+    color_buffer.ImageView   = 0;
+    scaled_framebuffer       = VK_NULL_HANDLE;
+    retired.push_back(old);
+    info.oldSwapchain = swapchain;
+    swapchain = 0;
+}
+
+void CSwapchain::DestroyRetired(bool all) {
+    // The retired resources were last used by the frame with timeline value old.value, and (with a separate
+    // present family) by the ownership transfer with present_timeline value old.present_value.
+    uint32_t i = 0;
+    for (auto& old : retired) {
+        bool done = all || (timeline.IsDone(old.value) && present_timeline.IsDone(old.present_value));
+        if (!done) { std::swap(retired[i++], old); continue; }  // still in use
+        for(auto& buf : old.buffers) {
+            if (buf.present_cmd) vk->FreeCommandBuffers(device, present_pool, 1, &buf.present_cmd);
+            if (buf.ownership_semaphore) vk->DestroySemaphore(device, buf.ownership_semaphore, HostAllocator());
+            vk->FreeCommandBuffers(device, static_pool, 1, &buf.static_cmd);
+            if (buf.queries.pool) gpu_timer.Destroy(buf.queries);
+            vk->DestroySemaphore(device, buf.render_semaphore, HostAllocator());
+            vk->DestroyFramebuffer(device, buf.framebuffer, HostAllocator());
+            vk->DestroyImageView(device, buf.view, HostAllocator());
+        }
+        if (old.depth_view)   vk->DestroyImageView(device, old.depth_view,   HostAllocator());
+        if (old.depth_image)  vk->DestroyImage    (device, old.depth_image,  HostAllocator());
+        if (old.depth_memory) vk->FreeMemory      (device, old.depth_memory, HostAllocator());
+        if (old.scaled_framebuffer) vk->DestroyFramebuffer(device, old.scaled_framebuffer, HostAllocator());
+        if (old.color_view)   vk->DestroyImageView(device, old.color_view,   HostAllocator());
+        if (old.color_image)  vk->DestroyImage    (device, old.color_image,  HostAllocator());
+        if (old.color_memory) vk->FreeMemory      (device, old.color_memory, HostAllocator());
+        vk->DestroySwapchainKHR(device, old.swapchain, HostAllocator());
+    }
+    retired.resize(i);
+}
 //---------------------------------------------------------------------------------
 
 CSwapchainBuffer& CSwapchain::AcquireNext() {
+    PROFILE_ZONE("AcquireNext");
     ASSERT(!is_acquired, "CSwapchain: Previous swapchain buffer has not yet been presented.\n");
 
-    VkResult result = vkAcquireNextImageKHR(device, swapchain, UINT64_MAX, acquire_semaphore, VK_NULL_HANDLE, &acquired_index);
-    if(result == VK_ERROR_OUT_OF_DATE_KHR) SetExtent();  // window resize
+    CFrame& frame = frames[frame_index];
+    timeline.Wait(frame.value);  // wait for the GPU to finish this slot's previous frame
+    if (!retired.empty()) DestroyRetired();
+
+    VkResult result = vk->AcquireNextImageKHR(device, swapchain, UINT64_MAX, frame.acquire_semaphore, VK_NULL_HANDLE, &acquired_index);
+    if(result == VK_ERROR_OUT_OF_DATE_KHR) {  // window resize
+        SetExtent();
+        result = vk->AcquireNextImageKHR(device, swapchain, UINT64_MAX, frame.acquire_semaphore, VK_NULL_HANDLE, &acquired_index);
+    }
+    VKERRCHECK(result);
 
     CSwapchainBuffer& buf = buffers[acquired_index];
     buf.extent = info.imageExtent;
-    vkWaitForFences(device, 1, &buf.fence, VK_TRUE, UINT64_MAX);
     is_acquired = true;
     return buf;
 }
 
 void CSwapchain::Present() {
+    PROFILE_ZONE("Present");
     ASSERT(!!is_acquired, "CSwapchain: A buffer must be acquired before presenting.\n");
     // --- Submit ---
     CSwapchainBuffer& buffer = buffers[acquired_index];
+    CFrame& frame = frames[frame_index];
     VkSubmitInfo submitInfo = {};
     submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
     VkPipelineStageFlags waitStages[] = {VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT};
     submitInfo.waitSemaphoreCount   = 1;
-    submitInfo.pWaitSemaphores      = &acquire_semaphore;
+    submitInfo.pWaitSemaphores      = &frame.acquire_semaphore;
     submitInfo.pWaitDstStageMask    = waitStages;
     submitInfo.commandBufferCount   = 1;
-    submitInfo.pCommandBuffers      = &buffer.command_buffer;
-    submitInfo.signalSemaphoreCount = 1;
-    submitInfo.pSignalSemaphores    = &submit_semaphore;
-    vkResetFences(device, 1, &buffer.fence);
-    VKERRCHECK(vkQueueSubmit(queue, 1, &submitInfo, buffer.fence));
+    submitInfo.pCommandBuffers      = &submit_cmd;
+    bool chain = separate_present && timeline.IsTimeline();  // The present queue waits on the timeline, instead of render_semaphore.
+    submitInfo.signalSemaphoreCount = chain ? 0 : 1;
+    submitInfo.pSignalSemaphores    = &buffer.render_semaphore;
+    frame.value = timeline.Submit(&submitInfo);
+    if (record_start) cpu_record.Add((Now() - record_start) / 1000000.0f);
+    buffer.last_value = frame.value;
+    frame_count++;
+    VkSemaphore* present_wait = &buffer.render_semaphore;
+    if (separate_present) {  // Acquire the image on the present queue, once rendering is done.
+        VkPipelineStageFlags ownershipStages[] = {VK_PIPELINE_STAGE_ALL_COMMANDS_BIT};
+        submitInfo.waitSemaphoreCount   = chain ? 0 : 1;
+        submitInfo.pWaitSemaphores      = &buffer.render_semaphore;
+        submitInfo.pWaitDstStageMask    = ownershipStages;
+        submitInfo.commandBufferCount   = 1;
+        submitInfo.pCommandBuffers      = &buffer.present_cmd;
+        submitInfo.signalSemaphoreCount = 1;
+        submitInfo.pSignalSemaphores    = &buffer.ownership_semaphore;
+        present_timeline.Submit(&submitInfo, chain ? &timeline : nullptr, frame.value);
+        present_wait = &buffer.ownership_semaphore;
+    }
     // --- Present ---
     VkPresentInfoKHR presentInfo = {};
     presentInfo.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
     presentInfo.waitSemaphoreCount = 1;
-    presentInfo.pWaitSemaphores    = &submit_semaphore;
+    presentInfo.pWaitSemaphores    = present_wait;
     presentInfo.swapchainCount     = 1;
     presentInfo.pSwapchains        = &swapchain;
     presentInfo.pImageIndices      = &acquired_index;
-    //VKERRCHECK(vkQueuePresentKHR(queue, &presentInfo));
+    //VKERRCHECK(vk->QueuePresentKHR(queue, &presentInfo));
+    if (batch) batch->Flush();  // this frame, and any other work queued for the graphics queue, in one vkQueueSubmit
+    if (present_batch && present_batch != batch) present_batch->Flush();
+
+    VkPresentTimeGOOGLE presentTime = {};
+    VkPresentTimesInfoGOOGLE presentTimes = {};
+    if (has_timing) {  // Tag the present, to match it with its timing results later.
+        presentTime.presentID          = ++present_id;
+        presentTime.desiredPresentTime = timing.target ? timing.target - timing.refresh / 2 : 0;  // not before the previous vblank
+        presentTimes.sType          = VK_STRUCTURE_TYPE_PRESENT_TIMES_INFO_GOOGLE;
+        presentTimes.swapchainCount = 1;
+        presentTimes.pTimes         = &presentTime;
+        presentInfo.pNext           = &presentTimes;
+    }
 
-    VkResult result = vkQueuePresentKHR(queue, &presentInfo);
+    VkResult result = vk->QueuePresentKHR(present_queue, &presentInfo);
     if(result == VK_ERROR_OUT_OF_DATE_KHR) SetExtent();  // window resize
-    else ShowVkResult(result);
+    else VKERRCHECK(result);
 
     is_acquired = false;
+    frame_index = (frame_index + 1) % frames.size();  // next frame-in-flight
 }
 
 
-VkCommandBuffer CSwapchain::BeginFrame() {
+VkCommandBuffer CSwapchain::BeginFrame(VkSubpassContents contents) {
+    Adapt();
+    Pace();
+    PROFILE_ZONE("BeginFrame");
+    if (has_timing) begin_time[(present_id + 1) % TIMING_HISTORY] = Now();
     auto& swapchain_buffer = AcquireNext();
-    auto& command_buffer = swapchain_buffer.command_buffer; 
+    record_start = Now();
+    CFrame& frame = frames[frame_index];
+    if (gpu_timer.IsEnabled()) {
+        gpu_timer.CpuFrame();
+        gpu_timer.Read(swapchain_buffer.queries);  // results of the last frame on this image, if the GPU is done with it
+        UpdateScale();
+    }
+    render_extent = swapchain_buffer.extent;
+    if (scaling) {
+        render_extent.width  = std::max(1u, (uint32_t)(render_extent.width  * render_scale + 0.5f));
+        render_extent.height = std::max(1u, (uint32_t)(render_extent.height * render_scale + 0.5f));
+    }
     VkCommandBufferBeginInfo beginInfo = {};
     beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
-    beginInfo.flags = VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT;
-    VKERRCHECK(vkBeginCommandBuffer(command_buffer, &beginInfo));
+    if (is_static) {
+        submit_cmd = swapchain_buffer.static_cmd;
+        is_recording = (swapchain_buffer.static_version != static_version);
+        if (!is_recording) return VK_NULL_HANDLE;  // Commands are up to date. Just resubmit them.
+        swapchain_buffer.static_version = static_version;
+        // The previous frame on this image may still be executing static_cmd. Wait for it, before re-recording.
+        timeline.Wait(swapchain_buffer.last_value);
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT;  // may be pending in more than one frame
+    } else {
+        submit_cmd = frame.command_buffer;
+        is_recording = true;
+        VKERRCHECK(vk->ResetCommandPool(device, frame.command_pool, 0));  // The frame's value was reached, so its commands are done.
+        for (auto& thread : frame.threads) {                               // Reset the secondaries too, in bulk.
+            if (thread.used) VKERRCHECK(vk->ResetCommandPool(device, thread.pool, 0));
+            thread.used = 0;
+        }
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    }
+    subpass_contents = contents;
+    auto& command_buffer = submit_cmd;
+    VKERRCHECK(vk->BeginCommandBuffer(command_buffer, &beginInfo));
+    marker.Begin(command_buffer, "Frame");
+    if (gpu_timer.IsEnabled()) {
+        gpu_timer.Reset(command_buffer, swapchain_buffer.queries);
+        gpu_timer.Begin(command_buffer, swapchain_buffer.queries, "Render pass");
+    }
+    if (scaling)  // The previous frame's blit may still be reading the color buffer.
+        vk->CmdPipelineBarrier(command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, 0,
+                               0, nullptr, 0, nullptr, 0, nullptr);
 
     VkRenderPassBeginInfo renderPassInfo = {};
     renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
-    renderPassInfo.renderPass = *renderpass;
-    renderPassInfo.framebuffer = swapchain_buffer.framebuffer;
+    renderPassInfo.renderPass = scaling ? renderpass->Offscreen() : *renderpass;
+    renderPassInfo.framebuffer = scaling ? scaled_framebuffer : swapchain_buffer.framebuffer;
     renderPassInfo.renderArea.offset = {0, 0};
-    renderPassInfo.renderArea.extent = swapchain_buffer.extent;
+    renderPassInfo.renderArea.extent = render_extent;
     renderPassInfo.clearValueCount = (uint32_t)renderpass->clearValues.size();
     renderPassInfo.pClearValues    =           renderpass->clearValues.data();
 
-    vkCmdBeginRenderPass(command_buffer, &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+    vk->CmdBeginRenderPass(command_buffer, &renderPassInfo, contents);
+    if (contents == VK_SUBPASS_CONTENTS_INLINE) SetViewport(command_buffer);
     return command_buffer;
 }
 
+void CSwapchain::ExecuteParallel(uint32_t task_count, const std::function<void(VkCommandBuffer cmd, uint32_t task)>& record) {
+    PROFILE_ZONE("ExecuteParallel");
+    ASSERT((is_recording && !is_static), "CSwapchain: ExecuteParallel must be called between BeginFrame and EndFrame, and not in static mode.\n");
+    ASSERT((subpass_contents == VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS),
+           "CSwapchain: ExecuteParallel requires BeginFrame(VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS).\n");
+    if (!task_count) return;
+    if (!thread_pool) SetThreadCount();
+
+    //-- Per-thread command pools, for this frame --
+    CFrame& frame = frames[frame_index];
+    while (frame.threads.size() < thread_pool->ThreadCount()) {
+        CThreadCommands thread = {};
+        VkCommandPoolCreateInfo poolInfo = {};
+        poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        poolInfo.queueFamilyIndex = family;
+        poolInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+        VKERRCHECK(vk->CreateCommandPool(device, &poolInfo, HostAllocator(), &thread.pool));
+        marker.SetName(VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_POOL_EXT, (uint64_t)thread.pool,
+                       "Frame %d thread %d command pool", frame_index, (int)frame.threads.size());
+        frame.threads.push_back(thread);
+    }
+    //----------------------------------------------
+
+    VkCommandBufferInheritanceInfo inheritInfo = {};
+    inheritInfo.sType       = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+    inheritInfo.renderPass  = scaling ? renderpass->Offscreen() : *renderpass;
+    inheritInfo.subpass     = 0;
+    inheritInfo.framebuffer = scaling ? scaled_framebuffer : buffers[acquired_index].framebuffer;
+
+    secondary_cmds.resize(task_count);
+    thread_pool->ParallelFor(task_count, [&](uint32_t task, uint32_t thread_index) {
+        PROFILE_ZONE("Record secondary");
+        CThreadCommands& thread = frame.threads[thread_index];
+        if (thread.used == thread.buffers.size()) {  // Allocate another secondary, for this thread.
+            VkCommandBufferAllocateInfo allocInfo = {};
+            allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+            allocInfo.commandPool = thread.pool;
+            allocInfo.level = VK_COMMAND_BUFFER_LEVEL_SECONDARY;
+            allocInfo.commandBufferCount = 1;
+            VkCommandBuffer cmd;
+            VKERRCHECK(vk->AllocateCommandBuffers(device, &allocInfo, &cmd));
+            thread.buffers.push_back(cmd);
+        }
+        VkCommandBuffer cmd = thread.buffers[thread.used++];
+
+        VkCommandBufferBeginInfo beginInfo = {};
+        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT | VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+        beginInfo.pInheritanceInfo = &inheritInfo;
+        VKERRCHECK(vk->BeginCommandBuffer(cmd, &beginInfo));
+        SetViewport(cmd);  // Dynamic state is not inherited.
+        record(cmd, task);
+        VKERRCHECK(vk->EndCommandBuffer(cmd));
+        secondary_cmds[task] = cmd;
+    });
+    vk->CmdExecuteCommands(submit_cmd, task_count, secondary_cmds.data());
+}
+
 
 void CSwapchain::EndFrame() {
-    auto& command_buffer = buffers[acquired_index].command_buffer;
-    vkCmdEndRenderPass(command_buffer);
-    VKERRCHECK(vkEndCommandBuffer(command_buffer));
+    PROFILE_ZONE("EndFrame");
+    if (is_recording) {
+        vk->CmdEndRenderPass(submit_cmd);
+        if (gpu_timer.IsEnabled()) gpu_timer.End(submit_cmd, buffers[acquired_index].queries);
+        if (scaling) Upscale(submit_cmd);
+        if (separate_present) ReleaseImage(submit_cmd);
+        marker.End(submit_cmd);
+        VKERRCHECK(vk->EndCommandBuffer(submit_cmd));
+        is_recording = false;
+    }
     Present();
 }
@@ -8,16 +8,129 @@
 *
 *  The CSwapchain constructor requires a CQueue and CRenderpass as parameters, so create these first.
 *  The CQueue must be presentable, and linked to the window surface.
+*  If the graphics queue family can't present, pass a graphics queue, and a separate present queue. (see below)
 *  The CRenderpass requires at least one color attachment, and optionally a depth attachment.
 *
 *  Use the PresentMode() function to select vsync behaviour (FIFO / MAILBOX / ...)
 *  Use the SetImageCount() to select double or tripple buffering. (default is 2: double-buffering)
+*  Use the SetFramesInFlight() to select how many frames the CPU may record, before waiting for the GPU. (default is 2)
+*
+*  FRAMES IN FLIGHT:
+*  Each frame-in-flight has its own command pool, command buffer and acquire-semaphore,
+*  so the CPU can record frame N+1, while the GPU is still rendering frame N.
+*  Frames are submitted through a CTimeline, (see CTimeline.h) so each submit has a counter value,
+*  and BeginFrame() only waits for the value of the frame that last used the same slot.
+*  The frames-in-flight count is independent of the swapchain image count.
+*  (Render-complete semaphores are per swapchain image, since the presentation engine, not the GPU
+*  timeline, decides when they may be reused.)
+*
+*  RECREATION:
+*  On resize, or when the present mode or image count changes, the new swapchain is created with
+*  oldSwapchain, without waiting for the device to go idle.  The old swapchain, its framebuffers,
+*  views, semaphores and depth buffer are retired, and destroyed by a later AcquireNext(), once
+*  the timeline has reached the value of the last frame that was submitted before the change.
 *
 *  PRESENTING:
 *  Call BeginFrame() to acquire the next frame's command buffer.
 *  Record vkCmd* commands, using the returned command buffer.
 *  Call EndFrame() to execure and Present image, when done.
 *
+*  STATIC MODE:
+*  For content that rarely changes, call SetStatic(true).  Each swapchain image then gets its own
+*  command buffer, which is recorded once, and resubmitted every frame.  BeginFrame() only returns a
+*  command buffer when the acquired image's commands must be (re)recorded, and VK_NULL_HANDLE otherwise.
+*  Call Invalidate() when the content changes.  Resizing re-records automatically.
+*  eg:
+*    swapchain.SetStatic(true);
+*    while (Window.ProcessEvents()) {
+*        if (VkCommandBuffer cmd_buf = swapchain.BeginFrame()) {  // only when the commands are out of date
+*            device.vk.CmdDraw(cmd_buf, ...);
+*        }
+*        swapchain.EndFrame();
+*    }
+*
+*  PARALLEL RECORDING:
+*  Call BeginFrame(VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS), then ExecuteParallel(count, func),
+*  to split the render pass into count secondary command buffers, which are recorded in parallel,
+*  on a thread pool. (see CThreadPool.h)  Each thread has its own command pool per frame-in-flight,
+*  and all of a frame's pools are reset at once, when the frame is reused.  The secondary command
+*  buffers are then executed in task order.  SetThreadCount() sets the pool size. (default: one per core)
+*  Parallel recording is not supported in static mode.
+*  eg:
+*    swapchain.BeginFrame(VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
+*    swapchain.ExecuteParallel(object_count, [&](VkCommandBuffer cmd_buf, uint32_t task) {
+*        device.vk.CmdBindPipeline(cmd_buf, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);  // State is not inherited.
+*        device.vk.CmdDraw(cmd_buf, ...);                                                // Draw object[task]
+*    });
+*    swapchain.EndFrame();
+*
+*  PRESENT TIMING AND PACING:
+*  If VK_GOOGLE_display_timing is enabled, (CDevice picks it, when available) each present is tagged
+*  with an id, and GetTiming() reports the display's refresh period, and how long frames took, from
+*  BeginFrame() until they were ready, and until they were actually on screen.
+*  SetPacing(true) then delays BeginFrame(), so each frame starts just in time to be ready for its
+*  vblank, (plus a small safety margin) instead of waiting in the present queue.  This gives the
+*  lowest latency that FIFO mode allows, without tearing.  Pacing has no effect without the extension.
+*  (Present times are on the CLOCK_MONOTONIC timeline, which std::chrono::steady_clock matches on
+*  Linux and Android.)
+*
+*  ADAPTIVE PRESENT MODE:
+*  SetAdaptive(goal) re-evaluates the present mode and image count every ADAPT_INTERVAL frames, from the
+*  measured frame cost, (p99 of the CPU recording time, and of the GPU render pass time, if the GPU timer
+*  is enabled) compared to the display refresh period. (from VK_GOOGLE_display_timing, else 60Hz is assumed)
+*    ADAPT_LATENCY: Frames that fit easily in a refresh use MAILBOX (3 images), frames that fit use FIFO (2 images),
+*                   and frames that miss vblanks use FIFO_RELAXED (3 images), which tears a late frame, instead of
+*                   showing the previous one again.
+*    ADAPT_POWER:   Always FIFO.  2 images while frames fit in a refresh, else 3, to avoid stutter.
+*  A change must be picked twice in a row, before the swapchain is recreated. (without stalls, see RECREATION)
+*
+*  GPU TIMING:
+*  Call EnableGpuTimer() to measure the GPU time of each frame's render pass, and of regions labeled
+*  with BeginRegion() / EndRegion(), using timestamp queries. (see CGpuTimer.h)  Results are read back
+*  a few frames later, without stalling.  PrintTimes() prints min / avg / p99 per region, and the CPU frame time.
+*  eg:
+*    swapchain.BeginRegion(cmd_buf, "Shadows");
+*    ...
+*    swapchain.EndRegion(cmd_buf);
+*
+*  DYNAMIC RESOLUTION:
+*  SetDynamicResolution(true) renders the frame into an offscreen color buffer, (with the shared depth buffer)
+*  at a fraction of the swapchain extent, (GetRenderScale) and then upscales it into the swapchain image, with
+*  a linear-filtered vkCmdBlitImage.  The color buffer is allocated at full size, and only its top-left part is
+*  used, so changing the scale needs no new allocations:  Every SCALE_INTERVAL GPU timer samples, the scale is
+*  lowered when the render pass takes longer than the budget, (default: 90% of the refresh period) or raised
+*  when it takes less than 75% of it, assuming that GPU time is proportional to the pixel count.
+*  The viewport and scissor are set to the render area by BeginFrame(), (and by ExecuteParallel(), for each
+*  secondary command buffer) so pipelines must declare them as dynamic state. (see CPipeline)
+*  Requires blit support for the surface format, and enables the GPU timer.
+*
+*  SEPARATE PRESENT QUEUE:
+*  CSwapchain(graphics_queue, present_queue, renderpass) renders on graphics_queue, and presents on present_queue,
+*  which must be linked to the window surface.  If the two queues are from different families, the swapchain
+*  images are still exclusive to one family at a time:  Each frame's command buffer ends by releasing its image
+*  to the present family, and a small prerecorded command buffer on the present queue acquires it, before the
+*  present.  (It waits on the graphics timeline, or on a render semaphore in fence mode.)  The image does not need
+*  to be transferred back, since each frame discards its previous contents.  If both queues are from the same
+*  family, this costs nothing extra.
+*  eg:
+*    CQueue* graphics = device.RequestQueue(VK_QUEUE_GRAPHICS_BIT);  // (without a surface)
+*    CQueue* present  = device.RequestQueue(0, surface);             // any family that can present
+*    device.Create();
+*    CSwapchain swapchain(*graphics, *present, renderpass);
+*
+*  BATCHED SUBMITS:
+*  CSwapchain(queues, renderpass) takes the graphics and present queues from a CQueueManager, (see CQueues.h)
+*  and queues its submits into their CSubmitBatch'es.  Present() then flushes each batch, right before
+*  presenting, so the frame, and any work that other threads queued for the same queue, goes out in a single
+*  vkQueueSubmit per queue.
+*  eg:
+*    CQueueManager queues(device, surface);
+*    device.Create();
+*    CSwapchain swapchain(queues, renderpass);
+*
+*  If VK_EXT_debug_marker is enabled, the swapchain objects are named, and each frame's commands
+*  are wrapped in a "Frame" region, for frame debuggers. (see DebugMarker.h)
+*
 */
 
 #ifndef CSWAPCHAIN_H
@@ -27,6 +140,12 @@
 #include "CDevices.h"
 #include "CRenderpass.h"
 #include "Buffers.h"
+#include "CProfiler.h"
+#include "CThreadPool.h"
+#include "CTimeline.h"
+#include "CQueues.h"
+#include "CGpuTimer.h"
+#include <memory>
 
 #ifdef ANDROID
 #define IS_ANDROID true  // ANDROID: default to power-save (limit to 60fps)
@@ -34,60 +153,199 @@
 #define IS_ANDROID false // PC: default to low-latency (no fps limit)
 #endif
 
+enum eAdaptiveGoal { ADAPT_OFF, ADAPT_LATENCY, ADAPT_POWER };
+
 struct CSwapchainBuffer {
     VkImage         image;
     VkImageView     view;  // TODO: MRT?
     VkExtent2D      extent;
     VkFramebuffer   framebuffer;
+    VkSemaphore     render_semaphore;   // signaled when rendering to this image is done. Present waits for it. (unless chained on the timeline)
+    VkCommandBuffer static_cmd;         // prerecorded commands, for static mode
+    uint32_t        static_version;     // static_cmd is up to date, if this matches CSwapchain::static_version
+    uint64_t        last_value;         // timeline value of the last frame that rendered to this image
+    CGpuQueries     queries;            // GPU timestamps, if the GPU timer is enabled
+    VkCommandBuffer present_cmd;         // acquires the image, on the present queue. (separate present family only)
+    VkSemaphore     ownership_semaphore; // signaled when present_cmd is done. Present waits for it. (separate present family only)
+};
+
+struct CRetired {  // resources of a replaced swapchain, destroyed once the frames that used them are done
+    uint64_t                      value;          // timeline value of the last frame that used these
+    uint64_t                      present_value;  // present_timeline value of the last ownership transfer
+    VkSwapchainKHR                swapchain;
+    std::vector<CSwapchainBuffer> buffers;
+    VkImage                       depth_image;
+    VkDeviceMemory                depth_memory;
+    VkImageView                   depth_view;
+    VkImage                       color_image;         // dynamic resolution target
+    VkDeviceMemory                color_memory;
+    VkImageView                   color_view;
+    VkFramebuffer                 scaled_framebuffer;
+};
+
+struct CPresentTiming {         // (nanoseconds)
+    uint64_t refresh;           // display refresh period. (0 = unknown)
+    uint64_t last_present;      // actual present time of the most recent frame, (0 = unknown)
+    uint64_t work;              // average time from BeginFrame, until the frame was ready to present
+    uint64_t latency;           // average time from BeginFrame, until the frame was on screen
+    uint64_t target;            // vblank that the current frame is paced for. (0 = not paced)
+};
+
+struct CThreadCommands {  // one thread's secondary command buffers, for one frame-in-flight
+    VkCommandPool                pool;
+    std::vector<VkCommandBuffer> buffers;  // allocated as needed, and reused
+    uint32_t                     used;     // buffers used in this frame
+};
+
+struct CFrame {  // per frame-in-flight resources
+    VkCommandPool   command_pool;
     VkCommandBuffer command_buffer;
-    VkFence         fence;
+    uint64_t        value;              // timeline value of this slot's last submit. (The GPU is done with it, once reached.)
+    VkSemaphore     acquire_semaphore;  // signaled when the acquired image is ready for rendering
+    std::vector<CThreadCommands> threads;  // per-thread secondary command pools. (ExecuteParallel)
 };
 /*
 struct CCmd : public CSwapchainBuffer {
+    const CDeviceTable* vk;  // device-level functions (owned by CDevice)
     void BindPipeline(VkPipeline graphicsPipeline);
     void Draw(uint32_t vertexCount, uint32_t instanceCount=1, uint32_t firstVertex=0, uint32_t  firstInstance=0);
 };
 */
 class CSwapchain {
-    VkPhysicalDevice   gpu;
-    VkDevice           device;
-    VkQueue            queue;
-    VkSurfaceKHR       surface;
-    VkSwapchainKHR     swapchain;
-    VkCommandPool      command_pool;
+    VkPhysicalDevice    gpu;
+    VkDevice            device;
+    const CDeviceTable* vk;            // device-level functions (owned by CDevice)
+    CDebugMarker        marker;        // names objects for frame debuggers
+    VkQueue             queue;         // graphics queue: runs the frame command buffers
+    VkQueue             present_queue; // same as queue, unless the graphics family can't present
+    VkSurfaceKHR        surface;
+    CSurfaceInfo*       surface_info;  // cached surface queries
+    VkSwapchainKHR      swapchain;
+    uint32_t            family;        // queue family, for the frame command pools
+    uint32_t            present_family;
+    bool                separate_present;  // present_family != family: transfer image ownership before presenting
+    VkCommandPool       present_pool;      // for the present_cmd buffers (separate present family only)
+    CTimeline           timeline;          // frame submits, on the graphics queue
+    CTimeline           present_timeline;  // ownership transfers, on the present queue (separate present family only)
+    CSubmitBatch*       batch;             // if set, submits are queued here, and flushed by Present() (see CQueues.h)
+    CSubmitBatch*       present_batch;     // the present queue's batch. (same as batch, unless the families differ)
     //VkRenderPass       renderpass;
-    CRenderpass*       renderpass;
+    CRenderpass*        renderpass;
 
     CDepthBuffer depth_buffer;
     std::vector<CSwapchainBuffer> buffers;
     uint32_t acquired_index;  // index of last acquired image
     bool is_acquired;
 
-    VkSemaphore acquire_semaphore;
-    VkSemaphore submit_semaphore;
+    std::vector<CFrame> frames;  // frames-in-flight ring
+    uint32_t frame_index;        // current frame in the ring
+    uint64_t frame_count;        // number of frames submitted
+
+    std::vector<CRetired> retired;  // deferred-deletion queue
+
+    VkCommandPool   static_pool;     // for the per-image static command buffers
+    bool            is_static;       // resubmit prerecorded command buffers
+    uint32_t        static_version;  // incremented by Invalidate()
+    VkCommandBuffer submit_cmd;      // command buffer to submit, for the current frame
+    bool            is_recording;    // submit_cmd is being recorded
+    VkSubpassContents subpass_contents;  // of the current frame's render pass
+
+    //-- Present timing (VK_GOOGLE_display_timing) --
+    static const uint32_t TIMING_HISTORY = 16;
+    bool           has_timing;                     // VK_GOOGLE_display_timing is enabled
+    bool           pacing;                         // delay BeginFrame, to start each frame just in time
+    uint64_t       pacing_margin;                  // (ns) extra time allowed for each frame
+    uint32_t       present_id;                     // id of the most recent present
+    uint64_t       begin_time[TIMING_HISTORY];     // BeginFrame time, by present id
+    CPresentTiming timing;
+    void UpdateTiming();                           // read back past present times
+    void Pace();                                   // sleep until it's time to start the next frame
+    //------------------------------------------------
+
+    CGpuTimer gpu_timer;                          // GPU timestamp queries. (disabled until EnableGpuTimer)
+
+    //-- Dynamic resolution --
+    static const uint32_t SCALE_INTERVAL = 8;    // GPU samples between scale adjustments
+    bool          scaling;                       // render to color_buffer, and upscale to the swapchain image
+    float         render_scale;                  // fraction of the swapchain extent, in each dimension
+    float         min_scale;
+    float         scale_budget;                  // (ms) GPU time allowed for the render pass. (0 = 90% of the refresh period)
+    float         scale_gpu;                     // (ms) running average of the render pass time, at the current scale
+    uint32_t      scale_samples;                 // samples averaged since the last adjustment
+    uint32_t      scale_seen;                    // render pass sample count of the GPU timer, when last checked
+    uint32_t      scale_skip;                    // samples to ignore, from frames recorded before the last change
+    CColorBuffer  color_buffer;                  // offscreen target, at full swapchain extent
+    VkFramebuffer scaled_framebuffer;            // color_buffer + depth_buffer, for renderpass->Offscreen()
+    VkExtent2D    render_extent;                 // render area of the current frame
+    void CreateScaledTarget();
+    void UpdateScale();                          // adjust render_scale, from the GPU times
+    void Upscale(VkCommandBuffer cmd);           // blit the render area to the acquired swapchain image
+    void ReleaseImage(VkCommandBuffer cmd);      // transfer ownership of the acquired image to the present family
+    //-------------------------
+
+    //-- Adaptive present mode --
+    static const uint32_t ADAPT_INTERVAL = 120;  // frames between evaluations
+    eAdaptiveGoal    adapt_goal;
+    uint64_t         adapt_frame;                // frame_count at the last evaluation
+    VkPresentModeKHR adapt_mode;                 // last choice. (A change must be picked twice in a row.)
+    uint32_t         adapt_images;
+    uint64_t         record_start;               // (ns) when the current frame's image was acquired
+    CTimeStats       cpu_record;                 // CPU time from image acquired, until submitted (ms)
+    void Adapt();
+    //---------------------------
+
+    std::unique_ptr<CThreadPool> thread_pool;     // for ExecuteParallel. (created on first use)
+    std::vector<VkCommandBuffer> secondary_cmds;  // recorded by ExecuteParallel
 
     void Init(VkPhysicalDevice gpu, VkDevice device, VkSurfaceKHR surface);
-    void CreateCommandPool(uint32_t family);
+    void CreateFrames(uint32_t count);
+    void DestroyFrames();
+    void Retire();                        // move the current swapchain resources to the deferred-deletion queue
+    void DestroyRetired(bool all = false);  // destroy retired resources, once no pending frame uses them
     void SetExtent();  //resize FrameBuffer image to match window surface
     //void SetFormat(VkFormat preferred_format = VK_FORMAT_B8G8R8A8_UNORM);
     void Apply();
     CSwapchainBuffer& AcquireNext();
     void Present();
+    CSwapchain(const CQueue& graphics_queue, const CQueue& present_queue, CRenderpass& renderpass, CQueueManager* queues);
 public:
     VkSurfaceCapabilitiesKHR surface_caps;
     VkSwapchainCreateInfoKHR info;
 
-    CSwapchain(const CQueue& present_queue, CRenderpass& renderpass);
+    CSwapchain(const CQueue& present_queue, CRenderpass& renderpass);                               // render and present on one queue
+    CSwapchain(const CQueue& graphics_queue, const CQueue& present_queue, CRenderpass& renderpass);  // render and present on separate queues
+    CSwapchain(CQueueManager& queues, CRenderpass& renderpass);                                     // batch submits per queue, flushed once per frame
     ~CSwapchain();
 
     bool PresentMode(bool no_tearing, bool powersave = IS_ANDROID);  // ANDROID: default to power-save mode (limit to 60fps)
     bool PresentMode(VkPresentModeKHR preferred_mode);               // If mode is not available, returns false and uses FIFO.
     bool SetImageCount(uint32_t image_count = 2);                    // 2=doublebuffer 3=tripplebuffer
+    void SetFramesInFlight(uint32_t count = 2);                      // number of frames the CPU may run ahead of the GPU
+    void SetStatic(bool enable);                                     // record per-image command buffers once, and reuse them
+    void Invalidate() { static_version++; }                          // re-record the static command buffers
+    void SetThreadCount(uint32_t count = 0);                         // threads for ExecuteParallel. (0 = one per core)
+    bool SetPacing(bool enable, uint32_t margin_us = 1000);          // Start frames just in time for vblank. (false if not supported)
+    const CPresentTiming& GetTiming() const { return timing; }       // present time feedback (VK_GOOGLE_display_timing)
+
+    void SetAdaptive(eAdaptiveGoal goal);                            // Tune present mode and image count, from frame times.
+    const CTimeStats& GetCpuRecordTime() const { return cpu_record; }
+
+    bool EnableGpuTimer();                                           // Measure GPU time per frame and region. (false if not supported)
+    void BeginRegion(VkCommandBuffer cmd, const char* name);         // Start a timed region. (name must be a string literal)
+    void EndRegion(VkCommandBuffer cmd);                             // End the innermost timed region.
+    const CGpuTimer& GetGpuTimer() const { return gpu_timer; }
+    void PrintTimes() { gpu_timer.Print(); }                         // min / avg / p99 of the CPU frame time, and of each GPU region
+
+    bool SetDynamicResolution(bool enable, float budget_ms = 0, float min_scale = 0.5f);  // Scale the render area, to fit the GPU budget. (false if not supported)
+    float GetRenderScale() const { return scaling ? render_scale : 1.0f; }
+    VkExtent2D GetRenderExtent() const { return render_extent; }    // render area of the current frame
+    void SetViewport(VkCommandBuffer cmd);                           // Set viewport and scissor to the render area.
 
     VkExtent2D GetExtent(){return info.imageExtent;}
     void Print();
 
-    VkCommandBuffer BeginFrame();  // Get next cmd buffer and start recording commands
+    VkCommandBuffer BeginFrame(VkSubpassContents contents = VK_SUBPASS_CONTENTS_INLINE);  // Get next cmd buffer and start recording commands. (Static mode: VK_NULL_HANDLE if up to date)
+    void ExecuteParallel(uint32_t task_count, const std::function<void(VkCommandBuffer cmd, uint32_t task)>& record);  // Record secondaries in parallel
     void EndFrame();               // End the renderpass and present
 };
 
@@ -23,13 +23,21 @@
 *   CPipeline loads the shaders and configures the graphics pipeline.
 *   CSwapchain manages the frame/command buffers and presents the result to the window surface.
 *
+* Run with "--null [frames]" to render on the null driver, without a GPU or display,
+* and print the CPU time per frame. (Requires the USE_VULKAN_WRAPPER CMake option)
+* Run with "--adaptive" to tune the present mode and image count from measured frame times,
+* and with "--dynamic" to lower the render resolution when the GPU can't keep up. (Both are off by default.)
+*
 */
 
 #include "WSIWindow.h"
 #include "CDevices.h"
+#include "CQueues.h"
 #include "CRenderpass.h"
 #include "CSwapchain.h"
 #include "CPipeline.h"
+#include "NullDriver.h"
+#include <chrono>
 
 //-- EVENT HANDLERS --
 class CWindow : public WSIWindow {
@@ -41,6 +49,23 @@ class CWindow : public WSIWindow {
 
 int main(int argc, char *argv[]) {
     setvbuf(stdout, NULL, _IONBF, 0);                      // Prevent printf buffering in QtCreator
+    CHostAllocator allocator;                              // Pooled host allocator, with per-frame stats (see CAllocator.h)
+    SetHostAllocator(allocator);                           // Install it BEFORE creating the instance.
+    uint32_t frame_limit = 0;                              // 0 = run until the window is closed
+    bool adaptive = false, dynamic_resolution = false;
+    for (int i = 1; i < argc; ++i) {
+        if (!strcmp(argv[i], "--null")) {                  // CPU-only benchmark: --null [frames]
+            if (!UseNullDriver()) return 0;
+            frame_limit = (i + 1 < argc && atoi(argv[i + 1]) > 0) ? (uint32_t)atoi(argv[++i]) : 1000;
+        } else if (!strcmp(argv[i], "--adaptive")) {
+            adaptive = true;
+        } else if (!strcmp(argv[i], "--dynamic")) {
+            dynamic_resolution = true;
+        } else {
+            printf("Usage: Example3 [--null [frames]] [--adaptive] [--dynamic]\n");
+            return 0;
+        }
+    }
     CInstance instance(true);                              // Create a Vulkan Instance
     instance.DebugReport.SetFlags(14);                     // Error+Perf+Warning flags
     CWindow Window;                                        // Create a Vulkan window
@@ -54,8 +79,11 @@ int main(int argc, char *argv[]) {
     gpus.Print();        // List the available GPUs.
     if (!gpu) return 0;  // Exit if no devices can present to the given surface.
 
-    CDevice device(*gpu);                                             // Create Logical device on selected gpu
-    CQueue* queue = device.AddQueue(VK_QUEUE_GRAPHICS_BIT, surface);  // Create the present-queue
+    CDevice device(*gpu);                                      // Logical device on selected gpu
+    CQueueManager queues(device, surface);                     // Declare graphics, present, compute and transfer queues
+    if (!queues.Graphics() || !queues.Present()) return 0;
+    device.Create();                                           // Create the logical device, once.
+    queues.Print();
 
     //--- Renderpass ---
     VkFormat color_fmt = gpu->FindSurfaceFormat(surface);
@@ -67,8 +95,14 @@ int main(int argc, char *argv[]) {
     //-------------------
 
     //--- Swapchain ---
-    CSwapchain swapchain(*queue, renderpass);
+    CSwapchain swapchain(queues, renderpass);  // submits are batched per queue, and flushed once per frame
     swapchain.SetImageCount(3);  // use tripple-buffering
+    swapchain.SetFramesInFlight(2);  // record the next frame, while the GPU renders this one
+    swapchain.SetStatic(true);       // the triangle never changes: record each image's commands once
+    if (!frame_limit) swapchain.SetPacing(true);  // start frames just in time for vblank (if VK_GOOGLE_display_timing is available)
+    if (adaptive) swapchain.SetAdaptive(ADAPT_LATENCY);  // tune present mode and image count, from measured frame times
+    swapchain.EnableGpuTimer();      // measure GPU time per frame, with timestamp queries
+    swapchain.SetDynamicResolution(dynamic_resolution);  // lower the render resolution when the GPU can't keep up, and upscale
     swapchain.Print();
     //-----------------
 
@@ -80,12 +114,32 @@ int main(int argc, char *argv[]) {
     printf("Pipeline created\n");
     //----------------
 
+    CDebugMarker marker(device, device.vk);  // Labels command-buffer regions, for frame debuggers.
+
+    PROFILE_THREAD("Main");
+    uint32_t frames = 0;
+    auto start = std::chrono::steady_clock::now();
     while (Window.ProcessEvents()) {  // Main event loop, runs until window is closed.
-        VkCommandBuffer cmd_buf = swapchain.BeginFrame();
-          vkCmdBindPipeline(cmd_buf, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
-          vkCmdDraw(cmd_buf, 3, 1, 0, 0);
+        PROFILE_ZONE("Frame");
+        allocator.NextFrame();                                   // Count host allocations per frame
+        if (VkCommandBuffer cmd_buf = swapchain.BeginFrame()) {  // Static mode: only record when out of date
+          marker.Begin(cmd_buf, "Triangle", 0xFF8000);
+          swapchain.BeginRegion(cmd_buf, "Triangle");
+          device.vk.CmdBindPipeline(cmd_buf, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
+          device.vk.CmdDraw(cmd_buf, 3, 1, 0, 0);
+          swapchain.EndRegion(cmd_buf);
+          marker.End(cmd_buf);
+        }
         swapchain.EndFrame();
+        if (++frames == frame_limit) Window.Close();
+    }
+    if (frame_limit) {
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        printf("%d frames: %.2f us/frame (CPU)\n", frames, ms * 1000.0 / frames);
     }
+    swapchain.PrintTimes();
+    allocator.Print();                    // Host allocation stats. (calls/frame are from the last frame)
+    PROFILE_SAVE("Example3_trace.json");  // Open in chrome://tracing (Requires the ENABLE_PROFILER CMake option)
 
     return 0;
 }
@@ -45,6 +45,9 @@ public:
         bool no_tick;
         bool no_render;
         bool no_present;
+
+        bool null_driver;  // CPU-only benchmark: no GPU work, and no window
+        int  frame_limit;  // quit after this many frames. (0 = run until closed)
     };
     const Settings &settings() const { return settings_; }
 
@@ -79,6 +82,9 @@ protected:
         settings_.no_render = false;
         settings_.no_present = false;
 
+        settings_.null_driver = false;
+        settings_.frame_limit = 0;
+
         parse_args(args);
     }
 
@@ -109,6 +115,12 @@ private:
                 settings_.no_render = true;
             } else if (*it == "-np") {
                 settings_.no_present = true;
+            } else if (*it == "--null") {
+                settings_.null_driver = true;
+                if (!settings_.frame_limit) settings_.frame_limit = 1000;
+            } else if (*it == "--frames") {
+                ++it;
+                settings_.frame_limit = std::stoi(*it);
             }
         }
 #endif
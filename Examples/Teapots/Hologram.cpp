@@ -27,6 +27,7 @@
 #include "Hologram.h"
 #include "Meshes.h"
 #include "Shell.h"
+#include "CProfiler.h"
 
 namespace {
 
@@ -97,7 +98,9 @@ void Hologram::attach_shell(Shell &sh)
     const Shell::Context &ctx = sh.context();
     physical_dev_ = ctx.physical_dev;
     dev_ = ctx.dev;
+    marker_ = CDebugMarker(dev_, ctx.debug_marker);
     queue_ = ctx.game_queue;
+    timeline_.Init(dev_, queue_, ctx.timeline);
     queue_family_ = ctx.game_queue_family;
     format_ = ctx.format.format;
 
@@ -156,6 +159,7 @@ void Hologram::detach_shell()
     }
 
     destroy_frame_data();
+    timeline_.Destroy();
 
     vkDestroyPipeline(dev_, pipeline_, nullptr);
     vkDestroyPipelineLayout(dev_, pipeline_layout_, nullptr);
@@ -218,6 +222,7 @@ void Hologram::create_render_pass()
     render_pass_info.pDependencies = subpass_deps.data();
 
     vk::assert_success(vkCreateRenderPass(dev_, &render_pass_info, nullptr, &render_pass_));
+    marker_.SetName(VK_DEBUG_REPORT_OBJECT_TYPE_RENDER_PASS_EXT, (uint64_t)render_pass_, "Hologram render pass");
 }
 
 void Hologram::create_shader_modules()
@@ -239,6 +244,9 @@ void Hologram::create_shader_modules()
     sh_info.codeSize = sizeof(Hologram_frag);
     sh_info.pCode = Hologram_frag;
     vk::assert_success(vkCreateShaderModule(dev_, &sh_info, nullptr, &fs_));
+
+    marker_.SetName(VK_DEBUG_REPORT_OBJECT_TYPE_SHADER_MODULE_EXT, (uint64_t)vs_, "Hologram.vert");
+    marker_.SetName(VK_DEBUG_REPORT_OBJECT_TYPE_SHADER_MODULE_EXT, (uint64_t)fs_, "Hologram.frag");
 }
 
 void Hologram::create_descriptor_set_layout()
@@ -282,6 +290,7 @@ void Hologram::create_pipeline_layout()
 
     vk::assert_success(vkCreatePipelineLayout(dev_, &pipeline_layout_info,
                 nullptr, &pipeline_layout_));
+    marker_.SetName(VK_DEBUG_REPORT_OBJECT_TYPE_PIPELINE_LAYOUT_EXT, (uint64_t)pipeline_layout_, "Hologram pipeline layout");
 }
 
 void Hologram::create_pipeline()
@@ -365,13 +374,13 @@ void Hologram::create_pipeline()
     pipeline_info.renderPass = render_pass_;
     pipeline_info.subpass = 0;
     vk::assert_success(vkCreateGraphicsPipelines(dev_, VK_NULL_HANDLE, 1, &pipeline_info, nullptr, &pipeline_));
+    marker_.SetName(VK_DEBUG_REPORT_OBJECT_TYPE_PIPELINE_EXT, (uint64_t)pipeline_, "Hologram pipeline");
 }
 
 void Hologram::create_frame_data(int count)
 {
-    frame_data_.resize(count);
+    frame_data_.resize(count);  // (values start at 0: not submitted yet)
 
-    create_fences();
     create_command_buffers();
 
     if (!use_push_constants_) {
@@ -400,22 +409,9 @@ void Hologram::destroy_frame_data()
     worker_cmd_pools_.clear();
     vkDestroyCommandPool(dev_, primary_cmd_pool_, nullptr);
 
-    for (auto &data : frame_data_)
-        vkDestroyFence(dev_, data.fence, nullptr);
-
     frame_data_.clear();
 }
 
-void Hologram::create_fences()
-{
-    VkFenceCreateInfo fence_info = {};
-    fence_info.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
-    fence_info.flags = VK_FENCE_CREATE_SIGNALED_BIT;
-
-    for (auto &data : frame_data_)
-        vk::assert_success(vkCreateFence(dev_, &fence_info, nullptr, &data.fence));
-}
-
 void Hologram::create_command_buffers()
 {
     VkCommandPoolCreateInfo cmd_pool_info = {};
@@ -443,6 +439,14 @@ void Hologram::create_command_buffers()
             VK_COMMAND_BUFFER_LEVEL_PRIMARY : VK_COMMAND_BUFFER_LEVEL_SECONDARY;
 
         vk::assert_success(vkAllocateCommandBuffers(dev_, &cmd_info, cmds.data()));
+
+        bool primary = (i == cmd_pools.size() - 1);
+        marker_.SetName(VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_POOL_EXT, (uint64_t)cmd_pool,
+                        primary ? "Primary command pool" : "Worker %d command pool", (int)i);
+        for (size_t f = 0; f < cmds.size(); f++)
+            marker_.SetName(VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT, (uint64_t)cmds[f],
+                            primary ? "Primary frame %d" : "Worker %d frame %d",
+                            primary ? (int)f : (int)i, (int)f);
     }
 
     // update frame_data_
@@ -702,11 +706,13 @@ void Hologram::draw_object(const Simulation::Object &obj, FrameData &data, VkCom
 
 void Hologram::update_simulation(const Worker &worker)
 {
+    PROFILE_ZONE("Worker update");
     sim_.update(worker.tick_interval_, worker.object_begin_, worker.object_end_);
 }
 
 void Hologram::draw_objects(Worker &worker)
 {
+    PROFILE_ZONE("Worker draw");
     auto &data = frame_data_[frame_data_index_];
     auto cmd = data.worker_cmds[worker.index_];
 
@@ -721,20 +727,24 @@ void Hologram::draw_objects(Worker &worker)
     begin_info.pInheritanceInfo = &inherit_info;
 
     vkBeginCommandBuffer(cmd, &begin_info);
+    {
+        char label[32];
+        snprintf(label, sizeof(label), "Worker %d teapots", worker.index_);
+        CDebugLabel region(marker_, cmd, label, 0x4080FF);
 
-    vkCmdSetViewport(cmd, 0, 1, &viewport_);
-    vkCmdSetScissor(cmd, 0, 1, &scissor_);
+        vkCmdSetViewport(cmd, 0, 1, &viewport_);
+        vkCmdSetScissor(cmd, 0, 1, &scissor_);
 
-    vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline_);
+        vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline_);
 
-    meshes_->cmd_bind_buffers(cmd);
+        meshes_->cmd_bind_buffers(cmd);
 
-    for (int i = worker.object_begin_; i < worker.object_end_; i++) {
-        auto &obj = sim_.objects()[i];
+        for (int i = worker.object_begin_; i < worker.object_end_; i++) {
+            auto &obj = sim_.objects()[i];
 
-        draw_object(obj, data, cmd);
+            draw_object(obj, data, cmd);
+        }
     }
-
     vkEndCommandBuffer(cmd);
 
     if (!use_push_constants_) {
@@ -784,11 +794,14 @@ void Hologram::on_tick()
 
 void Hologram::on_frame(float frame_pred)
 {
+    PROFILE_ZONE("on_frame");
     auto &data = frame_data_[frame_data_index_];
 
     // wait for the last submission since we reuse frame data
-    vk::assert_success(vkWaitForFences(dev_, 1, &data.fence, true, UINT64_MAX));
-    vk::assert_success(vkResetFences(dev_, 1, &data.fence));
+    {
+        PROFILE_ZONE("Wait for frame data");
+        timeline_.Wait(data.value);
+    }
 
     const Shell::BackBuffer &back = shell_->context().acquired_back_buffer;
 
@@ -797,6 +810,7 @@ void Hologram::on_frame(float frame_pred)
         worker->draw_objects(framebuffers_[back.image_index]);
 
     VkResult res = vkBeginCommandBuffer(data.primary_cmd, &primary_cmd_begin_info_);
+    marker_.Begin(data.primary_cmd, "Hologram frame");
 
     if (!use_push_constants_) {
         VkBufferMemoryBarrier buf_barrier = {};
@@ -819,13 +833,17 @@ void Hologram::on_frame(float frame_pred)
             VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
 
     // record render pass commands
-    for (auto &worker : workers_)
-        worker->wait_idle();
+    {
+        PROFILE_ZONE("Wait for workers");
+        for (auto &worker : workers_)
+            worker->wait_idle();
+    }
     vkCmdExecuteCommands(data.primary_cmd,
             static_cast<uint32_t>(data.worker_cmds.size()),
             data.worker_cmds.data());
 
     vkCmdEndRenderPass(data.primary_cmd);
+    marker_.End(data.primary_cmd);
     vkEndCommandBuffer(data.primary_cmd);
 
     // wait for the image to be owned and signal for render completion
@@ -833,7 +851,7 @@ void Hologram::on_frame(float frame_pred)
     primary_cmd_submit_info_.pCommandBuffers = &data.primary_cmd;
     primary_cmd_submit_info_.pSignalSemaphores = &back.render_semaphore;
 
-    res = vkQueueSubmit(queue_, 1, &primary_cmd_submit_info_, data.fence);
+    data.value = timeline_.Submit(&primary_cmd_submit_info_);
 
     frame_data_index_ = (frame_data_index_ + 1) % frame_data_.size();
 
@@ -913,6 +931,7 @@ void Hologram::Worker::wait_idle()
 
 void Hologram::Worker::update_loop()
 {
+    PROFILE_THREAD("Worker %d", index_);
     while (true) {
         std::unique_lock<std::mutex> lock(mutex_);
 
@@ -28,6 +28,8 @@
 
 #include "Simulation.h"
 #include "Game.h"
+#include "DebugMarker.h"
+#include "CTimeline.h"
 
 class Meshes;
 
@@ -94,8 +96,8 @@ private:
     };
 
     struct FrameData {
-        // signaled when this struct is ready for reuse
-        VkFence fence;
+        // timeline value of the last submit that used this struct. (ready for reuse, once reached)
+        uint64_t value;
 
         VkCommandBuffer primary_cmd;
         std::vector<VkCommandBuffer> worker_cmds;
@@ -130,7 +132,6 @@ private:
 
     void create_frame_data(int count);
     void destroy_frame_data();
-    void create_fences();
     void create_command_buffers();
     void create_buffers();
     void create_buffer_memory();
@@ -138,7 +139,9 @@ private:
 
     VkPhysicalDevice physical_dev_;
     VkDevice dev_;
+    CDebugMarker marker_;  // names objects and command-buffer regions, for frame debuggers
     VkQueue queue_;
+    CTimeline timeline_;  // counts the frame submits on queue_ (see CTimeline.h)
     uint32_t queue_family_;
     VkFormat format_;
     VkDeviceSize aligned_object_data_size;
@@ -36,8 +36,8 @@ public:
         VkSemaphore acquire_semaphore;
         VkSemaphore render_semaphore;
 
-        // signaled when this struct is ready for reuse
-        VkFence present_fence;
+        // present-queue timeline value, reached when this struct is ready for reuse
+        uint64_t present_value;
     };
 
     struct Context {
@@ -48,6 +48,8 @@ public:
         uint32_t present_queue_family;
 
         VkDevice dev;
+        bool debug_marker;  // VK_EXT_debug_marker is enabled on dev
+        bool timeline;      // VK_KHR_timeline_semaphore is enabled on dev
         VkQueue game_queue;
         VkQueue present_queue;
 
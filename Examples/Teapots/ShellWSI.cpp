@@ -21,6 +21,7 @@
 #include <cassert>
 
 #include "Validation.h"
+#include "CProfiler.h"
 
 ShellWSI::ShellWSI(Game &game, VkInstance instance, CSurface* surface) : Shell(game),
     surface(surface),
@@ -112,6 +113,7 @@ void ShellWSI::create_context(){
 
     vkGetDeviceQueue(ctx_.dev, ctx_.game_queue_family,    0, &ctx_.game_queue);
     vkGetDeviceQueue(ctx_.dev, ctx_.present_queue_family, 0, &ctx_.present_queue);
+    present_timeline_.Init(ctx_.dev, ctx_.present_queue, ctx_.timeline);
 
     create_back_buffers();
 
@@ -134,6 +136,7 @@ void ShellWSI::destroy_context()
     ctx_.present_queue = VK_NULL_HANDLE;
 
     vkDeviceWaitIdle(ctx_.dev);
+    present_timeline_.Destroy();
     vkDestroyDevice(ctx_.dev, nullptr);
     ctx_.dev = VK_NULL_HANDLE;
 }
@@ -160,13 +163,37 @@ void ShellWSI::create_dev(){
         dev_info.queueCreateInfoCount = 1;
     }
 
+    // optional: VK_EXT_debug_marker, to name objects for frame debuggers (see DebugMarker.h)
+    std::vector<VkExtensionProperties> exts;
+    vk::enumerate(ctx_.physical_dev, nullptr, exts);
+    std::vector<const char *> extensions = device_extensions_;
+    ctx_.debug_marker = false;
+    for (const auto &ext : exts)
+        if (!strcmp(ext.extensionName, VK_EXT_DEBUG_MARKER_EXTENSION_NAME)) ctx_.debug_marker = true;
+    if (ctx_.debug_marker) extensions.push_back(VK_EXT_DEBUG_MARKER_EXTENSION_NAME);
+
+    // optional: VK_KHR_timeline_semaphore, to track frames with counters instead of fences (see CTimeline.h)
+    ctx_.timeline = false;
+    for (const auto &ext : exts)
+        if (!strcmp(ext.extensionName, VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME)) ctx_.timeline = true;
+    VkPhysicalDeviceTimelineSemaphoreFeaturesKHR timeline_features = {};
+    VkPhysicalDeviceFeatures2KHR features2 = {};
+    if (ctx_.timeline) {
+        extensions.push_back(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME);
+        timeline_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR;
+        timeline_features.timelineSemaphore = VK_TRUE;  // (always supported, with the extension)
+        features2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2_KHR;
+        features2.pNext = &timeline_features;
+        dev_info.pNext = &features2;
+    }
+
     dev_info.pQueueCreateInfos = queue_info.data();
-    dev_info.enabledExtensionCount = static_cast<uint32_t>(device_extensions_.size());
-    dev_info.ppEnabledExtensionNames = device_extensions_.data();
+    dev_info.enabledExtensionCount = static_cast<uint32_t>(extensions.size());
+    dev_info.ppEnabledExtensionNames = extensions.data();
 
-    // disable all features
+    // disable all features (other than the ones in features2)
     VkPhysicalDeviceFeatures features = {};
-    dev_info.pEnabledFeatures = &features;
+    dev_info.pEnabledFeatures = ctx_.timeline ? nullptr : &features;
 
     vk::assert_success(vkCreateDevice(ctx_.physical_dev, &dev_info, nullptr, &ctx_.dev));
 }
@@ -175,20 +202,15 @@ void ShellWSI::create_back_buffers(){
     VkSemaphoreCreateInfo sem_info = {};
     sem_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
 
-    VkFenceCreateInfo fence_info = {};
-    fence_info.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
-    fence_info.flags = VK_FENCE_CREATE_SIGNALED_BIT;
-
     // BackBuffer is used to track which swapchain image and its associated
     // sync primitives are busy.  Having more BackBuffer's than swapchain
-    // images may allows us to replace CPU wait on present_fence by GPU wait
+    // images may allows us to replace CPU wait on present_value by GPU wait
     // on acquire_semaphore.
     const int count = settings_.back_buffer_count + 1;
     for (int i = 0; i < count; i++) {
         BackBuffer buf = {};
-        vk::assert_success(vkCreateSemaphore(ctx_.dev, &sem_info,   nullptr, &buf.acquire_semaphore));
-        vk::assert_success(vkCreateSemaphore(ctx_.dev, &sem_info,   nullptr, &buf.render_semaphore));
-        vk::assert_success(vkCreateFence    (ctx_.dev, &fence_info, nullptr, &buf.present_fence));
+        vk::assert_success(vkCreateSemaphore(ctx_.dev, &sem_info, nullptr, &buf.acquire_semaphore));
+        vk::assert_success(vkCreateSemaphore(ctx_.dev, &sem_info, nullptr, &buf.render_semaphore));
 
         ctx_.back_buffers.push(buf);
     }
@@ -200,7 +222,6 @@ void ShellWSI::destroy_back_buffers(){
 
         vkDestroySemaphore(ctx_.dev, buf.acquire_semaphore, nullptr);
         vkDestroySemaphore(ctx_.dev, buf.render_semaphore, nullptr);
-        vkDestroyFence(ctx_.dev, buf.present_fence, nullptr);
 
         ctx_.back_buffers.pop();
     }
@@ -338,6 +359,7 @@ void ShellWSI::add_game_time(float time){
 }
 
 void ShellWSI::acquire_back_buffer(){
+    PROFILE_ZONE("acquire_back_buffer");
     // acquire just once when not presenting
     if (settings_.no_present &&
         ctx_.acquired_back_buffer.acquire_semaphore != VK_NULL_HANDLE)
@@ -346,10 +368,7 @@ void ShellWSI::acquire_back_buffer(){
     auto &buf = ctx_.back_buffers.front();
 
     // wait until acquire and render semaphores are waited/unsignaled
-    vk::assert_success(vkWaitForFences(ctx_.dev, 1, &buf.present_fence,
-                true, UINT64_MAX));
-    // reset the fence
-    vk::assert_success(vkResetFences(ctx_.dev, 1, &buf.present_fence));
+    present_timeline_.Wait(buf.present_value);
 
 
 
@@ -366,11 +385,13 @@ void ShellWSI::acquire_back_buffer(){
 }
 
 void ShellWSI::present_back_buffer(){
-    const auto &buf = ctx_.acquired_back_buffer;
+    auto &buf = ctx_.acquired_back_buffer;
 
     if (!settings_.no_render)
         game_.on_frame(game_time_ / game_tick_);
 
+    PROFILE_ZONE("present_back_buffer");
+
     if (settings_.no_present) {
         fake_present();
         return;
@@ -387,7 +408,7 @@ void ShellWSI::present_back_buffer(){
 
     vk::assert_success(vkQueuePresentKHR(ctx_.present_queue, &present_info));
 
-    vk::assert_success(vkQueueSubmit(ctx_.present_queue, 0, nullptr, buf.present_fence));
+    buf.present_value = present_timeline_.Submit();  // empty submit, after the present
     ctx_.back_buffers.push(buf);
 }
 
@@ -25,6 +25,7 @@
 #include <chrono>
 
 #include "WSIWindow.h"
+#include "CTimeline.h"
 #include "Shell.h"
 
 //-----------------------------High Resolution Timer-----------------------------
@@ -59,6 +60,7 @@ protected:
     const Game::Settings &settings_;
 private:
     std::vector<const char *> device_extensions_;
+    CTimeline present_timeline_;  // counts the present-queue submits that track back buffers (see CTimeline.h)
 
     //PFN_vkGetInstanceProcAddr load_vk(){}
     bool can_present(VkPhysicalDevice phy, uint32_t queue_family);
@@ -27,8 +27,11 @@
 */
 
 #include "WSIWindow.h"
+#include "NullDriver.h"
+#include "CProfiler.h"
 #include <string>
 #include <vector>
+#include <chrono>
 
 #include "Hologram.h"
 #include "ShellWSI.h"
@@ -95,6 +98,9 @@ int main(int argc, char *argv[]){
     const char* title = settings.name.c_str();
     //settings.validate=true;                       // Enable Validation without using -v flag (for Android)
 
+    //--Null driver (CPU-only benchmark)--
+    if (settings.null_driver && !UseNullDriver()) return 0;
+
     //--Create Instance and Window--
     CInstance inst(settings.validate);              // Create a Vulkan Instance
     MyWindow Window;                                // Create a window
@@ -118,10 +124,20 @@ int main(int argc, char *argv[]){
     Window.ShowKeyboard(true);
 
     //--Run main message loop--
+    PROFILE_THREAD("Main");
+    int frames = 0;
+    auto start = std::chrono::steady_clock::now();
     while(Window.ProcessEvents(!Window.animate)){   // Main event loop, runs until window is closed.
+        PROFILE_ZONE("Frame");
         shell.step();                               // Render next frame
+        if(++frames == settings.frame_limit) Window.Close();
+    }
+    if(settings.frame_limit){
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        printf("%d frames: %.2f us/frame (CPU)\n", frames, ms * 1000.0 / frames);
     }
     shell.quit();
+    PROFILE_SAVE("Teapots_trace.json");             // Open in chrome://tracing (Requires the ENABLE_PROFILER CMake option)
     delete game;
     return 0;
 }
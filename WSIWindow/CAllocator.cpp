@@ -0,0 +1,197 @@
+// Copyright (c) 2017 Rene Lindsay
+
+#include "CAllocator.h"
+#include <stdlib.h>
+#include <string.h>
+
+static const VkAllocationCallbacks* host_allocator = nullptr;
+
+const VkAllocationCallbacks* HostAllocator() { return host_allocator; }
+void SetHostAllocator(const VkAllocationCallbacks* callbacks) { host_allocator = callbacks; }
+
+//-------------------------CHostAllocator-------------------------
+// Every allocation is preceded by a 16-byte header, so Free() can find its arena and size class.
+struct CBlockHeader {
+    void*    base;   // malloc'd pointer, for large blocks. (0 for pool slots)
+    uint32_t size;   // requested size
+    uint8_t  cls;    // size class, or LARGE
+    uint8_t  scope;  // VkSystemAllocationScope
+    uint8_t  pad[16 - sizeof(void*) - 6];
+};
+static_assert(sizeof(CBlockHeader) == 16, "CBlockHeader must be 16 bytes");
+
+static const uint8_t  LARGE       = 0xFF;
+static const size_t   MIN_CLASS   = 16;
+static const size_t   CHUNK_SIZE  = 64 * 1024;
+static const size_t   POOL_ALIGN  = 16;  // pool slots are 16-byte aligned
+
+static uint8_t SizeClass(size_t size) {  // 16, 32, 64 ... 2048, or LARGE
+    size_t slot = MIN_CLASS;
+    for (uint32_t i = 0; i < CHostAllocator::CLASS_COUNT; ++i) {
+        if (size <= slot) return (uint8_t)i;
+        slot <<= 1;
+    }
+    return LARGE;
+}
+
+static size_t SlotSize(uint8_t cls) { return (MIN_CLASS << cls) + sizeof(CBlockHeader); }
+
+CHostAllocator::CHostAllocator() {
+    callbacks = {};
+    callbacks.pUserData       = this;
+    callbacks.pfnAllocation   = AllocFn;
+    callbacks.pfnReallocation = ReallocFn;
+    callbacks.pfnFree         = FreeFn;
+}
+
+CHostAllocator::~CHostAllocator() {
+    if (HostAllocator() == &callbacks) SetHostAllocator(nullptr);
+    for (auto& arena : arenas) {
+        if (arena.stats.live_count) LOGW("CHostAllocator: %d allocations still live.\n", arena.stats.live_count);
+        for (auto& pool : arena.pools) {
+            while (pool.chunks) {
+                void* next = *(void**)pool.chunks;
+                free(pool.chunks);
+                pool.chunks = next;
+            }
+        }
+    }
+}
+
+void* CHostAllocator::Alloc(size_t size, size_t alignment, VkSystemAllocationScope scope) {
+    if (!size) return nullptr;
+    if ((uint32_t)scope >= SCOPE_COUNT) scope = VK_SYSTEM_ALLOCATION_SCOPE_OBJECT;
+    uint8_t cls = (alignment <= POOL_ALIGN) ? SizeClass(size) : LARGE;
+    CArena& arena = arenas[scope];
+    CBlockHeader* header = nullptr;
+
+    if (cls == LARGE) {
+        if (alignment < POOL_ALIGN) alignment = POOL_ALIGN;
+        void* base = malloc(size + alignment + sizeof(CBlockHeader));
+        if (!base) return nullptr;
+        uintptr_t user = ((uintptr_t)base + sizeof(CBlockHeader) + alignment - 1) & ~(uintptr_t)(alignment - 1);
+        header = (CBlockHeader*)user - 1;
+        header->base = base;
+    }
+
+    std::lock_guard<std::mutex> guard(arena.lock);
+    if (cls != LARGE) {
+        CPool& pool = arena.pools[cls];
+        if (!pool.free_list) {  // carve a new chunk into slots
+            size_t slot_size = SlotSize(cls);
+            char* chunk = (char*)malloc(CHUNK_SIZE);
+            if (!chunk) return nullptr;
+            *(void**)chunk = pool.chunks;
+            pool.chunks = chunk;
+            for (size_t ofs = POOL_ALIGN; ofs + slot_size <= CHUNK_SIZE; ofs += slot_size) {
+                *(void**)(chunk + ofs) = pool.free_list;
+                pool.free_list = chunk + ofs;
+            }
+        }
+        header = (CBlockHeader*)pool.free_list;
+        pool.free_list = *(void**)pool.free_list;
+        header->base = nullptr;
+    }
+    header->size  = (uint32_t)size;
+    header->cls   = cls;
+    header->scope = (uint8_t)scope;
+
+    CStats& stats = arena.stats;
+    stats.live_bytes += size;
+    stats.live_count++;
+    stats.total_calls++;
+    stats.frame_calls++;
+    if (stats.live_bytes > stats.peak_bytes) stats.peak_bytes = stats.live_bytes;
+    return header + 1;
+}
+
+void CHostAllocator::Free(void* memory) {
+    if (!memory) return;
+    CBlockHeader* header = (CBlockHeader*)memory - 1;
+    CArena& arena = arenas[header->scope];
+    std::lock_guard<std::mutex> guard(arena.lock);
+    CStats& stats = arena.stats;
+    stats.live_bytes -= header->size;
+    stats.live_count--;
+    stats.total_calls++;
+    stats.frame_calls++;
+    if (header->cls == LARGE) {
+        free(header->base);
+    } else {
+        CPool& pool = arena.pools[header->cls];
+        *(void**)header = pool.free_list;
+        pool.free_list = header;
+    }
+}
+
+void* CHostAllocator::Realloc(void* original, size_t size, size_t alignment, VkSystemAllocationScope scope) {
+    if (!original) return Alloc(size, alignment, scope);
+    if (!size) { Free(original); return nullptr; }
+    CBlockHeader* header = (CBlockHeader*)original - 1;
+    if (header->cls != LARGE && size <= (MIN_CLASS << header->cls)) {  // still fits in its slot
+        CArena& arena = arenas[header->scope];
+        std::lock_guard<std::mutex> guard(arena.lock);
+        arena.stats.live_bytes = arena.stats.live_bytes - header->size + size;
+        if (arena.stats.live_bytes > arena.stats.peak_bytes) arena.stats.peak_bytes = arena.stats.live_bytes;
+        arena.stats.total_calls++;
+        arena.stats.frame_calls++;
+        header->size = (uint32_t)size;
+        return original;
+    }
+    void* memory = Alloc(size, alignment, scope);
+    if (!memory) return nullptr;  // original stays valid
+    memcpy(memory, original, (size < header->size) ? size : header->size);
+    Free(original);
+    return memory;
+}
+
+void* CHostAllocator::AllocFn(void* user, size_t size, size_t align, VkSystemAllocationScope scope) {
+    return ((CHostAllocator*)user)->Alloc(size, align, scope);
+}
+
+void* CHostAllocator::ReallocFn(void* user, void* orig, size_t size, size_t align, VkSystemAllocationScope scope) {
+    return ((CHostAllocator*)user)->Realloc(orig, size, align, scope);
+}
+
+void CHostAllocator::FreeFn(void* user, void* memory) { ((CHostAllocator*)user)->Free(memory); }
+
+CHostAllocator::CStats CHostAllocator::Stats(VkSystemAllocationScope scope) {
+    CArena& arena = arenas[scope];
+    std::lock_guard<std::mutex> guard(arena.lock);
+    return arena.stats;
+}
+
+CHostAllocator::CStats CHostAllocator::Total() {
+    CStats total = {};
+    for (uint32_t i = 0; i < SCOPE_COUNT; ++i) {
+        CStats s = Stats((VkSystemAllocationScope)i);
+        total.live_bytes      += s.live_bytes;
+        total.peak_bytes      += s.peak_bytes;       // sum of per-scope peaks
+        total.total_calls     += s.total_calls;
+        total.frame_calls     += s.frame_calls;
+        total.max_frame_calls += s.max_frame_calls;  // sum of per-scope maxima
+        total.live_count      += s.live_count;
+    }
+    return total;
+}
+
+void CHostAllocator::NextFrame() {
+    for (auto& arena : arenas) {
+        std::lock_guard<std::mutex> guard(arena.lock);
+        CStats& stats = arena.stats;
+        if (stats.frame_calls > stats.max_frame_calls) stats.max_frame_calls = stats.frame_calls;
+        stats.frame_calls = 0;
+    }
+}
+
+void CHostAllocator::Print() {
+    const char* names[SCOPE_COUNT] = {"Command ", "Object  ", "Cache   ", "Device  ", "Instance"};
+    LOG_FLUSH();
+    printf("Host allocations:   live(KB)  peak(KB)  count  calls/frame  max/frame  total calls\n");
+    for (uint32_t i = 0; i < SCOPE_COUNT; ++i) {
+        CStats s = Stats((VkSystemAllocationScope)i);
+        printf("\t%s : %8.1f  %8.1f  %5d  %11d  %9d  %11llu\n", names[i], s.live_bytes / 1024.0, s.peak_bytes / 1024.0,
+               s.live_count, s.frame_calls, s.max_frame_calls, (unsigned long long)s.total_calls);
+    }
+}
+//----------------------------------------------------------------
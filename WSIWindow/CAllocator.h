@@ -0,0 +1,85 @@
+// Copyright (c) 2017 Rene Lindsay
+
+/*
+*  This unit provides a host-memory allocator for the Vulkan driver. (VkAllocationCallbacks)
+*
+*  By default, all vkCreate* / vkDestroy* calls in WSIWindow pass HostAllocator(), which returns nullptr,
+*  so the driver uses its own allocator.  Call SetHostAllocator() BEFORE creating the CInstance, to install
+*  CHostAllocator, or your own VkAllocationCallbacks.  (Objects must be destroyed with the same callbacks.)
+*
+*  CHostAllocator:
+*  ---------------
+*  Small allocations are served from size-class pools (16 - 2048 bytes), with a separate arena for each
+*  VkSystemAllocationScope (command / object / cache / device / instance), so short-lived command-scope
+*  allocations don't fragment the long-lived ones.  Larger, or over-aligned allocations go to malloc.
+*  Live bytes, peak bytes and call counts are tracked per scope.  Call NextFrame() once per frame,
+*  to reset the per-frame call counters, (the busiest frame is kept) and Print() to show the stats.
+*  NOTE: Stats are per scope, not per object type, since the callbacks are only told the scope.
+*  (Tagging each vkCreate* call through pUserData would need separate callbacks per call site.)
+*
+*  eg:
+*    CHostAllocator allocator;
+*    SetHostAllocator(allocator);
+*    CInstance instance;
+*    ...
+*    allocator.Print();
+*/
+
+#ifndef CALLOCATOR_H
+#define CALLOCATOR_H
+
+#include "Validation.h"
+#include <mutex>
+#include <stdint.h>
+
+const VkAllocationCallbacks* HostAllocator();                   // Returns installed callbacks, or nullptr for the driver default.
+void SetHostAllocator(const VkAllocationCallbacks* callbacks);  // Call BEFORE creating CInstance. (nullptr to uninstall)
+
+//-------------------------CHostAllocator-------------------------
+class CHostAllocator {
+  public:
+    static const uint32_t SCOPE_COUNT = 5;  // VK_SYSTEM_ALLOCATION_SCOPE_COMMAND .. INSTANCE
+    static const uint32_t CLASS_COUNT = 8;  // size classes: 16, 32, 64 ... 2048 bytes
+
+    struct CStats {
+        uint64_t live_bytes;       // currently allocated
+        uint64_t peak_bytes;       // high-water mark
+        uint64_t total_calls;      // alloc + realloc + free, since start
+        uint32_t frame_calls;      // alloc + realloc + free, since NextFrame()
+        uint32_t max_frame_calls;  // most calls in one frame, since start
+        uint32_t live_count;       // number of live allocations
+    };
+
+  private:
+    struct CPool {                 // free-list of fixed-size slots, carved from chunks
+        void*  free_list = nullptr;
+        void*  chunks    = nullptr;  // linked list of chunks, for release
+    };
+    struct CArena {                // one per allocation scope
+        std::mutex lock;
+        CPool      pools[CLASS_COUNT];
+        CStats     stats = {};
+    };
+    CArena arenas[SCOPE_COUNT];
+    VkAllocationCallbacks callbacks;
+
+    void* Alloc  (size_t size, size_t alignment, VkSystemAllocationScope scope);
+    void* Realloc(void* original, size_t size, size_t alignment, VkSystemAllocationScope scope);
+    void  Free   (void* memory);
+
+    static VKAPI_ATTR void* VKAPI_CALL AllocFn  (void* user, size_t size, size_t align, VkSystemAllocationScope scope);
+    static VKAPI_ATTR void* VKAPI_CALL ReallocFn(void* user, void* orig, size_t size, size_t align, VkSystemAllocationScope scope);
+    static VKAPI_ATTR void  VKAPI_CALL FreeFn   (void* user, void* memory);
+
+  public:
+    CHostAllocator();
+    ~CHostAllocator();  // Destroy AFTER all Vulkan objects using it.
+    operator const VkAllocationCallbacks*() const { return &callbacks; }
+    CStats Stats(VkSystemAllocationScope scope);
+    CStats Total();
+    void NextFrame();  // Reset per-frame call counters
+    void Print();      // Print per-scope stats
+};
+//----------------------------------------------------------------
+
+#endif
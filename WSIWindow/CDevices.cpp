@@ -2,6 +2,52 @@
 
 #include "CDevices.h"
 
+//-------------------------CFeatureChain--------------------------
+CFeatureChain& CFeatureChain::operator=(const CFeatureChain& other) {
+    nodes = other.nodes;
+    sizes = other.sizes;
+    Link();
+    return *this;
+}
+
+void CFeatureChain::Link() {
+    repeat(nodes.size()) ((CHeader*)nodes[i].data())->pNext = (i + 1 < nodes.size()) ? nodes[i + 1].data() : nullptr;
+}
+
+void* CFeatureChain::Append(VkStructureType sType, size_t size) {
+    nodes.push_back(vector<uint64_t>((size + 7) / 8, 0));
+    sizes.push_back(size);
+    ((CHeader*)nodes.back().data())->sType = sType;
+    Link();
+    return nodes.back().data();
+}
+
+void* CFeatureChain::Find(VkStructureType sType) const {
+    for (auto& node : nodes) if (((CHeader*)node.data())->sType == sType) return (void*)node.data();
+    return nullptr;
+}
+
+// Feature structs are a header, followed by VkBool32's only. Clear the requested features which are not supported.
+uint32_t CFeatureChain::Intersect(const CFeatureChain& supported) {
+    uint32_t cleared = 0;
+    repeat(nodes.size()) {
+        CHeader* header = (CHeader*)nodes[i].data();
+        VkBool32* req = (VkBool32*)(header + 1);
+        const VkBool32* sup = (const VkBool32*)supported.Find(header->sType);
+        uint32_t count = (uint32_t)((sizes[i] - sizeof(CHeader)) / sizeof(VkBool32));
+        if (sup) sup = (const VkBool32*)((const CHeader*)sup + 1);
+        for (uint32_t j = 0; j < count; ++j) {
+            if (req[j] && !(sup && sup[j])) {
+                LOGW("Feature %d of struct sType=%d is not supported.\n", j, header->sType);
+                req[j] = VK_FALSE;
+                cleared++;
+            }
+        }
+    }
+    return cleared;
+}
+//----------------------------------------------------------------
+
 //------------------------CPhysicalDevice-------------------------
 CPhysicalDevice::CPhysicalDevice() : handle(0), properties(), features(), extensions() {}
 
@@ -16,27 +62,22 @@ const char* CPhysicalDevice::VendorName() const {
 // Returns the QueueFamily index, or -1 if not found.
 int CPhysicalDevice::FindQueueFamily(VkQueueFlags flags, VkSurfaceKHR surface){
     repeat (queue_families.size()) {
-        VkBool32 can_present = false;
         if ((queue_families[i].queueFlags & flags) != flags) continue;
-        if (surface) VKERRCHECK(vkGetPhysicalDeviceSurfaceSupportKHR(handle, i, surface, &can_present));
-        if (!!surface == !!can_present) return i;
+        bool can_present = surface && CSurfaceInfo::Get(handle, surface).CanPresent(i);
+        if (!!surface == can_present) return i;
     }
     return -1;
 }
 
-std::vector<VkSurfaceFormatKHR> CPhysicalDevice::SurfaceFormats(VkSurfaceKHR surface) {  // Get Surface format list
-    std::vector<VkSurfaceFormatKHR> formats;
-    uint32_t count = 0;
-    vkGetPhysicalDeviceSurfaceFormatsKHR(handle, surface, &count, nullptr);
-    formats.resize(count);
-    vkGetPhysicalDeviceSurfaceFormatsKHR(handle, surface, &count, formats.data());
-    ASSERT(!!count, "No supported surface formats found.");
+const std::vector<VkSurfaceFormatKHR>& CPhysicalDevice::SurfaceFormats(VkSurfaceKHR surface) {  // Get Surface format list
+    const std::vector<VkSurfaceFormatKHR>& formats = CSurfaceInfo::Get(handle, surface).Formats();
+    ASSERT(!!formats.size(), "No supported surface formats found.");
     return formats;
 }
 
 //--Returns the first supported surface color format from the preferred_formats list, or VK_FORMAT_UNDEFINED if no match found.
 VkFormat CPhysicalDevice::FindSurfaceFormat(VkSurfaceKHR surface, std::vector<VkFormat> preferred_formats) {
-    auto formats = SurfaceFormats(surface);  // get list of supported surface formats
+    auto& formats = SurfaceFormats(surface);  // get list of supported surface formats
     for (auto& pf : preferred_formats) 
         for (auto& f : formats) 
             if(f.format == pf) return f.format;
@@ -44,6 +85,15 @@ VkFormat CPhysicalDevice::FindSurfaceFormat(VkSurfaceKHR surface, std::vector<Vk
     return VK_FORMAT_UNDEFINED;
 }
 
+bool CPhysicalDevice::QueryFeatures(CFeatureChain& chain) const {
+    if (!get_features2) return false;
+    VkPhysicalDeviceFeatures2KHR features2 = {};
+    features2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2_KHR;
+    features2.pNext = chain.Head();
+    get_features2(handle, &features2);
+    return true;
+}
+
 VkFormat CPhysicalDevice::FindDepthFormat(std::vector<VkFormat> preferred_formats) {
     for (auto& format : preferred_formats) {
         VkFormatProperties formatProps;
@@ -57,7 +107,7 @@ VkFormat CPhysicalDevice::FindDepthFormat(std::vector<VkFormat> preferred_format
 //----------------------------------------------------------------
 
 //------------------------CPhysicalDevices------------------------
-CPhysicalDevices::CPhysicalDevices(const VkInstance instance) {
+CPhysicalDevices::CPhysicalDevices(const VkInstance instance, uint32_t api_version) {
     VkResult result;
     uint gpu_count = 0;
     vector<VkPhysicalDevice> gpus;
@@ -71,18 +121,38 @@ CPhysicalDevices::CPhysicalDevices(const VkInstance instance) {
     VKERRCHECK(result);
     if (!gpu_count) LOGW("No GPU devices found.");  // Vulkan driver missing?
 
+    // vkGetPhysicalDeviceFeatures2: from VK_KHR_get_physical_device_properties2, or core 1.1
+    // The core name may only be used if both the instance and the gpu are 1.1 or later. (checked per gpu, below)
+    const uint32_t VERSION_1_1 = VK_MAKE_VERSION(1, 1, 0);
+    auto get_features2_khr  = (PFN_vkGetPhysicalDeviceFeatures2KHR)vkGetInstanceProcAddr(instance, "vkGetPhysicalDeviceFeatures2KHR");
+    auto get_features2_core = (PFN_vkGetPhysicalDeviceFeatures2KHR)0;
+    if (!get_features2_khr && api_version >= VERSION_1_1)
+        get_features2_core = (PFN_vkGetPhysicalDeviceFeatures2KHR)vkGetInstanceProcAddr(instance, "vkGetPhysicalDeviceFeatures2");
+
     gpu_list.resize(gpu_count);
     for (uint i = 0; i < gpu_count; ++i) {  // for each device
         CPhysicalDevice& gpu = gpu_list[i];
         gpu.handle = gpus[i];
         vkGetPhysicalDeviceProperties(gpu, &gpu.properties);
         vkGetPhysicalDeviceFeatures  (gpu, &gpu.features);
+        gpu.get_features2 = get_features2_khr;
+        if (!gpu.get_features2 && gpu.properties.apiVersion >= VERSION_1_1) gpu.get_features2 = get_features2_core;
         //--Surface caps--
         // VkSurfaceCapabilitiesKHR surface_caps;
         // VKERRCHECK(vkGetPhysicalDeviceSurfaceCapabilitiesKHR(gpu, surface, &surface_caps));
         //----------------
         gpu.extensions.Init(gpu);
         gpu.extensions.Pick(VK_KHR_SWAPCHAIN_EXTENSION_NAME);
+        int marker = gpu.extensions.IndexOf(VK_EXT_DEBUG_MARKER_EXTENSION_NAME);  // Object names for debuggers. (see DebugMarker.h)
+        if (marker > -1) gpu.extensions.Pick((uint32_t)marker);                    // (Usually only present when a debugger is attached.)
+        int timing = gpu.extensions.IndexOf(VK_GOOGLE_DISPLAY_TIMING_EXTENSION_NAME);  // Present-time feedback, for frame pacing.
+        if (timing > -1) gpu.extensions.Pick((uint32_t)timing);
+        int timeline = gpu.extensions.IndexOf(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME);  // Frame counters, for CTimeline.
+        if (timeline > -1 && gpu.get_features2) {                                        // (The feature is enabled via pNext.)
+            gpu.extensions.Pick((uint32_t)timeline);
+            gpu.extended_features.Add<VkPhysicalDeviceTimelineSemaphoreFeaturesKHR>(
+                VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR).timelineSemaphore = VK_TRUE;
+        }
 
         // Get Queue Family properties
         uint family_count = 0;
@@ -100,6 +170,7 @@ CPhysicalDevice* CPhysicalDevices::FindPresentable(VkSurfaceKHR surface) {
 }
 
 void CPhysicalDevices::Print(bool show_queues) {
+    LOG_FLUSH();
     printf("Physical Devices: %d\n", Count());
     for (uint i = 0; i < Count(); ++i) {  // each gpu
         CPhysicalDevice& gpu = gpu_list[i];
@@ -121,15 +192,23 @@ void CPhysicalDevices::Print(bool show_queues) {
 //----------------------------------------------------------------
 
 //-----------------------------CDevice----------------------------
-CQueue* CDevice::AddQueue(VkQueueFlags flags, VkSurfaceKHR surface) {
-    uint f_inx = gpu.FindQueueFamily(flags, surface);                                        // Find correct queue family
-    if (f_inx < 0) { LOGW("Could not create queue with requested properties."); return 0; }  // exit if not found
-    uint max = gpu.queue_families[f_inx].queueCount;                                         // max number of queues
-    uint q_inx = FamilyQueueCount(f_inx);                                                    // count queues from this family
-    if (q_inx == max) { LOGW("No more queues available from this family."); return 0; }      // exit if too many queues
-    CQueue queue = {0, f_inx, q_inx, flags, surface, handle, gpu};                           // create queue
-    queues.push_back(queue);                                                                 // add to queue list
-    Create();                                                                                // create logical device
+// Declare a queue, without creating the logical device yet. Call Create() when all queues are declared.
+CQueue* CDevice::RequestQueue(VkQueueFlags flags, VkSurfaceKHR surface, float priority) {
+    int f_inx = gpu.FindQueueFamily(flags, surface);                                          // Find correct queue family
+    if (f_inx < 0) { LOGW("Could not create queue with requested properties.\n"); return 0; }  // exit if not found
+    CQueue* queue = RequestFamilyQueue(f_inx, priority, surface);
+    if (queue) queue->flags = flags;
+    return queue;
+}
+
+CQueue* CDevice::RequestFamilyQueue(uint family, float priority, VkSurfaceKHR surface) {
+    if (handle) { LOGW("Queues must be requested before the logical device is created.\n"); return 0; }
+    if (family >= gpu.queue_families.size()) { LOGW("Invalid queue family: %d\n", family); return 0; }
+    if (!FreeQueueCount(family)) { LOGW("No more queues available from this family.\n"); return 0; }  // exit if too many queues
+    uint q_inx = FamilyQueueCount(family);                                                          // count queues from this family
+    VkQueueFlags flags = gpu.queue_families[family].queueFlags;
+    CQueue queue = {0, family, q_inx, flags, priority, surface, handle, gpu, &vk, false};           // declare queue
+    queues.push_back(queue);                                                                        // add to queue list
     LOGI("Queue: %d  flags: [ %s%s%s%s]%s\n", q_inx,
          (flags & 1) ? "GRAPHICS " : "", (flags & 2) ? "COMPUTE " : "",
          (flags & 4) ? "TRANSFER " : "", (flags & 8) ? "SPARSE "  : "",
@@ -137,59 +216,108 @@ CQueue* CDevice::AddQueue(VkQueueFlags flags, VkSurfaceKHR surface) {
     return &queues.back();
 }
 
+uint CDevice::FreeQueueCount(uint family) {
+    if (family >= gpu.queue_families.size()) return 0;
+    return gpu.queue_families[family].queueCount - FamilyQueueCount(family);
+}
+
+// Legacy path: Each call re-creates the logical device. Prefer RequestQueue() + Create().
+CQueue* CDevice::AddQueue(VkQueueFlags flags, VkSurfaceKHR surface) {
+    if (handle) {
+        LOGW("AddQueue: Re-creating logical device. (Use RequestQueue + Create instead.)\n");
+        Destroy();
+    }
+    CQueue* queue = RequestQueue(flags, surface);
+    if (queue) Create();
+    return queue;
+}
+
 uint CDevice::FamilyQueueCount(uint family) {
     uint count = 0;
     for (auto& q : queues) if (q.family == family) count++;
     return count;
 }
 
-void CDevice::Create() {
-    if (handle) Destroy();  // destroy old handle
-    std::vector<float> priorities(queues.size(), 0.0f);
+bool CDevice::Create() {
+    if (handle) { LOGW("Logical device was already created.\n"); return true; }
+    if (queues.empty()) LOGW("Creating logical device with no queues.\n");
+    vector<vector<float>> priorities(gpu.queue_families.size());  // per-family, ordered by queue index
+    for (auto& q : queues) priorities[q.family].push_back(q.priority);
     std::vector<VkDeviceQueueCreateInfo> info_list;
     repeat (gpu.queue_families.size()) {
-        uint queue_count = FamilyQueueCount(i);
+        uint queue_count = (uint)priorities[i].size();
         if (queue_count > 0) {
             VkDeviceQueueCreateInfo info = {};
             info.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
             info.queueFamilyIndex = i;
             info.queueCount       = queue_count;
-            info.pQueuePriorities = priorities.data();
+            info.pQueuePriorities = priorities[i].data();
             info_list.push_back(info);
             // LOGI("\t%d x queue_family_%d\n", queue_count, i);
         }
     }
 
-    CDeviceExtensions& extensions = gpu.extensions;
+#ifdef ENABLE_VALIDATION
+    extensions.Print();
+#endif
     VkDeviceCreateInfo device_create_info = {};
     device_create_info.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
     device_create_info.queueCreateInfoCount    = (uint32_t)info_list.size();
     device_create_info.pQueueCreateInfos       = info_list.data();
     device_create_info.enabledExtensionCount   = extensions.PickCount();
     device_create_info.ppEnabledExtensionNames = extensions.PickList();
-    device_create_info.pEnabledFeatures        = &gpu.enabled_features;
-    VKERRCHECK(vkCreateDevice(gpu, &device_create_info, nullptr, &handle));         // create device
-    //for (auto& q : queues) vkGetDeviceQueue(handle, q.family, q.index, &q.handle);  // get queue handles
+    device_create_info.pEnabledFeatures        = &enabled_features;
+
+    //-- Enable only the supported features --
+    VkBool32* req = (VkBool32*)&enabled_features;
+    VkBool32* sup = (VkBool32*)&gpu.features;
+    repeat(sizeof(VkPhysicalDeviceFeatures) / sizeof(VkBool32)) {
+        if (req[i] && !sup[i]) { LOGW("Device feature %d is not supported.\n", i); req[i] = VK_FALSE; }
+    }
+    VkPhysicalDeviceFeatures2KHR features2 = {};
+    if (extended_features.Count()) {
+        CFeatureChain supported = extended_features;
+        if (gpu.QueryFeatures(supported)) {
+            extended_features.Intersect(supported);
+            features2.sType    = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2_KHR;
+            features2.pNext    = extended_features.Head();
+            features2.features = enabled_features;
+            device_create_info.pNext            = &features2;  // features are passed via pNext instead
+            device_create_info.pEnabledFeatures = nullptr;
+        } else {
+            LOGW("vkGetPhysicalDeviceFeatures2 is not available. Extended features were not enabled.\n");
+            extended_features.Intersect(CFeatureChain());  // clear all
+        }
+    }
+    //----------------------------------------
+    VkResult result = vkCreateDevice(gpu, &device_create_info, HostAllocator(), &handle);  // create device
+    VKERRCHECK(result);
+    if (result != VK_SUCCESS) { handle = 0; return false; }
+    vk.Load(handle);  // this device's own dispatch table
+    auto* timeline = extended_features.Get<VkPhysicalDeviceTimelineSemaphoreFeaturesKHR>(
+                         VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR);
+    bool has_timeline = timeline && timeline->timelineSemaphore && extensions.IsPicked(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME);
     for (auto& q : queues) {
-        q.device = handle;
-        vkGetDeviceQueue(handle, q.family, q.index, &q.handle);  // get queue handles
+        q.device   = handle;
+        q.timeline = has_timeline;
+        vk.GetDeviceQueue(handle, q.family, q.index, &q.handle);  // get queue handles
     }
-
+    LOGI("Logical device created\n");
+    return true;
 }
 
 void CDevice::Destroy(){
     if (!handle) return;
-    vkDeviceWaitIdle(handle);
-    vkDestroyDevice(handle, nullptr);
+    vk.DeviceWaitIdle(handle);
+    vk.DestroyDevice(handle, HostAllocator());
+    vk.Unload();
     handle = 0;
 }
 
-CDevice::CDevice(CPhysicalDevice gpu) : handle() {
-    this->gpu = gpu;
+CDevice::CDevice(CPhysicalDevice gpu)
+    : handle(), gpu(gpu), extensions(this->gpu.extensions), enabled_features(this->gpu.enabled_features),
+      extended_features(this->gpu.extended_features) {
     LOGI("Logical Device using GPU: %s\n",gpu.properties.deviceName);
-#ifdef ENABLE_VALIDATION
-    gpu.extensions.Print();
-#endif
 }
 
 CDevice::~CDevice() {
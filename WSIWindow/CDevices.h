@@ -8,6 +8,7 @@
 *   └CPhysicalDevice ----------------------------------> : CDevice
 *     ├VkPhysicalDeviceProperties                          └CQueue[]
 *     ├VkPhysicalDeviceFeatures
+*     ├CFeatureChain              (pNext chain)
 *     ├CDeviceExtensions[]        (Picklist)
 *     └CQueueFamily[]             (array)
 *
@@ -24,10 +25,43 @@
 * Use FindSurfaceFormat() function to find a supported color format for the given window surface.
 * Use FindDepthFormat() function to find a supported depth format.
 *
+* CFeatureChain:
+* --------------
+* A typed pNext chain of extension / Vulkan 1.1+ feature structs. (eg. VkPhysicalDevice16BitStorageFeaturesKHR)
+* Use Add<T>(sType) to append a zeroed struct, and set the features you want to VK_TRUE.
+* CDevice::Create() queries support with vkGetPhysicalDeviceFeatures2, and enables only the available features.
+* Newer structs (descriptor indexing, buffer device address, 8-bit storage) can be added the same way,
+* once their vulkan.h definitions are available.  (VkCompat.h declares the timeline semaphore ones, and
+* VK_KHR_timeline_semaphore is picked and enabled automatically, when available. See CQueue::timeline.)
+*
+* eg:
+*    auto& storage16 = device.extended_features.Add<VkPhysicalDevice16BitStorageFeaturesKHR>(
+*                          VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_16BIT_STORAGE_FEATURES_KHR);
+*    storage16.storageBuffer16BitAccess = VK_TRUE;
+*    device.extensions.Pick(VK_KHR_16BIT_STORAGE_EXTENSION_NAME);
+*    device.Create();
+*    bool ok = !!storage16.storageBuffer16BitAccess;  // VK_FALSE if not supported
+*
 * CDevice:
 * --------
 * Create an instance of CDevice, using the picked CPhysicalDevice as input.
-* Then call the AddQueue() function, to add queues to the logical device.
+* Declare the required queues with RequestQueue(), and pick extensions / features on
+* device.extensions and device.enabled_features, then call Create() once, to create the logical device.
+* (AddQueue() is still available, but re-creates the logical device each time it is called.)
+*
+* eg:
+*    CDevice device(*gpu);
+*    CQueue* graphics = device.RequestQueue(VK_QUEUE_GRAPHICS_BIT, surface, 1.0f);
+*    CQueue* transfer = device.RequestQueue(VK_QUEUE_TRANSFER_BIT);
+*    device.Create();  // creates the VkDevice, and fills in the queue handles.
+*
+* Dispatch table:
+* ---------------
+* Each CDevice loads its own table of device-level functions (CDeviceTable) when it is created.
+* Calling through device.vk skips the loader trampoline, and works for any number of devices,
+* while the global vk* functions work with any device, but may go through the loader.
+*    device.vk.CmdDraw(cmd_buf, 3, 1, 0, 0);
+*    queue->vk->QueueSubmit(*queue, 1, &submit_info, fence);
 *
 */
 
@@ -36,7 +70,35 @@
 
 #include "CInstance.h"
 #include "WindowImpl.h"
+#include "CDeviceTable.h"
+#include "VkCompat.h"  // extensions newer than the bundled vulkan.h
+#include <deque>
+
+//-------------------------CFeatureChain--------------------------
+class CFeatureChain {
+    struct CHeader { VkStructureType sType; void* pNext; };  // common header of all feature structs
+    vector<vector<uint64_t>> nodes;                          // struct storage (8-byte aligned)
+    vector<size_t>           sizes;                          // struct sizes, in bytes
+    void  Link();                                            // Re-link pNext pointers
+    void* Append(VkStructureType sType, size_t size);
+    void* Find(VkStructureType sType) const;
 
+  public:
+    CFeatureChain() {}
+    CFeatureChain(const CFeatureChain& other) : nodes(other.nodes), sizes(other.sizes) { Link(); }
+    CFeatureChain& operator=(const CFeatureChain& other);
+
+    template <typename T> T& Add(VkStructureType sType) {  // Returns existing struct of this type, or appends a zeroed one.
+        void* node = Find(sType);
+        return *(T*)(node ? node : Append(sType, sizeof(T)));
+    }
+    template <typename T> T* Get(VkStructureType sType) const { return (T*)Find(sType); }
+    void*    Head() const { return nodes.empty() ? nullptr : (void*)nodes[0].data(); }  // For pNext
+    uint32_t Count() const { return (uint32_t)nodes.size(); }
+    uint32_t Intersect(const CFeatureChain& supported);  // Clears unsupported features. Returns number cleared.
+    void     Clear() { nodes.clear(); sizes.clear(); }
+};
+//----------------------------------------------------------------
 //------------------------CPhysicalDevice-------------------------
 class CPhysicalDevice {
   public:
@@ -50,12 +112,15 @@ class CPhysicalDevice {
     // VkSurfaceCapabilitiesKHR   surface_caps;
     // -- Configurable properties --
     CDeviceExtensions        extensions;             // picklist: select extensions to load (Defaults to "VK_KHR_swapchain" only.)
-    VkPhysicalDeviceFeatures enabled_features = {};  // Set required features.   TODO: finish this.
+    VkPhysicalDeviceFeatures enabled_features = {};  // Set required features. (Unsupported ones are dropped.)
+    CFeatureChain            extended_features;      // Set required extension / 1.1+ features. (pNext chain)
+    PFN_vkGetPhysicalDeviceFeatures2KHR get_features2 = 0;  // 0 if neither Vulkan 1.1 nor VK_KHR_get_physical_device_properties2
 
     operator VkPhysicalDevice() const { return handle; }
-    int FindQueueFamily(VkQueueFlags flags, VkSurfaceKHR surface = 0);  // Returns a QueueFamlyIndex, or -1 if none found.
+    bool QueryFeatures(CFeatureChain& chain) const;  // Fill chain with supported features. Returns false if unavailable.
+    int FindQueueFamily(VkQueueFlags flags, VkSurfaceKHR surface = 0);  // Returns a QueueFamlyIndex, or -1 if none found. (cached)
 
-    std::vector<VkSurfaceFormatKHR> SurfaceFormats(VkSurfaceKHR surface);     // Returns list of supported surface formats.
+    const std::vector<VkSurfaceFormatKHR>& SurfaceFormats(VkSurfaceKHR surface);  // Returns list of supported surface formats. (cached)
     VkFormat FindSurfaceFormat(VkSurfaceKHR surface,                          // Returns first supported format from given list,
         std::vector<VkFormat> preferred_formats = {VK_FORMAT_B8G8R8A8_UNORM,  // or VK_FORMAT_UNDEFINED if no match was found.
                                                    VK_FORMAT_R8G8B8A8_UNORM});
@@ -72,7 +137,8 @@ class CPhysicalDevices {
     vector<CPhysicalDevice> gpu_list;
 
    public:
-    CPhysicalDevices(const VkInstance instance);
+    CPhysicalDevices(const VkInstance instance, uint32_t api_version = VK_API_VERSION_1_0);  // api_version: as negotiated by the instance
+    CPhysicalDevices(const CInstance& instance) : CPhysicalDevices(instance, instance.ApiVersion()) {}
     uint32_t Count() { return (uint32_t)gpu_list.size(); }
     CPhysicalDevice* FindPresentable(VkSurfaceKHR surface);  // Returns first device able to present to surface, or null if none.
     CPhysicalDevice& operator[](const int i) { return gpu_list[i]; }
@@ -85,9 +151,12 @@ struct CQueue{
     uint            family;   // queue family
     uint            index;    // queue index
     VkQueueFlags    flags;    // Graphics / Compute / Transfer / Sparse / Protected
+    float           priority; // 0.0 - 1.0
     VkSurfaceKHR    surface;  // 0 if queue can not present
     VkDevice        device;   // (used by CSwapchain)
     CPhysicalDevice gpu;      // (used by CSwapchain)
+    const CDeviceTable* vk;   // dispatch table of the device (used by CSwapchain)
+    bool            timeline; // VK_KHR_timeline_semaphore is enabled on the device (used by CTimeline)
 
     operator VkQueue() const { return handle; }
 };
@@ -97,15 +166,27 @@ class CDevice {
     //friend class CSwapchain;
     VkDevice        handle;
     CPhysicalDevice gpu;
-    vector<CQueue>  queues;
+    deque<CQueue>   queues;  // deque: CQueue pointers stay valid when more queues are added
     uint FamilyQueueCount(uint family);
-    void Create();
     void Destroy();
 
    public:
     CDevice(CPhysicalDevice gpu);
     ~CDevice();
-    CQueue* AddQueue(VkQueueFlags flags, VkSurfaceKHR surface = 0);  // returns 0 if failed
+    CDevice(const CDevice&) = delete;             // The references below point into this object's own gpu copy,
+    CDevice& operator=(const CDevice&) = delete;  // and the VkDevice must only be destroyed once.
+    CDeviceExtensions&        extensions;         // picklist: select device extensions before calling Create()
+    VkPhysicalDeviceFeatures& enabled_features;   // set required features before calling Create()
+    CFeatureChain&            extended_features;  // set required extension / 1.1+ features before calling Create()
+    CDeviceTable              vk;                 // device-level functions of this device. eg: device.vk.CmdDraw(...)
+
+    CQueue* RequestQueue(VkQueueFlags flags, VkSurfaceKHR surface = 0, float priority = 0.0f);  // Declare queue. returns 0 if failed
+    CQueue* RequestFamilyQueue(uint family, float priority = 0.0f, VkSurfaceKHR surface = 0);   // Declare queue from given family.
+    uint    FreeQueueCount(uint family);                                                       // Queues not yet requested from family
+    bool    Create();                                                                        // Create the logical device, once.
+    CQueue* AddQueue(VkQueueFlags flags, VkSurfaceKHR surface = 0);  // RequestQueue + Create. (Re-creates device each time.)
+    bool    IsCreated() const { return !!handle; }
+    const CPhysicalDevice& GPU() const { return gpu; }
     operator VkDevice() const { return handle; }
 };
 //----------------------------------------------------------------
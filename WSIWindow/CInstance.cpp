@@ -65,6 +65,7 @@ char** CPickList::PickList()    const { return (char**)  pick_list.data(); }
 uint32_t CPickList::PickCount() const { return (uint32_t)pick_list.size(); }
 
 void CPickList::Print(const char* listName) {
+    LOG_FLUSH();
     printf("%s picked: %d of %d\n", listName, PickCount(), Count());
     repeat(Count()) {
         bool picked = false;
@@ -122,7 +123,7 @@ void CDeviceExtensions::Init(VkPhysicalDevice phy, const char* layer_name) {
 //----------------------------------------------------------------
 
 //---------------------------CInstance----------------------------
-CInstance::CInstance(const bool enable_validation, const char* app_name, const char* engine_name) {
+CInstance::CInstance(const bool enable_validation, const char* app_name, const char* engine_name, uint32_t api_version) {
     CLayers layers;
 #ifdef ENABLE_VALIDATION
     // clang-format off
@@ -153,19 +154,45 @@ CInstance::CInstance(const bool enable_validation, const char* app_name, const c
 #endif
     } else LOGE("Failed to load VK_KHR_Surface");
 
+    // Needed for the pNext feature chain on 1.0 instances. (Core in 1.1)
+    if (extensions.IndexOf(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME) >= 0)
+        extensions.Pick(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME);
+
 #ifdef ENABLE_VALIDATION
     extensions.Pick(VK_EXT_DEBUG_REPORT_EXTENSION_NAME);  // in Debug mode, Enable Validation
     extensions.Print();
 #endif
     assert(extensions.PickCount() >= 2);
-    Create(layers, extensions, app_name, engine_name);
+    Create(layers, extensions, app_name, engine_name, api_version);
+}
+
+CInstance::CInstance(const CLayers& layers, const CExtensions& extensions, const char* app_name, const char* engine_name,
+                     uint32_t api_version) {
+    Create(layers, extensions, app_name, engine_name, api_version);
 }
 
-CInstance::CInstance(const CLayers& layers, const CExtensions& extensions, const char* app_name, const char* engine_name) {
-    Create(layers, extensions, app_name, engine_name);
+// vkEnumerateInstanceVersion only exists in 1.1+ loaders, so it is fetched at runtime.
+uint32_t CInstance::LoaderVersion() {
+    typedef VkResult (VKAPI_PTR *PFN_EnumerateInstanceVersion)(uint32_t* pApiVersion);
+    auto enumerate_version = (PFN_EnumerateInstanceVersion)vkGetInstanceProcAddr(NULL, "vkEnumerateInstanceVersion");
+    uint32_t version = VK_API_VERSION_1_0;
+    if (enumerate_version) VKERRCHECK(enumerate_version(&version));
+    return version;
 }
 
-void CInstance::Create(const CLayers& layers, const CExtensions& extensions, const char* app_name, const char* engine_name) {
+void CInstance::Create(const CLayers& layers, const CExtensions& extensions, const char* app_name, const char* engine_name,
+                       uint32_t requested_version) {
+#ifdef VK_NO_PROTOTYPES
+    bool success = (InitVulkan() == 1);  // Load the Vulkan library, if not loaded yet.
+    LOG_FLUSH();
+    printf("Initialize Vulkan: ");
+    print(success ? eGREEN : eRED, success ? "SUCCESS\n" : "FAILED (Vulkan driver not found.)\n");
+#endif
+    // Negotiate api version: 1.0 loaders fail with VK_ERROR_INCOMPATIBLE_DRIVER, if a higher version is requested.
+    uint32_t loader_version = LoaderVersion();
+    api_version = VK_MAKE_VERSION(1, VK_VERSION_MINOR(requested_version), 0);
+    if (api_version > loader_version) api_version = VK_MAKE_VERSION(1, VK_VERSION_MINOR(loader_version), 0);
+
     // initialize the VkApplicationInfo structure
     VkApplicationInfo app_info  = {};
     app_info.sType              = VK_STRUCTURE_TYPE_APPLICATION_INFO;
@@ -174,7 +201,7 @@ void CInstance::Create(const CLayers& layers, const CExtensions& extensions, con
     app_info.applicationVersion = 1;
     app_info.pEngineName        = engine_name;
     app_info.engineVersion      = 1;
-    app_info.apiVersion         = VK_API_VERSION_1_0;
+    app_info.apiVersion         = api_version;
 
     // initialize the VkInstanceCreateInfo structure
     VkInstanceCreateInfo inst_info    = {};
@@ -187,21 +214,26 @@ void CInstance::Create(const CLayers& layers, const CExtensions& extensions, con
     inst_info.enabledLayerCount       = layers.PickCount();
     inst_info.ppEnabledLayerNames     = layers.PickList();
 
-    VKERRCHECK(vkCreateInstance(&inst_info, NULL, &instance));
-    LOGI("Vulkan Instance created\n");
+    VKERRCHECK(vkCreateInstance(&inst_info, HostAllocator(), &instance));
+#ifdef VK_NO_PROTOTYPES
+    InitVulkanInstance(instance);  // Bypass the loader trampolines for instance-level calls.
+#endif
+    LOGI("Vulkan Instance created (API %d.%d)\n", VK_VERSION_MAJOR(api_version), VK_VERSION_MINOR(api_version));
 #ifdef ENABLE_VALIDATION
     if (extensions.IsPicked(VK_EXT_DEBUG_REPORT_EXTENSION_NAME))
         DebugReport.Init(instance);  // If VK_EXT_debug_report is loaded, initialize it.
 #endif
 }
 
-void CInstance::Print() { printf("->Instance %s created.\n", (!!instance) ? "" : "NOT"); }
+void CInstance::Print() { LOG_FLUSH(); printf("->Instance %s created.\n", (!!instance) ? "" : "NOT"); }
 
 CInstance::~CInstance() {
+    PrintVkResultStats();
 #ifdef ENABLE_VALIDATION
+    DebugReport.PrintSummary();
     DebugReport.Destroy();  // Must be called BEFORE vkDestroyInstance()
 #endif
-    vkDestroyInstance(instance, NULL);
+    vkDestroyInstance(instance, HostAllocator());
     LOGI("Vulkan Instance destroyed\n");
 }
 
@@ -26,6 +26,9 @@
 * At CInstance creation time, you can override which extensions and layers get loaded,
 * by passing in your own list, or CLayers and CExtensions to the CInstance constructor.
 *
+* The api_version parameter is the highest Vulkan version the application wants to use.
+* It is negotiated down to what the loader supports. (Use ApiVersion() to get the result.)
+*
 *
 * -------Vars defined by CMAKE:-------
 *  #define VK_USE_PLATFORM_WIN32_KHR    // On Windows
@@ -39,6 +42,7 @@
 #define CINSTANCE_H
 
 #include "Validation.h"
+#include "CAllocator.h"
 #include <assert.h>
 #include <string.h>
 #include <string>
@@ -50,6 +54,13 @@ typedef unsigned int uint;
 
 //---------------------------Macros-------------------------------
 #define repeat(COUNT) for (uint32_t i = 0; i < COUNT; ++i)
+
+#ifndef VK_API_VERSION_1_1                                // Newer versions are not in the bundled vulkan.h,
+#define VK_API_VERSION_1_1 VK_MAKE_VERSION(1, 1, 0)       // but may still be negotiated with newer loaders.
+#endif
+#ifndef VK_API_VERSION_1_2
+#define VK_API_VERSION_1_2 VK_MAKE_VERSION(1, 2, 0)
+#endif
 //----------------------------------------------------------------
 // clang-format off
 //--------------------------CPickList-----------------------------
@@ -106,11 +117,18 @@ struct CDeviceExtensions : public CPickList {
 //---------------------------CInstance----------------------------
 class CInstance {
     VkInstance instance;
-    void Create(const CLayers& layers, const CExtensions& extensions, const char* app_name, const char* engine_name);
+    uint32_t   api_version;  // negotiated api version
+    void Create(const CLayers& layers, const CExtensions& extensions, const char* app_name, const char* engine_name,
+                uint32_t api_version);
 
   public:
-    CInstance(const CLayers& layers, const CExtensions& extensions, const char* app_name = "VulkanApp", const char* engine_name = "");
-    CInstance(const bool enable_validation = true, const char* app_name = "VulkanApp", const char* engine_name = "");
+    CInstance(const CLayers& layers, const CExtensions& extensions, const char* app_name = "VulkanApp", const char* engine_name = "",
+              uint32_t api_version = VK_API_VERSION_1_0);
+    CInstance(const bool enable_validation = true, const char* app_name = "VulkanApp", const char* engine_name = "",
+              uint32_t api_version = VK_API_VERSION_1_0);
+
+    static uint32_t LoaderVersion();        // Highest version supported by the loader. (1.0 loaders return VK_API_VERSION_1_0)
+    uint32_t ApiVersion() const { return api_version; }
 
     ~CInstance();
     // CLayers     layers;
@@ -0,0 +1,316 @@
+// Copyright (c) 2017 Rene Lindsay
+
+#include "CLogger.h"
+
+#ifdef ENABLE_ASYNC_LOGGING
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+//-----------------------------CArgs------------------------------
+void CLogger::CArgs::Put(char type, uint8_t size, uint64_t bits) {
+    if (pos + 10 > end) return;  // record is full: drop the argument
+    pos[0] = type;
+    pos[1] = (char)size;
+    memcpy(pos + 2, &bits, 8);
+    pos += 10;
+}
+
+void CLogger::CArgs::String(const char* str) {
+    if (!str) return Put('p', sizeof(void*), 0);  // printed as "(null)"
+    if (pos + 5 > end) return;
+    size_t len = strlen(str);
+    size_t max = end - pos - 5;
+    if (len > max) len = max;  // truncate
+    uint16_t len16 = (uint16_t)len;
+    pos[0] = 's';
+    pos[1] = 0;
+    memcpy(pos + 2, &len16, 2);
+    memcpy(pos + 4, str, len);
+    pos[4 + len] = 0;
+    pos += 5 + len;
+}
+//----------------------------------------------------------------
+
+//-----------------------------Format-----------------------------
+// Formats a record's packed arguments, using its printf format string.
+// Each conversion is printed with snprintf, after rewriting its length-modifier to match the packed type.
+struct CArg {
+    char        type;  // 'i'=signed int, 'u'=unsigned int, 'f'=double, 'p'=pointer, 's'=string, 0=missing
+    uint8_t     size;
+    uint64_t    bits;
+    const char* str;
+};
+
+static CArg NextArg(const char*& args, const char* end) {
+    CArg arg = {};
+    if (args >= end) return arg;
+    arg.type = args[0];
+    arg.size = (uint8_t)args[1];
+    if (arg.type == 's') {
+        uint16_t len;
+        memcpy(&len, args + 2, 2);
+        arg.str = args + 4;
+        args += 5 + len;
+    } else {
+        memcpy(&arg.bits, args + 2, 8);
+        args += 10;
+    }
+    return arg;
+}
+
+static int64_t AsSigned(const CArg& arg) {    // Sign-extend from the promoted (at least int) size.
+    if (arg.type == 'f') { double d; memcpy(&d, &arg.bits, 8); return (int64_t)d; }
+    uint32_t size = arg.size < 4 ? 4 : arg.size;
+    if (size >= 8) return (int64_t)arg.bits;
+    return (int64_t)(int32_t)(uint32_t)arg.bits;
+}
+
+static uint64_t AsUnsigned(const CArg& arg) {  // Truncate to the promoted (at least int) size.
+    if (arg.type == 'f') { double d; memcpy(&d, &arg.bits, 8); return (uint64_t)d; }
+    uint32_t size = arg.size < 4 ? 4 : arg.size;
+    if (size >= 8) return arg.bits;
+    return (uint32_t)arg.bits;
+}
+
+static double AsDouble(const CArg& arg) {
+    if (arg.type == 'f') { double d; memcpy(&d, &arg.bits, 8); return d; }
+    return (arg.type == 'i') ? (double)AsSigned(arg) : (double)AsUnsigned(arg);
+}
+
+static void Format(char* out, size_t cap, const char* format, const char* args, const char* end) {
+    size_t len = 0;
+    auto append = [&](const char* str, size_t n) {
+        if (len + n >= cap) n = cap - 1 - len;
+        memcpy(out + len, str, n);
+        len += n;
+    };
+    const char* f = format;
+    while (*f && len < cap - 1) {
+        if (*f != '%') { append(f++, 1); continue; }
+        const char* start = f++;
+        if (*f == '%') { append(f++, 1); continue; }
+
+        char spec[32];  // the conversion, rewritten for snprintf
+        size_t s = 0;
+        spec[s++] = '%';
+        while (*f && strchr("-+ #0'", *f) && s < 8) spec[s++] = *f++;           // flags
+        if (*f == '*') { s += snprintf(spec + s, 12, "%d", (int)AsSigned(NextArg(args, end))); f++; }
+        else while (*f >= '0' && *f <= '9' && s < 16) spec[s++] = *f++;          // width
+        if (*f == '.') {                                                          // precision
+            spec[s++] = *f++;
+            if (*f == '*') { s += snprintf(spec + s, 12, "%d", (int)AsSigned(NextArg(args, end))); f++; }
+            else while (*f >= '0' && *f <= '9' && s < 28) spec[s++] = *f++;
+        }
+        while (*f && strchr("hljztLq", *f)) f++;                                 // length (replaced below)
+        char conv = *f;
+        if (!conv) break;
+        f++;
+
+        CArg arg = NextArg(args, end);
+        if (!arg.type) { append(start, f - start); continue; }  // missing argument: print the spec as is
+
+        char buf[512];
+        int n = 0;
+        switch (conv) {
+            case 'd': case 'i':
+                spec[s++] = 'l'; spec[s++] = 'l'; spec[s++] = conv; spec[s] = 0;
+                n = snprintf(buf, sizeof(buf), spec, (long long)AsSigned(arg));
+                break;
+            case 'u': case 'o': case 'x': case 'X':
+                spec[s++] = 'l'; spec[s++] = 'l'; spec[s++] = conv; spec[s] = 0;
+                n = snprintf(buf, sizeof(buf), spec, (unsigned long long)AsUnsigned(arg));
+                break;
+            case 'c':
+                spec[s++] = conv; spec[s] = 0;
+                n = snprintf(buf, sizeof(buf), spec, (int)AsSigned(arg));
+                break;
+            case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+                spec[s++] = conv; spec[s] = 0;
+                n = snprintf(buf, sizeof(buf), spec, AsDouble(arg));
+                break;
+            case 's':
+                spec[s++] = conv; spec[s] = 0;
+                n = snprintf(buf, sizeof(buf), spec, (arg.type == 's') ? arg.str : "(null)");
+                break;
+            case 'p':
+                spec[s++] = conv; spec[s] = 0;
+                n = snprintf(buf, sizeof(buf), spec, (void*)(uintptr_t)arg.bits);
+                break;
+            default:  // unknown conversion (or %n): print the spec as is
+                append(start, f - start);
+                continue;
+        }
+        if (n > 0) append(buf, (n < (int)sizeof(buf)) ? n : sizeof(buf) - 1);
+    }
+    out[len] = 0;
+}
+
+static void Print(const CLogger::CRecord& rec, const char* args) {  // args: the packed arguments, following the header
+    char line[4096];
+    Format(line, sizeof(line), rec.format, args, args + rec.size - sizeof(rec));
+    if (rec.prefix[0]) {
+        color((eColor)rec.color);
+        fputs(rec.prefix, stdout);
+        color(eRESET);
+    }
+    fputs(line, stdout);
+}
+//----------------------------------------------------------------
+
+//-----------------------------CRing------------------------------
+// Single-producer / single-consumer byte ring. The owning thread writes; the logger thread reads.
+struct CRing {
+    std::atomic<uint64_t> head;   // write position (bytes written)
+    std::atomic<uint64_t> tail;   // read position (bytes consumed)
+    std::atomic<bool>     owned;  // A thread is using this ring. (Cleared on thread exit, so it can be reused.)
+    CRing*                next;   // next ring in the logger's list
+    char                  data[CLogger::RING_SIZE];
+
+    CRing() : head(0), tail(0), owned(true), next(nullptr) {}
+
+    void Copy(uint64_t pos, const char* src, uint32_t size) {  // copy into the ring, with wrap-around
+        uint32_t at    = (uint32_t)(pos % CLogger::RING_SIZE);
+        uint32_t first = CLogger::RING_SIZE - at;
+        if (first > size) first = size;
+        memcpy(data + at, src, first);
+        memcpy(data, src + first, size - first);
+    }
+
+    void Read(uint64_t pos, char* dst, uint32_t size) const {  // copy out of the ring, with wrap-around
+        uint32_t at    = (uint32_t)(pos % CLogger::RING_SIZE);
+        uint32_t first = CLogger::RING_SIZE - at;
+        if (first > size) first = size;
+        memcpy(dst, data + at, first);
+        memcpy(dst + first, data, size - first);
+    }
+};
+//----------------------------------------------------------------
+
+//-----------------------------Logger-----------------------------
+static std::atomic<bool> logger_closed(false);  // Set at exit. Then Commit() prints synchronously. (read by any thread)
+
+class CLoggerThread {
+    std::atomic<CRing*>   rings;     // lock-free list of all rings. (Rings are reused, never removed. See CRingOwner.)
+    std::atomic<uint64_t> next_seq;  // sequence number of the next record
+    std::atomic<uint64_t> printed;   // number of records printed
+    std::atomic<bool>     stop;
+    std::thread           thread;
+    uint64_t              expected;  // seq of the next record to print. (logger thread only)
+
+    // Print the oldest record from all rings. Returns false if there is nothing to print yet.
+    // A record's seq is taken before it is published, so a newer record may show up first.
+    // If in_order is set, records are held back until the expected seq is published too.
+    bool PrintNext(bool in_order) {
+        CRing* oldest = nullptr;
+        CLogger::CRecord rec = {};
+        for (CRing* ring = rings.load(std::memory_order_acquire); ring; ring = ring->next) {
+            uint64_t tail = ring->tail.load(std::memory_order_relaxed);
+            if (tail == ring->head.load(std::memory_order_acquire)) continue;
+            CLogger::CRecord hdr;
+            ring->Read(tail, (char*)&hdr, sizeof(hdr));
+            if (!oldest || hdr.seq < rec.seq) { oldest = ring; rec = hdr; }
+        }
+        if (!oldest) return false;
+        if (in_order && rec.seq != expected) return false;  // An older record is still being written.
+        expected = rec.seq + 1;
+
+        char record[CLogger::RECORD_SIZE];
+        uint64_t tail = oldest->tail.load(std::memory_order_relaxed);
+        oldest->Read(tail, record, rec.size);
+        oldest->tail.store(tail + rec.size, std::memory_order_release);
+        Print(rec, record + sizeof(rec));
+        return true;
+    }
+
+    void Run() {
+        while (true) {
+            bool stopping = stop.load();  // At exit, print what is left, even if a writer never finished.
+            uint64_t count = 0;
+            while (PrintNext(!stopping)) count++;
+            if (count) {
+                fflush(stdout);
+                printed.fetch_add(count, std::memory_order_release);
+            } else if (stopping) {
+                break;
+            } else {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+    }
+
+  public:
+    CLoggerThread() : rings(nullptr), next_seq(0), printed(0), stop(false), expected(0) { thread = std::thread(&CLoggerThread::Run, this); }
+
+    ~CLoggerThread() {  // Print all remaining records, then switch to synchronous printing.
+        stop.store(true);
+        thread.join();
+        logger_closed.store(true, std::memory_order_release);  // (after the join: all records were printed)
+        // Rings are not freed, since detached threads may still own them.
+    }
+
+    CRing* NewRing() {
+        for (CRing* ring = rings.load(std::memory_order_acquire); ring; ring = ring->next) {  // Reuse a ring from an exited thread.
+            bool owned = false;
+            if (ring->owned.compare_exchange_strong(owned, true)) return ring;
+        }
+        CRing* ring = new CRing();
+        ring->next  = rings.load(std::memory_order_relaxed);
+        while (!rings.compare_exchange_weak(ring->next, ring, std::memory_order_release)) {}
+        return ring;
+    }
+
+    uint64_t NextSeq() { return next_seq.fetch_add(1, std::memory_order_relaxed); }
+
+    void Flush() {
+        uint64_t target = next_seq.load(std::memory_order_relaxed);
+        while (printed.load(std::memory_order_acquire) < target) std::this_thread::yield();
+    }
+};
+
+static CLoggerThread& Logger() {  // Started by the first LOG* call.
+    static CLoggerThread logger;
+    return logger;
+}
+
+struct CRingOwner {  // Gives each thread its own ring, and releases it on thread exit, for NewRing() to reuse.
+    CRing* ring;
+    CRingOwner() : ring(Logger().NewRing()) {}
+    ~CRingOwner() { ring->owned.store(false); }
+};
+//----------------------------------------------------------------
+
+void CLogger::Commit(char* record, uint32_t size, eColor color, const char* prefix, const char* format) {
+    CRecord rec;
+    rec.prefix = prefix;
+    rec.format = format;
+    rec.size   = (uint16_t)size;
+    rec.color  = (uint8_t)color;
+
+    if (logger_closed.load(std::memory_order_acquire)) {  // after exit: print synchronously
+        rec.seq = 0;
+        memcpy(record, &rec, sizeof(rec));
+        Print(rec, record + sizeof(rec));
+        return;
+    }
+
+    static thread_local CRingOwner owner;
+    CRing* ring    = owner.ring;
+    uint64_t head  = ring->head.load(std::memory_order_relaxed);
+    while (head + size - ring->tail.load(std::memory_order_acquire) > RING_SIZE) std::this_thread::yield();  // ring is full
+
+    rec.seq = Logger().NextSeq();  // (After the wait: newer records are held back, until this one is published.)
+    memcpy(record, &rec, sizeof(rec));
+    ring->Copy(head, record, size);
+    ring->head.store(head + size, std::memory_order_release);
+
+    if (color == eRED) Flush();  // Make sure errors are printed, before an assert or crash.
+}
+
+void CLogger::Flush() {
+    if (!logger_closed.load(std::memory_order_acquire)) Logger().Flush();
+}
+
+#endif  // ENABLE_ASYNC_LOGGING
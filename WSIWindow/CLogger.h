@@ -0,0 +1,90 @@
+// Copyright (c) 2017 Rene Lindsay
+
+/*
+*  CLogger is an asynchronous backend for the LOG* macros. (Enabled by the ENABLE_ASYNC_LOGGING CMake option)
+*
+*  Instead of formatting and printing on the calling thread, each LOG* call packs its format-string pointer
+*  and arguments into a binary record, in a lock-free ring buffer owned by the calling thread.  A background
+*  thread merges the rings in call order, then formats, colors and prints each line, so render and worker
+*  threads never wait for the terminal, and lines from different threads don't get mixed up.
+*
+*  - Format strings must be string literals, (as in all LOG* calls) since only their pointer is stored.
+*  - String arguments are copied, so temporary strings are fine.  Records longer than RECORD_SIZE are truncated.
+*  - LOGE messages are flushed before LOGE returns, so they are not lost if the app then asserts or crashes.
+*  - Plain printf output is not ordered with LOG* output.  Call LOG_FLUSH() first, if order matters.
+*    (The print() macro does this for you.)
+*  - If a thread's ring is full, that thread waits for the background thread to catch up.
+*
+*  eg:
+*    LOGI("Queue %d of %d created\n", i, count);  // Just use the LOG* macros as before.
+*    LOG_FLUSH();                                  // Wait until all LOG* messages so far are printed,
+*    printf("Swapchain:\n");                       // so this line is printed after them.
+*/
+
+#ifndef CLOGGER_H
+#define CLOGGER_H
+
+#include "Validation.h"  // for eColor
+#include <stdint.h>
+#include <string.h>
+#include <cstddef>
+#include <type_traits>
+
+//----------------------------CLogger-----------------------------
+class CLogger {
+  public:
+    static const uint32_t RING_SIZE   = 64 * 1024;  // bytes per thread (power of 2)
+    static const uint32_t RECORD_SIZE = 2048;       // max bytes per record, including copied strings
+
+    struct CRecord {         // record header. Packed arguments follow it in the ring.
+        uint64_t    seq;     // global call order
+        const char* prefix;  // "INFO : " etc.
+        const char* format;  // printf format (string literal)
+        uint16_t    size;    // size of the record, including this header
+        uint8_t     color;   // eColor of the prefix
+    };
+
+    class CArgs {  // Packs printf arguments as: type, size, value (or length + chars, for strings)
+        char* pos;
+        char* end;
+        void Put(char type, uint8_t size, uint64_t bits);
+        void String(const char* str);
+
+      public:
+        CArgs(char* begin, char* end) : pos(begin), end(end) {}
+        char* End() const { return pos; }
+
+        void Add(const char* str)  { String(str); }
+        void Add(char* str)        { String(str); }
+        void Add(std::nullptr_t)   { Put('p', sizeof(void*), 0); }
+        void Add(float  value)     { Add((double)value); }
+        void Add(long double value){ Add((double)value); }
+        void Add(double value)     { uint64_t bits; memcpy(&bits, &value, 8); Put('f', 8, bits); }
+        template <typename T> void Add(T* ptr) { Put('p', sizeof(void*), (uint64_t)(uintptr_t)ptr); }
+        template <typename T> void Add(T value) {
+            static_assert(std::is_integral<T>::value || std::is_enum<T>::value, "LOG*: unsupported argument type");
+            Put(std::is_signed<T>::value ? 'i' : 'u', sizeof(T), (uint64_t)value);
+        }
+    };
+
+    template <typename... ARGS>
+    static void Write(eColor color, const char* prefix, const char* format, ARGS... args) {
+        char record[RECORD_SIZE];
+        CArgs packer(record + sizeof(CRecord), record + RECORD_SIZE);
+        Pack(packer, args...);
+        Commit(record, (uint32_t)(packer.End() - record), color, prefix, format);
+    }
+
+    static void Flush();  // Wait until all LOG* messages written so far are printed.
+
+  private:
+    static void Pack(CArgs& packer) {}
+    template <typename T, typename... ARGS> static void Pack(CArgs& packer, T arg, ARGS... args) {
+        packer.Add(arg);
+        Pack(packer, args...);
+    }
+    static void Commit(char* record, uint32_t size, eColor color, const char* prefix, const char* format);
+};
+//----------------------------------------------------------------
+
+#endif
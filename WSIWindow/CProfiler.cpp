@@ -0,0 +1,117 @@
+// Copyright (c) 2017 Rene Lindsay
+
+#include "CProfiler.h"
+
+#ifdef ENABLE_PROFILER
+
+#include "Validation.h"
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <vector>
+#include <stdarg.h>
+#include <string.h>
+
+//---------------------------CZoneRing----------------------------
+struct CZone {
+    const char* name;
+    uint64_t    begin;  // ns
+    uint64_t    end;    // ns
+};
+
+struct CZoneRing {  // Written only by its owning thread. Read by Save().
+    std::atomic<uint64_t> head;   // number of zones recorded
+    std::atomic<bool>     owned;  // A thread is using this ring. (Cleared on thread exit, so it can be reused.)
+    uint32_t              tid;
+    char                  name[32];
+    CZone                 zones[CProfiler::RING_SIZE];
+};
+
+static std::mutex              rings_lock;  // only locked when a thread records its first zone, and by Save()
+static std::vector<CZoneRing*> rings;       // Rings are never freed, so zones of exited threads can still be saved.
+
+struct CZoneRingOwner {  // Gives each thread its own ring, and releases it on thread exit.
+    CZoneRing* ring;
+    CZoneRingOwner() {
+        std::lock_guard<std::mutex> guard(rings_lock);
+        for (CZoneRing* r : rings) {  // Reuse the ring of an exited thread.
+            bool owned = false;
+            if (r->owned.compare_exchange_strong(owned, true)) { ring = r; return; }
+        }
+        ring = new CZoneRing();
+        ring->head  = 0;
+        ring->owned = true;
+        ring->tid   = (uint32_t)rings.size();
+        snprintf(ring->name, sizeof(ring->name), "Thread %d", ring->tid);
+        rings.push_back(ring);
+    }
+    ~CZoneRingOwner() { ring->owned = false; }
+};
+
+static CZoneRing* ThreadRing() {
+    static thread_local CZoneRingOwner owner;
+    return owner.ring;
+}
+//----------------------------------------------------------------
+
+//---------------------------CProfiler----------------------------
+uint64_t CProfiler::Now() {
+    static const auto start = std::chrono::steady_clock::now();
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+void CProfiler::Record(const char* name, uint64_t begin, uint64_t end) {
+    CZoneRing* ring = ThreadRing();
+    uint64_t   head = ring->head.load(std::memory_order_relaxed);
+    ring->zones[head & (RING_SIZE - 1)] = {name, begin, end};  // overwrites the oldest zone, when full
+    ring->head.store(head + 1, std::memory_order_release);
+}
+
+void CProfiler::NameThread(const char* format, ...) {
+    CZoneRing* ring = ThreadRing();
+    va_list args;
+    va_start(args, format);
+    vsnprintf(ring->name, sizeof(ring->name), format, args);
+    va_end(args);
+}
+
+static void WriteString(FILE* file, const char* str) {  // JSON string, with quotes and escapes
+    fputc('"', file);
+    for (const char* c = str; *c; ++c) {
+        if (*c == '"' || *c == '\\') fputc('\\', file);
+        if ((unsigned char)*c >= ' ') fputc(*c, file);
+    }
+    fputc('"', file);
+}
+
+bool CProfiler::Save(const char* filename) {
+    FILE* file = fopen(filename, "w");
+    if (!file) { LOGE("Profiler: Can't create file: %s\n", filename); return false; }
+
+    std::lock_guard<std::mutex> guard(rings_lock);
+    uint64_t count = 0;
+    fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    for (CZoneRing* ring : rings) {
+        fprintf(file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":", count++ ? ",\n" : "", ring->tid);
+        WriteString(file, ring->name);
+        fprintf(file, "}}");
+
+        uint64_t head  = ring->head.load(std::memory_order_acquire);
+        uint64_t first = (head > RING_SIZE) ? head - RING_SIZE : 0;
+        for (uint64_t i = first; i < head; ++i) {
+            const CZone& zone = ring->zones[i & (RING_SIZE - 1)];
+            fprintf(file, ",\n{\"name\":");
+            WriteString(file, zone.name);
+            fprintf(file, ",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}", ring->tid,
+                    zone.begin / 1000.0, (zone.end - zone.begin) / 1000.0);
+            count++;
+        }
+    }
+    fprintf(file, "\n]}\n");
+    fclose(file);
+    LOGI("Profiler: Saved %d zones to %s\n", (int)(count - rings.size()), filename);
+    return true;
+}
+//----------------------------------------------------------------
+
+#endif  // ENABLE_PROFILER
@@ -0,0 +1,65 @@
+// Copyright (c) 2017 Rene Lindsay
+
+/*
+*  CProfiler is a CPU profiler, which records the start and duration of named zones, on every thread.
+*  (Enabled by the ENABLE_PROFILER CMake option.  When disabled, the PROFILE_* macros compile to nothing.)
+*
+*  Each thread records its zones into its own ring buffer, without locks, keeping the most recent
+*  RING_SIZE zones.  PROFILE_SAVE() writes all rings to a Chrome trace file, which can be opened in
+*  chrome://tracing or https://ui.perfetto.dev, to see where each frame's time goes, across threads.
+*
+*  - PROFILE_ZONE(name)   : Time the rest of the current scope. The name must be a string literal.
+*  - PROFILE_THREAD(name) : Name the current thread in the trace. (printf-style)
+*  - PROFILE_SAVE(file)   : Write the trace file. Call it while other threads are idle, or at exit.
+*
+*  eg:
+*    void DrawFrame() {
+*        PROFILE_ZONE("DrawFrame");
+*        ...
+*    }
+*    PROFILE_SAVE("trace.json");
+*/
+
+#ifndef CPROFILER_H
+#define CPROFILER_H
+
+#include <stdint.h>
+
+#ifdef ENABLE_PROFILER
+
+//---------------------------CProfiler----------------------------
+class CProfiler {
+  public:
+    static const uint32_t RING_SIZE = 64 * 1024;  // zones per thread (power of 2)
+
+    static uint64_t Now();                                          // nanoseconds since the profiler started
+    static void     Record(const char* name, uint64_t begin, uint64_t end);  // Add a zone to this thread's ring.
+    static void     NameThread(const char* format, ...);            // Name this thread, in the trace.
+    static bool     Save(const char* filename);                     // Write all rings as Chrome trace JSON.
+};
+
+class CProfileZone {  // Records a zone, from construction, to the end of its scope.
+    const char* name;
+    uint64_t    begin;
+
+  public:
+    CProfileZone(const char* name) : name(name), begin(CProfiler::Now()) {}
+    ~CProfileZone() { CProfiler::Record(name, begin, CProfiler::Now()); }
+};
+//----------------------------------------------------------------
+
+#define PROFILE_CONCAT2(A, B) A##B
+#define PROFILE_CONCAT(A, B) PROFILE_CONCAT2(A, B)
+#define PROFILE_ZONE(NAME)     CProfileZone PROFILE_CONCAT(profile_zone_, __LINE__)(NAME)
+#define PROFILE_THREAD(...)    CProfiler::NameThread(__VA_ARGS__)
+#define PROFILE_SAVE(FILENAME) CProfiler::Save(FILENAME)
+
+#else
+
+#define PROFILE_ZONE(NAME)
+#define PROFILE_THREAD(...)
+#define PROFILE_SAVE(FILENAME)
+
+#endif  // ENABLE_PROFILER
+
+#endif
@@ -0,0 +1,178 @@
+// Copyright (c) 2017 Rene Lindsay
+
+#include "CQueues.h"
+
+//---------------------------CSubmitBatch-------------------------
+void CSubmitBatch::Add(const VkSubmitInfo& info, VkFence fence) {
+    CSubmit submit;
+    submit.pNext      = info.pNext;
+    submit.has_values = false;
+    submit.values     = {};
+    submit.fence      = fence;
+    auto* values = (const VkTimelineSemaphoreSubmitInfoKHR*)info.pNext;  // (from CTimeline::Submit)
+    if (values && values->sType == VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR) {
+        submit.pNext      = values->pNext;
+        submit.has_values = true;
+        submit.values     = *values;
+        submit.wait_values  .assign(values->pWaitSemaphoreValues,   values->pWaitSemaphoreValues   + values->waitSemaphoreValueCount);
+        submit.signal_values.assign(values->pSignalSemaphoreValues, values->pSignalSemaphoreValues + values->signalSemaphoreValueCount);
+    }
+    submit.wait_semaphores  .assign(info.pWaitSemaphores,   info.pWaitSemaphores   + info.waitSemaphoreCount);
+    submit.wait_stages      .assign(info.pWaitDstStageMask, info.pWaitDstStageMask + info.waitSemaphoreCount);
+    submit.command_buffers  .assign(info.pCommandBuffers,   info.pCommandBuffers   + info.commandBufferCount);
+    submit.signal_semaphores.assign(info.pSignalSemaphores, info.pSignalSemaphores + info.signalSemaphoreCount);
+    std::lock_guard<std::mutex> guard(lock);
+    pending.push_back(std::move(submit));
+}
+
+uint32_t CSubmitBatch::PendingCount() {
+    std::lock_guard<std::mutex> guard(lock);
+    return (uint32_t)pending.size();
+}
+
+VkResult CSubmitBatch::Flush(VkFence fence) {
+    std::lock_guard<std::mutex> guard(lock);
+    if (pending.empty() && !fence) return VK_SUCCESS;
+    flushing.swap(pending);  // reuse vector capacity from frame to frame
+    pending.clear();
+
+    infos.resize(flushing.size());
+    repeat(flushing.size()) {
+        CSubmit& s = flushing[i];
+        VkSubmitInfo& info = infos[i];
+        info = {};
+        info.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        info.pNext                = s.pNext;
+        info.waitSemaphoreCount   = (uint32_t)s.wait_semaphores.size();
+        info.pWaitSemaphores      =           s.wait_semaphores.data();
+        info.pWaitDstStageMask    =           s.wait_stages.data();
+        info.commandBufferCount   = (uint32_t)s.command_buffers.size();
+        info.pCommandBuffers      =           s.command_buffers.data();
+        info.signalSemaphoreCount = (uint32_t)s.signal_semaphores.size();
+        info.pSignalSemaphores    =           s.signal_semaphores.data();
+        if (s.has_values) {  // re-link the copied timeline values
+            s.values.pNext                  = s.pNext;
+            s.values.pWaitSemaphoreValues   = s.wait_values.data();
+            s.values.pSignalSemaphoreValues = s.signal_values.data();
+            info.pNext = &s.values;
+        }
+    }
+    // Each vkQueueSubmit takes one fence, so a fenced submit ends a call. (Usually there is one per frame.)
+    VkResult result = VK_SUCCESS;
+    uint32_t first = 0;
+    repeat(flushing.size()) {
+        if (!flushing[i].fence) continue;
+        result = QueueSubmit(queue, (uint32_t)i + 1 - first, &infos[first], flushing[i].fence);
+        VKERRCHECK(result);
+        first = (uint32_t)i + 1;
+    }
+    if (first < infos.size() || fence) {
+        result = QueueSubmit(queue, (uint32_t)infos.size() - first, infos.data() + first, fence);  // fence may signal an empty batch
+        VKERRCHECK(result);
+    }
+    flushing.clear();
+    return result;
+}
+//----------------------------------------------------------------
+
+//---------------------------CQueueManager------------------------
+CQueueManager::CQueueManager(CDevice& device, VkSurfaceKHR surface) : device(device), queues() {
+    if (device.IsCreated()) { LOGE("CQueueManager must be created before calling CDevice::Create().\n"); return; }
+    const VkQueueFlags G = VK_QUEUE_GRAPHICS_BIT, C = VK_QUEUE_COMPUTE_BIT, T = VK_QUEUE_TRANSFER_BIT;
+
+    queues[eQUEUE_GRAPHICS] = device.RequestQueue(G, surface, 1.0f);
+    queues[eQUEUE_PRESENT]  = queues[eQUEUE_GRAPHICS];
+    if (!queues[eQUEUE_GRAPHICS] && surface) {                                         // No family can render and present:
+        queues[eQUEUE_GRAPHICS] = device.RequestQueue(G, 0, 1.0f);                     //   render on a graphics queue,
+        queues[eQUEUE_PRESENT]  = device.RequestQueue(0, surface, 1.0f);                //   and present on another family.
+    }
+    if (!queues[eQUEUE_GRAPHICS]) LOGW("No graphics queue available.\n");
+    if (surface && !queues[eQUEUE_PRESENT]) LOGW("No queue can present to this surface.\n");
+
+    queues[eQUEUE_COMPUTE] = Pick(C, G, 0.5f);                                       // async compute
+    if (!queues[eQUEUE_COMPUTE]) queues[eQUEUE_COMPUTE] = Pick(C, 0, 0.5f);           // spare queue, any compute family
+    if (!queues[eQUEUE_COMPUTE]) queues[eQUEUE_COMPUTE] = queues[eQUEUE_GRAPHICS];    // share graphics queue
+
+    queues[eQUEUE_TRANSFER] = Pick(T, G | C, 0.5f);                                    // DMA engine
+    if (!queues[eQUEUE_TRANSFER]) queues[eQUEUE_TRANSFER] = Pick(T, G, 0.5f);          // compute-only family
+    if (!queues[eQUEUE_TRANSFER]) queues[eQUEUE_TRANSFER] = queues[eQUEUE_COMPUTE];    // share compute queue
+}
+
+// Returns the first queue family with all required flags, and none of the excluded flags, that still has a free queue.
+int CQueueManager::FindFamily(VkQueueFlags required, VkQueueFlags excluded) {
+    const vector<VkQueueFamilyProperties>& families = device.GPU().queue_families;
+    repeat(families.size()) {
+        VkQueueFlags flags = families[i].queueFlags;
+        if (flags & VK_QUEUE_GRAPHICS_BIT) flags |= VK_QUEUE_TRANSFER_BIT;  // graphics / compute families
+        if (flags & VK_QUEUE_COMPUTE_BIT)  flags |= VK_QUEUE_TRANSFER_BIT;  // implicitly support transfers
+        if ((flags & required) != required || (flags & excluded)) continue;
+        if (device.FreeQueueCount(i) > 0) return i;
+    }
+    return -1;
+}
+
+CQueue* CQueueManager::Pick(VkQueueFlags flags, VkQueueFlags excluded, float priority) {
+    int family = FindFamily(flags, excluded);
+    if (family < 0) return 0;
+    CQueue* queue = device.RequestFamilyQueue(family, priority);
+    if (queue) queue->flags = flags;
+    return queue;
+}
+
+bool CQueueManager::IsDedicated(eQueueRole role) {
+    CQueue* graphics = queues[eQUEUE_GRAPHICS];
+    CQueue* queue    = queues[role];
+    if (!queue) return false;
+    return (role == eQUEUE_GRAPHICS) || !graphics || (queue->family != graphics->family);
+}
+
+CSubmitBatch* CQueueManager::Batch(eQueueRole role) {
+    CQueue* queue = queues[role];
+    if (!queue || !queue->handle) { LOGE("Queue is not available. (Was CDevice::Create() called?)\n"); return 0; }
+    std::lock_guard<std::mutex> guard(batches_lock);
+    for (auto& batch : batches) if (batch->queue == queue->handle) return batch.get();
+    batches.emplace_back(new CSubmitBatch(*queue));
+    return batches.back().get();
+}
+
+void CQueueManager::Submit(eQueueRole role, const VkSubmitInfo& info) {
+    CSubmitBatch* batch = Batch(role);
+    if (batch) batch->Add(info);
+}
+
+void CQueueManager::Submit(eQueueRole role, VkCommandBuffer cmd, VkSemaphore wait, VkPipelineStageFlags wait_stage,
+                           VkSemaphore signal) {
+    VkSubmitInfo info = {};
+    info.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    info.waitSemaphoreCount   = wait ? 1 : 0;
+    info.pWaitSemaphores      = &wait;
+    info.pWaitDstStageMask    = &wait_stage;
+    info.commandBufferCount   = cmd ? 1 : 0;
+    info.pCommandBuffers      = &cmd;
+    info.signalSemaphoreCount = signal ? 1 : 0;
+    info.pSignalSemaphores    = &signal;
+    Submit(role, info);
+}
+
+VkResult CQueueManager::Flush(eQueueRole role, VkFence fence) {
+    CSubmitBatch* batch = Batch(role);
+    return batch ? batch->Flush(fence) : VK_ERROR_INITIALIZATION_FAILED;
+}
+
+void CQueueManager::FlushAll() {
+    std::lock_guard<std::mutex> guard(batches_lock);
+    for (auto& batch : batches) batch->Flush();
+}
+
+void CQueueManager::Print() {
+    const char* names[] = {"Graphics", "Present ", "Compute ", "Transfer"};
+    printf("Queue roles:\n");
+    repeat(eQUEUE_ROLE_COUNT) {
+        CQueue* q = queues[i];
+        if (!q) { print(eFAINT, "\t%s : not available\n", names[i]); continue; }
+        bool dedicated = IsDedicated((eQueueRole)i);
+        printf("\t%s : family=%d index=%d priority=%.2f %s\n", names[i], q->family, q->index, q->priority,
+               dedicated ? "" : "(shared with graphics family)");
+    }
+}
+//----------------------------------------------------------------
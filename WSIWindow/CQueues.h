@@ -0,0 +1,116 @@
+// Copyright (c) 2017 Rene Lindsay
+
+/*
+*  This unit routes work to dedicated queue families, and batches queue submissions.
+*
+*  CDevice ──> CQueueManager
+*              ├CQueue* Graphics()  (presentable, if a surface was given and the family can present)
+*              ├CQueue* Present()   (same as Graphics(), unless the graphics family can't present)
+*              ├CQueue* Compute()   (async-compute family, if available)
+*              ├CQueue* Transfer()  (DMA / transfer-only family, if available)
+*              └Submit() / Flush()  (submission scheduler, one CSubmitBatch per VkQueue)
+*
+*  WARNING: This unit is a work in progress.
+*  Interfaces are experimental and likely to change.
+*
+* CQueueManager:
+* --------------
+* Create a CQueueManager on a CDevice that has not been created yet.
+* It picks the best queue family for each role, and requests the queues with suitable priorities:
+*   Graphics : First family with GRAPHICS support. (and can present to the surface, if given.)      priority 1.0
+*   Present  : The graphics queue, or else a queue from any family that can present to the surface. priority 1.0
+*   Compute  : Prefers a COMPUTE family without GRAPHICS, for async compute.                       priority 0.5
+*   Transfer : Prefers a TRANSFER-only family (DMA engine), then a family without GRAPHICS.        priority 0.5
+* If no dedicated family is available, the role falls back to a spare queue, or shares the graphics queue.
+* Then call device.Create(), to create the logical device.
+*
+* Submission scheduler:
+* ---------------------
+* Submit() may be called from any thread. It copies the VkSubmitInfo arrays, and queues it for the given role.
+* Flush() sends all pending submits for a queue as ONE vkQueueSubmit call. (Call once per queue, per frame.)
+* Roles that share the same VkQueue are merged into the same batch.
+* A CTimeline can also queue its submits into a batch, (see CTimeline::Init) with their timeline values,
+* or fences, attached.  A submit with a fence ends a vkQueueSubmit call, since each call takes only one fence.
+* Flush() and vkQueuePresentKHR must not be called on the same queue from different threads at once.
+* (CSwapchain flushes its queues from the render thread, right before presenting.)
+* NOTE: pNext chains are not copied, (except for a leading VkTimelineSemaphoreSubmitInfoKHR) so they must
+* stay valid until Flush() is called.
+*
+* eg:
+*    CDevice device(*gpu);
+*    CQueueManager queues(device, surface);
+*    device.Create();
+*    queues.Submit(eQUEUE_TRANSFER, upload_cmd, 0, 0, upload_done);                                 // worker thread
+*    queues.Submit(eQUEUE_GRAPHICS, draw_cmd, upload_done, VK_PIPELINE_STAGE_VERTEX_INPUT_BIT);     // render thread
+*    queues.Flush(eQUEUE_TRANSFER);
+*    queues.Flush(eQUEUE_GRAPHICS, frame_fence);
+*/
+
+#ifndef CQUEUES_H
+#define CQUEUES_H
+
+#include "CDevices.h"
+#include <mutex>
+#include <memory>
+
+enum eQueueRole { eQUEUE_GRAPHICS, eQUEUE_PRESENT, eQUEUE_COMPUTE, eQUEUE_TRANSFER, eQUEUE_ROLE_COUNT };
+
+//---------------------------CSubmitBatch-------------------------
+// Pending submits for one VkQueue.  (Arrays are copied, so callers may free theirs after Add.)
+class CSubmitBatch {
+    struct CSubmit {
+        const void*                      pNext;     // rest of the chain, after the timeline values (not copied)
+        bool                             has_values;
+        VkTimelineSemaphoreSubmitInfoKHR values;    // copy of a leading timeline struct, if has_values
+        vector<uint64_t>                 wait_values;
+        vector<uint64_t>                 signal_values;
+        vector<VkSemaphore>              wait_semaphores;
+        vector<VkPipelineStageFlags>     wait_stages;
+        vector<VkCommandBuffer>          command_buffers;
+        vector<VkSemaphore>              signal_semaphores;
+        VkFence                          fence;     // signaled when this, and all earlier submits, are done
+    };
+    std::mutex           lock;     // guards pending list, and the VkQueue (vkQueueSubmit requires external sync)
+    vector<CSubmit>      pending;
+    vector<CSubmit>      flushing;
+    vector<VkSubmitInfo> infos;
+    PFN_vkQueueSubmit    QueueSubmit;
+
+  public:
+    VkQueue queue;
+    CSubmitBatch(const CQueue& queue) : QueueSubmit(queue.vk->QueueSubmit), queue(queue.handle) {}
+    void     Add(const VkSubmitInfo& info, VkFence fence = 0);
+    VkResult Flush(VkFence fence = 0);  // One vkQueueSubmit for all pending submits. (One more per fence.)
+    uint32_t PendingCount();
+};
+//----------------------------------------------------------------
+//---------------------------CQueueManager------------------------
+class CQueueManager {
+    CDevice& device;
+    CQueue*  queues[eQUEUE_ROLE_COUNT];
+    vector<unique_ptr<CSubmitBatch>> batches;  // one per unique VkQueue (created on first use)
+    std::mutex batches_lock;
+    int  FindFamily(VkQueueFlags required, VkQueueFlags excluded);
+    CQueue* Pick(VkQueueFlags flags, VkQueueFlags excluded, float priority);
+
+  public:
+    CQueueManager(CDevice& device, VkSurfaceKHR surface = 0);  // Call BEFORE device.Create()
+    CQueue* Queue(eQueueRole role) { return queues[role]; }    // Returns 0 if role is unavailable
+    CQueue* Graphics() { return queues[eQUEUE_GRAPHICS]; }
+    CQueue* Present()  { return queues[eQUEUE_PRESENT];  }
+    CQueue* Compute()  { return queues[eQUEUE_COMPUTE];  }
+    CQueue* Transfer() { return queues[eQUEUE_TRANSFER]; }
+    bool IsDedicated(eQueueRole role);  // True if role has its own queue family. (not shared with graphics)
+
+    // -- Submission scheduler (thread-safe) --
+    CSubmitBatch* Batch(eQueueRole role);  // The batch of this role's queue. (eg: for CTimeline::Init)
+    void Submit(eQueueRole role, const VkSubmitInfo& info);
+    void Submit(eQueueRole role, VkCommandBuffer cmd, VkSemaphore wait = 0, VkPipelineStageFlags wait_stage = 0,
+                VkSemaphore signal = 0);
+    VkResult Flush(eQueueRole role, VkFence fence = 0);  // Submit pending work for this role's queue, in one call.
+    void FlushAll();                                     // Flush all queues. (no fences)
+    void Print();
+};
+//----------------------------------------------------------------
+
+#endif
@@ -0,0 +1,63 @@
+// Copyright (c) 2017 Rene Lindsay
+
+#include "CThreadPool.h"
+#include "CProfiler.h"
+
+//--------------------------CThreadPool---------------------------
+CThreadPool::CThreadPool(uint32_t thread_count)
+    : job(nullptr), task_count(0), next_task(0), busy(0), generation(0), quit(false) {
+    if (!thread_count) thread_count = std::thread::hardware_concurrency();
+    if (!thread_count) thread_count = 1;
+    for (uint32_t i = 1; i < thread_count; ++i) threads.emplace_back(&CThreadPool::Run, this, i);
+}
+
+CThreadPool::~CThreadPool() {
+    {
+        std::lock_guard<std::mutex> guard(mutex);
+        quit = true;
+    }
+    wake.notify_all();
+    for (auto& thread : threads) thread.join();
+}
+
+void CThreadPool::Run(uint32_t thread) {
+    PROFILE_THREAD("Pool worker %d", thread);
+    uint64_t seen = 0;
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        wake.wait(lock, [&] { return quit || generation != seen; });
+        if (quit) return;
+        seen = generation;
+        lock.unlock();
+        Work(thread);
+        lock.lock();
+        if (--busy == 0) done.notify_one();
+    }
+}
+
+void CThreadPool::Work(uint32_t thread) {
+    uint32_t task;
+    while ((task = next_task.fetch_add(1, std::memory_order_relaxed)) < task_count) (*job)(task, thread);
+}
+
+void CThreadPool::ParallelFor(uint32_t count, const CTask& func) {
+    if (count == 0) return;
+    if (count == 1 || threads.empty()) {  // Not worth waking the workers.
+        for (uint32_t i = 0; i < count; ++i) func(i, 0);
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> guard(mutex);
+        job        = &func;
+        task_count = count;
+        next_task  = 0;
+        busy       = (uint32_t)threads.size();
+        generation++;
+    }
+    wake.notify_all();
+    Work(0);
+    std::unique_lock<std::mutex> lock(mutex);
+    done.wait(lock, [&] { return busy == 0; });
+    job = nullptr;
+}
+//----------------------------------------------------------------
@@ -0,0 +1,59 @@
+// Copyright (c) 2017 Rene Lindsay
+
+/*
+*  CThreadPool runs a function on a fixed set of worker threads, for parallel command-buffer recording.
+*
+*  ParallelFor(count, func) calls func(task, thread) once for each task in [0, count), and returns when
+*  all tasks are done.  The calling thread also runs tasks, as thread 0, so a pool of N threads only
+*  starts N-1 workers.  The thread index is in [0, ThreadCount()), and is unique among concurrently
+*  running tasks, so it can index per-thread resources, like command pools, without locks.
+*
+*  ParallelFor() must not be called from more than one thread at a time, or from inside a task.
+*
+*  eg:
+*    CThreadPool pool;  // one thread per core
+*    pool.ParallelFor(64, [&](uint32_t task, uint32_t thread) {
+*        Record(cmd_pools[thread], objects[task]);
+*    });
+*/
+
+#ifndef CTHREADPOOL_H
+#define CTHREADPOOL_H
+
+#include <stdint.h>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//--------------------------CThreadPool---------------------------
+class CThreadPool {
+  public:
+    typedef std::function<void(uint32_t task, uint32_t thread)> CTask;
+
+  private:
+    std::vector<std::thread> threads;     // workers 1..N-1 (The calling thread is thread 0.)
+    std::mutex               mutex;
+    std::condition_variable  wake;        // signaled when a job starts, or on quit
+    std::condition_variable  done;        // signaled when the last worker finishes a job
+    const CTask*             job;
+    uint32_t                 task_count;
+    std::atomic<uint32_t>    next_task;
+    uint32_t                 busy;        // workers still running the current job
+    uint64_t                 generation;  // incremented for each job
+    bool                     quit;
+
+    void Run(uint32_t thread);   // worker thread loop
+    void Work(uint32_t thread);  // run tasks, until none are left
+
+  public:
+    CThreadPool(uint32_t thread_count = 0);  // 0 = one thread per core
+    ~CThreadPool();
+    uint32_t ThreadCount() const { return (uint32_t)threads.size() + 1; }
+    void ParallelFor(uint32_t count, const CTask& func);
+};
+//----------------------------------------------------------------
+
+#endif
@@ -0,0 +1,215 @@
+// Copyright (c) 2017 Rene Lindsay
+
+#include "CTimeline.h"
+#include "CQueues.h"
+#include <algorithm>
+
+//---------------------------CTimeline----------------------------
+static const uint32_t FENCE_BATCH = 4;  // fence mode: signaled fences are reset in batches of (at least) this many
+
+CTimeline::CTimeline()
+    : device(), queue(), semaphore(), batch(), submitted(0), completed(0),
+      QueueSubmit(), CreateFence(), DestroyFence(), ResetFences(), GetFenceStatus(), WaitForFences(),
+      CreateSemaphore(), DestroySemaphore(), GetSemaphoreCounterValue(), WaitSemaphores() {}
+
+bool CTimeline::Init(const CQueue& queue, CSubmitBatch* batch) {
+    Destroy();
+    ASSERT((!batch || batch->queue == queue.handle), "CTimeline: The batch belongs to a different queue.\n");
+    const CDeviceTable& vk = *queue.vk;
+    this->batch      = batch;
+    device           = queue.device;
+    this->queue      = queue.handle;
+    QueueSubmit      = vk.QueueSubmit;
+    CreateFence      = vk.CreateFence;
+    DestroyFence     = vk.DestroyFence;
+    ResetFences      = vk.ResetFences;
+    GetFenceStatus   = vk.GetFenceStatus;
+    WaitForFences    = vk.WaitForFences;
+    CreateSemaphore  = vk.CreateSemaphore;
+    DestroySemaphore = vk.DestroySemaphore;
+    return Create(queue.timeline);
+}
+
+bool CTimeline::Init(VkDevice device, VkQueue queue, bool use_timeline) {
+    Destroy();
+    this->device = device;
+    this->queue  = queue;
+#define LOAD(NAME) NAME = (PFN_vk##NAME)vkGetDeviceProcAddr(device, "vk" #NAME)
+    LOAD(QueueSubmit);
+    LOAD(CreateFence);
+    LOAD(DestroyFence);
+    LOAD(ResetFences);
+    LOAD(GetFenceStatus);
+    LOAD(WaitForFences);
+    LOAD(CreateSemaphore);
+    LOAD(DestroySemaphore);
+#undef LOAD
+    return Create(use_timeline);
+}
+
+// Returns true if a timeline semaphore was created, or false for fence mode.
+bool CTimeline::Create(bool use_timeline) {
+    submitted = 0;
+    completed = 0;
+    if (!use_timeline) return false;
+    GetSemaphoreCounterValue = (PFN_vkGetSemaphoreCounterValueKHR)vkGetDeviceProcAddr(device, "vkGetSemaphoreCounterValueKHR");
+    WaitSemaphores           = (PFN_vkWaitSemaphoresKHR)          vkGetDeviceProcAddr(device, "vkWaitSemaphoresKHR");
+    if (!GetSemaphoreCounterValue || !WaitSemaphores) {
+        LOGW("CTimeline: VK_KHR_timeline_semaphore functions not found. Using fences instead.\n");
+        return false;
+    }
+    VkSemaphoreTypeCreateInfoKHR type_info = {};
+    type_info.sType         = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO_KHR;
+    type_info.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE_KHR;
+    type_info.initialValue  = 0;
+    VkSemaphoreCreateInfo info = {};
+    info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+    info.pNext = &type_info;
+    VKERRCHECK(CreateSemaphore(device, &info, HostAllocator(), &semaphore));
+    return !!semaphore;
+}
+
+void CTimeline::Destroy() {
+    if (!device) return;
+    for (auto& p : pending) done_fences.push_back(p.fence);
+    for (VkFence fence : free_fences) DestroyFence(device, fence, HostAllocator());
+    for (VkFence fence : done_fences) DestroyFence(device, fence, HostAllocator());
+    if (semaphore) DestroySemaphore(device, semaphore, HostAllocator());
+    pending.clear();
+    free_fences.clear();
+    done_fences.clear();
+    semaphore = VK_NULL_HANDLE;
+    batch     = nullptr;
+    device    = VK_NULL_HANDLE;
+    queue     = VK_NULL_HANDLE;
+    submitted = 0;
+    completed = 0;
+}
+
+VkFence CTimeline::NextFence() {
+    if (free_fences.empty()) {
+        if (done_fences.size() < FENCE_BATCH) {  // Grow the pool, rather than reset one fence per submit.
+            VkFenceCreateInfo info = {};
+            info.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+            VkFence fence;
+            VKERRCHECK(CreateFence(device, &info, HostAllocator(), &fence));
+            return fence;
+        }
+        VKERRCHECK(ResetFences(device, (uint32_t)done_fences.size(), done_fences.data()));
+        free_fences.swap(done_fences);
+    }
+    VkFence fence = free_fences.back();
+    free_fences.pop_back();
+    return fence;
+}
+
+void CTimeline::Poll() {  // Fences of one queue signal in submit order, so stop at the first unsignaled one.
+    while (!pending.empty() && GetFenceStatus(device, pending.front().fence) == VK_SUCCESS) {
+        completed = pending.front().value;
+        done_fences.push_back(pending.front().fence);
+        pending.pop_front();
+    }
+}
+
+uint64_t CTimeline::Submit(const VkSubmitInfo* info, CTimeline* wait_for, uint64_t wait_value, VkPipelineStageFlags wait_stage) {
+    VkSubmitInfo submit = {};
+    submit.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    if (info) submit = *info;
+    uint64_t value = submitted + 1;
+
+    bool gpu_wait = false;
+    if (wait_for && wait_value > wait_for->completed) {
+        if (wait_for->IsTimeline()) gpu_wait = true;
+        else wait_for->Wait(wait_value);  // fence mode: wait on the CPU
+    }
+
+    VkSemaphore          waits  [MAX_SEMAPHORES];
+    VkPipelineStageFlags stages [MAX_SEMAPHORES];
+    VkSemaphore          signals[MAX_SEMAPHORES];
+    uint64_t             wait_values  [MAX_SEMAPHORES] = {};  // (ignored for binary semaphores)
+    uint64_t             signal_values[MAX_SEMAPHORES] = {};
+    VkTimelineSemaphoreSubmitInfoKHR values = {};
+    if (semaphore || gpu_wait) {  // Append the timeline semaphores to the batch's own semaphores.
+        uint32_t wait_count   = submit.waitSemaphoreCount;
+        uint32_t signal_count = submit.signalSemaphoreCount;
+        ASSERT((wait_count < MAX_SEMAPHORES && signal_count < MAX_SEMAPHORES), "CTimeline: Too many semaphores in one submit.\n");
+        std::copy(submit.pWaitSemaphores,   submit.pWaitSemaphores   + wait_count,   waits);
+        std::copy(submit.pWaitDstStageMask, submit.pWaitDstStageMask + wait_count,   stages);
+        std::copy(submit.pSignalSemaphores, submit.pSignalSemaphores + signal_count, signals);
+        if (gpu_wait) {
+            waits      [wait_count] = wait_for->semaphore;
+            stages     [wait_count] = wait_stage;
+            wait_values[wait_count] = wait_value;
+            wait_count++;
+        }
+        if (semaphore) {
+            signals      [signal_count] = semaphore;
+            signal_values[signal_count] = value;
+            signal_count++;
+        }
+        values.sType                     = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR;
+        values.pNext                     = submit.pNext;
+        values.waitSemaphoreValueCount   = wait_count;
+        values.pWaitSemaphoreValues      = wait_values;
+        values.signalSemaphoreValueCount = signal_count;
+        values.pSignalSemaphoreValues    = signal_values;
+        submit.pNext                = &values;
+        submit.waitSemaphoreCount   = wait_count;
+        submit.pWaitSemaphores      = waits;
+        submit.pWaitDstStageMask    = stages;
+        submit.signalSemaphoreCount = signal_count;
+        submit.pSignalSemaphores    = signals;
+    }
+
+    VkFence fence = semaphore ? VK_NULL_HANDLE : NextFence();
+    if (batch) {
+        batch->Add(submit, fence);  // sent by the batch's next Flush()
+    } else {
+        uint32_t batch_count = (info || semaphore || gpu_wait) ? 1 : 0;  // An empty submit may still signal a fence.
+        VKERRCHECK(QueueSubmit(queue, batch_count, &submit, fence));
+    }
+    if (fence) pending.push_back({value, fence});
+    submitted = value;
+    return value;
+}
+
+uint64_t CTimeline::Completed() {
+    if (semaphore) {
+        uint64_t value = 0;
+        VKERRCHECK(GetSemaphoreCounterValue(device, semaphore, &value));
+        completed = std::max(completed, value);
+    } else {
+        Poll();
+    }
+    return completed;
+}
+
+bool CTimeline::Wait(uint64_t value, uint64_t timeout) {
+    if (IsDone(value)) return true;
+    if (value > submitted) { LOGW("CTimeline: Can't wait for value %llu, which was not submitted yet.\n", (unsigned long long)value); return false; }
+    if (batch) batch->Flush();  // The submit may still be queued in the batch.
+    if (semaphore) {
+        VkSemaphoreWaitInfoKHR info = {};
+        info.sType          = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO_KHR;
+        info.semaphoreCount = 1;
+        info.pSemaphores    = &semaphore;
+        info.pValues        = &value;
+        VkResult result = WaitSemaphores(device, &info, timeout);
+        if (result == VK_TIMEOUT) return false;
+        VKERRCHECK(result);
+        completed = std::max(completed, value);
+        return true;
+    }
+    // Fence mode: pending holds one fence per value, from completed+1 to submitted.
+    VkFence fence = pending[(size_t)(value - pending.front().value)].fence;
+    VkResult result = WaitForFences(device, 1, &fence, VK_TRUE, timeout);
+    if (result == VK_TIMEOUT) return false;
+    VKERRCHECK(result);
+    while (!pending.empty() && pending.front().value <= value) {  // earlier submits are done too
+        completed = pending.front().value;
+        done_fences.push_back(pending.front().fence);
+        pending.pop_front();
+    }
+    return true;
+}
+//----------------------------------------------------------------
@@ -0,0 +1,109 @@
+// Copyright (c) 2017 Rene Lindsay
+
+/*
+*  CTimeline tracks the GPU progress of one queue, as a single counter, that increases by one with each submit.
+*
+*  Submit() returns the value that the GPU will reach when that batch is done.  To recycle a resource,
+*  keep the value of the last submit that used it, and check IsDone(value), or Wait(value), instead of
+*  waiting on, and resetting, a fence per resource.
+*
+*  If VK_KHR_timeline_semaphore is enabled on the device, the counter is a timeline semaphore.
+*  (CDevice picks the extension and its timelineSemaphore feature automatically, when available. See CQueue::timeline.)
+*  Otherwise, each submit gets a fence from a small pool, and the counter is advanced as the fences signal.
+*  Signaled fences are only reset, in one batch, when the pool runs out of unsignaled ones.
+*
+*  Submit() can also make a batch wait for another queue's timeline to reach a value.  With timeline
+*  semaphores, the GPU waits, and no extra binary semaphore is needed.  In fence mode, the CPU waits
+*  for the value before submitting, so prefer a binary semaphore there, if the CPU should not stall.
+*  (Check IsTimeline().)
+*
+*  If a CSubmitBatch is given to Init(), (see CQueues.h) each submit is queued into it, with its timeline
+*  values or fence attached, and is only sent to the GPU by the batch's next Flush(), together with any other
+*  work queued for that queue.  Wait() flushes the batch first, so it never waits for a submit that was not sent.
+*
+*  A CTimeline is not thread-safe. Use one per queue, from one thread.
+*
+*  WARNING: This unit is a work in progress.
+*  Interfaces are experimental and likely to change.
+*
+*  eg:
+*    CTimeline timeline;
+*    timeline.Init(*graphics_queue);           // or timeline.Init(vk_device, vk_queue, timeline_enabled);
+*                                              // or timeline.Init(*queues.Graphics(), queues.Batch(eQUEUE_GRAPHICS));
+*    ...
+*    timeline.Wait(frame.value);               // wait for the GPU to finish the last submit that used this frame
+*    ... record frame.cmd ...
+*    frame.value = timeline.Submit(&submit_info);
+*    ...
+*    compute.Submit(&compute_info, &timeline, frame.value);  // runs after the frame, on the compute queue
+*/
+
+#ifndef CTIMELINE_H
+#define CTIMELINE_H
+
+#include "CDevices.h"
+#include "VkCompat.h"  // VK_KHR_timeline_semaphore
+#include <deque>
+
+class CSubmitBatch;
+
+//---------------------------CTimeline----------------------------
+class CTimeline {
+    static const uint32_t MAX_SEMAPHORES = 8;  // per submit, including the timeline's own
+
+    struct CPending {                          // fence mode: a submit that has not signaled yet
+        uint64_t value;
+        VkFence  fence;
+    };
+
+    VkDevice             device;
+    VkQueue              queue;
+    VkSemaphore          semaphore;            // timeline semaphore, or VK_NULL_HANDLE in fence mode
+    CSubmitBatch*        batch;                // if set, submits are queued here, instead of submitted directly
+    uint64_t             submitted;            // value of the last submit
+    uint64_t             completed;            // last value known to be reached by the GPU
+    std::deque<CPending> pending;              // fence mode: in submit order
+    std::vector<VkFence> free_fences;          // fence mode: unsignaled, ready to use
+    std::vector<VkFence> done_fences;          // fence mode: signaled, to be reset in one batch
+
+    PFN_vkQueueSubmit                 QueueSubmit;
+    PFN_vkCreateFence                 CreateFence;
+    PFN_vkDestroyFence                DestroyFence;
+    PFN_vkResetFences                 ResetFences;
+    PFN_vkGetFenceStatus              GetFenceStatus;
+    PFN_vkWaitForFences               WaitForFences;
+    PFN_vkCreateSemaphore             CreateSemaphore;
+    PFN_vkDestroySemaphore            DestroySemaphore;
+    PFN_vkGetSemaphoreCounterValueKHR GetSemaphoreCounterValue;
+    PFN_vkWaitSemaphoresKHR           WaitSemaphores;
+
+    bool    Create(bool use_timeline);         // create the timeline semaphore, if enabled
+    VkFence NextFence();                       // fence mode: an unsignaled fence, for the next submit
+    void    Poll();                            // fence mode: advance 'completed' past the signaled fences
+
+  public:
+    CTimeline();
+    ~CTimeline() { Destroy(); }
+    CTimeline(const CTimeline&) = delete;
+    CTimeline& operator=(const CTimeline&) = delete;
+
+    // Init returns true if a timeline semaphore is used, or false for fence mode.
+    bool Init(const CQueue& queue, CSubmitBatch* batch = nullptr);  // Uses a timeline semaphore if queue.timeline is set.
+    bool Init(VkDevice device, VkQueue queue, bool use_timeline);   // for devices without a CDeviceTable. (loads with vkGetDeviceProcAddr)
+    void Destroy();                                                 // The queue must be idle.
+    bool IsTimeline() const { return !!semaphore; }
+
+    // Submit one batch, (or an empty one, if info is null) and return its value.
+    // If wait_for is given, the batch also waits until that timeline reaches wait_value.
+    uint64_t Submit(const VkSubmitInfo* info = nullptr, CTimeline* wait_for = nullptr, uint64_t wait_value = 0,
+                    VkPipelineStageFlags wait_stage = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+
+    uint64_t Submitted() const { return submitted; }                // value of the last submit
+    uint64_t Completed();                                           // last value reached by the GPU. (doesn't wait)
+    bool     IsDone(uint64_t value) { return value <= completed || value <= Completed(); }
+    bool     Wait(uint64_t value, uint64_t timeout = UINT64_MAX);   // false on timeout
+    bool     WaitIdle() { return Wait(submitted); }
+};
+//----------------------------------------------------------------
+
+#endif
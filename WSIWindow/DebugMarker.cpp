@@ -0,0 +1,72 @@
+// Copyright (c) 2017 Rene Lindsay
+
+#include "DebugMarker.h"
+#include <stdarg.h>
+
+//--------------------------CDebugMarker--------------------------
+CDebugMarker::CDebugMarker() : device(0), SetObjectName(0), CmdBegin(0), CmdEnd(0), CmdInsert(0) {}
+
+CDebugMarker::CDebugMarker(VkDevice device, const CDeviceTable& vk)
+    : device(device),
+      SetObjectName(vk.DebugMarkerSetObjectNameEXT),
+      CmdBegin     (vk.CmdDebugMarkerBeginEXT),
+      CmdEnd       (vk.CmdDebugMarkerEndEXT),
+      CmdInsert    (vk.CmdDebugMarkerInsertEXT) {
+    if (!SetObjectName || !CmdBegin || !CmdEnd || !CmdInsert) *this = CDebugMarker();
+}
+
+CDebugMarker::CDebugMarker(VkDevice device, bool enabled) : CDebugMarker() {
+    if (!enabled) return;
+    this->device  = device;
+    SetObjectName = (PFN_vkDebugMarkerSetObjectNameEXT) vkGetDeviceProcAddr(device, "vkDebugMarkerSetObjectNameEXT");
+    CmdBegin      = (PFN_vkCmdDebugMarkerBeginEXT)      vkGetDeviceProcAddr(device, "vkCmdDebugMarkerBeginEXT");
+    CmdEnd        = (PFN_vkCmdDebugMarkerEndEXT)        vkGetDeviceProcAddr(device, "vkCmdDebugMarkerEndEXT");
+    CmdInsert     = (PFN_vkCmdDebugMarkerInsertEXT)     vkGetDeviceProcAddr(device, "vkCmdDebugMarkerInsertEXT");
+    if (!SetObjectName || !CmdBegin || !CmdEnd || !CmdInsert) *this = CDebugMarker();
+}
+
+void CDebugMarker::SetName(VkDebugReportObjectTypeEXT type, uint64_t object, const char* format, ...) const {
+    if (!SetObjectName || !object) return;
+    char name[128];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(name, sizeof(name), format, args);
+    va_end(args);
+
+    VkDebugMarkerObjectNameInfoEXT info = {};
+    info.sType       = VK_STRUCTURE_TYPE_DEBUG_MARKER_OBJECT_NAME_INFO_EXT;
+    info.objectType  = type;
+    info.object      = object;
+    info.pObjectName = name;
+    VKERRCHECK(SetObjectName(device, &info));
+}
+
+static VkDebugMarkerMarkerInfoEXT MarkerInfo(const char* name, uint32_t rgb) {
+    VkDebugMarkerMarkerInfoEXT info = {};
+    info.sType       = VK_STRUCTURE_TYPE_DEBUG_MARKER_MARKER_INFO_EXT;
+    info.pMarkerName = name;
+    if (rgb) {  // 0 = no color
+        info.color[0] = ((rgb >> 16) & 0xFF) / 255.f;
+        info.color[1] = ((rgb >>  8) & 0xFF) / 255.f;
+        info.color[2] = ((rgb      ) & 0xFF) / 255.f;
+        info.color[3] = 1.f;
+    }
+    return info;
+}
+
+void CDebugMarker::Begin(VkCommandBuffer cmd, const char* name, uint32_t rgb) const {
+    if (!CmdBegin) return;
+    VkDebugMarkerMarkerInfoEXT info = MarkerInfo(name, rgb);
+    CmdBegin(cmd, &info);
+}
+
+void CDebugMarker::End(VkCommandBuffer cmd) const {
+    if (CmdEnd) CmdEnd(cmd);
+}
+
+void CDebugMarker::Insert(VkCommandBuffer cmd, const char* name, uint32_t rgb) const {
+    if (!CmdInsert) return;
+    VkDebugMarkerMarkerInfoEXT info = MarkerInfo(name, rgb);
+    CmdInsert(cmd, &info);
+}
+//----------------------------------------------------------------
@@ -0,0 +1,60 @@
+// Copyright (c) 2017 Rene Lindsay
+
+/*
+*  CDebugMarker gives Vulkan objects readable names, and marks labeled regions in command buffers,
+*  using the VK_EXT_debug_marker device extension.  Frame debuggers and profilers (eg. RenderDoc)
+*  then show "Swapchain image 2" or "Draw teapots", instead of raw handles and call lists.
+*
+*  CDevice picks VK_EXT_debug_marker automatically, when the GPU (or an attached debugger) provides it.
+*  If the extension is not enabled, all functions are no-ops, and names are not even formatted.
+*
+*  CDebugLabel marks a region, from its construction, to the end of its scope.
+*
+*  eg:
+*    CDebugMarker marker(device, device.vk);   // or CDebugMarker marker(vk_device, enabled);
+*    marker.SetName(VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT, (uint64_t)image, "Swapchain image %d", i);
+*    {
+*        CDebugLabel label(marker, cmd_buf, "Shadow pass", 0x808080);  // gray region
+*        ...
+*    }
+*/
+
+#ifndef DEBUGMARKER_H
+#define DEBUGMARKER_H
+
+#include "CDeviceTable.h"
+
+//--------------------------CDebugMarker--------------------------
+class CDebugMarker {
+    VkDevice                          device;
+    PFN_vkDebugMarkerSetObjectNameEXT SetObjectName;
+    PFN_vkCmdDebugMarkerBeginEXT      CmdBegin;
+    PFN_vkCmdDebugMarkerEndEXT        CmdEnd;
+    PFN_vkCmdDebugMarkerInsertEXT     CmdInsert;
+
+  public:
+    CDebugMarker();                                        // disabled
+    CDebugMarker(VkDevice device, const CDeviceTable& vk); // enabled if VK_EXT_debug_marker was enabled on the device
+    CDebugMarker(VkDevice device, bool enabled);           // for devices without a CDeviceTable. (loads with vkGetDeviceProcAddr)
+    bool IsEnabled() const { return !!SetObjectName; }
+
+    void SetName(VkDebugReportObjectTypeEXT type, uint64_t object, const char* format, ...) const;  // printf-style name
+    void Begin (VkCommandBuffer cmd, const char* name, uint32_t rgb = 0) const;  // Begin a labeled region. (rgb: 0xRRGGBB)
+    void End   (VkCommandBuffer cmd) const;                                      // End the innermost region.
+    void Insert(VkCommandBuffer cmd, const char* name, uint32_t rgb = 0) const;  // Single label, between commands.
+};
+//----------------------------------------------------------------
+
+//---------------------------CDebugLabel--------------------------
+class CDebugLabel {  // Labeled command-buffer region, for the lifetime of this object.
+    const CDebugMarker& marker;
+    VkCommandBuffer     cmd;
+
+  public:
+    CDebugLabel(const CDebugMarker& marker, VkCommandBuffer cmd, const char* name, uint32_t rgb = 0)
+        : marker(marker), cmd(cmd) { marker.Begin(cmd, name, rgb); }
+    ~CDebugLabel() { marker.End(cmd); }
+};
+//----------------------------------------------------------------
+
+#endif
@@ -0,0 +1,701 @@
+// Copyright (c) 2017 Rene Lindsay
+
+#include "NullDriver.h"
+#include "VkCompat.h"  // VK_KHR_timeline_semaphore declarations
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <new>
+#include <vector>
+
+static bool null_driver_active = false;
+
+bool NullDriverActive() { return null_driver_active; }
+
+bool UseNullDriver() {
+#ifdef VK_NO_PROTOTYPES
+    InitVulkanDriver(NullDriverGetInstanceProcAddr);
+    null_driver_active = true;
+    LOGI("Using the null Vulkan driver. (No GPU work will be done.)\n");
+    return true;
+#else
+    LOGE("The null driver requires the USE_VULKAN_WRAPPER CMake option.\n");
+    return false;
+#endif
+}
+
+//----------------------------Handles-----------------------------
+// Non-dispatchable handles are unique numbers, or point to a small bookkeeping object.
+// There is only one instance, gpu, device and queue, so they point to static dummies.
+static std::atomic<uint64_t> handle_count(0);
+
+template <typename H> static H NewHandle() { return (H)(uintptr_t)++handle_count; }
+template <typename H, typename T> static H ToHandle(T* object) { return (H)(uintptr_t)object; }
+template <typename T, typename H> static T* ToObject(H handle) { return (T*)(uintptr_t)handle; }
+
+struct CNullObject    { uint64_t id; };
+struct CNullBuffer    { VkDeviceSize size; };
+struct CNullImage     { VkDeviceSize size; };
+struct CNullSurface   { VkExtent2D extent; };
+struct CNullSemaphore { uint64_t value; bool timeline; };  // timeline semaphores are signaled on submit
+struct CNullSwapchain {
+    std::vector<VkImage>                        images;
+    uint32_t                                    next;
+    std::vector<VkPastPresentationTimingGOOGLE> timings;  // VK_GOOGLE_display_timing results, not yet read
+};
+
+static CNullObject null_instance, null_gpu, null_device, null_queue;
+
+//--------------------------Host memory---------------------------
+// Like a real driver, the null driver allocates its bookkeeping objects through the app's VkAllocationCallbacks,
+// when given, (OBJECT scope) so host-allocator stats (eg: CHostAllocator) show real numbers without a GPU.
+template <typename T, typename... ARGS> static T* New(const VkAllocationCallbacks* allocator, ARGS... args) {
+    if (!allocator) return new T{args...};
+    void* memory = allocator->pfnAllocation(allocator->pUserData, sizeof(T), alignof(T), VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+    return memory ? new (memory) T{args...} : nullptr;
+}
+
+template <typename T> static void Delete(const VkAllocationCallbacks* allocator, T* object) {
+    if (!allocator || !object) { delete object; return; }
+    object->~T();
+    allocator->pfnFree(allocator->pUserData, object);
+}
+
+// Copy items to the output array, using the usual Vulkan count / array pattern.
+template <typename T> static VkResult Enumerate(uint32_t* count, T* out, const T* items, uint32_t item_count) {
+    if (!out) { *count = item_count; return VK_SUCCESS; }
+    uint32_t n = (*count < item_count) ? *count : item_count;
+    for (uint32_t i = 0; i < n; ++i) out[i] = items[i];
+    *count = n;
+    return (n < item_count) ? VK_INCOMPLETE : VK_SUCCESS;
+}
+
+// Find an extension struct in a pNext chain.
+static const void* FindNext(const void* next, VkStructureType sType) {
+    struct CChain { VkStructureType sType; const CChain* pNext; };  // header of every pNext struct
+    for (auto* node = (const CChain*)next; node; node = node->pNext)
+        if (node->sType == sType) return node;
+    return nullptr;
+}
+
+static VkExtensionProperties Extension(const char* name, uint32_t version) {
+    VkExtensionProperties ext = {};
+    strncpy(ext.extensionName, name, VK_MAX_EXTENSION_NAME_SIZE - 1);
+    ext.specVersion = version;
+    return ext;
+}
+
+//---------------------------Instance-----------------------------
+static VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo*, const VkAllocationCallbacks*, VkInstance* instance) {
+    *instance = (VkInstance)&null_instance;
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL EnumerateInstanceExtensionProperties(const char* layer, uint32_t* count, VkExtensionProperties* props) {
+    static const VkExtensionProperties exts[] = {
+        Extension(VK_KHR_SURFACE_EXTENSION_NAME, 25),
+        Extension(VK_KHR_DISPLAY_EXTENSION_NAME, 21),
+        Extension(VK_EXT_DEBUG_REPORT_EXTENSION_NAME, 9),
+        Extension(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME, 1),
+#ifdef VK_USE_PLATFORM_XCB_KHR
+        Extension(VK_KHR_XCB_SURFACE_EXTENSION_NAME, 6),
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        Extension(VK_KHR_WIN32_SURFACE_EXTENSION_NAME, 6),
+#endif
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+        Extension(VK_KHR_ANDROID_SURFACE_EXTENSION_NAME, 6),
+#endif
+    };
+    if (layer) { *count = 0; return VK_ERROR_LAYER_NOT_PRESENT; }
+    return Enumerate(count, props, exts, sizeof(exts) / sizeof(exts[0]));
+}
+
+template <typename HANDLE, typename PROPS>  // No layers: The null driver replaces the loader.
+static VKAPI_ATTR VkResult VKAPI_CALL EnumerateLayers(HANDLE, uint32_t* count, PROPS*) { *count = 0; return VK_SUCCESS; }
+
+static VKAPI_ATTR VkResult VKAPI_CALL EnumerateInstanceLayerProperties(uint32_t* count, VkLayerProperties*) {
+    *count = 0;
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL EnumeratePhysicalDevices(VkInstance, uint32_t* count, VkPhysicalDevice* gpus) {
+    const VkPhysicalDevice gpu = (VkPhysicalDevice)&null_gpu;
+    return Enumerate(count, gpus, &gpu, 1);
+}
+
+//-------------------------Physical Device------------------------
+static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceProperties(VkPhysicalDevice, VkPhysicalDeviceProperties* props) {
+    *props = {};
+    props->apiVersion    = VK_MAKE_VERSION(1, 0, VK_HEADER_VERSION);
+    props->driverVersion = VK_MAKE_VERSION(1, 0, 0);
+    props->vendorID      = 0x10000;  // Not a PCI vendor ID
+    props->deviceID      = 1;
+    props->deviceType    = VK_PHYSICAL_DEVICE_TYPE_CPU;
+    strncpy(props->deviceName, "Null Vulkan Device", VK_MAX_PHYSICAL_DEVICE_NAME_SIZE - 1);
+    memset(props->pipelineCacheUUID, 0x4E, VK_UUID_SIZE);
+
+    VkPhysicalDeviceLimits& limits = props->limits;
+    limits.maxImageDimension1D                   = 16384;
+    limits.maxImageDimension2D                   = 16384;
+    limits.maxImageDimension3D                   = 2048;
+    limits.maxImageDimensionCube                 = 16384;
+    limits.maxImageArrayLayers                   = 2048;
+    limits.maxTexelBufferElements                = 1 << 27;
+    limits.maxUniformBufferRange                 = 65536;
+    limits.maxStorageBufferRange                 = 1u << 30;
+    limits.maxPushConstantsSize                  = 256;
+    limits.maxMemoryAllocationCount              = 4096;
+    limits.maxSamplerAllocationCount             = 4000;
+    limits.bufferImageGranularity                = 1;
+    limits.maxBoundDescriptorSets                = 8;
+    limits.maxPerStageDescriptorSamplers         = 1024;
+    limits.maxPerStageDescriptorUniformBuffers   = 1024;
+    limits.maxPerStageDescriptorStorageBuffers   = 1024;
+    limits.maxPerStageDescriptorSampledImages    = 1024;
+    limits.maxPerStageDescriptorStorageImages    = 1024;
+    limits.maxPerStageResources                  = 4096;
+    limits.maxDescriptorSetSamplers              = 4096;
+    limits.maxDescriptorSetUniformBuffers        = 4096;
+    limits.maxDescriptorSetUniformBuffersDynamic = 16;
+    limits.maxDescriptorSetStorageBuffers        = 4096;
+    limits.maxDescriptorSetStorageBuffersDynamic = 16;
+    limits.maxDescriptorSetSampledImages         = 4096;
+    limits.maxDescriptorSetStorageImages         = 4096;
+    limits.maxVertexInputAttributes              = 32;
+    limits.maxVertexInputBindings                = 32;
+    limits.maxVertexInputAttributeOffset         = 2047;
+    limits.maxVertexInputBindingStride           = 2048;
+    limits.maxVertexOutputComponents             = 128;
+    limits.maxFragmentInputComponents            = 128;
+    limits.maxFragmentOutputAttachments          = 8;
+    limits.maxComputeSharedMemorySize            = 32768;
+    limits.maxComputeWorkGroupInvocations        = 1024;
+    for (int i = 0; i < 3; ++i) {
+        limits.maxComputeWorkGroupCount[i] = 65535;
+        limits.maxComputeWorkGroupSize[i]  = 1024;
+    }
+    limits.maxDrawIndexedIndexValue              = 0xFFFFFFFF;
+    limits.maxDrawIndirectCount                  = 0xFFFFFFFF;
+    limits.maxSamplerAnisotropy                  = 16.0f;
+    limits.maxViewports                          = 16;
+    limits.maxViewportDimensions[0]              = 16384;
+    limits.maxViewportDimensions[1]              = 16384;
+    limits.viewportBoundsRange[0]                = -32768.0f;
+    limits.viewportBoundsRange[1]                = 32767.0f;
+    limits.minMemoryMapAlignment                 = 16;  // malloc alignment
+    limits.minTexelBufferOffsetAlignment         = 16;
+    limits.minUniformBufferOffsetAlignment       = 256;
+    limits.minStorageBufferOffsetAlignment       = 256;
+    limits.maxFramebufferWidth                   = 16384;
+    limits.maxFramebufferHeight                  = 16384;
+    limits.maxFramebufferLayers                  = 2048;
+    limits.framebufferColorSampleCounts          = VK_SAMPLE_COUNT_1_BIT;
+    limits.framebufferDepthSampleCounts          = VK_SAMPLE_COUNT_1_BIT;
+    limits.framebufferStencilSampleCounts        = VK_SAMPLE_COUNT_1_BIT;
+    limits.framebufferNoAttachmentsSampleCounts  = VK_SAMPLE_COUNT_1_BIT;
+    limits.maxColorAttachments                   = 8;
+    limits.sampledImageColorSampleCounts         = VK_SAMPLE_COUNT_1_BIT;
+    limits.sampledImageIntegerSampleCounts       = VK_SAMPLE_COUNT_1_BIT;
+    limits.sampledImageDepthSampleCounts         = VK_SAMPLE_COUNT_1_BIT;
+    limits.sampledImageStencilSampleCounts       = VK_SAMPLE_COUNT_1_BIT;
+    limits.storageImageSampleCounts              = VK_SAMPLE_COUNT_1_BIT;
+    limits.maxSampleMaskWords                    = 1;
+    limits.timestampComputeAndGraphics           = VK_TRUE;
+    limits.timestampPeriod                       = 1.0f;
+    limits.maxClipDistances                      = 8;
+    limits.maxCullDistances                      = 8;
+    limits.maxCombinedClipAndCullDistances       = 8;
+    limits.pointSizeRange[0]                     = 1.0f;
+    limits.pointSizeRange[1]                     = 64.0f;
+    limits.lineWidthRange[0]                     = 1.0f;
+    limits.lineWidthRange[1]                     = 8.0f;
+    limits.pointSizeGranularity                  = 1.0f;
+    limits.lineWidthGranularity                  = 1.0f;
+    limits.optimalBufferCopyOffsetAlignment      = 1;
+    limits.optimalBufferCopyRowPitchAlignment    = 1;
+    limits.nonCoherentAtomSize                   = 64;
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceFeatures(VkPhysicalDevice, VkPhysicalDeviceFeatures* features) {
+    VkBool32* flags = (VkBool32*)features;  // Supports everything.
+    for (size_t i = 0; i < sizeof(*features) / sizeof(VkBool32); ++i) flags[i] = VK_TRUE;
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceFeatures2(VkPhysicalDevice gpu, VkPhysicalDeviceFeatures2KHR* features) {
+    GetPhysicalDeviceFeatures(gpu, &features->features);  // other extension structs in pNext are left as-is
+    auto* timeline = (VkPhysicalDeviceTimelineSemaphoreFeaturesKHR*)
+        FindNext(features->pNext, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR);
+    if (timeline) timeline->timelineSemaphore = VK_TRUE;
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceProperties2(VkPhysicalDevice gpu, VkPhysicalDeviceProperties2KHR* props) {
+    GetPhysicalDeviceProperties(gpu, &props->properties);
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceQueueFamilyProperties(VkPhysicalDevice, uint32_t* count, VkQueueFamilyProperties* props) {
+    VkQueueFamilyProperties family = {};
+    family.queueFlags                  = VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT | VK_QUEUE_SPARSE_BINDING_BIT;
+    family.queueCount                  = 16;
+    family.timestampValidBits          = 64;
+    family.minImageTransferGranularity = {1, 1, 1};
+    Enumerate(count, props, &family, 1);
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceMemoryProperties(VkPhysicalDevice, VkPhysicalDeviceMemoryProperties* props) {
+    const VkMemoryPropertyFlags host = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+    *props = {};
+    props->memoryTypeCount = 3;
+    props->memoryTypes[0]  = {VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, 0};
+    props->memoryTypes[1]  = {host | VK_MEMORY_PROPERTY_HOST_CACHED_BIT, 1};
+    props->memoryTypes[2]  = {host | VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, 0};
+    props->memoryHeapCount = 2;
+    props->memoryHeaps[0]  = {4ull << 30, VK_MEMORY_HEAP_DEVICE_LOCAL_BIT};
+    props->memoryHeaps[1]  = {4ull << 30, 0};
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceFormatProperties(VkPhysicalDevice, VkFormat, VkFormatProperties* props) {
+    const VkFormatFeatureFlags all = VK_FORMAT_FEATURE_FLAG_BITS_MAX_ENUM;  // every format supports everything
+    *props = {all, all, all};
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceImageFormatProperties(VkPhysicalDevice, VkFormat, VkImageType, VkImageTiling,
+                                                                             VkImageUsageFlags, VkImageCreateFlags, VkImageFormatProperties* props) {
+    *props = {{16384, 16384, 2048}, 15, 2048, VK_SAMPLE_COUNT_1_BIT, 1ull << 31};
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceSparseImageFormatProperties(VkPhysicalDevice, VkFormat, VkImageType, VkSampleCountFlagBits,
+                                                                               VkImageUsageFlags, VkImageTiling, uint32_t* count, VkSparseImageFormatProperties*) {
+    *count = 0;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL EnumerateDeviceExtensionProperties(VkPhysicalDevice, const char* layer, uint32_t* count, VkExtensionProperties* props) {
+    static const VkExtensionProperties exts[] = {
+        Extension(VK_KHR_SWAPCHAIN_EXTENSION_NAME, 68),
+        Extension(VK_EXT_DEBUG_MARKER_EXTENSION_NAME, 4),
+        Extension(VK_GOOGLE_DISPLAY_TIMING_EXTENSION_NAME, 1),
+        Extension(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME, 2),
+    };
+    if (layer) { *count = 0; return VK_ERROR_LAYER_NOT_PRESENT; }
+    return Enumerate(count, props, exts, sizeof(exts) / sizeof(exts[0]));
+}
+
+//----------------------------Surface-----------------------------
+template <typename INFO>  // Platform surfaces have no known size, so the swapchain picks it.
+static VKAPI_ATTR VkResult VKAPI_CALL CreateSurface(VkInstance, const INFO*, const VkAllocationCallbacks* allocator, VkSurfaceKHR* surface) {
+    CNullSurface* object = New<CNullSurface>(allocator, VkExtent2D{0xFFFFFFFF, 0xFFFFFFFF});
+    if (!object) return VK_ERROR_OUT_OF_HOST_MEMORY;
+    *surface = ToHandle<VkSurfaceKHR>(object);
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL CreateDisplayPlaneSurface(VkInstance, const VkDisplaySurfaceCreateInfoKHR* info,
+                                                                const VkAllocationCallbacks* allocator, VkSurfaceKHR* surface) {
+    CNullSurface* object = New<CNullSurface>(allocator, info->imageExtent);
+    if (!object) return VK_ERROR_OUT_OF_HOST_MEMORY;
+    *surface = ToHandle<VkSurfaceKHR>(object);
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL DestroySurface(VkInstance, VkSurfaceKHR surface, const VkAllocationCallbacks* allocator) {
+    Delete(allocator, ToObject<CNullSurface>(surface));
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfaceSupport(VkPhysicalDevice, uint32_t, VkSurfaceKHR, VkBool32* supported) {
+    *supported = VK_TRUE;
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfaceCapabilities(VkPhysicalDevice, VkSurfaceKHR surface, VkSurfaceCapabilitiesKHR* caps) {
+    *caps = {};
+    caps->minImageCount           = 1;
+    caps->maxImageCount           = 8;
+    caps->currentExtent           = ToObject<CNullSurface>(surface)->extent;
+    caps->minImageExtent          = {1, 1};
+    caps->maxImageExtent          = {16384, 16384};
+    caps->maxImageArrayLayers     = 1;
+    caps->supportedTransforms     = VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR;
+    caps->currentTransform        = VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR;
+    caps->supportedCompositeAlpha = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR;
+    caps->supportedUsageFlags     = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT |
+                                    VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_STORAGE_BIT;
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfaceFormats(VkPhysicalDevice, VkSurfaceKHR, uint32_t* count, VkSurfaceFormatKHR* formats) {
+    static const VkSurfaceFormatKHR list[] = {
+        {VK_FORMAT_B8G8R8A8_UNORM, VK_COLOR_SPACE_SRGB_NONLINEAR_KHR},
+        {VK_FORMAT_B8G8R8A8_SRGB,  VK_COLOR_SPACE_SRGB_NONLINEAR_KHR},
+        {VK_FORMAT_R8G8B8A8_UNORM, VK_COLOR_SPACE_SRGB_NONLINEAR_KHR},
+    };
+    return Enumerate(count, formats, list, sizeof(list) / sizeof(list[0]));
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfacePresentModes(VkPhysicalDevice, VkSurfaceKHR, uint32_t* count, VkPresentModeKHR* modes) {
+    static const VkPresentModeKHR list[] = {
+        VK_PRESENT_MODE_FIFO_KHR, VK_PRESENT_MODE_MAILBOX_KHR, VK_PRESENT_MODE_IMMEDIATE_KHR, VK_PRESENT_MODE_FIFO_RELAXED_KHR
+    };
+    return Enumerate(count, modes, list, sizeof(list) / sizeof(list[0]));
+}
+
+#ifdef VK_USE_PLATFORM_XCB_KHR
+static VKAPI_ATTR VkBool32 VKAPI_CALL GetPhysicalDeviceXcbPresentationSupport(VkPhysicalDevice, uint32_t, xcb_connection_t*, xcb_visualid_t) {
+    return VK_TRUE;
+}
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+static VKAPI_ATTR VkBool32 VKAPI_CALL GetPhysicalDeviceWin32PresentationSupport(VkPhysicalDevice, uint32_t) { return VK_TRUE; }
+#endif
+
+//----------------------------Device------------------------------
+static VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice, const VkDeviceCreateInfo*, const VkAllocationCallbacks*, VkDevice* device) {
+    *device = (VkDevice)&null_device;
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetDeviceQueue(VkDevice, uint32_t, uint32_t, VkQueue* queue) { *queue = (VkQueue)&null_queue; }
+
+// vkCreate* functions that just need a new handle.
+// With an allocator, the handle points to a CNullObject allocated with it, which the matching vkDestroy* frees.
+template <typename H> static VkResult NewObject(const VkAllocationCallbacks* allocator, H* handle) {
+    if (!allocator) { *handle = NewHandle<H>(); return VK_SUCCESS; }
+    CNullObject* object = New<CNullObject>(allocator, (uint64_t)++handle_count);
+    if (!object) return VK_ERROR_OUT_OF_HOST_MEMORY;
+    *handle = ToHandle<H>(object);
+    return VK_SUCCESS;
+}
+
+template <typename PARENT, typename INFO, typename H>
+static VKAPI_ATTR VkResult VKAPI_CALL Create(PARENT, const INFO*, const VkAllocationCallbacks* allocator, H* handle) {
+    return NewObject(allocator, handle);
+}
+
+template <typename PARENT, typename H>
+static VKAPI_ATTR void VKAPI_CALL Destroy(PARENT, H handle, const VkAllocationCallbacks* allocator) {
+    if (allocator) Delete(allocator, ToObject<CNullObject>(handle));  // (without one, the handle is just a number)
+}
+
+template <typename INFO>  // vkCreateGraphicsPipelines / vkCreateComputePipelines
+static VKAPI_ATTR VkResult VKAPI_CALL CreatePipelines(VkDevice, VkPipelineCache, uint32_t count, const INFO*,
+                                                      const VkAllocationCallbacks* allocator, VkPipeline* pipelines) {
+    for (uint32_t i = 0; i < count; ++i) {
+        VkResult result = NewObject(allocator, &pipelines[i]);
+        if (result != VK_SUCCESS) return result;
+    }
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL AllocateCommandBuffers(VkDevice, const VkCommandBufferAllocateInfo* info, VkCommandBuffer* buffers) {
+    for (uint32_t i = 0; i < info->commandBufferCount; ++i) buffers[i] = NewHandle<VkCommandBuffer>();
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL AllocateDescriptorSets(VkDevice, const VkDescriptorSetAllocateInfo* info, VkDescriptorSet* sets) {
+    for (uint32_t i = 0; i < info->descriptorSetCount; ++i) sets[i] = NewHandle<VkDescriptorSet>();
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL GetPipelineCacheData(VkDevice, VkPipelineCache, size_t* size, void*) {
+    *size = 0;
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL GetQueryPoolResults(VkDevice, VkQueryPool, uint32_t, uint32_t, size_t size, void* data, VkDeviceSize, VkQueryResultFlags) {
+    memset(data, 0, size);  // All queries are available, and read zero. (No GPU work is done, so timestamps don't advance.)
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetRenderAreaGranularity(VkDevice, VkRenderPass, VkExtent2D* granularity) { *granularity = {1, 1}; }
+
+//----------------------------Memory------------------------------
+// Device memory is host memory, so mapped writes (eg: uniform buffers) still cost what they would on a GPU.
+static VKAPI_ATTR VkResult VKAPI_CALL AllocateMemory(VkDevice, const VkMemoryAllocateInfo* info, const VkAllocationCallbacks*, VkDeviceMemory* memory) {
+    void* block = malloc(info->allocationSize ? (size_t)info->allocationSize : 1);
+    if (!block) return VK_ERROR_OUT_OF_HOST_MEMORY;
+    *memory = ToHandle<VkDeviceMemory>(block);
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL FreeMemory(VkDevice, VkDeviceMemory memory, const VkAllocationCallbacks*) {
+    free(ToObject<void>(memory));
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL MapMemory(VkDevice, VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize, VkMemoryMapFlags, void** data) {
+    *data = ToObject<char>(memory) + offset;
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL CreateBuffer(VkDevice, const VkBufferCreateInfo* info, const VkAllocationCallbacks* allocator, VkBuffer* buffer) {
+    CNullBuffer* object = New<CNullBuffer>(allocator, info->size);
+    if (!object) return VK_ERROR_OUT_OF_HOST_MEMORY;
+    *buffer = ToHandle<VkBuffer>(object);
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL DestroyBuffer(VkDevice, VkBuffer buffer, const VkAllocationCallbacks* allocator) {
+    Delete(allocator, ToObject<CNullBuffer>(buffer));
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetBufferMemoryRequirements(VkDevice, VkBuffer buffer, VkMemoryRequirements* reqs) {
+    reqs->size           = ToObject<CNullBuffer>(buffer)->size;
+    reqs->alignment      = 256;
+    reqs->memoryTypeBits = 0x7;
+}
+
+static VkDeviceSize ImageSize(const VkImageCreateInfo* info) {  // 4 bytes per texel, for all mip levels
+    return 4ull * info->extent.width * info->extent.height * info->extent.depth * info->arrayLayers * (info->mipLevels > 1 ? 2 : 1);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL CreateImage(VkDevice, const VkImageCreateInfo* info, const VkAllocationCallbacks* allocator, VkImage* image) {
+    CNullImage* object = New<CNullImage>(allocator, ImageSize(info));
+    if (!object) return VK_ERROR_OUT_OF_HOST_MEMORY;
+    *image = ToHandle<VkImage>(object);
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL DestroyImage(VkDevice, VkImage image, const VkAllocationCallbacks* allocator) {
+    Delete(allocator, ToObject<CNullImage>(image));
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetImageMemoryRequirements(VkDevice, VkImage image, VkMemoryRequirements* reqs) {
+    reqs->size           = ToObject<CNullImage>(image)->size;
+    reqs->alignment      = 256;
+    reqs->memoryTypeBits = 0x7;
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetImageSubresourceLayout(VkDevice, VkImage image, const VkImageSubresource*, VkSubresourceLayout* layout) {
+    *layout = {};
+    layout->size = ToObject<CNullImage>(image)->size;
+}
+
+//---------------------------Swapchain----------------------------
+static VKAPI_ATTR VkResult VKAPI_CALL CreateSwapchain(VkDevice, const VkSwapchainCreateInfoKHR* info, const VkAllocationCallbacks* allocator, VkSwapchainKHR* swapchain) {
+    uint32_t count = info->minImageCount < 1 ? 1 : info->minImageCount > 8 ? 8 : info->minImageCount;
+    VkDeviceSize size = 4ull * info->imageExtent.width * info->imageExtent.height;
+    CNullSwapchain* chain = New<CNullSwapchain>(allocator);
+    if (!chain) return VK_ERROR_OUT_OF_HOST_MEMORY;
+    for (uint32_t i = 0; i < count; ++i) chain->images.push_back(ToHandle<VkImage>(New<CNullImage>(allocator, size)));  // owned by the swapchain
+    *swapchain = ToHandle<VkSwapchainKHR>(chain);
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL DestroySwapchain(VkDevice, VkSwapchainKHR swapchain, const VkAllocationCallbacks* allocator) {
+    CNullSwapchain* chain = ToObject<CNullSwapchain>(swapchain);
+    if (!chain) return;
+    for (VkImage image : chain->images) Delete(allocator, ToObject<CNullImage>(image));
+    Delete(allocator, chain);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL GetSwapchainImages(VkDevice, VkSwapchainKHR swapchain, uint32_t* count, VkImage* images) {
+    CNullSwapchain* chain = ToObject<CNullSwapchain>(swapchain);
+    return Enumerate(count, images, chain->images.data(), (uint32_t)chain->images.size());
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL AcquireNextImage(VkDevice, VkSwapchainKHR swapchain, uint64_t, VkSemaphore, VkFence, uint32_t* index) {
+    CNullSwapchain* chain = ToObject<CNullSwapchain>(swapchain);
+    *index = chain->next;
+    chain->next = (chain->next + 1) % (uint32_t)chain->images.size();
+    return VK_SUCCESS;
+}
+
+//-------------------------Display timing-------------------------
+// A simulated 60Hz display, on the steady_clock (CLOCK_MONOTONIC) timeline. Presents don't block,
+// but each one is reported as shown at the first vblank after it was queued, (and not before its desiredPresentTime)
+static const uint64_t null_refresh_ns = 16666667;
+
+static uint64_t NextVblank(uint64_t time) { return (time / null_refresh_ns + 1) * null_refresh_ns; }
+
+static VKAPI_ATTR VkResult VKAPI_CALL GetRefreshCycleDuration(VkDevice, VkSwapchainKHR, VkRefreshCycleDurationGOOGLE* props) {
+    props->refreshDuration = null_refresh_ns;
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL GetPastPresentationTiming(VkDevice, VkSwapchainKHR swapchain, uint32_t* count, VkPastPresentationTimingGOOGLE* timings) {
+    CNullSwapchain* chain = ToObject<CNullSwapchain>(swapchain);
+    VkResult result = Enumerate(count, timings, chain->timings.data(), (uint32_t)chain->timings.size());
+    if (timings) chain->timings.erase(chain->timings.begin(), chain->timings.begin() + *count);  // Each result is only returned once.
+    return result;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL QueuePresent(VkQueue, const VkPresentInfoKHR* info) {
+    auto* times = (const VkPresentTimesInfoGOOGLE*)FindNext(info->pNext, VK_STRUCTURE_TYPE_PRESENT_TIMES_INFO_GOOGLE);
+    if (!times || !times->pTimes) return VK_SUCCESS;
+
+    uint64_t now = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    for (uint32_t i = 0; i < info->swapchainCount && i < times->swapchainCount; ++i) {
+        const VkPresentTimeGOOGLE& time = times->pTimes[i];
+        VkPastPresentationTimingGOOGLE timing = {};
+        timing.presentID           = time.presentID;
+        timing.desiredPresentTime  = time.desiredPresentTime;
+        timing.earliestPresentTime = NextVblank(now);
+        timing.actualPresentTime   = NextVblank(time.desiredPresentTime > now ? time.desiredPresentTime : now);
+        timing.presentMargin       = timing.earliestPresentTime - now;
+        CNullSwapchain* chain = ToObject<CNullSwapchain>(info->pSwapchains[i]);
+        if (chain->timings.size() < 64) chain->timings.push_back(timing);
+    }
+    return VK_SUCCESS;
+}
+
+//----------------------Timeline semaphores-----------------------
+// The GPU is done as soon as a batch is submitted, so signal its timeline semaphores right away.
+static VKAPI_ATTR VkResult VKAPI_CALL CreateSemaphore(VkDevice, const VkSemaphoreCreateInfo* info, const VkAllocationCallbacks* allocator, VkSemaphore* semaphore) {
+    auto* type = (const VkSemaphoreTypeCreateInfoKHR*)FindNext(info->pNext, VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO_KHR);
+    bool timeline = type && type->semaphoreType == VK_SEMAPHORE_TYPE_TIMELINE_KHR;
+    CNullSemaphore* object = New<CNullSemaphore>(allocator, timeline ? type->initialValue : 0, timeline);
+    if (!object) return VK_ERROR_OUT_OF_HOST_MEMORY;
+    *semaphore = ToHandle<VkSemaphore>(object);
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL DestroySemaphore(VkDevice, VkSemaphore semaphore, const VkAllocationCallbacks* allocator) {
+    Delete(allocator, ToObject<CNullSemaphore>(semaphore));
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL QueueSubmit(VkQueue, uint32_t count, const VkSubmitInfo* submits, VkFence) {
+    for (uint32_t i = 0; i < count; ++i) {
+        const VkSubmitInfo& submit = submits[i];
+        auto* values = (const VkTimelineSemaphoreSubmitInfoKHR*)FindNext(submit.pNext, VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR);
+        if (!values) continue;
+        for (uint32_t j = 0; j < submit.signalSemaphoreCount && j < values->signalSemaphoreValueCount; ++j) {
+            CNullSemaphore* semaphore = ToObject<CNullSemaphore>(submit.pSignalSemaphores[j]);
+            if (semaphore->timeline) semaphore->value = values->pSignalSemaphoreValues[j];
+        }
+    }
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreCounterValue(VkDevice, VkSemaphore semaphore, uint64_t* value) {
+    *value = ToObject<CNullSemaphore>(semaphore)->value;
+    return VK_SUCCESS;
+}
+
+// Nothing else will signal the semaphores, so a wait for values that were not submitted times out at once.
+static VKAPI_ATTR VkResult VKAPI_CALL WaitSemaphores(VkDevice, const VkSemaphoreWaitInfoKHR* info, uint64_t) {
+    const VkSemaphoreWaitFlagsKHR WAIT_ANY = 1;  // VK_SEMAPHORE_WAIT_ANY_BIT_KHR
+    uint32_t reached = 0;
+    for (uint32_t i = 0; i < info->semaphoreCount; ++i)
+        if (ToObject<CNullSemaphore>(info->pSemaphores[i])->value >= info->pValues[i]) reached++;
+    bool done = (info->flags & WAIT_ANY) ? reached > 0 : reached == info->semaphoreCount;
+    return done ? VK_SUCCESS : VK_TIMEOUT;
+}
+
+//-------------------------Function table-------------------------
+struct CNullProc {
+    const char*        name;
+    PFN_vkVoidFunction proc;
+};
+
+// static_cast checks that each function matches the signature of the Vulkan function it replaces.
+#define PROC(NAME, FN) {"vk" #NAME, (PFN_vkVoidFunction)static_cast<PFN_vk##NAME>(FN)}
+
+static const CNullProc null_procs[] = {
+    PROC(CreateInstance,                             CreateInstance),
+    PROC(EnumerateInstanceExtensionProperties,       EnumerateInstanceExtensionProperties),
+    PROC(EnumerateInstanceLayerProperties,           EnumerateInstanceLayerProperties),
+    PROC(EnumerateDeviceLayerProperties,             (EnumerateLayers<VkPhysicalDevice, VkLayerProperties>)),
+    PROC(EnumeratePhysicalDevices,                   EnumeratePhysicalDevices),
+    PROC(GetPhysicalDeviceProperties,                GetPhysicalDeviceProperties),
+    PROC(GetPhysicalDeviceProperties2KHR,            GetPhysicalDeviceProperties2),
+    PROC(GetPhysicalDeviceFeatures,                  GetPhysicalDeviceFeatures),
+    PROC(GetPhysicalDeviceFeatures2KHR,              GetPhysicalDeviceFeatures2),
+    PROC(GetPhysicalDeviceQueueFamilyProperties,     GetPhysicalDeviceQueueFamilyProperties),
+    PROC(GetPhysicalDeviceMemoryProperties,          GetPhysicalDeviceMemoryProperties),
+    PROC(GetPhysicalDeviceFormatProperties,          GetPhysicalDeviceFormatProperties),
+    PROC(GetPhysicalDeviceImageFormatProperties,     GetPhysicalDeviceImageFormatProperties),
+    PROC(GetPhysicalDeviceSparseImageFormatProperties, GetPhysicalDeviceSparseImageFormatProperties),
+    PROC(EnumerateDeviceExtensionProperties,         EnumerateDeviceExtensionProperties),
+    PROC(CreateDebugReportCallbackEXT,               (Create<VkInstance, VkDebugReportCallbackCreateInfoEXT, VkDebugReportCallbackEXT>)),
+    PROC(DestroyDebugReportCallbackEXT,              (Destroy<VkInstance, VkDebugReportCallbackEXT>)),
+    //--Surface--
+    PROC(CreateDisplayPlaneSurfaceKHR,               CreateDisplayPlaneSurface),
+#ifdef VK_USE_PLATFORM_XCB_KHR
+    PROC(CreateXcbSurfaceKHR,                        CreateSurface<VkXcbSurfaceCreateInfoKHR>),
+    PROC(GetPhysicalDeviceXcbPresentationSupportKHR, GetPhysicalDeviceXcbPresentationSupport),
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    PROC(CreateWin32SurfaceKHR,                      CreateSurface<VkWin32SurfaceCreateInfoKHR>),
+    PROC(GetPhysicalDeviceWin32PresentationSupportKHR, GetPhysicalDeviceWin32PresentationSupport),
+#endif
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+    PROC(CreateAndroidSurfaceKHR,                    CreateSurface<VkAndroidSurfaceCreateInfoKHR>),
+#endif
+    PROC(DestroySurfaceKHR,                          DestroySurface),
+    PROC(GetPhysicalDeviceSurfaceSupportKHR,         GetPhysicalDeviceSurfaceSupport),
+    PROC(GetPhysicalDeviceSurfaceCapabilitiesKHR,    GetPhysicalDeviceSurfaceCapabilities),
+    PROC(GetPhysicalDeviceSurfaceFormatsKHR,         GetPhysicalDeviceSurfaceFormats),
+    PROC(GetPhysicalDeviceSurfacePresentModesKHR,    GetPhysicalDeviceSurfacePresentModes),
+    //--Device--
+    PROC(CreateDevice,                               CreateDevice),
+    PROC(GetDeviceQueue,                             GetDeviceQueue),
+    PROC(CreateFence,                                (Create<VkDevice, VkFenceCreateInfo,               VkFence>)),
+    PROC(DestroyFence,                               (Destroy<VkDevice, VkFence>)),
+    PROC(CreateSemaphore,                            CreateSemaphore),
+    PROC(DestroySemaphore,                           DestroySemaphore),
+    PROC(QueueSubmit,                                QueueSubmit),
+    PROC(CreateEvent,                                (Create<VkDevice, VkEventCreateInfo,               VkEvent>)),
+    PROC(DestroyEvent,                               (Destroy<VkDevice, VkEvent>)),
+    PROC(CreateQueryPool,                            (Create<VkDevice, VkQueryPoolCreateInfo,           VkQueryPool>)),
+    PROC(DestroyQueryPool,                           (Destroy<VkDevice, VkQueryPool>)),
+    PROC(CreateBufferView,                           (Create<VkDevice, VkBufferViewCreateInfo,          VkBufferView>)),
+    PROC(DestroyBufferView,                          (Destroy<VkDevice, VkBufferView>)),
+    PROC(CreateImageView,                            (Create<VkDevice, VkImageViewCreateInfo,           VkImageView>)),
+    PROC(DestroyImageView,                           (Destroy<VkDevice, VkImageView>)),
+    PROC(CreateShaderModule,                         (Create<VkDevice, VkShaderModuleCreateInfo,        VkShaderModule>)),
+    PROC(DestroyShaderModule,                        (Destroy<VkDevice, VkShaderModule>)),
+    PROC(CreatePipelineCache,                        (Create<VkDevice, VkPipelineCacheCreateInfo,       VkPipelineCache>)),
+    PROC(DestroyPipelineCache,                       (Destroy<VkDevice, VkPipelineCache>)),
+    PROC(CreatePipelineLayout,                       (Create<VkDevice, VkPipelineLayoutCreateInfo,      VkPipelineLayout>)),
+    PROC(DestroyPipelineLayout,                      (Destroy<VkDevice, VkPipelineLayout>)),
+    PROC(CreateSampler,                              (Create<VkDevice, VkSamplerCreateInfo,             VkSampler>)),
+    PROC(DestroySampler,                             (Destroy<VkDevice, VkSampler>)),
+    PROC(CreateDescriptorSetLayout,                  (Create<VkDevice, VkDescriptorSetLayoutCreateInfo, VkDescriptorSetLayout>)),
+    PROC(DestroyDescriptorSetLayout,                 (Destroy<VkDevice, VkDescriptorSetLayout>)),
+    PROC(CreateDescriptorPool,                       (Create<VkDevice, VkDescriptorPoolCreateInfo,      VkDescriptorPool>)),
+    PROC(DestroyDescriptorPool,                      (Destroy<VkDevice, VkDescriptorPool>)),
+    PROC(CreateFramebuffer,                          (Create<VkDevice, VkFramebufferCreateInfo,         VkFramebuffer>)),
+    PROC(DestroyFramebuffer,                         (Destroy<VkDevice, VkFramebuffer>)),
+    PROC(CreateRenderPass,                           (Create<VkDevice, VkRenderPassCreateInfo,          VkRenderPass>)),
+    PROC(DestroyRenderPass,                          (Destroy<VkDevice, VkRenderPass>)),
+    PROC(CreateCommandPool,                          (Create<VkDevice, VkCommandPoolCreateInfo,         VkCommandPool>)),
+    PROC(DestroyCommandPool,                         (Destroy<VkDevice, VkCommandPool>)),
+    PROC(CreateGraphicsPipelines,                    CreatePipelines<VkGraphicsPipelineCreateInfo>),
+    PROC(CreateComputePipelines,                     CreatePipelines<VkComputePipelineCreateInfo>),
+    PROC(DestroyPipeline,                            (Destroy<VkDevice, VkPipeline>)),
+    PROC(AllocateCommandBuffers,                     AllocateCommandBuffers),
+    PROC(AllocateDescriptorSets,                     AllocateDescriptorSets),
+    PROC(GetPipelineCacheData,                       GetPipelineCacheData),
+    PROC(GetRenderAreaGranularity,                   GetRenderAreaGranularity),
+    PROC(GetQueryPoolResults,                        GetQueryPoolResults),
+    //--Memory--
+    PROC(AllocateMemory,                             AllocateMemory),
+    PROC(FreeMemory,                                 FreeMemory),
+    PROC(MapMemory,                                  MapMemory),
+    PROC(CreateBuffer,                               CreateBuffer),
+    PROC(DestroyBuffer,                              DestroyBuffer),
+    PROC(GetBufferMemoryRequirements,                GetBufferMemoryRequirements),
+    PROC(CreateImage,                                CreateImage),
+    PROC(DestroyImage,                               DestroyImage),
+    PROC(GetImageMemoryRequirements,                 GetImageMemoryRequirements),
+    PROC(GetImageSubresourceLayout,                  GetImageSubresourceLayout),
+    //--Swapchain--
+    PROC(CreateSwapchainKHR,                         CreateSwapchain),
+    PROC(DestroySwapchainKHR,                        DestroySwapchain),
+    PROC(GetSwapchainImagesKHR,                      GetSwapchainImages),
+    PROC(AcquireNextImageKHR,                        AcquireNextImage),
+    PROC(QueuePresentKHR,                            QueuePresent),
+    PROC(GetRefreshCycleDurationGOOGLE,              GetRefreshCycleDuration),
+    PROC(GetPastPresentationTimingGOOGLE,            GetPastPresentationTiming),
+    //--Timeline semaphores--
+    PROC(GetSemaphoreCounterValueKHR,                GetSemaphoreCounterValue),
+    PROC(WaitSemaphoresKHR,                          WaitSemaphores),
+};
+#undef PROC
+
+// Returns the null driver's version of a function, or nullptr, for vulkan_wrapper to use a no-op instead.
+VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL NullDriverGetInstanceProcAddr(VkInstance instance, const char* name) {
+    for (const CNullProc& proc : null_procs)
+        if (!strcmp(name, proc.name)) return proc.proc;
+    return nullptr;
+}
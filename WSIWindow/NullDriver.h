@@ -0,0 +1,39 @@
+// Copyright (c) 2017 Rene Lindsay
+
+/*
+*  The null driver is an in-process Vulkan "driver", which does no GPU work at all.  (WARNING: work in progress)
+*
+*  It is used to measure the CPU cost of WSIWindow and the app itself, (picklists, swapchain bookkeeping,
+*  command recording, etc.) on machines without a GPU.  It plugs into vulkan_wrapper, so it requires the
+*  USE_VULKAN_WRAPPER CMake option, and replaces the Vulkan loader, so validation layers are not available.
+*
+*  - It reports one fake GPU, ("Null Vulkan Device") with a single queue family, that supports everything.
+*  - vkCreate* / vkAllocate* functions return unique handles, but create nothing.
+*  - Device memory is real host memory, so it can be mapped and written to.
+*  - Swapchains have real image handles, and vkAcquireNextImageKHR cycles through them.
+*  - VK_KHR_timeline_semaphore is supported. The GPU is "done" with each batch as soon as it is submitted,
+*    so timeline semaphores are signaled by vkQueueSubmit.  (Fences are always signaled.)
+*  - All other functions, including all vkCmd* functions, are no-ops, that return VK_SUCCESS.
+*
+*  While the null driver is active, WSIWindow creates a headless window, with no OS window or events,
+*  which keeps running until Close() is called.
+*
+*  eg:
+*    UseNullDriver();                 // Call before creating the CInstance.
+*    CInstance instance;
+*    WSIWindow window;                // headless
+*    ...
+*    while (window.ProcessEvents()) { DrawFrame(); if (++frames == 1000) window.Close(); }
+*/
+
+#ifndef NULLDRIVER_H
+#define NULLDRIVER_H
+
+#include "Validation.h"
+
+bool UseNullDriver();     // Route all Vulkan calls to the null driver. Returns false if not supported by this build.
+bool NullDriverActive();  // Returns true if UseNullDriver() succeeded.
+
+VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL NullDriverGetInstanceProcAddr(VkInstance instance, const char* name);
+
+#endif
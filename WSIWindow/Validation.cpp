@@ -21,22 +21,21 @@
 */
 
 #include "Validation.h"
+#include "CAllocator.h"
 #include <string.h>  // for strlen
+#include <ctype.h>   // for isdigit
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
 
 //--------------------Vulkan Dispatch Table---------------------
 // WARNING: vulkan_wrapper.h must be #included BEFORE vulkan.h
 
 #ifdef VK_NO_PROTOTYPES
 #ifdef __LINUX__
-#include <vulkan_wrapper.cpp>
+#include <vulkan_wrapper.cpp>  // Functions are resolved on first call. (See CInstance::Create)
 #endif
-struct INITVULKAN {
-    INITVULKAN() {
-        bool success = (InitVulkan() == 1);  // Returns true if this device supports Vulkan.
-        printf("Initialize Vulkan: ");
-        print(success ? eGREEN : eRED, success ? "SUCCESS\n" : "FAILED (Vulkan driver not found.)\n");
-    }
-} INITVULKAN;  // Run this function BEFORE main.
 #endif
 
 //-------------------------------------------------------------
@@ -98,8 +97,54 @@ void ShowVkResult(VkResult err) {
     if (err < 0) _LOGE("%s ", VkResultStr(err));  // Print error
 }
 #else
+const char* VkResultStr(VkResult err) { return ""; }
 void ShowVkResult(VkResult err) {}
 #endif
+
+//--------------------------VkResult stats-------------------------
+// Lock-free table of non-success results, counted by VkResultFail. (Slot is free while result == VK_SUCCESS.)
+struct CResultCount {
+    std::atomic<int32_t>  result;
+    std::atomic<uint32_t> count;
+    const char*           file;  // first call site
+    int                   line;
+};
+static CResultCount result_stats[32];
+static PFN_VkErrorHandler error_handler = nullptr;
+
+static void CountVkResult(VkResult result, const char* file, int line) {
+    for (CResultCount& slot : result_stats) {
+        int32_t found = slot.result.load(std::memory_order_acquire);
+        if (found == VK_SUCCESS) {  // free slot: claim it
+            if (slot.result.compare_exchange_strong(found, result)) {
+                slot.file = file;
+                slot.line = line;
+                found     = result;
+            }
+        }
+        if (found == result) { slot.count.fetch_add(1, std::memory_order_relaxed); return; }
+    }
+}
+
+COLD void VkResultFail(VkResult result, const char* file, int line) {
+    CountVkResult(result, file, line);
+    if (result > 0) return;  // non-fatal: only count it
+    if (error_handler) return error_handler(result, file, line);
+    _LOGE("%s (%d) at %s:%d\n", VkResultStr(result), result, file, line);
+    assert(!"VKERRCHECK failed");
+}
+
+void SetVkErrorHandler(PFN_VkErrorHandler handler) { error_handler = handler; }
+
+void PrintVkResultStats() {
+    bool header = false;
+    for (CResultCount& slot : result_stats) {
+        if (slot.result.load() == VK_SUCCESS) break;
+        if (!header) { LOG_FLUSH(); printf("VkResult counts:\n"); header = true; }
+        printf("\t%8d  %-32s (first at %s:%d)\n", slot.count.load(), VkResultStr((VkResult)slot.result.load()),
+               slot.file ? slot.file : "?", slot.line);
+    }
+}
 //----------------------------------------------------------------
 // clang-format off
 //------------------------------------DEBUG REPORT CALLBACK-----------------------------------
@@ -123,14 +168,114 @@ DebugReportFn(VkDebugReportFlagsEXT msgFlags, VkDebugReportObjectTypeEXT objType
 }
 //--------------------------------------------------------------------------------------------
 
+//---------------------------------------CMessageStats----------------------------------------
+//  Counts validation messages by ID, and decides which ones to pass on to the callback.
+//  The layers don't provide message IDs, (msgCode is always 0) so the ID is a hash of the message text,
+//  skipping numbers that follow a space or symbol, (object handles, indices, etc.) but not VUID numbers.
+
+struct CMessageCount {
+    uint64_t              id;        // hash of the message (0 = empty slot)
+    VkDebugReportFlagsEXT flags;
+    uint32_t              count;     // times reported
+    uint32_t              printed;   // times passed on to the callback
+    char                  text[96];  // start of the first message, for the summary
+};
+
+struct CMessageStats {
+    static const uint32_t MAX_IDS = 1024;          // hash-table size (power of 2)
+    std::mutex    lock;                            // Layers may call back from any thread.
+    CMessageCount ids[MAX_IDS];
+    uint32_t      id_count;
+    uint32_t      second_count;                    // messages passed on, in the current second
+    uint32_t      second_dropped;                  // messages dropped by the rate limit, in the current second
+    uint32_t      total_dropped;                   // messages dropped by the rate limit, since start (for the summary)
+    std::chrono::steady_clock::time_point second;  // start of the current second
+
+    CMessageStats() : ids(), id_count(0), second_count(0), second_dropped(0), total_dropped(0),
+                      second(std::chrono::steady_clock::now()) {}
+
+    static uint64_t Hash(int32_t code, const char* layer, const char* msg) {
+        uint64_t hash = 14695981039346656037ULL ^ (uint32_t)code;  // FNV-1a
+        for (const char* str : {layer, msg}) {
+            char prev = ' ';
+            for (const char* c = str; *c; prev = *c++) {
+                bool word = (prev == '-' || prev == '_' || isalnum((unsigned char)prev));
+                if (!word && isdigit((unsigned char)*c)) {                  // skip a number, or a 0x... handle
+                    while (isxdigit((unsigned char)c[1]) || c[1] == 'x') c++;
+                    continue;
+                }
+                hash = (hash ^ (uint8_t)*c) * 1099511628211ULL;
+            }
+        }
+        return hash ? hash : 1;
+    }
+
+    CMessageCount* Find(uint64_t id) {  // Find or add the entry for this ID. Returns null if the table is full.
+        for (uint32_t i = 0; i < MAX_IDS; ++i) {
+            CMessageCount& entry = ids[(id + i) & (MAX_IDS - 1)];
+            if (entry.id == id) return &entry;
+            if (entry.id == 0) { entry.id = id; id_count++; return &entry; }
+        }
+        return nullptr;
+    }
+
+    // Count the message, and return true if it should be passed on to the callback.
+    // dropped returns the number of messages dropped in the previous second, (to report) even if this one is dropped too.
+    bool Count(VkDebugReportFlagsEXT flags, int32_t code, const char* layer, const char* msg,
+               uint32_t max_repeats, uint32_t max_per_second, bool& last, uint32_t& dropped) {
+        std::lock_guard<std::mutex> guard(lock);
+        last    = false;
+        dropped = 0;
+        if (max_per_second) {  // start a new second
+            auto now = std::chrono::steady_clock::now();
+            if (now - second >= std::chrono::seconds(1)) {
+                dropped        = second_dropped;
+                second         = now;
+                second_count   = 0;
+                second_dropped = 0;
+            }
+        }
+        CMessageCount* entry = Find(Hash(code, layer, msg));
+        if (!entry) return true;
+        if (entry->count++ == 0) {
+            entry->flags = flags;
+            snprintf(entry->text, sizeof(entry->text), "%s", msg);
+        }
+        if (max_repeats && entry->printed >= max_repeats) return false;
+
+        if (max_per_second) {
+            if (second_count >= max_per_second) { second_dropped++; total_dropped++; return false; }
+            second_count++;
+        }
+        last = (++entry->printed == max_repeats);
+        return true;
+    }
+};
+//--------------------------------------------------------------------------------------------
+
 //----------------------------------------CDebugReport----------------------------------------
 
+VKAPI_ATTR VkBool32 VKAPI_CALL
+CDebugReport::Filter(VkDebugReportFlagsEXT msgFlags, VkDebugReportObjectTypeEXT objType, uint64_t srcObject,
+        size_t location, int32_t msgCode, const char *pLayerPrefix, const char *pMsg, void *pUserData) {
+    CDebugReport& self = *(CDebugReport*)pUserData;
+    bool last;
+    uint32_t dropped;
+    bool pass = self.stats->Count(msgFlags, msgCode, pLayerPrefix, pMsg, self.max_repeats, self.max_per_second, last, dropped);
+    if (dropped) LOGW("%d validation messages were dropped by the rate limit.\n", dropped);
+    if (!pass) return (msgFlags & VK_DEBUG_REPORT_ERROR_BIT_EXT) ? VK_TRUE : VK_FALSE;  // dropped: still bail out on errors
+    VkBool32 result = self.func(msgFlags, objType, srcObject, location, msgCode, pLayerPrefix, pMsg, nullptr);
+    if (last) LOG("\t(Further repeats of this message are counted, but not shown.)\n");
+    return result;
+}
+
 void CDebugReport::Init(VkInstance inst) {
     assert(!!inst);
     vkCreateDebugReportCallbackEXT  = (PFN_vkCreateDebugReportCallbackEXT)  vkGetInstanceProcAddr(inst, "vkCreateDebugReportCallbackEXT" );
     vkDestroyDebugReportCallbackEXT = (PFN_vkDestroyDebugReportCallbackEXT) vkGetInstanceProcAddr(inst, "vkDestroyDebugReportCallbackEXT");
 
     instance = inst;
+    if (!stats) stats = new CMessageStats();
     func  = DebugReportFn;                                 // Use default debug-report function.
     flags = VK_DEBUG_REPORT_INFORMATION_BIT_EXT         |  // 1
             VK_DEBUG_REPORT_WARNING_BIT_EXT             |  // 2
@@ -155,16 +300,57 @@ void CDebugReport::Set(VkDebugReportFlagsEXT newFlags, PFN_vkDebugReportCallback
     create_info.sType                              = VK_STRUCTURE_TYPE_DEBUG_REPORT_CREATE_INFO_EXT;
     create_info.pNext                              = NULL;
     create_info.flags                              = newFlags;
-    create_info.pfnCallback                        = newFunc; // Callback function to call
-    create_info.pUserData                          = NULL;
-    VKERRCHECK(vkCreateDebugReportCallbackEXT(instance, &create_info, NULL, &debug_report_callback));
+    create_info.pfnCallback                        = Filter;  // Filter calls func
+    create_info.pUserData                          = this;
+    VKERRCHECK(vkCreateDebugReportCallbackEXT(instance, &create_info, HostAllocator(), &debug_report_callback));
 }
 
 void CDebugReport::Destroy() {
-    if (debug_report_callback) vkDestroyDebugReportCallbackEXT(instance, debug_report_callback, NULL);
+    if (debug_report_callback) vkDestroyDebugReportCallbackEXT(instance, debug_report_callback, HostAllocator());
+    debug_report_callback = 0;
+}
+
+void CDebugReport::SetRateLimit(uint32_t repeats, uint32_t per_second) {
+    max_repeats    = repeats;
+    max_per_second = per_second;
+}
+
+void CDebugReport::PrintSummary() {  // Print message counts, sorted by count.
+    if (!stats) return;
+    std::lock_guard<std::mutex> guard(stats->lock);
+    CMessageCount* list[CMessageStats::MAX_IDS];
+    uint32_t count = 0;
+    uint32_t total[5] = {};  // info, warn, perf, error, debug
+    for (CMessageCount& entry : stats->ids) {
+        if (!entry.count) continue;
+        list[count++] = &entry;
+        for (uint32_t i = 0; i < 5; ++i) if (entry.flags & (1 << i)) total[i] += entry.count;
+    }
+    if (!count) return;
+    std::sort(list, list + count, [](CMessageCount* a, CMessageCount* b) { return a->count > b->count; });
+
+    LOG_FLUSH();
+    printf("Validation messages: %d IDs  (errors: %d  warnings: %d  perf: %d  info: %d  debug: %d)\n",
+           count, total[3], total[1], total[2], total[0], total[4]);
+    printf("\t  Count  Shown  Type   Message\n");
+    const char*  names [] = {"INFO ", "WARN ", "PERF ", "ERROR", "DEBUG"};
+    const eColor colors[] = {eGREEN, eYELLOW, eCYAN, eRED, eBLUE};
+    const uint32_t max_rows = 20;
+    for (uint32_t i = 0; i < count && i < max_rows; ++i) {
+        CMessageCount& entry = *list[i];
+        uint32_t type = 0;
+        while (type < 4 && !(entry.flags & (1 << type))) type++;
+        printf("\t%7d  %5d  ", entry.count, entry.printed);
+        print(colors[type], "%s", names[type]);
+        printf("  %.70s\n", entry.text);
+    }
+    if (count > max_rows) printf("\t... and %d more\n", count - max_rows);
+    if (stats->total_dropped)  // includes the last second's drops, which were never reported
+        print(eYELLOW, "\t%d messages were dropped by the rate limit.\n", stats->total_dropped);
 }
 
 void CDebugReport::Print() {  // print the state of the report flags
+    LOG_FLUSH();
     printf("Debug Report flags : [");
     if(flags&  1) { print(eGREEN, "INFO:1 |"); } else { print(eFAINT, "info:0 |"); }
     if(flags&  2) { print(eYELLOW,"WARN:2 |"); } else { print(eFAINT, "warn:0 |"); }
@@ -174,11 +360,16 @@ void CDebugReport::Print() {  // print the state of the report flags
     print(eRESET,"] = %d\n",flags);
 }
 
+CDebugReport::~CDebugReport() { delete stats; }
+
 #else   // No Validation
 void CDebugReport::SetFlags(VkDebugReportFlagsEXT flags)              { LOGW("Vulkan Validation was not enabled at compile-time.\n"); }
 void CDebugReport::SetCallback(PFN_vkDebugReportCallbackEXT debugFunc){ LOGW("Vulkan Validation was not enabled at compile-time.\n"); }
+void CDebugReport::SetRateLimit(uint32_t repeats, uint32_t per_second){ LOGW("Vulkan Validation was not enabled at compile-time.\n"); }
+void CDebugReport::PrintSummary() {}
+CDebugReport::~CDebugReport() {}
 #endif  // ENABLE_VALIDATION
 
 CDebugReport::CDebugReport(): vkCreateDebugReportCallbackEXT(0),vkDestroyDebugReportCallbackEXT(0),
-    debug_report_callback(0), instance(0), func(0), flags(0) {}
+    debug_report_callback(0), instance(0), func(0), flags(0), stats(0), max_repeats(5), max_per_second(50) {}
 //--------------------------------------------------------------------------------------------
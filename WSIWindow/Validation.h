@@ -27,6 +27,7 @@
 *-------Vars defined by CMAKE:-------
 *  #define ENABLE_VALIDATION 1          // Enables Vulkan Validation
 *  #define ENABLE_LOGGING    1          // Enables LOG* print messages
+*  #define ENABLE_ASYNC_LOGGING 1       // Print LOG* messages from a background thread (see CLogger.h)
 *------------------------------------
 *--------------------------------------------------------------------------
 */
@@ -54,16 +55,26 @@
 //------------------------------------------
 
 //===========================================Check VkResult=============================================
-// Macro to check VkResult for errors(negative) or warnings(positive), and print as a string.
-#ifdef NDEBUG                           // In release builds, don't print VkResult strings.
-#define VKERRCHECK(VKFN) { (void)VKFN; }
-#else                                   // In debug builds, show warnings and errors. assert on error.
-#define VKERRCHECK(VKFN) { VkResult VKRESULT = VKFN;                            \
-                           ShowVkResult(VKRESULT);                              \
-                           assert(VKRESULT >= 0);                               \
-                           if (VKRESULT) printf("%s:%d\n", __FILE__, __LINE__); \
-                         }
+// Macro to check VkResult for errors(negative) or warnings(positive).
+// The success path is a single compare, with a branch that is predicted not-taken.
+// Anything else goes to VkResultFail(), which is out of line, and placed in the cold text section:
+//   - Non-fatal results (VK_SUBOPTIMAL_KHR, VK_TIMEOUT, VK_INCOMPLETE, ...) are counted, not printed.
+//     PrintVkResultStats() lists the counts, and the first call site of each. (CInstance prints them at exit.)
+//   - Errors are counted, and passed to the error handler.  The default handler prints the error,
+//     and asserts in debug builds.  Use SetVkErrorHandler() to route errors to your own function instead.
+// eg: SetVkErrorHandler([](VkResult result, const char* file, int line) { crash_report(result, file, line); });
+
+#if defined(__GNUC__) || defined(__clang__)
+#define UNLIKELY(EXPRESSION) __builtin_expect(!!(EXPRESSION), 0)
+#define COLD __attribute__((cold, noinline))
+#else
+#define UNLIKELY(EXPRESSION) (EXPRESSION)
+#define COLD __declspec(noinline)
 #endif
+
+#define VKERRCHECK(VKFN) { VkResult VKRESULT = VKFN;                                                     \
+                           if (UNLIKELY(VKRESULT != VK_SUCCESS)) VkResultFail(VKRESULT, __FILE__, __LINE__); \
+                         }
 //======================================================================================================
 
 //===============================================LOGGING================================================
@@ -89,7 +100,7 @@ enum eColor { eRESET, eRED, eGREEN, eYELLOW, eBLUE, eMAGENTA, eCYAN, eWHITE,
               eFAINT,eBRED,eBGREEN,eBYELLOW,eBBLUE,eBMAGENTA,eBCYAN, eBRIGHT };  // bright colors
 void color(eColor color);
 // void print(eColor col,const char* format,...);
-#define print(COLOR,...) { color(COLOR); printf(__VA_ARGS__);  color(eRESET); }
+#define print(COLOR,...) { LOG_FLUSH(); color(COLOR); printf(__VA_ARGS__);  color(eRESET); }
 
 // clang-format off
 #ifdef ANDROID
@@ -103,6 +114,14 @@ void color(eColor color);
     #define _LOGW(...)   __android_log_print(ANDROID_LOG_WARN   ,LOG_TAG,__VA_ARGS__)
     #define _LOGE(...)   __android_log_print(ANDROID_LOG_ERROR  ,LOG_TAG,__VA_ARGS__)
     //#define printf(...)  __android_log_print(ANDROID_LOG_INFO   ,LOG_TAG,__VA_ARGS__)
+#elif defined(ENABLE_ASYNC_LOGGING)  // Pack the arguments, and let CLogger's thread format and print them.
+    #define _LOG(...)  {CLogger::Write(eRESET,  "",          __VA_ARGS__);}
+    #define _LOGV(...) {CLogger::Write(eCYAN,   "PERF : ",   __VA_ARGS__);}
+    #define _LOGD(...) {CLogger::Write(eBLUE,   "DEBUG: ",   __VA_ARGS__);}
+    #define _LOGI(...) {CLogger::Write(eGREEN,  "INFO : ",   __VA_ARGS__);}
+    #define _LOGW(...) {CLogger::Write(eYELLOW, "WARNING: ", __VA_ARGS__);}
+    #define _LOGE(...) {CLogger::Write(eRED,    "ERROR: ",   __VA_ARGS__);}
+    #define LOG_FLUSH() CLogger::Flush()
 #else
     #define _LOG(...)  {                            printf(__VA_ARGS__);}
     #define _LOGV(...) {print(eCYAN,  "PERF : "  ); printf(__VA_ARGS__);}
@@ -111,6 +130,9 @@ void color(eColor color);
     #define _LOGW(...) {print(eYELLOW,"WARNING: "); printf(__VA_ARGS__);}
     #define _LOGE(...) {print(eRED,   "ERROR: "  ); printf(__VA_ARGS__);}
 #endif
+#ifndef LOG_FLUSH
+    #define LOG_FLUSH()  /* Wait until queued LOG* messages are printed. (before a plain printf) */
+#endif
 //-----------------------------Enable / Disable Logging-----------------------------
 //  Use these 6 LOG* functions for printing to the terminal, or Android Logcat.
 #ifdef ENABLE_LOGGING
@@ -141,6 +163,9 @@ void color(eColor color);
 //  Alternatively, vulkan_wrapper.h can be used to replace all Vulkan functions with a dispatch-table,
 //  which skips the loader, and calls the ICD directly, thereby improving performance.
 //  Android has no loader, and always uses vulkan_wrapper.h.
+//  vulkan_wrapper.h/.cpp are generated from vulkan.h by VulkanWrapper/generate.py. (CMake re-runs it, if Python is found.)
+//  Each function is resolved on its first call, so only the functions the app uses are ever looked up.
+//  TraceVulkan(1) routes every call through a timing thunk, to find which calls use the most CPU time.
 //  For more details, see /source/loader/LoaderAndLayerInterface.md in the VS or LVL repo.
 //
 //  WARNING: If you enable USE_VULKAN_WRAPPER, make sure vulkan.h is NEVER #included before vulkan_wrapper.h
@@ -156,18 +181,41 @@ void color(eColor color);
 
 void ShowVkResult(VkResult err);  // Print warnings and errors.
 
+typedef void (*PFN_VkErrorHandler)(VkResult result, const char* file, int line);
+COLD void VkResultFail(VkResult result, const char* file, int line);  // Called by VKERRCHECK, when result != VK_SUCCESS.
+void SetVkErrorHandler(PFN_VkErrorHandler handler);                   // Handle VKERRCHECK errors. (null = print and assert)
+void PrintVkResultStats();                                            // Print counts of non-success results.
+
 //============================================ CDebugReport ============================================
+//  All validation messages pass through a filter, before reaching the callback. (default or custom)
+//  The filter identifies each message by its text, (ignoring object handles and other numbers) counts it,
+//  and drops repeats, so a warning that fires every draw call doesn't flood the console and stall the app.
+//  - Each message ID is passed on at most max_repeats times. (default: 5)
+//  - At most max_per_second messages are passed on per second, in total. (default: 50)
+//  - When the instance is destroyed, a summary table lists how often each message ID was reported,
+//    and how many messages the rate limit dropped.
+//  eg: instance.DebugReport.SetRateLimit(0, 0);  // Pass on every message. (no filtering)
+//
+struct CMessageStats;                                          // per-message-ID counters (see Validation.cpp)
+
 class CDebugReport {
     CDebugReport();
+    ~CDebugReport();
     PFN_vkCreateDebugReportCallbackEXT  vkCreateDebugReportCallbackEXT;
     PFN_vkDestroyDebugReportCallbackEXT vkDestroyDebugReportCallbackEXT;
     VkDebugReportCallbackEXT            debug_report_callback;
     VkInstance                          instance;
     PFN_vkDebugReportCallbackEXT        func;
     VkDebugReportFlagsEXT               flags;
+    CMessageStats*                      stats;
+    uint32_t                            max_repeats;
+    uint32_t                            max_per_second;
 
     void Set(VkDebugReportFlagsEXT flags, PFN_vkDebugReportCallbackEXT debugFunc = 0);
     void Print();  // Print the debug report flags state.
+    static VKAPI_ATTR VkBool32 VKAPI_CALL Filter(VkDebugReportFlagsEXT msgFlags, VkDebugReportObjectTypeEXT objType,
+                                                 uint64_t srcObject, size_t location, int32_t msgCode,
+                                                 const char* pLayerPrefix, const char* pMsg, void* pUserData);
 
     friend class CInstance;                                    // CInstance calls Init and Destroy
     void Init(VkInstance inst);                                // Initialize with default callback, and all flags enabled.
@@ -177,7 +225,13 @@ class CDebugReport {
     VkDebugReportFlagsEXT GetFlags() { return flags; }         // Returns current flag settings.
     void SetFlags(VkDebugReportFlagsEXT flags);                // Select which type of messages to display
     void SetCallback(PFN_vkDebugReportCallbackEXT debugFunc);  // Set a custom callback function for printing debug reports
+    void SetRateLimit(uint32_t max_repeats, uint32_t max_per_second);  // Limit repeated messages. (0 = unlimited)
+    void PrintSummary();                                       // Print message counts, by message ID.
 };
 //=======================================================================================================
 
+#if defined(ENABLE_ASYNC_LOGGING) && !defined(ANDROID)
+#include "CLogger.h"
+#endif
+
 #endif
@@ -0,0 +1,69 @@
+// Copyright (c) 2017 Rene Lindsay
+
+/*
+*  Declarations from newer Vulkan headers, which the bundled vulkan.h predates.
+*  Each block is skipped if vulkan.h already defines the extension.
+*
+*  VK_KHR_timeline_semaphore : The structs and functions used by CTimeline, by CDevice, (to pick the extension
+*                              and its feature) and by the null driver.
+*/
+
+#ifndef VKCOMPAT_H
+#define VKCOMPAT_H
+
+#include "Validation.h"  // vulkan.h or vulkan_wrapper.h
+
+//------------------VK_KHR_timeline_semaphore---------------------
+#ifndef VK_KHR_timeline_semaphore
+#define VK_KHR_timeline_semaphore 1
+#define VK_KHR_TIMELINE_SEMAPHORE_SPEC_VERSION   2
+#define VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME "VK_KHR_timeline_semaphore"
+#define VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR ((VkStructureType)1000207000)
+#define VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO_KHR                  ((VkStructureType)1000207002)
+#define VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR              ((VkStructureType)1000207003)
+#define VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO_KHR                         ((VkStructureType)1000207004)
+
+typedef enum VkSemaphoreTypeKHR {
+    VK_SEMAPHORE_TYPE_BINARY_KHR   = 0,
+    VK_SEMAPHORE_TYPE_TIMELINE_KHR = 1,
+    VK_SEMAPHORE_TYPE_MAX_ENUM_KHR = 0x7FFFFFFF
+} VkSemaphoreTypeKHR;
+typedef VkFlags VkSemaphoreWaitFlagsKHR;
+
+typedef struct VkPhysicalDeviceTimelineSemaphoreFeaturesKHR {
+    VkStructureType    sType;
+    void*              pNext;
+    VkBool32           timelineSemaphore;
+} VkPhysicalDeviceTimelineSemaphoreFeaturesKHR;
+
+typedef struct VkSemaphoreTypeCreateInfoKHR {
+    VkStructureType    sType;
+    const void*        pNext;
+    VkSemaphoreTypeKHR semaphoreType;
+    uint64_t           initialValue;
+} VkSemaphoreTypeCreateInfoKHR;
+
+typedef struct VkTimelineSemaphoreSubmitInfoKHR {
+    VkStructureType    sType;
+    const void*        pNext;
+    uint32_t           waitSemaphoreValueCount;
+    const uint64_t*    pWaitSemaphoreValues;
+    uint32_t           signalSemaphoreValueCount;
+    const uint64_t*    pSignalSemaphoreValues;
+} VkTimelineSemaphoreSubmitInfoKHR;
+
+typedef struct VkSemaphoreWaitInfoKHR {
+    VkStructureType         sType;
+    const void*             pNext;
+    VkSemaphoreWaitFlagsKHR flags;
+    uint32_t                semaphoreCount;
+    const VkSemaphore*      pSemaphores;
+    const uint64_t*         pValues;
+} VkSemaphoreWaitInfoKHR;
+
+typedef VkResult (VKAPI_PTR *PFN_vkGetSemaphoreCounterValueKHR)(VkDevice device, VkSemaphore semaphore, uint64_t* pValue);
+typedef VkResult (VKAPI_PTR *PFN_vkWaitSemaphoresKHR)(VkDevice device, const VkSemaphoreWaitInfoKHR* pWaitInfo, uint64_t timeout);
+#endif
+//----------------------------------------------------------------
+
+#endif
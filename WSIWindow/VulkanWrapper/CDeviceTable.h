@@ -0,0 +1,683 @@
+// This file is generated by VulkanWrapper/generate.py, from vulkan.h (VK_HEADER_VERSION 69). DO NOT EDIT.
+/*
+*  CDeviceTable holds the device-level Vulkan functions of one VkDevice, loaded with vkGetDeviceProcAddr.
+*  Calls go straight to the driver, without the loader trampoline, and each CDevice owns its own table,
+*  so several devices (even on different drivers) can be used at the same time.
+*  Function names drop the "vk" prefix. Functions of extensions that were not enabled are null.
+*
+*  eg:
+*    device.vk.CmdDraw(cmd_buf, 3, 1, 0, 0);
+*/
+
+#ifndef CDEVICETABLE_H
+#define CDEVICETABLE_H
+
+#include "Validation.h"  // vulkan.h or vulkan_wrapper.h
+#include <string.h>
+
+struct CDeviceTable {
+    // VK_VERSION_1_0
+    PFN_vkDestroyDevice DestroyDevice;
+    PFN_vkGetDeviceQueue GetDeviceQueue;
+    PFN_vkQueueSubmit QueueSubmit;
+    PFN_vkQueueWaitIdle QueueWaitIdle;
+    PFN_vkDeviceWaitIdle DeviceWaitIdle;
+    PFN_vkAllocateMemory AllocateMemory;
+    PFN_vkFreeMemory FreeMemory;
+    PFN_vkMapMemory MapMemory;
+    PFN_vkUnmapMemory UnmapMemory;
+    PFN_vkFlushMappedMemoryRanges FlushMappedMemoryRanges;
+    PFN_vkInvalidateMappedMemoryRanges InvalidateMappedMemoryRanges;
+    PFN_vkGetDeviceMemoryCommitment GetDeviceMemoryCommitment;
+    PFN_vkBindBufferMemory BindBufferMemory;
+    PFN_vkBindImageMemory BindImageMemory;
+    PFN_vkGetBufferMemoryRequirements GetBufferMemoryRequirements;
+    PFN_vkGetImageMemoryRequirements GetImageMemoryRequirements;
+    PFN_vkGetImageSparseMemoryRequirements GetImageSparseMemoryRequirements;
+    PFN_vkQueueBindSparse QueueBindSparse;
+    PFN_vkCreateFence CreateFence;
+    PFN_vkDestroyFence DestroyFence;
+    PFN_vkResetFences ResetFences;
+    PFN_vkGetFenceStatus GetFenceStatus;
+    PFN_vkWaitForFences WaitForFences;
+    PFN_vkCreateSemaphore CreateSemaphore;
+    PFN_vkDestroySemaphore DestroySemaphore;
+    PFN_vkCreateEvent CreateEvent;
+    PFN_vkDestroyEvent DestroyEvent;
+    PFN_vkGetEventStatus GetEventStatus;
+    PFN_vkSetEvent SetEvent;
+    PFN_vkResetEvent ResetEvent;
+    PFN_vkCreateQueryPool CreateQueryPool;
+    PFN_vkDestroyQueryPool DestroyQueryPool;
+    PFN_vkGetQueryPoolResults GetQueryPoolResults;
+    PFN_vkCreateBuffer CreateBuffer;
+    PFN_vkDestroyBuffer DestroyBuffer;
+    PFN_vkCreateBufferView CreateBufferView;
+    PFN_vkDestroyBufferView DestroyBufferView;
+    PFN_vkCreateImage CreateImage;
+    PFN_vkDestroyImage DestroyImage;
+    PFN_vkGetImageSubresourceLayout GetImageSubresourceLayout;
+    PFN_vkCreateImageView CreateImageView;
+    PFN_vkDestroyImageView DestroyImageView;
+    PFN_vkCreateShaderModule CreateShaderModule;
+    PFN_vkDestroyShaderModule DestroyShaderModule;
+    PFN_vkCreatePipelineCache CreatePipelineCache;
+    PFN_vkDestroyPipelineCache DestroyPipelineCache;
+    PFN_vkGetPipelineCacheData GetPipelineCacheData;
+    PFN_vkMergePipelineCaches MergePipelineCaches;
+    PFN_vkCreateGraphicsPipelines CreateGraphicsPipelines;
+    PFN_vkCreateComputePipelines CreateComputePipelines;
+    PFN_vkDestroyPipeline DestroyPipeline;
+    PFN_vkCreatePipelineLayout CreatePipelineLayout;
+    PFN_vkDestroyPipelineLayout DestroyPipelineLayout;
+    PFN_vkCreateSampler CreateSampler;
+    PFN_vkDestroySampler DestroySampler;
+    PFN_vkCreateDescriptorSetLayout CreateDescriptorSetLayout;
+    PFN_vkDestroyDescriptorSetLayout DestroyDescriptorSetLayout;
+    PFN_vkCreateDescriptorPool CreateDescriptorPool;
+    PFN_vkDestroyDescriptorPool DestroyDescriptorPool;
+    PFN_vkResetDescriptorPool ResetDescriptorPool;
+    PFN_vkAllocateDescriptorSets AllocateDescriptorSets;
+    PFN_vkFreeDescriptorSets FreeDescriptorSets;
+    PFN_vkUpdateDescriptorSets UpdateDescriptorSets;
+    PFN_vkCreateFramebuffer CreateFramebuffer;
+    PFN_vkDestroyFramebuffer DestroyFramebuffer;
+    PFN_vkCreateRenderPass CreateRenderPass;
+    PFN_vkDestroyRenderPass DestroyRenderPass;
+    PFN_vkGetRenderAreaGranularity GetRenderAreaGranularity;
+    PFN_vkCreateCommandPool CreateCommandPool;
+    PFN_vkDestroyCommandPool DestroyCommandPool;
+    PFN_vkResetCommandPool ResetCommandPool;
+    PFN_vkAllocateCommandBuffers AllocateCommandBuffers;
+    PFN_vkFreeCommandBuffers FreeCommandBuffers;
+    PFN_vkBeginCommandBuffer BeginCommandBuffer;
+    PFN_vkEndCommandBuffer EndCommandBuffer;
+    PFN_vkResetCommandBuffer ResetCommandBuffer;
+    PFN_vkCmdBindPipeline CmdBindPipeline;
+    PFN_vkCmdSetViewport CmdSetViewport;
+    PFN_vkCmdSetScissor CmdSetScissor;
+    PFN_vkCmdSetLineWidth CmdSetLineWidth;
+    PFN_vkCmdSetDepthBias CmdSetDepthBias;
+    PFN_vkCmdSetBlendConstants CmdSetBlendConstants;
+    PFN_vkCmdSetDepthBounds CmdSetDepthBounds;
+    PFN_vkCmdSetStencilCompareMask CmdSetStencilCompareMask;
+    PFN_vkCmdSetStencilWriteMask CmdSetStencilWriteMask;
+    PFN_vkCmdSetStencilReference CmdSetStencilReference;
+    PFN_vkCmdBindDescriptorSets CmdBindDescriptorSets;
+    PFN_vkCmdBindIndexBuffer CmdBindIndexBuffer;
+    PFN_vkCmdBindVertexBuffers CmdBindVertexBuffers;
+    PFN_vkCmdDraw CmdDraw;
+    PFN_vkCmdDrawIndexed CmdDrawIndexed;
+    PFN_vkCmdDrawIndirect CmdDrawIndirect;
+    PFN_vkCmdDrawIndexedIndirect CmdDrawIndexedIndirect;
+    PFN_vkCmdDispatch CmdDispatch;
+    PFN_vkCmdDispatchIndirect CmdDispatchIndirect;
+    PFN_vkCmdCopyBuffer CmdCopyBuffer;
+    PFN_vkCmdCopyImage CmdCopyImage;
+    PFN_vkCmdBlitImage CmdBlitImage;
+    PFN_vkCmdCopyBufferToImage CmdCopyBufferToImage;
+    PFN_vkCmdCopyImageToBuffer CmdCopyImageToBuffer;
+    PFN_vkCmdUpdateBuffer CmdUpdateBuffer;
+    PFN_vkCmdFillBuffer CmdFillBuffer;
+    PFN_vkCmdClearColorImage CmdClearColorImage;
+    PFN_vkCmdClearDepthStencilImage CmdClearDepthStencilImage;
+    PFN_vkCmdClearAttachments CmdClearAttachments;
+    PFN_vkCmdResolveImage CmdResolveImage;
+    PFN_vkCmdSetEvent CmdSetEvent;
+    PFN_vkCmdResetEvent CmdResetEvent;
+    PFN_vkCmdWaitEvents CmdWaitEvents;
+    PFN_vkCmdPipelineBarrier CmdPipelineBarrier;
+    PFN_vkCmdBeginQuery CmdBeginQuery;
+    PFN_vkCmdEndQuery CmdEndQuery;
+    PFN_vkCmdResetQueryPool CmdResetQueryPool;
+    PFN_vkCmdWriteTimestamp CmdWriteTimestamp;
+    PFN_vkCmdCopyQueryPoolResults CmdCopyQueryPoolResults;
+    PFN_vkCmdPushConstants CmdPushConstants;
+    PFN_vkCmdBeginRenderPass CmdBeginRenderPass;
+    PFN_vkCmdNextSubpass CmdNextSubpass;
+    PFN_vkCmdEndRenderPass CmdEndRenderPass;
+    PFN_vkCmdExecuteCommands CmdExecuteCommands;
+    // VK_KHR_swapchain
+    PFN_vkCreateSwapchainKHR CreateSwapchainKHR;
+    PFN_vkDestroySwapchainKHR DestroySwapchainKHR;
+    PFN_vkGetSwapchainImagesKHR GetSwapchainImagesKHR;
+    PFN_vkAcquireNextImageKHR AcquireNextImageKHR;
+    PFN_vkQueuePresentKHR QueuePresentKHR;
+    // VK_KHR_display_swapchain
+    PFN_vkCreateSharedSwapchainsKHR CreateSharedSwapchainsKHR;
+    // VK_KHR_maintenance1
+    PFN_vkTrimCommandPoolKHR TrimCommandPoolKHR;
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    // VK_KHR_external_memory_win32
+    PFN_vkGetMemoryWin32HandleKHR GetMemoryWin32HandleKHR;
+    PFN_vkGetMemoryWin32HandlePropertiesKHR GetMemoryWin32HandlePropertiesKHR;
+#endif
+
+    // VK_KHR_external_memory_fd
+    PFN_vkGetMemoryFdKHR GetMemoryFdKHR;
+    PFN_vkGetMemoryFdPropertiesKHR GetMemoryFdPropertiesKHR;
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    // VK_KHR_external_semaphore_win32
+    PFN_vkImportSemaphoreWin32HandleKHR ImportSemaphoreWin32HandleKHR;
+    PFN_vkGetSemaphoreWin32HandleKHR GetSemaphoreWin32HandleKHR;
+#endif
+
+    // VK_KHR_external_semaphore_fd
+    PFN_vkImportSemaphoreFdKHR ImportSemaphoreFdKHR;
+    PFN_vkGetSemaphoreFdKHR GetSemaphoreFdKHR;
+    // VK_KHR_push_descriptor
+    PFN_vkCmdPushDescriptorSetKHR CmdPushDescriptorSetKHR;
+    // VK_KHR_descriptor_update_template
+    PFN_vkCreateDescriptorUpdateTemplateKHR CreateDescriptorUpdateTemplateKHR;
+    PFN_vkDestroyDescriptorUpdateTemplateKHR DestroyDescriptorUpdateTemplateKHR;
+    PFN_vkUpdateDescriptorSetWithTemplateKHR UpdateDescriptorSetWithTemplateKHR;
+    PFN_vkCmdPushDescriptorSetWithTemplateKHR CmdPushDescriptorSetWithTemplateKHR;
+    // VK_KHR_shared_presentable_image
+    PFN_vkGetSwapchainStatusKHR GetSwapchainStatusKHR;
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    // VK_KHR_external_fence_win32
+    PFN_vkImportFenceWin32HandleKHR ImportFenceWin32HandleKHR;
+    PFN_vkGetFenceWin32HandleKHR GetFenceWin32HandleKHR;
+#endif
+
+    // VK_KHR_external_fence_fd
+    PFN_vkImportFenceFdKHR ImportFenceFdKHR;
+    PFN_vkGetFenceFdKHR GetFenceFdKHR;
+    // VK_KHR_get_memory_requirements2
+    PFN_vkGetImageMemoryRequirements2KHR GetImageMemoryRequirements2KHR;
+    PFN_vkGetBufferMemoryRequirements2KHR GetBufferMemoryRequirements2KHR;
+    PFN_vkGetImageSparseMemoryRequirements2KHR GetImageSparseMemoryRequirements2KHR;
+    // VK_KHR_sampler_ycbcr_conversion
+    PFN_vkCreateSamplerYcbcrConversionKHR CreateSamplerYcbcrConversionKHR;
+    PFN_vkDestroySamplerYcbcrConversionKHR DestroySamplerYcbcrConversionKHR;
+    // VK_KHR_bind_memory2
+    PFN_vkBindBufferMemory2KHR BindBufferMemory2KHR;
+    PFN_vkBindImageMemory2KHR BindImageMemory2KHR;
+    // VK_EXT_debug_marker
+    PFN_vkDebugMarkerSetObjectTagEXT DebugMarkerSetObjectTagEXT;
+    PFN_vkDebugMarkerSetObjectNameEXT DebugMarkerSetObjectNameEXT;
+    PFN_vkCmdDebugMarkerBeginEXT CmdDebugMarkerBeginEXT;
+    PFN_vkCmdDebugMarkerEndEXT CmdDebugMarkerEndEXT;
+    PFN_vkCmdDebugMarkerInsertEXT CmdDebugMarkerInsertEXT;
+    // VK_AMD_draw_indirect_count
+    PFN_vkCmdDrawIndirectCountAMD CmdDrawIndirectCountAMD;
+    PFN_vkCmdDrawIndexedIndirectCountAMD CmdDrawIndexedIndirectCountAMD;
+    // VK_AMD_shader_info
+    PFN_vkGetShaderInfoAMD GetShaderInfoAMD;
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    // VK_NV_external_memory_win32
+    PFN_vkGetMemoryWin32HandleNV GetMemoryWin32HandleNV;
+#endif
+
+    // VK_KHX_device_group
+    PFN_vkGetDeviceGroupPeerMemoryFeaturesKHX GetDeviceGroupPeerMemoryFeaturesKHX;
+    PFN_vkCmdSetDeviceMaskKHX CmdSetDeviceMaskKHX;
+    PFN_vkCmdDispatchBaseKHX CmdDispatchBaseKHX;
+    PFN_vkGetDeviceGroupPresentCapabilitiesKHX GetDeviceGroupPresentCapabilitiesKHX;
+    PFN_vkGetDeviceGroupSurfacePresentModesKHX GetDeviceGroupSurfacePresentModesKHX;
+    PFN_vkAcquireNextImage2KHX AcquireNextImage2KHX;
+    // VK_NVX_device_generated_commands
+    PFN_vkCmdProcessCommandsNVX CmdProcessCommandsNVX;
+    PFN_vkCmdReserveSpaceForCommandsNVX CmdReserveSpaceForCommandsNVX;
+    PFN_vkCreateIndirectCommandsLayoutNVX CreateIndirectCommandsLayoutNVX;
+    PFN_vkDestroyIndirectCommandsLayoutNVX DestroyIndirectCommandsLayoutNVX;
+    PFN_vkCreateObjectTableNVX CreateObjectTableNVX;
+    PFN_vkDestroyObjectTableNVX DestroyObjectTableNVX;
+    PFN_vkRegisterObjectsNVX RegisterObjectsNVX;
+    PFN_vkUnregisterObjectsNVX UnregisterObjectsNVX;
+    // VK_NV_clip_space_w_scaling
+    PFN_vkCmdSetViewportWScalingNV CmdSetViewportWScalingNV;
+    // VK_EXT_display_control
+    PFN_vkDisplayPowerControlEXT DisplayPowerControlEXT;
+    PFN_vkRegisterDeviceEventEXT RegisterDeviceEventEXT;
+    PFN_vkRegisterDisplayEventEXT RegisterDisplayEventEXT;
+    PFN_vkGetSwapchainCounterEXT GetSwapchainCounterEXT;
+    // VK_GOOGLE_display_timing
+    PFN_vkGetRefreshCycleDurationGOOGLE GetRefreshCycleDurationGOOGLE;
+    PFN_vkGetPastPresentationTimingGOOGLE GetPastPresentationTimingGOOGLE;
+    // VK_EXT_discard_rectangles
+    PFN_vkCmdSetDiscardRectangleEXT CmdSetDiscardRectangleEXT;
+    // VK_EXT_hdr_metadata
+    PFN_vkSetHdrMetadataEXT SetHdrMetadataEXT;
+    // VK_EXT_sample_locations
+    PFN_vkCmdSetSampleLocationsEXT CmdSetSampleLocationsEXT;
+    // VK_EXT_validation_cache
+    PFN_vkCreateValidationCacheEXT CreateValidationCacheEXT;
+    PFN_vkDestroyValidationCacheEXT DestroyValidationCacheEXT;
+    PFN_vkMergeValidationCachesEXT MergeValidationCachesEXT;
+    PFN_vkGetValidationCacheDataEXT GetValidationCacheDataEXT;
+    // VK_EXT_external_memory_host
+    PFN_vkGetMemoryHostPointerPropertiesEXT GetMemoryHostPointerPropertiesEXT;
+    // VK_AMD_buffer_marker
+    PFN_vkCmdWriteBufferMarkerAMD CmdWriteBufferMarkerAMD;
+
+    CDeviceTable() { memset((void*)this, 0, sizeof(*this)); }
+
+    void Unload() {  // Set all entries to null.
+#ifdef VULKAN_WRAPPER_H
+        TraceVulkanRemoveTable(this);
+#endif
+        memset((void*)this, 0, sizeof(*this));
+    }
+
+    void Load(VkDevice device) {
+#define LOAD(NAME) NAME = (PFN_vk##NAME)vkGetDeviceProcAddr(device, "vk" #NAME)
+        LOAD(DestroyDevice);
+        LOAD(GetDeviceQueue);
+        LOAD(QueueSubmit);
+        LOAD(QueueWaitIdle);
+        LOAD(DeviceWaitIdle);
+        LOAD(AllocateMemory);
+        LOAD(FreeMemory);
+        LOAD(MapMemory);
+        LOAD(UnmapMemory);
+        LOAD(FlushMappedMemoryRanges);
+        LOAD(InvalidateMappedMemoryRanges);
+        LOAD(GetDeviceMemoryCommitment);
+        LOAD(BindBufferMemory);
+        LOAD(BindImageMemory);
+        LOAD(GetBufferMemoryRequirements);
+        LOAD(GetImageMemoryRequirements);
+        LOAD(GetImageSparseMemoryRequirements);
+        LOAD(QueueBindSparse);
+        LOAD(CreateFence);
+        LOAD(DestroyFence);
+        LOAD(ResetFences);
+        LOAD(GetFenceStatus);
+        LOAD(WaitForFences);
+        LOAD(CreateSemaphore);
+        LOAD(DestroySemaphore);
+        LOAD(CreateEvent);
+        LOAD(DestroyEvent);
+        LOAD(GetEventStatus);
+        LOAD(SetEvent);
+        LOAD(ResetEvent);
+        LOAD(CreateQueryPool);
+        LOAD(DestroyQueryPool);
+        LOAD(GetQueryPoolResults);
+        LOAD(CreateBuffer);
+        LOAD(DestroyBuffer);
+        LOAD(CreateBufferView);
+        LOAD(DestroyBufferView);
+        LOAD(CreateImage);
+        LOAD(DestroyImage);
+        LOAD(GetImageSubresourceLayout);
+        LOAD(CreateImageView);
+        LOAD(DestroyImageView);
+        LOAD(CreateShaderModule);
+        LOAD(DestroyShaderModule);
+        LOAD(CreatePipelineCache);
+        LOAD(DestroyPipelineCache);
+        LOAD(GetPipelineCacheData);
+        LOAD(MergePipelineCaches);
+        LOAD(CreateGraphicsPipelines);
+        LOAD(CreateComputePipelines);
+        LOAD(DestroyPipeline);
+        LOAD(CreatePipelineLayout);
+        LOAD(DestroyPipelineLayout);
+        LOAD(CreateSampler);
+        LOAD(DestroySampler);
+        LOAD(CreateDescriptorSetLayout);
+        LOAD(DestroyDescriptorSetLayout);
+        LOAD(CreateDescriptorPool);
+        LOAD(DestroyDescriptorPool);
+        LOAD(ResetDescriptorPool);
+        LOAD(AllocateDescriptorSets);
+        LOAD(FreeDescriptorSets);
+        LOAD(UpdateDescriptorSets);
+        LOAD(CreateFramebuffer);
+        LOAD(DestroyFramebuffer);
+        LOAD(CreateRenderPass);
+        LOAD(DestroyRenderPass);
+        LOAD(GetRenderAreaGranularity);
+        LOAD(CreateCommandPool);
+        LOAD(DestroyCommandPool);
+        LOAD(ResetCommandPool);
+        LOAD(AllocateCommandBuffers);
+        LOAD(FreeCommandBuffers);
+        LOAD(BeginCommandBuffer);
+        LOAD(EndCommandBuffer);
+        LOAD(ResetCommandBuffer);
+        LOAD(CmdBindPipeline);
+        LOAD(CmdSetViewport);
+        LOAD(CmdSetScissor);
+        LOAD(CmdSetLineWidth);
+        LOAD(CmdSetDepthBias);
+        LOAD(CmdSetBlendConstants);
+        LOAD(CmdSetDepthBounds);
+        LOAD(CmdSetStencilCompareMask);
+        LOAD(CmdSetStencilWriteMask);
+        LOAD(CmdSetStencilReference);
+        LOAD(CmdBindDescriptorSets);
+        LOAD(CmdBindIndexBuffer);
+        LOAD(CmdBindVertexBuffers);
+        LOAD(CmdDraw);
+        LOAD(CmdDrawIndexed);
+        LOAD(CmdDrawIndirect);
+        LOAD(CmdDrawIndexedIndirect);
+        LOAD(CmdDispatch);
+        LOAD(CmdDispatchIndirect);
+        LOAD(CmdCopyBuffer);
+        LOAD(CmdCopyImage);
+        LOAD(CmdBlitImage);
+        LOAD(CmdCopyBufferToImage);
+        LOAD(CmdCopyImageToBuffer);
+        LOAD(CmdUpdateBuffer);
+        LOAD(CmdFillBuffer);
+        LOAD(CmdClearColorImage);
+        LOAD(CmdClearDepthStencilImage);
+        LOAD(CmdClearAttachments);
+        LOAD(CmdResolveImage);
+        LOAD(CmdSetEvent);
+        LOAD(CmdResetEvent);
+        LOAD(CmdWaitEvents);
+        LOAD(CmdPipelineBarrier);
+        LOAD(CmdBeginQuery);
+        LOAD(CmdEndQuery);
+        LOAD(CmdResetQueryPool);
+        LOAD(CmdWriteTimestamp);
+        LOAD(CmdCopyQueryPoolResults);
+        LOAD(CmdPushConstants);
+        LOAD(CmdBeginRenderPass);
+        LOAD(CmdNextSubpass);
+        LOAD(CmdEndRenderPass);
+        LOAD(CmdExecuteCommands);
+        LOAD(CreateSwapchainKHR);
+        LOAD(DestroySwapchainKHR);
+        LOAD(GetSwapchainImagesKHR);
+        LOAD(AcquireNextImageKHR);
+        LOAD(QueuePresentKHR);
+        LOAD(CreateSharedSwapchainsKHR);
+        LOAD(TrimCommandPoolKHR);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        LOAD(GetMemoryWin32HandleKHR);
+        LOAD(GetMemoryWin32HandlePropertiesKHR);
+#endif
+        LOAD(GetMemoryFdKHR);
+        LOAD(GetMemoryFdPropertiesKHR);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        LOAD(ImportSemaphoreWin32HandleKHR);
+        LOAD(GetSemaphoreWin32HandleKHR);
+#endif
+        LOAD(ImportSemaphoreFdKHR);
+        LOAD(GetSemaphoreFdKHR);
+        LOAD(CmdPushDescriptorSetKHR);
+        LOAD(CreateDescriptorUpdateTemplateKHR);
+        LOAD(DestroyDescriptorUpdateTemplateKHR);
+        LOAD(UpdateDescriptorSetWithTemplateKHR);
+        LOAD(CmdPushDescriptorSetWithTemplateKHR);
+        LOAD(GetSwapchainStatusKHR);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        LOAD(ImportFenceWin32HandleKHR);
+        LOAD(GetFenceWin32HandleKHR);
+#endif
+        LOAD(ImportFenceFdKHR);
+        LOAD(GetFenceFdKHR);
+        LOAD(GetImageMemoryRequirements2KHR);
+        LOAD(GetBufferMemoryRequirements2KHR);
+        LOAD(GetImageSparseMemoryRequirements2KHR);
+        LOAD(CreateSamplerYcbcrConversionKHR);
+        LOAD(DestroySamplerYcbcrConversionKHR);
+        LOAD(BindBufferMemory2KHR);
+        LOAD(BindImageMemory2KHR);
+        LOAD(DebugMarkerSetObjectTagEXT);
+        LOAD(DebugMarkerSetObjectNameEXT);
+        LOAD(CmdDebugMarkerBeginEXT);
+        LOAD(CmdDebugMarkerEndEXT);
+        LOAD(CmdDebugMarkerInsertEXT);
+        LOAD(CmdDrawIndirectCountAMD);
+        LOAD(CmdDrawIndexedIndirectCountAMD);
+        LOAD(GetShaderInfoAMD);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        LOAD(GetMemoryWin32HandleNV);
+#endif
+        LOAD(GetDeviceGroupPeerMemoryFeaturesKHX);
+        LOAD(CmdSetDeviceMaskKHX);
+        LOAD(CmdDispatchBaseKHX);
+        LOAD(GetDeviceGroupPresentCapabilitiesKHX);
+        LOAD(GetDeviceGroupSurfacePresentModesKHX);
+        LOAD(AcquireNextImage2KHX);
+        LOAD(CmdProcessCommandsNVX);
+        LOAD(CmdReserveSpaceForCommandsNVX);
+        LOAD(CreateIndirectCommandsLayoutNVX);
+        LOAD(DestroyIndirectCommandsLayoutNVX);
+        LOAD(CreateObjectTableNVX);
+        LOAD(DestroyObjectTableNVX);
+        LOAD(RegisterObjectsNVX);
+        LOAD(UnregisterObjectsNVX);
+        LOAD(CmdSetViewportWScalingNV);
+        LOAD(DisplayPowerControlEXT);
+        LOAD(RegisterDeviceEventEXT);
+        LOAD(RegisterDisplayEventEXT);
+        LOAD(GetSwapchainCounterEXT);
+        LOAD(GetRefreshCycleDurationGOOGLE);
+        LOAD(GetPastPresentationTimingGOOGLE);
+        LOAD(CmdSetDiscardRectangleEXT);
+        LOAD(SetHdrMetadataEXT);
+        LOAD(CmdSetSampleLocationsEXT);
+        LOAD(CreateValidationCacheEXT);
+        LOAD(DestroyValidationCacheEXT);
+        LOAD(MergeValidationCachesEXT);
+        LOAD(GetValidationCacheDataEXT);
+        LOAD(GetMemoryHostPointerPropertiesEXT);
+        LOAD(CmdWriteBufferMarkerAMD);
+#undef LOAD
+#ifdef VULKAN_WRAPPER_H
+        TraceVulkanAddTable(this, Swap);  // TraceVulkan() also times the calls through this table.
+#endif
+    }
+
+#ifdef VULKAN_WRAPPER_H  // Tracing: (see TraceVulkan, in vulkan_wrapper.h)
+    ~CDeviceTable() { TraceVulkanRemoveTable(this); }
+    CDeviceTable(const CDeviceTable&) = delete;  // (registered by address)
+    CDeviceTable& operator=(const CDeviceTable&) = delete;
+
+  private:
+    static void Swap(void* table, int enable) {
+        CDeviceTable& vk = *(CDeviceTable*)table;
+#define SWAP(NAME) TraceVulkanSwap((PFN_vkVoidFunction*)&vk.NAME, "vk" #NAME, enable)
+        SWAP(DestroyDevice);
+        SWAP(GetDeviceQueue);
+        SWAP(QueueSubmit);
+        SWAP(QueueWaitIdle);
+        SWAP(DeviceWaitIdle);
+        SWAP(AllocateMemory);
+        SWAP(FreeMemory);
+        SWAP(MapMemory);
+        SWAP(UnmapMemory);
+        SWAP(FlushMappedMemoryRanges);
+        SWAP(InvalidateMappedMemoryRanges);
+        SWAP(GetDeviceMemoryCommitment);
+        SWAP(BindBufferMemory);
+        SWAP(BindImageMemory);
+        SWAP(GetBufferMemoryRequirements);
+        SWAP(GetImageMemoryRequirements);
+        SWAP(GetImageSparseMemoryRequirements);
+        SWAP(QueueBindSparse);
+        SWAP(CreateFence);
+        SWAP(DestroyFence);
+        SWAP(ResetFences);
+        SWAP(GetFenceStatus);
+        SWAP(WaitForFences);
+        SWAP(CreateSemaphore);
+        SWAP(DestroySemaphore);
+        SWAP(CreateEvent);
+        SWAP(DestroyEvent);
+        SWAP(GetEventStatus);
+        SWAP(SetEvent);
+        SWAP(ResetEvent);
+        SWAP(CreateQueryPool);
+        SWAP(DestroyQueryPool);
+        SWAP(GetQueryPoolResults);
+        SWAP(CreateBuffer);
+        SWAP(DestroyBuffer);
+        SWAP(CreateBufferView);
+        SWAP(DestroyBufferView);
+        SWAP(CreateImage);
+        SWAP(DestroyImage);
+        SWAP(GetImageSubresourceLayout);
+        SWAP(CreateImageView);
+        SWAP(DestroyImageView);
+        SWAP(CreateShaderModule);
+        SWAP(DestroyShaderModule);
+        SWAP(CreatePipelineCache);
+        SWAP(DestroyPipelineCache);
+        SWAP(GetPipelineCacheData);
+        SWAP(MergePipelineCaches);
+        SWAP(CreateGraphicsPipelines);
+        SWAP(CreateComputePipelines);
+        SWAP(DestroyPipeline);
+        SWAP(CreatePipelineLayout);
+        SWAP(DestroyPipelineLayout);
+        SWAP(CreateSampler);
+        SWAP(DestroySampler);
+        SWAP(CreateDescriptorSetLayout);
+        SWAP(DestroyDescriptorSetLayout);
+        SWAP(CreateDescriptorPool);
+        SWAP(DestroyDescriptorPool);
+        SWAP(ResetDescriptorPool);
+        SWAP(AllocateDescriptorSets);
+        SWAP(FreeDescriptorSets);
+        SWAP(UpdateDescriptorSets);
+        SWAP(CreateFramebuffer);
+        SWAP(DestroyFramebuffer);
+        SWAP(CreateRenderPass);
+        SWAP(DestroyRenderPass);
+        SWAP(GetRenderAreaGranularity);
+        SWAP(CreateCommandPool);
+        SWAP(DestroyCommandPool);
+        SWAP(ResetCommandPool);
+        SWAP(AllocateCommandBuffers);
+        SWAP(FreeCommandBuffers);
+        SWAP(BeginCommandBuffer);
+        SWAP(EndCommandBuffer);
+        SWAP(ResetCommandBuffer);
+        SWAP(CmdBindPipeline);
+        SWAP(CmdSetViewport);
+        SWAP(CmdSetScissor);
+        SWAP(CmdSetLineWidth);
+        SWAP(CmdSetDepthBias);
+        SWAP(CmdSetBlendConstants);
+        SWAP(CmdSetDepthBounds);
+        SWAP(CmdSetStencilCompareMask);
+        SWAP(CmdSetStencilWriteMask);
+        SWAP(CmdSetStencilReference);
+        SWAP(CmdBindDescriptorSets);
+        SWAP(CmdBindIndexBuffer);
+        SWAP(CmdBindVertexBuffers);
+        SWAP(CmdDraw);
+        SWAP(CmdDrawIndexed);
+        SWAP(CmdDrawIndirect);
+        SWAP(CmdDrawIndexedIndirect);
+        SWAP(CmdDispatch);
+        SWAP(CmdDispatchIndirect);
+        SWAP(CmdCopyBuffer);
+        SWAP(CmdCopyImage);
+        SWAP(CmdBlitImage);
+        SWAP(CmdCopyBufferToImage);
+        SWAP(CmdCopyImageToBuffer);
+        SWAP(CmdUpdateBuffer);
+        SWAP(CmdFillBuffer);
+        SWAP(CmdClearColorImage);
+        SWAP(CmdClearDepthStencilImage);
+        SWAP(CmdClearAttachments);
+        SWAP(CmdResolveImage);
+        SWAP(CmdSetEvent);
+        SWAP(CmdResetEvent);
+        SWAP(CmdWaitEvents);
+        SWAP(CmdPipelineBarrier);
+        SWAP(CmdBeginQuery);
+        SWAP(CmdEndQuery);
+        SWAP(CmdResetQueryPool);
+        SWAP(CmdWriteTimestamp);
+        SWAP(CmdCopyQueryPoolResults);
+        SWAP(CmdPushConstants);
+        SWAP(CmdBeginRenderPass);
+        SWAP(CmdNextSubpass);
+        SWAP(CmdEndRenderPass);
+        SWAP(CmdExecuteCommands);
+        SWAP(CreateSwapchainKHR);
+        SWAP(DestroySwapchainKHR);
+        SWAP(GetSwapchainImagesKHR);
+        SWAP(AcquireNextImageKHR);
+        SWAP(QueuePresentKHR);
+        SWAP(CreateSharedSwapchainsKHR);
+        SWAP(TrimCommandPoolKHR);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        SWAP(GetMemoryWin32HandleKHR);
+        SWAP(GetMemoryWin32HandlePropertiesKHR);
+#endif
+        SWAP(GetMemoryFdKHR);
+        SWAP(GetMemoryFdPropertiesKHR);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        SWAP(ImportSemaphoreWin32HandleKHR);
+        SWAP(GetSemaphoreWin32HandleKHR);
+#endif
+        SWAP(ImportSemaphoreFdKHR);
+        SWAP(GetSemaphoreFdKHR);
+        SWAP(CmdPushDescriptorSetKHR);
+        SWAP(CreateDescriptorUpdateTemplateKHR);
+        SWAP(DestroyDescriptorUpdateTemplateKHR);
+        SWAP(UpdateDescriptorSetWithTemplateKHR);
+        SWAP(CmdPushDescriptorSetWithTemplateKHR);
+        SWAP(GetSwapchainStatusKHR);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        SWAP(ImportFenceWin32HandleKHR);
+        SWAP(GetFenceWin32HandleKHR);
+#endif
+        SWAP(ImportFenceFdKHR);
+        SWAP(GetFenceFdKHR);
+        SWAP(GetImageMemoryRequirements2KHR);
+        SWAP(GetBufferMemoryRequirements2KHR);
+        SWAP(GetImageSparseMemoryRequirements2KHR);
+        SWAP(CreateSamplerYcbcrConversionKHR);
+        SWAP(DestroySamplerYcbcrConversionKHR);
+        SWAP(BindBufferMemory2KHR);
+        SWAP(BindImageMemory2KHR);
+        SWAP(DebugMarkerSetObjectTagEXT);
+        SWAP(DebugMarkerSetObjectNameEXT);
+        SWAP(CmdDebugMarkerBeginEXT);
+        SWAP(CmdDebugMarkerEndEXT);
+        SWAP(CmdDebugMarkerInsertEXT);
+        SWAP(CmdDrawIndirectCountAMD);
+        SWAP(CmdDrawIndexedIndirectCountAMD);
+        SWAP(GetShaderInfoAMD);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        SWAP(GetMemoryWin32HandleNV);
+#endif
+        SWAP(GetDeviceGroupPeerMemoryFeaturesKHX);
+        SWAP(CmdSetDeviceMaskKHX);
+        SWAP(CmdDispatchBaseKHX);
+        SWAP(GetDeviceGroupPresentCapabilitiesKHX);
+        SWAP(GetDeviceGroupSurfacePresentModesKHX);
+        SWAP(AcquireNextImage2KHX);
+        SWAP(CmdProcessCommandsNVX);
+        SWAP(CmdReserveSpaceForCommandsNVX);
+        SWAP(CreateIndirectCommandsLayoutNVX);
+        SWAP(DestroyIndirectCommandsLayoutNVX);
+        SWAP(CreateObjectTableNVX);
+        SWAP(DestroyObjectTableNVX);
+        SWAP(RegisterObjectsNVX);
+        SWAP(UnregisterObjectsNVX);
+        SWAP(CmdSetViewportWScalingNV);
+        SWAP(DisplayPowerControlEXT);
+        SWAP(RegisterDeviceEventEXT);
+        SWAP(RegisterDisplayEventEXT);
+        SWAP(GetSwapchainCounterEXT);
+        SWAP(GetRefreshCycleDurationGOOGLE);
+        SWAP(GetPastPresentationTimingGOOGLE);
+        SWAP(CmdSetDiscardRectangleEXT);
+        SWAP(SetHdrMetadataEXT);
+        SWAP(CmdSetSampleLocationsEXT);
+        SWAP(CreateValidationCacheEXT);
+        SWAP(DestroyValidationCacheEXT);
+        SWAP(MergeValidationCachesEXT);
+        SWAP(GetValidationCacheDataEXT);
+        SWAP(GetMemoryHostPointerPropertiesEXT);
+        SWAP(CmdWriteBufferMarkerAMD);
+#undef SWAP
+    }
+#endif
+};
+
+#endif
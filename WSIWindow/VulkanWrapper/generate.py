@@ -0,0 +1,778 @@
+#!/usr/bin/env python
+#
+# Copyright (c) 2017 Rene Lindsay
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+# Generates vulkan_wrapper.h / vulkan_wrapper.cpp from vulkan.h.
+#
+# vulkan.h is itself generated from the Vulkan registry (vk.xml), and is always
+# in sync with the PFN_* typedefs we compile against, so we read the prototypes
+# from there. Newer headers split platform extensions into vulkan_<platform>.h,
+# which are followed through their #include, keeping the enclosing #ifdef.
+#
+# Each function pointer starts out pointing to a lazy stub, which resolves the
+# real entry-point on first call, so only functions the app actually uses are
+# ever looked up. InitVulkanInstance() / InitVulkanDevice() reset the pointers
+# back to their stubs, so they get re-resolved through the new instance/device.
+#
+# For call-tracing, each function also gets a thunk, which times the call, and
+# forwards it to the real function. TraceVulkan(1) swaps the pointers over to the
+# thunks, and TraceVulkan(0) swaps them back, so tracing costs nothing when off.
+#
+# InitVulkanDriver() replaces the Vulkan library with an in-process driver, (eg: the
+# null driver) and every function that driver doesn't provide becomes a no-op.
+#
+# It also generates CDeviceTable.h, next to the wrapper: a struct of device-level
+# function pointers, loaded per VkDevice, so each CDevice can own its own dispatch table.
+#
+# Usage: python generate.py [path/to/vulkan.h] [out_dir]
+#   With no arguments, the pre-generated files in this folder are updated, from the bundled vulkan.h.
+#   (CMake re-generates all three in the build folder, from the vulkan.h in use.)
+
+import os
+import re
+import sys
+
+GLOBAL, INSTANCE, DEVICE = 0, 1, 2
+LEVEL_NAMES = ["LEVEL_GLOBAL", "LEVEL_INSTANCE", "LEVEL_DEVICE"]
+GLOBAL_FUNCTIONS = ["vkGetInstanceProcAddr", "vkGetDeviceProcAddr", "vkCreateInstance"]
+
+
+class Command:
+    def __init__(self, name, ret, params, guard, group):
+        self.name = name
+        self.ret = ret
+        self.params = params  # list of (declaration, name)
+        self.guard = guard    # platform #ifdef, or None
+        self.group = group    # extension / version name
+
+        first = params[0][0].split()[0] if params else ""
+        if name in GLOBAL_FUNCTIONS or name.startswith("vkEnumerateInstance"):
+            self.level = GLOBAL
+        elif first in ("VkDevice", "VkQueue", "VkCommandBuffer"):
+            self.level = DEVICE
+        else:
+            self.level = INSTANCE
+
+
+def parse_params(text):
+    params = []
+    for decl in text.split(","):
+        decl = " ".join(decl.split())
+        if not decl or decl == "void":
+            continue
+        name = re.search(r"(\w+)\s*(\[\w*\])?$", decl).group(1)
+        params.append((decl, name))
+    return params
+
+
+def parse_header(path, guard=None, commands=None, state=None):
+    if commands is None:
+        commands, state = [], {"group": "VK_VERSION_1_0", "header_version": "?"}
+    guards = [guard]
+    lines = open(path).read().splitlines()
+    i = 0
+    while i < len(lines):
+        line = lines[i].strip()
+        m = re.match(r"#if(n?def)?\s+(.*)", line)
+        if m:
+            cond = m.group(2).strip() if m.group(1) == "def" else None
+            guards.append(cond if cond and cond.startswith("VK_USE_PLATFORM") else guards[-1])
+        elif line.startswith("#endif"):
+            guards.pop()
+        m = re.match(r"#define\s+(VK_VERSION_\d+_\d+|VK_[A-Z]+_[a-z0-9_]+)\s+1$", line)  # version or extension name
+        if m:
+            state["group"] = m.group(1)
+        m = re.match(r"#define\s+VK_HEADER_VERSION\s+(\d+)", line)
+        if m:
+            state["header_version"] = m.group(1)
+        m = re.match(r'#include\s+"(vulkan_\w+\.h)"', line)  # vulkan_core.h, vulkan_xcb.h ...
+        if m:
+            include = os.path.join(os.path.dirname(path), m.group(1))
+            if os.path.exists(include):
+                parse_header(include, guards[-1], commands, state)
+        m = re.match(r"VKAPI_ATTR\s+(.+?)\s+VKAPI_CALL\s+(vk\w+)\s*\((.*)", line)
+        if m:
+            ret, name, text = m.group(1), m.group(2), m.group(3)
+            while ");" not in text:
+                i += 1
+                text += " " + lines[i].strip()
+            text = text[:text.index(");")]
+            if name not in [c.name for c in commands]:
+                commands.append(Command(name, ret, parse_params(text), guards[-1], state["group"]))
+        i += 1
+    return commands, state
+
+
+def guarded(commands, emit):
+    out, guard = [], None
+    for c in commands:
+        if c.guard != guard:
+            if guard:
+                out.append("#endif")
+            if c.guard:
+                out.append("#ifdef " + c.guard)
+            guard = c.guard
+        out.extend(emit(c))
+    if guard:
+        out.append("#endif")
+    return out
+
+
+def grouped(commands, emit):
+    out, group, guard = [], None, None
+    for c in commands:
+        if c.guard != guard:
+            if guard:
+                out += ["#endif", ""]
+            if c.guard:
+                out.append("#ifdef " + c.guard)
+            guard = c.guard
+        if c.group != group:
+            out.append("// " + c.group)
+            group = c.group
+        out.extend(emit(c))
+    if guard:
+        out.append("#endif")
+    return out
+
+
+LICENSE = """\
+/*
+ * Copyright 2016 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+"""  # The generated files keep the API of Android's vulkan_wrapper, and its notice.
+
+HEADER = LICENSE + """\
+// This file is generated by generate.py, from vulkan.h (VK_HEADER_VERSION {version}). DO NOT EDIT.
+#ifndef VULKAN_WRAPPER_H
+#define VULKAN_WRAPPER_H
+
+#ifdef __cplusplus
+extern "C" {{
+#endif
+
+#define VK_NO_PROTOTYPES 1
+#include <vulkan/vulkan.h>
+
+/* Load the Vulkan library. Returns 0 if vulkan is not available, non-zero if it is available.
+ * This is optional, as the first Vulkan call loads it anyway.
+ * All function pointers start out pointing to stubs, which resolve the real function on first call.
+ */
+int InitVulkan(void);
+
+/* Re-resolve function pointers through vkGetInstanceProcAddr / vkGetDeviceProcAddr,
+ * to skip the loader trampolines. Call after vkCreateInstance / vkCreateDevice.
+ * Device-level pointers are then only valid for that device. InitVulkanDevice(VK_NULL_HANDLE)
+ * restores pointers that work with any device.
+ */
+void InitVulkanInstance(VkInstance instance);
+void InitVulkanDevice(VkDevice device);
+
+/* Use an in-process driver instead of the Vulkan library. (eg: NullDriverGetInstanceProcAddr)
+ * All functions are looked up with driver(VK_NULL_HANDLE, name), and any function it returns null for,
+ * becomes a no-op, that returns VK_SUCCESS. Call before any other Vulkan function.
+ */
+void InitVulkanDriver(PFN_vkGetInstanceProcAddr driver);
+
+/* Call tracing: (WARNING: work in progress)
+ * TraceVulkan(1) points every function at a thunk, which counts its calls and CPU time.
+ * TraceVulkan(0) restores the direct pointers, so there is no overhead while tracing is off.
+ * Call TraceVulkanNextFrame() once per frame, to close the frame's stats.
+ * TraceVulkanPrint() lists the functions that took the most CPU time in the last frame.
+ * TraceVulkanDump() writes the most recent calls to a binary file. (Format in vulkan_wrapper.cpp)
+ * Calls through a dispatch table (CDeviceTable) are traced too, once the table is registered.
+ * Traced functions may be called from any thread: each thread counts into its own counters,
+ * which TraceVulkanNextFrame() adds up.  Call the TraceVulkan* functions themselves from one thread,
+ * and only call TraceVulkan() and TraceVulkanDump() while no other thread is calling Vulkan.
+ *
+ * eg: TraceVulkan(1);
+ *     while (Window.ProcessEvents()) {{ DrawFrame(); TraceVulkanNextFrame(); }}
+ *     TraceVulkanPrint(10);
+ *     TraceVulkanDump("vulkan.trace");
+ */
+void TraceVulkan(int enable);
+int  TraceVulkanEnabled(void);
+void TraceVulkanNextFrame(void);
+void TraceVulkanPrint(int top_n);
+int  TraceVulkanDump(const char* filename);  // Returns 0 if the file could not be written.
+
+/* Dispatch tables: (used by CDeviceTable)
+ * TraceVulkanAddTable() registers a table, so TraceVulkan() also calls swap(table, enable) for it.
+ * The swap function calls TraceVulkanSwap() for each of the table's entries, which points the entry
+ * at a thunk, or back at the real function.  Remove the table again, before it is freed.
+ */
+typedef void (*PFN_TraceVulkanTable)(void* table, int enable);
+void TraceVulkanAddTable(void* table, PFN_TraceVulkanTable swap);  // Re-add after re-loading the table.
+void TraceVulkanRemoveTable(void* table);
+void TraceVulkanSwap(PFN_vkVoidFunction* entry, const char* name, int enable);
+
+{declarations}
+
+#ifdef __cplusplus
+}}
+#endif
+
+#endif  // VULKAN_WRAPPER_H
+"""
+
+SOURCE = LICENSE + """\
+// This file is generated by generate.py, from vulkan.h (VK_HEADER_VERSION {version}). DO NOT EDIT.
+#include <atomic>  // (outside of extern "C", as it declares templates)
+
+#ifdef __cplusplus
+extern "C" {{
+#endif
+
+#ifdef _WIN32
+    #define VK_USE_PLATFORM_WIN32_KHR
+    #include <windows.h>
+#else
+    #include <dlfcn.h>
+    #include <time.h>
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "vulkan_wrapper.h"
+
+#ifdef _WIN32
+    typedef HMODULE LIBHANDLE;
+    static LIBHANDLE LoadVulkanLibrary() {{ return LoadLibraryA("vulkan-1.dll"); }}
+    static PFN_vkVoidFunction GetSymbol(LIBHANDLE lib, const char* fn) {{ return (PFN_vkVoidFunction)GetProcAddress(lib, fn); }}
+#else
+    typedef void* LIBHANDLE;
+    static LIBHANDLE LoadVulkanLibrary() {{
+        LIBHANDLE lib = dlopen("libvulkan.so.1", RTLD_NOW | RTLD_LOCAL);
+        return lib ? lib : dlopen("libvulkan.so", RTLD_NOW | RTLD_LOCAL);
+    }}
+    static PFN_vkVoidFunction GetSymbol(LIBHANDLE lib, const char* fn) {{ return (PFN_vkVoidFunction)dlsym(lib, fn); }}
+#endif
+
+enum {{ LEVEL_GLOBAL, LEVEL_INSTANCE, LEVEL_DEVICE }};
+
+static LIBHANDLE                 libvulkan         = 0;
+static PFN_vkGetInstanceProcAddr loader_gipa       = 0;
+static PFN_vkGetDeviceProcAddr   loader_gdpa       = 0;
+static VkInstance                dispatch_instance = VK_NULL_HANDLE;
+static VkDevice                  dispatch_device   = VK_NULL_HANDLE;
+static PFN_vkGetInstanceProcAddr driver_gipa       = 0;  // in-process driver, instead of libvulkan
+
+static PFN_vkVoidFunction DriverProc(const char* name);
+
+// Library exports: from the in-process driver if set, else from libvulkan.
+static PFN_vkVoidFunction LibraryProc(const char* name) {{
+    return driver_gipa ? DriverProc(name) : GetSymbol(libvulkan, name);
+}}
+
+int InitVulkan(void) {{
+    if (libvulkan || driver_gipa) return 1;
+    LIBHANDLE lib = LoadVulkanLibrary();
+    if (!lib) return 0;
+    loader_gipa = (PFN_vkGetInstanceProcAddr)GetSymbol(lib, "vkGetInstanceProcAddr");
+    loader_gdpa = (PFN_vkGetDeviceProcAddr)  GetSymbol(lib, "vkGetDeviceProcAddr");
+    libvulkan   = lib;
+    return 1;
+}}
+
+//-------------------------------Tracing--------------------------------
+#define TRACE_COUNT  {count}     // number of functions
+#define TRACE_EVENTS (1 << 16)   // number of recent calls kept for TraceVulkanDump
+#define TRACE_TABLES 16          // number of dispatch tables that can be traced at once
+
+struct CTraceStat  {{ uint32_t calls; uint64_t time; }};                     // time in nanoseconds
+struct CTraceEvent {{ uint32_t id; uint32_t frame; uint64_t start; uint64_t time; }};
+struct CTraceTable {{ void* table; PFN_TraceVulkanTable swap; }};
+
+// Per-thread counters: Only the owning thread writes to them, and they only ever grow, so
+// TraceVulkanNextFrame() can read them while the thread runs, and subtract the last frame's totals.
+// Blocks are never freed. When a thread exits, its block is handed on to the next new thread.
+struct CTraceThread {{
+    std::atomic<uint64_t> calls[TRACE_COUNT];
+    std::atomic<uint64_t> time[TRACE_COUNT];
+    std::atomic<int>      in_use;
+    CTraceThread*         next;
+}};
+
+struct CTraceThreadRef {{  // releases the thread's block, when the thread exits
+    CTraceThread* block;
+    ~CTraceThreadRef() {{ if (block) block->in_use.store(0, std::memory_order_release); }}
+}};
+
+static int                        trace_enabled = 0;
+static PFN_vkVoidFunction         traced_procs[TRACE_COUNT];  // real functions, while the pointers point at thunks
+static PFN_vkVoidFunction         table_procs[TRACE_COUNT];   // real functions of the traced dispatch tables
+static CTraceTable                trace_tables[TRACE_TABLES];
+static std::atomic<CTraceThread*> trace_threads(nullptr);     // all per-thread blocks (push only)
+static thread_local CTraceThreadRef trace_thread = {{}};
+static uint64_t                   trace_total_calls[TRACE_COUNT];  // sum of all threads, at the end of the last frame
+static uint64_t                   trace_total_time[TRACE_COUNT];
+static CTraceStat                 trace_last[TRACE_COUNT];    // last completed frame
+static std::atomic<uint32_t>      trace_frame_index(0);
+static CTraceEvent*               trace_events = 0;           // ring buffer
+static std::atomic<uint64_t>      trace_event_count(0);
+
+static const char* trace_names[TRACE_COUNT] = {{
+{names}
+}};
+
+static uint64_t TraceTime(void) {{
+#ifdef _WIN32
+    static LARGE_INTEGER freq = {{}};
+    if (!freq.QuadPart) QueryPerformanceFrequency(&freq);
+    LARGE_INTEGER t;
+    QueryPerformanceCounter(&t);
+    return (uint64_t)(t.QuadPart / freq.QuadPart) * 1000000000ull + (uint64_t)(t.QuadPart % freq.QuadPart) * 1000000000ull / freq.QuadPart;
+#else
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint64_t)t.tv_sec * 1000000000ull + (uint64_t)t.tv_nsec;
+#endif
+}}
+
+static CTraceThread* TraceThread(void) {{
+    CTraceThread* block = trace_thread.block;
+    if (block) return block;
+    for (block = trace_threads.load(std::memory_order_acquire); block; block = block->next) {{  // reuse a free block
+        int in_use = 0;
+        if (block->in_use.compare_exchange_strong(in_use, 1, std::memory_order_acquire)) break;
+    }}
+    if (!block) {{
+        block = new CTraceThread();  // (zeroed)
+        block->in_use.store(1, std::memory_order_relaxed);
+        block->next = trace_threads.load(std::memory_order_relaxed);
+        while (!trace_threads.compare_exchange_weak(block->next, block, std::memory_order_release)) {{}}
+    }}
+    trace_thread.block = block;
+    return block;
+}}
+
+static void TraceCall(uint32_t id, uint64_t start) {{
+    uint64_t time = TraceTime() - start;
+    CTraceThread* thread = TraceThread();  // Only this thread writes to its counters, so no atomic add is needed.
+    thread->calls[id].store(thread->calls[id].load(std::memory_order_relaxed) + 1,    std::memory_order_relaxed);
+    thread->time[id] .store(thread->time[id] .load(std::memory_order_relaxed) + time, std::memory_order_relaxed);
+    uint64_t index = trace_event_count.fetch_add(1, std::memory_order_relaxed);
+    CTraceEvent& event = trace_events[index % TRACE_EVENTS];
+    event.id    = id;
+    event.frame = trace_frame_index.load(std::memory_order_relaxed);
+    event.start = start;
+    event.time  = time;
+}}
+
+// Find a function: from the current device or instance if set, else from the loader exports.
+// While tracing, the thunk stays in the slot, and the real function goes into traced_procs instead.
+static PFN_vkVoidFunction LoadProc(PFN_vkVoidFunction* slot, uint32_t id, const char* name, int level) {{
+    if (!InitVulkan()) return 0;
+    PFN_vkVoidFunction fn = 0;
+    if (level == LEVEL_DEVICE && dispatch_device && loader_gdpa) fn = loader_gdpa(dispatch_device, name);
+    if (!fn && level != LEVEL_GLOBAL && dispatch_instance && loader_gipa) fn = loader_gipa(dispatch_instance, name);
+    if (!fn) fn = LibraryProc(name);                                  // loader export (trampoline)
+    if (!fn && level == LEVEL_GLOBAL && loader_gipa) fn = loader_gipa(VK_NULL_HANDLE, name);
+    if (fn) {{                                                        // else keep the stub, to retry later
+        if (trace_enabled) traced_procs[id] = fn;
+        else               *slot            = fn;
+    }}
+    return fn;
+}}
+
+//-----------------------------Lazy stubs-------------------------------
+{stubs}
+
+//-------------------------------No-ops---------------------------------
+{noops}
+
+//-------------------------In-process driver----------------------------
+struct CNamedProc {{
+    const char*        name;
+    PFN_vkVoidFunction proc;
+}};
+
+static const CNamedProc noop_table[] = {{
+{noop_table}
+}};
+
+static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL DriverGetInstanceProcAddr(VkInstance instance, const char* name) {{ return DriverProc(name); }}
+static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL DriverGetDeviceProcAddr(VkDevice device, const char* name) {{ return DriverProc(name); }}
+
+// The driver's own function, else a no-op. The wrapper answers the GetProcAddr functions itself,
+// so functions looked up through them also fall back to no-ops.
+static PFN_vkVoidFunction DriverProc(const char* name) {{
+    if (!strcmp(name, "vkGetInstanceProcAddr")) return (PFN_vkVoidFunction)DriverGetInstanceProcAddr;
+    if (!strcmp(name, "vkGetDeviceProcAddr"))   return (PFN_vkVoidFunction)DriverGetDeviceProcAddr;
+    PFN_vkVoidFunction fn = driver_gipa(VK_NULL_HANDLE, name);
+    for (size_t i = 0; !fn && i < sizeof(noop_table) / sizeof(noop_table[0]); ++i)
+        if (!strcmp(name, noop_table[i].name)) fn = noop_table[i].proc;
+    return fn;
+}}
+
+//-----------------------------Trace thunks-----------------------------
+{thunks}
+
+//--------------------------Table trace thunks--------------------------
+{table_thunks}
+
+//--------------------------Function pointers---------------------------
+{pointers}
+
+//-----------------------------Proc table-------------------------------
+struct CProcEntry {{
+    PFN_vkVoidFunction* slot;
+    PFN_vkVoidFunction  stub;
+    PFN_vkVoidFunction  trace;
+    uint32_t            id;
+    int                 level;
+}};
+
+static const CProcEntry proc_table[] = {{
+{table}
+}};
+
+struct CTableThunk {{
+    uint32_t           id;
+    PFN_vkVoidFunction trace;
+}};
+
+static const CTableThunk table_thunk_table[] = {{
+{table_thunk_table}
+}};
+
+// Reset all pointers at or above the given level to their stubs, so they get re-resolved on next call.
+static void ResetProcs(int level) {{
+    for (size_t i = 0; i < sizeof(proc_table) / sizeof(proc_table[0]); ++i) {{
+        const CProcEntry& proc = proc_table[i];
+        if (proc.level < level) continue;
+        if (trace_enabled) traced_procs[proc.id] = proc.stub;
+        else               *proc.slot            = proc.stub;
+    }}
+}}
+
+void InitVulkanInstance(VkInstance instance) {{
+    dispatch_instance = instance;
+    dispatch_device   = VK_NULL_HANDLE;
+    ResetProcs(LEVEL_INSTANCE);
+}}
+
+void InitVulkanDevice(VkDevice device) {{
+    dispatch_device = device;
+    ResetProcs(LEVEL_DEVICE);
+}}
+
+void InitVulkanDriver(PFN_vkGetInstanceProcAddr driver) {{
+    driver_gipa = driver;
+    loader_gipa = driver ? DriverGetInstanceProcAddr : 0;
+    loader_gdpa = driver ? DriverGetDeviceProcAddr   : 0;
+    ResetProcs(LEVEL_GLOBAL);
+}}
+
+//-------------------------------Tracing--------------------------------
+// Swap each pointer with its thunk. (Not thread-safe: don't toggle while other threads call Vulkan.)
+void TraceVulkan(int enable) {{
+    if (!enable == !trace_enabled) return;
+    if (enable && !trace_events) {{
+        trace_events = (CTraceEvent*)calloc(TRACE_EVENTS, sizeof(CTraceEvent));
+        if (!trace_events) return;
+    }}
+    for (size_t i = 0; i < sizeof(proc_table) / sizeof(proc_table[0]); ++i) {{
+        const CProcEntry& proc = proc_table[i];
+        if (enable) {{ traced_procs[proc.id] = *proc.slot;  *proc.slot = proc.trace; }}
+        else        {{ *proc.slot = traced_procs[proc.id]; }}
+    }}
+    for (int i = 0; i < TRACE_TABLES; ++i)
+        if (trace_tables[i].table) trace_tables[i].swap(trace_tables[i].table, enable);
+    trace_enabled = enable;
+}}
+
+int TraceVulkanEnabled(void) {{ return trace_enabled; }}
+
+void TraceVulkanNextFrame(void) {{
+    if (!trace_enabled) return;
+    uint64_t calls[TRACE_COUNT] = {{}};
+    uint64_t time [TRACE_COUNT] = {{}};
+    for (CTraceThread* thread = trace_threads.load(std::memory_order_acquire); thread; thread = thread->next) {{
+        for (uint32_t i = 0; i < TRACE_COUNT; ++i) {{
+            calls[i] += thread->calls[i].load(std::memory_order_relaxed);
+            time[i]  += thread->time[i] .load(std::memory_order_relaxed);
+        }}
+    }}
+    for (uint32_t i = 0; i < TRACE_COUNT; ++i) {{
+        trace_last[i].calls  = (uint32_t)(calls[i] - trace_total_calls[i]);
+        trace_last[i].time   = time[i] - trace_total_time[i];
+        trace_total_calls[i] = calls[i];
+        trace_total_time[i]  = time[i];
+    }}
+    trace_frame_index.fetch_add(1, std::memory_order_relaxed);
+}}
+
+//---------------------------Dispatch tables----------------------------
+void TraceVulkanAddTable(void* table, PFN_TraceVulkanTable swap) {{
+    int slot = -1;
+    for (int i = 0; i < TRACE_TABLES && slot < 0; ++i) if (trace_tables[i].table == table) slot = i;
+    for (int i = 0; i < TRACE_TABLES && slot < 0; ++i) if (!trace_tables[i].table) slot = i;
+    if (slot < 0) return;  // too many tables: calls through this one are not traced
+    trace_tables[slot].table = table;
+    trace_tables[slot].swap  = swap;
+    if (trace_enabled) swap(table, 1);
+}}
+
+void TraceVulkanRemoveTable(void* table) {{
+    int count = 0;
+    for (int i = 0; i < TRACE_TABLES; ++i) {{
+        if (trace_tables[i].table == table) trace_tables[i].table = 0;
+        if (trace_tables[i].table) count++;
+    }}
+    if (!count) memset(table_procs, 0, sizeof(table_procs));  // The next device may be on another driver.
+}}
+
+// Point a table entry at its thunk, or back at the real function.
+// All traced tables share one real function per entry, so a table whose entry points at another
+// function, (eg: a second device, on another driver) keeps that entry untraced.
+void TraceVulkanSwap(PFN_vkVoidFunction* entry, const char* name, int enable) {{
+    if (!*entry) return;  // (extension not enabled)
+    for (size_t i = 0; i < sizeof(table_thunk_table) / sizeof(table_thunk_table[0]); ++i) {{
+        const CTableThunk& thunk = table_thunk_table[i];
+        if (strcmp(trace_names[thunk.id], name)) continue;
+        PFN_vkVoidFunction& real = table_procs[thunk.id];
+        if (!enable) {{
+            if (*entry == thunk.trace) *entry = real;
+        }} else if (*entry != thunk.trace && (!real || real == *entry)) {{
+            real   = *entry;
+            *entry = thunk.trace;
+        }}
+        return;
+    }}
+}}
+
+static int CompareTraceTime(const void* a, const void* b) {{
+    uint64_t ta = trace_last[*(const uint32_t*)a].time;
+    uint64_t tb = trace_last[*(const uint32_t*)b].time;
+    return (ta < tb) - (ta > tb);  // descending
+}}
+
+void TraceVulkanPrint(int top_n) {{
+    uint32_t order[TRACE_COUNT];
+    uint32_t calls = 0;
+    uint64_t time  = 0;
+    for (uint32_t i = 0; i < TRACE_COUNT; ++i) {{
+        order[i] = i;
+        calls += trace_last[i].calls;
+        time  += trace_last[i].time;
+    }}
+    qsort(order, TRACE_COUNT, sizeof(order[0]), CompareTraceTime);
+    printf("Vulkan calls in frame %u: %u calls, %.3f ms\\n", trace_frame_index ? trace_frame_index - 1 : 0, calls, time / 1e6);
+    printf("\\t%-40s %8s %10s %9s\\n", "Function", "Calls", "Total(us)", "Avg(ns)");
+    for (int i = 0; i < top_n && i < TRACE_COUNT; ++i) {{
+        const CTraceStat& stat = trace_last[order[i]];
+        if (!stat.calls) break;
+        printf("\\t%-40s %8u %10.1f %9u\\n", trace_names[order[i]], stat.calls, stat.time / 1e3, (uint32_t)(stat.time / stat.calls));
+    }}
+}}
+
+/* Binary trace format: (native byte order)
+ *   char     magic[4] = "VKTR"
+ *   uint32_t version  = 1
+ *   uint32_t name_count, followed by name_count null-terminated function names. (indexed by id)
+ *   uint32_t event_count, followed by event_count records of:
+ *     {{ uint32_t id; uint32_t frame; uint64_t start; uint64_t time; }}  // start and time in nanoseconds
+ *   Events are in call order. Only the most recent TRACE_EVENTS calls are kept.
+ */
+int TraceVulkanDump(const char* filename) {{
+    FILE* file = fopen(filename, "wb");
+    if (!file) return 0;
+    const uint32_t version = 1, name_count = TRACE_COUNT;
+    fwrite("VKTR", 1, 4, file);
+    fwrite(&version, sizeof(version), 1, file);
+    fwrite(&name_count, sizeof(name_count), 1, file);
+    for (uint32_t i = 0; i < TRACE_COUNT; ++i) fwrite(trace_names[i], 1, strlen(trace_names[i]) + 1, file);
+    uint64_t first = (trace_event_count > TRACE_EVENTS) ? trace_event_count - TRACE_EVENTS : 0;
+    uint32_t event_count = (uint32_t)(trace_event_count - first);
+    fwrite(&event_count, sizeof(event_count), 1, file);
+    for (uint64_t i = first; i < trace_event_count; ++i) {{
+        const CTraceEvent& event = trace_events[i % TRACE_EVENTS];
+        fwrite(&event.id, sizeof(event.id), 1, file);
+        fwrite(&event.frame, sizeof(event.frame), 1, file);
+        fwrite(&event.start, sizeof(event.start), 1, file);
+        fwrite(&event.time, sizeof(event.time), 1, file);
+    }}
+    int ok = !ferror(file);
+    fclose(file);
+    return ok;
+}}
+
+#ifdef __cplusplus
+}}
+#endif
+"""
+
+
+TABLE = """\
+// This file is generated by VulkanWrapper/generate.py, from vulkan.h (VK_HEADER_VERSION {version}). DO NOT EDIT.
+/*
+*  CDeviceTable holds the device-level Vulkan functions of one VkDevice, loaded with vkGetDeviceProcAddr.
+*  Calls go straight to the driver, without the loader trampoline, and each CDevice owns its own table,
+*  so several devices (even on different drivers) can be used at the same time.
+*  Function names drop the "vk" prefix. Functions of extensions that were not enabled are null.
+*
+*  eg:
+*    device.vk.CmdDraw(cmd_buf, 3, 1, 0, 0);
+*/
+
+#ifndef CDEVICETABLE_H
+#define CDEVICETABLE_H
+
+#include "Validation.h"  // vulkan.h or vulkan_wrapper.h
+#include <string.h>
+
+struct CDeviceTable {{
+{members}
+
+    CDeviceTable() {{ memset((void*)this, 0, sizeof(*this)); }}
+
+    void Unload() {{  // Set all entries to null.
+#ifdef VULKAN_WRAPPER_H
+        TraceVulkanRemoveTable(this);
+#endif
+        memset((void*)this, 0, sizeof(*this));
+    }}
+
+    void Load(VkDevice device) {{
+#define LOAD(NAME) NAME = (PFN_vk##NAME)vkGetDeviceProcAddr(device, "vk" #NAME)
+{loads}
+#undef LOAD
+#ifdef VULKAN_WRAPPER_H
+        TraceVulkanAddTable(this, Swap);  // TraceVulkan() also times the calls through this table.
+#endif
+    }}
+
+#ifdef VULKAN_WRAPPER_H  // Tracing: (see TraceVulkan, in vulkan_wrapper.h)
+    ~CDeviceTable() {{ TraceVulkanRemoveTable(this); }}
+    CDeviceTable(const CDeviceTable&) = delete;  // (registered by address)
+    CDeviceTable& operator=(const CDeviceTable&) = delete;
+
+  private:
+    static void Swap(void* table, int enable) {{
+        CDeviceTable& vk = *(CDeviceTable*)table;
+#define SWAP(NAME) TraceVulkanSwap((PFN_vkVoidFunction*)&vk.NAME, "vk" #NAME, enable)
+{swaps}
+#undef SWAP
+    }}
+#endif
+}};
+
+#endif
+"""
+
+
+def stub(c):
+    decl = ", ".join(p[0] for p in c.params)
+    args = ", ".join(p[1] for p in c.params)
+    ret = "" if c.ret == "void" else "return "
+    if c.ret == "void":
+        fail = "return;"
+    else:
+        fail = "return VK_ERROR_INITIALIZATION_FAILED;" if c.ret == "VkResult" else "return 0;"
+    return [
+        "static VKAPI_ATTR %s VKAPI_CALL Load_%s(%s) {" % (c.ret, c.name, decl),
+        '    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&%s, %d, "%s", %s);' % (c.name, c.id, c.name, LEVEL_NAMES[c.level]),
+        "    if (!fn) %s" % fail,
+        "    %s((PFN_%s)fn)(%s);" % (ret, c.name, args),
+        "}",
+    ]
+
+
+def noop(c):
+    decl = ", ".join(p[0] for p in c.params)
+    if c.ret == "void":
+        body = "}"
+    else:
+        body = " return %s; }" % ("VK_SUCCESS" if c.ret == "VkResult" else "0")
+    return ["static VKAPI_ATTR %s VKAPI_CALL Noop_%s(%s) {%s" % (c.ret, c.name, decl, body)]
+
+
+def thunk(c, prefix="Trace_", procs="traced_procs"):  # (table thunks: prefix="TraceTable_", procs="table_procs")
+    decl = ", ".join(p[0] for p in c.params)
+    args = ", ".join(p[1] for p in c.params)
+    call = "((PFN_%s)%s[%d])(%s);" % (c.name, procs, c.id, args)
+    lines = ["static VKAPI_ATTR %s VKAPI_CALL %s%s(%s) {" % (c.ret, prefix, c.name, decl),
+             "    uint64_t start = TraceTime();"]
+    if c.ret == "void":
+        lines += ["    " + call, "    TraceCall(%d, start);" % c.id]
+    else:
+        lines += ["    %s result = %s" % (c.ret, call), "    TraceCall(%d, start);" % c.id, "    return result;"]
+    return lines + ["}"]
+
+
+def generate_table(commands, version, out_dir):
+    device = [c for c in commands if c.level == DEVICE]
+    members = "\n".join(grouped(device, lambda c: ["    PFN_%s %s;" % (c.name, c.name[2:])]))
+    members = "\n".join(("    " + l if l.startswith("//") else l) for l in members.split("\n"))
+    loads = "\n".join(guarded(device, lambda c: ["        LOAD(%s);" % c.name[2:]]))
+    swaps = "\n".join(guarded(device, lambda c: ["        SWAP(%s);" % c.name[2:]]))
+    write(os.path.join(out_dir, "CDeviceTable.h"), TABLE.format(version=version, members=members, loads=loads, swaps=swaps))
+
+
+def generate(header, out_dir):
+    commands, state = parse_header(header)
+    version = state["header_version"]
+    for i, c in enumerate(commands):
+        c.id = i
+    declarations = "\n".join(grouped(commands, lambda c: ["extern PFN_%s %s;" % (c.name, c.name)]))
+    stubs = "\n".join(guarded(commands, stub))
+    noops = "\n".join(guarded(commands, noop))
+    noop_table = "\n".join(guarded(commands, lambda c: ['    {"%s", (PFN_vkVoidFunction)Noop_%s},' % (c.name, c.name)]))
+    thunks = "\n".join(guarded(commands, thunk))
+    device = [c for c in commands if c.level == DEVICE]
+    table_thunks = "\n".join(guarded(device, lambda c: thunk(c, "TraceTable_", "table_procs")))
+    table_thunk_table = "\n".join(guarded(device, lambda c: [
+        "    {%d, (PFN_vkVoidFunction)TraceTable_%s}," % (c.id, c.name)]))
+    pointers = "\n".join(guarded(commands, lambda c: ["PFN_%s %s = Load_%s;" % (c.name, c.name, c.name)]))
+    names = "\n".join('    "%s",' % c.name for c in commands)
+    table = "\n".join(guarded(commands, lambda c: [
+        "    {(PFN_vkVoidFunction*)&%s, (PFN_vkVoidFunction)Load_%s, (PFN_vkVoidFunction)Trace_%s, %d, %s}," %
+        (c.name, c.name, c.name, c.id, LEVEL_NAMES[c.level])]))
+
+    write(os.path.join(out_dir, "vulkan_wrapper.h"), HEADER.format(version=version, declarations=declarations))
+    write(os.path.join(out_dir, "vulkan_wrapper.cpp"),
+          SOURCE.format(version=version, count=len(commands), names=names, stubs=stubs, thunks=thunks,
+                        table_thunks=table_thunks, noops=noops, noop_table=noop_table,
+                        pointers=pointers, table=table, table_thunk_table=table_thunk_table))
+    generate_table(commands, version, out_dir)
+    print("vulkan_wrapper: %d functions (VK_HEADER_VERSION %s)" % (len(commands), version))
+
+
+def write(path, text):  # Only touch the file if it changed, to avoid needless rebuilds.
+    if os.path.exists(path) and open(path).read() == text:
+        return
+    with open(path, "w") as f:
+        f.write(text)
+
+
+if __name__ == "__main__":
+    here = os.path.dirname(os.path.abspath(__file__))
+    header = sys.argv[1] if len(sys.argv) > 1 else os.path.join(here, "vulkan", "vulkan.h")
+    out_dir = sys.argv[2] if len(sys.argv) > 2 else here
+    generate(header, out_dir)
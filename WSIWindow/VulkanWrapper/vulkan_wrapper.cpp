@@ -13,446 +13,5803 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
-// This file is generated.
+// This file is generated by generate.py, from vulkan.h (VK_HEADER_VERSION 69). DO NOT EDIT.
+#include <atomic>  // (outside of extern "C", as it declares templates)
+
 #ifdef __cplusplus
 extern "C" {
 #endif
-	
+
 #ifdef _WIN32
     #define VK_USE_PLATFORM_WIN32_KHR
     #include <windows.h>
-    FARPROC __stdcall dlsym(HMODULE lib, LPCSTR fn) { return GetProcAddress(lib, fn); }
 #else
     #include <dlfcn.h>
+    #include <time.h>
 #endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include "vulkan_wrapper.h"
 
-int InitVulkan(void) {
 #ifdef _WIN32
-    HMODULE libvulkan = LoadLibrary("vulkan-1.dll");
+    typedef HMODULE LIBHANDLE;
+    static LIBHANDLE LoadVulkanLibrary() { return LoadLibraryA("vulkan-1.dll"); }
+    static PFN_vkVoidFunction GetSymbol(LIBHANDLE lib, const char* fn) { return (PFN_vkVoidFunction)GetProcAddress(lib, fn); }
 #else
-    void* libvulkan = dlopen("libvulkan.so", RTLD_NOW | RTLD_LOCAL);
-#endif
-
-    if (!libvulkan){ return 0; }	
-	
-
-    // Vulkan supported, set function addresses
-    vkCreateInstance = reinterpret_cast<PFN_vkCreateInstance>(dlsym(libvulkan, "vkCreateInstance"));
-    vkDestroyInstance = reinterpret_cast<PFN_vkDestroyInstance>(dlsym(libvulkan, "vkDestroyInstance"));
-    vkEnumeratePhysicalDevices = reinterpret_cast<PFN_vkEnumeratePhysicalDevices>(dlsym(libvulkan, "vkEnumeratePhysicalDevices"));
-    vkGetPhysicalDeviceFeatures =
-        reinterpret_cast<PFN_vkGetPhysicalDeviceFeatures>(dlsym(libvulkan, "vkGetPhysicalDeviceFeatures"));
-    vkGetPhysicalDeviceFormatProperties =
-        reinterpret_cast<PFN_vkGetPhysicalDeviceFormatProperties>(dlsym(libvulkan, "vkGetPhysicalDeviceFormatProperties"));
-    vkGetPhysicalDeviceImageFormatProperties = reinterpret_cast<PFN_vkGetPhysicalDeviceImageFormatProperties>(
-        dlsym(libvulkan, "vkGetPhysicalDeviceImageFormatProperties"));
-    vkGetPhysicalDeviceProperties =
-        reinterpret_cast<PFN_vkGetPhysicalDeviceProperties>(dlsym(libvulkan, "vkGetPhysicalDeviceProperties"));
-    vkGetPhysicalDeviceQueueFamilyProperties = reinterpret_cast<PFN_vkGetPhysicalDeviceQueueFamilyProperties>(
-        dlsym(libvulkan, "vkGetPhysicalDeviceQueueFamilyProperties"));
-    vkGetPhysicalDeviceMemoryProperties =
-        reinterpret_cast<PFN_vkGetPhysicalDeviceMemoryProperties>(dlsym(libvulkan, "vkGetPhysicalDeviceMemoryProperties"));
-    vkGetInstanceProcAddr = reinterpret_cast<PFN_vkGetInstanceProcAddr>(dlsym(libvulkan, "vkGetInstanceProcAddr"));
-    vkGetDeviceProcAddr = reinterpret_cast<PFN_vkGetDeviceProcAddr>(dlsym(libvulkan, "vkGetDeviceProcAddr"));
-    vkCreateDevice = reinterpret_cast<PFN_vkCreateDevice>(dlsym(libvulkan, "vkCreateDevice"));
-    vkDestroyDevice = reinterpret_cast<PFN_vkDestroyDevice>(dlsym(libvulkan, "vkDestroyDevice"));
-    vkEnumerateInstanceExtensionProperties =
-        reinterpret_cast<PFN_vkEnumerateInstanceExtensionProperties>(dlsym(libvulkan, "vkEnumerateInstanceExtensionProperties"));
-    vkEnumerateDeviceExtensionProperties =
-        reinterpret_cast<PFN_vkEnumerateDeviceExtensionProperties>(dlsym(libvulkan, "vkEnumerateDeviceExtensionProperties"));
-    vkEnumerateInstanceLayerProperties =
-        reinterpret_cast<PFN_vkEnumerateInstanceLayerProperties>(dlsym(libvulkan, "vkEnumerateInstanceLayerProperties"));
-    vkEnumerateDeviceLayerProperties =
-        reinterpret_cast<PFN_vkEnumerateDeviceLayerProperties>(dlsym(libvulkan, "vkEnumerateDeviceLayerProperties"));
-    vkGetDeviceQueue = reinterpret_cast<PFN_vkGetDeviceQueue>(dlsym(libvulkan, "vkGetDeviceQueue"));
-    vkQueueSubmit = reinterpret_cast<PFN_vkQueueSubmit>(dlsym(libvulkan, "vkQueueSubmit"));
-    vkQueueWaitIdle = reinterpret_cast<PFN_vkQueueWaitIdle>(dlsym(libvulkan, "vkQueueWaitIdle"));
-    vkDeviceWaitIdle = reinterpret_cast<PFN_vkDeviceWaitIdle>(dlsym(libvulkan, "vkDeviceWaitIdle"));
-    vkAllocateMemory = reinterpret_cast<PFN_vkAllocateMemory>(dlsym(libvulkan, "vkAllocateMemory"));
-    vkFreeMemory = reinterpret_cast<PFN_vkFreeMemory>(dlsym(libvulkan, "vkFreeMemory"));
-    vkMapMemory = reinterpret_cast<PFN_vkMapMemory>(dlsym(libvulkan, "vkMapMemory"));
-    vkUnmapMemory = reinterpret_cast<PFN_vkUnmapMemory>(dlsym(libvulkan, "vkUnmapMemory"));
-    vkFlushMappedMemoryRanges = reinterpret_cast<PFN_vkFlushMappedMemoryRanges>(dlsym(libvulkan, "vkFlushMappedMemoryRanges"));
-    vkInvalidateMappedMemoryRanges =
-        reinterpret_cast<PFN_vkInvalidateMappedMemoryRanges>(dlsym(libvulkan, "vkInvalidateMappedMemoryRanges"));
-    vkGetDeviceMemoryCommitment =
-        reinterpret_cast<PFN_vkGetDeviceMemoryCommitment>(dlsym(libvulkan, "vkGetDeviceMemoryCommitment"));
-    vkBindBufferMemory = reinterpret_cast<PFN_vkBindBufferMemory>(dlsym(libvulkan, "vkBindBufferMemory"));
-    vkBindImageMemory = reinterpret_cast<PFN_vkBindImageMemory>(dlsym(libvulkan, "vkBindImageMemory"));
-    vkGetBufferMemoryRequirements =
-        reinterpret_cast<PFN_vkGetBufferMemoryRequirements>(dlsym(libvulkan, "vkGetBufferMemoryRequirements"));
-    vkGetImageMemoryRequirements =
-        reinterpret_cast<PFN_vkGetImageMemoryRequirements>(dlsym(libvulkan, "vkGetImageMemoryRequirements"));
-    vkGetImageSparseMemoryRequirements =
-        reinterpret_cast<PFN_vkGetImageSparseMemoryRequirements>(dlsym(libvulkan, "vkGetImageSparseMemoryRequirements"));
-    vkGetPhysicalDeviceSparseImageFormatProperties = reinterpret_cast<PFN_vkGetPhysicalDeviceSparseImageFormatProperties>(
-        dlsym(libvulkan, "vkGetPhysicalDeviceSparseImageFormatProperties"));
-    vkQueueBindSparse = reinterpret_cast<PFN_vkQueueBindSparse>(dlsym(libvulkan, "vkQueueBindSparse"));
-    vkCreateFence = reinterpret_cast<PFN_vkCreateFence>(dlsym(libvulkan, "vkCreateFence"));
-    vkDestroyFence = reinterpret_cast<PFN_vkDestroyFence>(dlsym(libvulkan, "vkDestroyFence"));
-    vkResetFences = reinterpret_cast<PFN_vkResetFences>(dlsym(libvulkan, "vkResetFences"));
-    vkGetFenceStatus = reinterpret_cast<PFN_vkGetFenceStatus>(dlsym(libvulkan, "vkGetFenceStatus"));
-    vkWaitForFences = reinterpret_cast<PFN_vkWaitForFences>(dlsym(libvulkan, "vkWaitForFences"));
-    vkCreateSemaphore = reinterpret_cast<PFN_vkCreateSemaphore>(dlsym(libvulkan, "vkCreateSemaphore"));
-    vkDestroySemaphore = reinterpret_cast<PFN_vkDestroySemaphore>(dlsym(libvulkan, "vkDestroySemaphore"));
-    vkCreateEvent = reinterpret_cast<PFN_vkCreateEvent>(dlsym(libvulkan, "vkCreateEvent"));
-    vkDestroyEvent = reinterpret_cast<PFN_vkDestroyEvent>(dlsym(libvulkan, "vkDestroyEvent"));
-    vkGetEventStatus = reinterpret_cast<PFN_vkGetEventStatus>(dlsym(libvulkan, "vkGetEventStatus"));
-    vkSetEvent = reinterpret_cast<PFN_vkSetEvent>(dlsym(libvulkan, "vkSetEvent"));
-    vkResetEvent = reinterpret_cast<PFN_vkResetEvent>(dlsym(libvulkan, "vkResetEvent"));
-    vkCreateQueryPool = reinterpret_cast<PFN_vkCreateQueryPool>(dlsym(libvulkan, "vkCreateQueryPool"));
-    vkDestroyQueryPool = reinterpret_cast<PFN_vkDestroyQueryPool>(dlsym(libvulkan, "vkDestroyQueryPool"));
-    vkGetQueryPoolResults = reinterpret_cast<PFN_vkGetQueryPoolResults>(dlsym(libvulkan, "vkGetQueryPoolResults"));
-    vkCreateBuffer = reinterpret_cast<PFN_vkCreateBuffer>(dlsym(libvulkan, "vkCreateBuffer"));
-    vkDestroyBuffer = reinterpret_cast<PFN_vkDestroyBuffer>(dlsym(libvulkan, "vkDestroyBuffer"));
-    vkCreateBufferView = reinterpret_cast<PFN_vkCreateBufferView>(dlsym(libvulkan, "vkCreateBufferView"));
-    vkDestroyBufferView = reinterpret_cast<PFN_vkDestroyBufferView>(dlsym(libvulkan, "vkDestroyBufferView"));
-    vkCreateImage = reinterpret_cast<PFN_vkCreateImage>(dlsym(libvulkan, "vkCreateImage"));
-    vkDestroyImage = reinterpret_cast<PFN_vkDestroyImage>(dlsym(libvulkan, "vkDestroyImage"));
-    vkGetImageSubresourceLayout =
-        reinterpret_cast<PFN_vkGetImageSubresourceLayout>(dlsym(libvulkan, "vkGetImageSubresourceLayout"));
-    vkCreateImageView = reinterpret_cast<PFN_vkCreateImageView>(dlsym(libvulkan, "vkCreateImageView"));
-    vkDestroyImageView = reinterpret_cast<PFN_vkDestroyImageView>(dlsym(libvulkan, "vkDestroyImageView"));
-    vkCreateShaderModule = reinterpret_cast<PFN_vkCreateShaderModule>(dlsym(libvulkan, "vkCreateShaderModule"));
-    vkDestroyShaderModule = reinterpret_cast<PFN_vkDestroyShaderModule>(dlsym(libvulkan, "vkDestroyShaderModule"));
-    vkCreatePipelineCache = reinterpret_cast<PFN_vkCreatePipelineCache>(dlsym(libvulkan, "vkCreatePipelineCache"));
-    vkDestroyPipelineCache = reinterpret_cast<PFN_vkDestroyPipelineCache>(dlsym(libvulkan, "vkDestroyPipelineCache"));
-    vkGetPipelineCacheData = reinterpret_cast<PFN_vkGetPipelineCacheData>(dlsym(libvulkan, "vkGetPipelineCacheData"));
-    vkMergePipelineCaches = reinterpret_cast<PFN_vkMergePipelineCaches>(dlsym(libvulkan, "vkMergePipelineCaches"));
-    vkCreateGraphicsPipelines = reinterpret_cast<PFN_vkCreateGraphicsPipelines>(dlsym(libvulkan, "vkCreateGraphicsPipelines"));
-    vkCreateComputePipelines = reinterpret_cast<PFN_vkCreateComputePipelines>(dlsym(libvulkan, "vkCreateComputePipelines"));
-    vkDestroyPipeline = reinterpret_cast<PFN_vkDestroyPipeline>(dlsym(libvulkan, "vkDestroyPipeline"));
-    vkCreatePipelineLayout = reinterpret_cast<PFN_vkCreatePipelineLayout>(dlsym(libvulkan, "vkCreatePipelineLayout"));
-    vkDestroyPipelineLayout = reinterpret_cast<PFN_vkDestroyPipelineLayout>(dlsym(libvulkan, "vkDestroyPipelineLayout"));
-    vkCreateSampler = reinterpret_cast<PFN_vkCreateSampler>(dlsym(libvulkan, "vkCreateSampler"));
-    vkDestroySampler = reinterpret_cast<PFN_vkDestroySampler>(dlsym(libvulkan, "vkDestroySampler"));
-    vkCreateDescriptorSetLayout =
-        reinterpret_cast<PFN_vkCreateDescriptorSetLayout>(dlsym(libvulkan, "vkCreateDescriptorSetLayout"));
-    vkDestroyDescriptorSetLayout =
-        reinterpret_cast<PFN_vkDestroyDescriptorSetLayout>(dlsym(libvulkan, "vkDestroyDescriptorSetLayout"));
-    vkCreateDescriptorPool = reinterpret_cast<PFN_vkCreateDescriptorPool>(dlsym(libvulkan, "vkCreateDescriptorPool"));
-    vkDestroyDescriptorPool = reinterpret_cast<PFN_vkDestroyDescriptorPool>(dlsym(libvulkan, "vkDestroyDescriptorPool"));
-    vkResetDescriptorPool = reinterpret_cast<PFN_vkResetDescriptorPool>(dlsym(libvulkan, "vkResetDescriptorPool"));
-    vkAllocateDescriptorSets = reinterpret_cast<PFN_vkAllocateDescriptorSets>(dlsym(libvulkan, "vkAllocateDescriptorSets"));
-    vkFreeDescriptorSets = reinterpret_cast<PFN_vkFreeDescriptorSets>(dlsym(libvulkan, "vkFreeDescriptorSets"));
-    vkUpdateDescriptorSets = reinterpret_cast<PFN_vkUpdateDescriptorSets>(dlsym(libvulkan, "vkUpdateDescriptorSets"));
-    vkCreateFramebuffer = reinterpret_cast<PFN_vkCreateFramebuffer>(dlsym(libvulkan, "vkCreateFramebuffer"));
-    vkDestroyFramebuffer = reinterpret_cast<PFN_vkDestroyFramebuffer>(dlsym(libvulkan, "vkDestroyFramebuffer"));
-    vkCreateRenderPass = reinterpret_cast<PFN_vkCreateRenderPass>(dlsym(libvulkan, "vkCreateRenderPass"));
-    vkDestroyRenderPass = reinterpret_cast<PFN_vkDestroyRenderPass>(dlsym(libvulkan, "vkDestroyRenderPass"));
-    vkGetRenderAreaGranularity = reinterpret_cast<PFN_vkGetRenderAreaGranularity>(dlsym(libvulkan, "vkGetRenderAreaGranularity"));
-    vkCreateCommandPool = reinterpret_cast<PFN_vkCreateCommandPool>(dlsym(libvulkan, "vkCreateCommandPool"));
-    vkDestroyCommandPool = reinterpret_cast<PFN_vkDestroyCommandPool>(dlsym(libvulkan, "vkDestroyCommandPool"));
-    vkResetCommandPool = reinterpret_cast<PFN_vkResetCommandPool>(dlsym(libvulkan, "vkResetCommandPool"));
-    vkAllocateCommandBuffers = reinterpret_cast<PFN_vkAllocateCommandBuffers>(dlsym(libvulkan, "vkAllocateCommandBuffers"));
-    vkFreeCommandBuffers = reinterpret_cast<PFN_vkFreeCommandBuffers>(dlsym(libvulkan, "vkFreeCommandBuffers"));
-    vkBeginCommandBuffer = reinterpret_cast<PFN_vkBeginCommandBuffer>(dlsym(libvulkan, "vkBeginCommandBuffer"));
-    vkEndCommandBuffer = reinterpret_cast<PFN_vkEndCommandBuffer>(dlsym(libvulkan, "vkEndCommandBuffer"));
-    vkResetCommandBuffer = reinterpret_cast<PFN_vkResetCommandBuffer>(dlsym(libvulkan, "vkResetCommandBuffer"));
-    vkCmdBindPipeline = reinterpret_cast<PFN_vkCmdBindPipeline>(dlsym(libvulkan, "vkCmdBindPipeline"));
-    vkCmdSetViewport = reinterpret_cast<PFN_vkCmdSetViewport>(dlsym(libvulkan, "vkCmdSetViewport"));
-    vkCmdSetScissor = reinterpret_cast<PFN_vkCmdSetScissor>(dlsym(libvulkan, "vkCmdSetScissor"));
-    vkCmdSetLineWidth = reinterpret_cast<PFN_vkCmdSetLineWidth>(dlsym(libvulkan, "vkCmdSetLineWidth"));
-    vkCmdSetDepthBias = reinterpret_cast<PFN_vkCmdSetDepthBias>(dlsym(libvulkan, "vkCmdSetDepthBias"));
-    vkCmdSetBlendConstants = reinterpret_cast<PFN_vkCmdSetBlendConstants>(dlsym(libvulkan, "vkCmdSetBlendConstants"));
-    vkCmdSetDepthBounds = reinterpret_cast<PFN_vkCmdSetDepthBounds>(dlsym(libvulkan, "vkCmdSetDepthBounds"));
-    vkCmdSetStencilCompareMask = reinterpret_cast<PFN_vkCmdSetStencilCompareMask>(dlsym(libvulkan, "vkCmdSetStencilCompareMask"));
-    vkCmdSetStencilWriteMask = reinterpret_cast<PFN_vkCmdSetStencilWriteMask>(dlsym(libvulkan, "vkCmdSetStencilWriteMask"));
-    vkCmdSetStencilReference = reinterpret_cast<PFN_vkCmdSetStencilReference>(dlsym(libvulkan, "vkCmdSetStencilReference"));
-    vkCmdBindDescriptorSets = reinterpret_cast<PFN_vkCmdBindDescriptorSets>(dlsym(libvulkan, "vkCmdBindDescriptorSets"));
-    vkCmdBindIndexBuffer = reinterpret_cast<PFN_vkCmdBindIndexBuffer>(dlsym(libvulkan, "vkCmdBindIndexBuffer"));
-    vkCmdBindVertexBuffers = reinterpret_cast<PFN_vkCmdBindVertexBuffers>(dlsym(libvulkan, "vkCmdBindVertexBuffers"));
-    vkCmdDraw = reinterpret_cast<PFN_vkCmdDraw>(dlsym(libvulkan, "vkCmdDraw"));
-    vkCmdDrawIndexed = reinterpret_cast<PFN_vkCmdDrawIndexed>(dlsym(libvulkan, "vkCmdDrawIndexed"));
-    vkCmdDrawIndirect = reinterpret_cast<PFN_vkCmdDrawIndirect>(dlsym(libvulkan, "vkCmdDrawIndirect"));
-    vkCmdDrawIndexedIndirect = reinterpret_cast<PFN_vkCmdDrawIndexedIndirect>(dlsym(libvulkan, "vkCmdDrawIndexedIndirect"));
-    vkCmdDispatch = reinterpret_cast<PFN_vkCmdDispatch>(dlsym(libvulkan, "vkCmdDispatch"));
-    vkCmdDispatchIndirect = reinterpret_cast<PFN_vkCmdDispatchIndirect>(dlsym(libvulkan, "vkCmdDispatchIndirect"));
-    vkCmdCopyBuffer = reinterpret_cast<PFN_vkCmdCopyBuffer>(dlsym(libvulkan, "vkCmdCopyBuffer"));
-    vkCmdCopyImage = reinterpret_cast<PFN_vkCmdCopyImage>(dlsym(libvulkan, "vkCmdCopyImage"));
-    vkCmdBlitImage = reinterpret_cast<PFN_vkCmdBlitImage>(dlsym(libvulkan, "vkCmdBlitImage"));
-    vkCmdCopyBufferToImage = reinterpret_cast<PFN_vkCmdCopyBufferToImage>(dlsym(libvulkan, "vkCmdCopyBufferToImage"));
-    vkCmdCopyImageToBuffer = reinterpret_cast<PFN_vkCmdCopyImageToBuffer>(dlsym(libvulkan, "vkCmdCopyImageToBuffer"));
-    vkCmdUpdateBuffer = reinterpret_cast<PFN_vkCmdUpdateBuffer>(dlsym(libvulkan, "vkCmdUpdateBuffer"));
-    vkCmdFillBuffer = reinterpret_cast<PFN_vkCmdFillBuffer>(dlsym(libvulkan, "vkCmdFillBuffer"));
-    vkCmdClearColorImage = reinterpret_cast<PFN_vkCmdClearColorImage>(dlsym(libvulkan, "vkCmdClearColorImage"));
-    vkCmdClearDepthStencilImage =
-        reinterpret_cast<PFN_vkCmdClearDepthStencilImage>(dlsym(libvulkan, "vkCmdClearDepthStencilImage"));
-    vkCmdClearAttachments = reinterpret_cast<PFN_vkCmdClearAttachments>(dlsym(libvulkan, "vkCmdClearAttachments"));
-    vkCmdResolveImage = reinterpret_cast<PFN_vkCmdResolveImage>(dlsym(libvulkan, "vkCmdResolveImage"));
-    vkCmdSetEvent = reinterpret_cast<PFN_vkCmdSetEvent>(dlsym(libvulkan, "vkCmdSetEvent"));
-    vkCmdResetEvent = reinterpret_cast<PFN_vkCmdResetEvent>(dlsym(libvulkan, "vkCmdResetEvent"));
-    vkCmdWaitEvents = reinterpret_cast<PFN_vkCmdWaitEvents>(dlsym(libvulkan, "vkCmdWaitEvents"));
-    vkCmdPipelineBarrier = reinterpret_cast<PFN_vkCmdPipelineBarrier>(dlsym(libvulkan, "vkCmdPipelineBarrier"));
-    vkCmdBeginQuery = reinterpret_cast<PFN_vkCmdBeginQuery>(dlsym(libvulkan, "vkCmdBeginQuery"));
-    vkCmdEndQuery = reinterpret_cast<PFN_vkCmdEndQuery>(dlsym(libvulkan, "vkCmdEndQuery"));
-    vkCmdResetQueryPool = reinterpret_cast<PFN_vkCmdResetQueryPool>(dlsym(libvulkan, "vkCmdResetQueryPool"));
-    vkCmdWriteTimestamp = reinterpret_cast<PFN_vkCmdWriteTimestamp>(dlsym(libvulkan, "vkCmdWriteTimestamp"));
-    vkCmdCopyQueryPoolResults = reinterpret_cast<PFN_vkCmdCopyQueryPoolResults>(dlsym(libvulkan, "vkCmdCopyQueryPoolResults"));
-    vkCmdPushConstants = reinterpret_cast<PFN_vkCmdPushConstants>(dlsym(libvulkan, "vkCmdPushConstants"));
-    vkCmdBeginRenderPass = reinterpret_cast<PFN_vkCmdBeginRenderPass>(dlsym(libvulkan, "vkCmdBeginRenderPass"));
-    vkCmdNextSubpass = reinterpret_cast<PFN_vkCmdNextSubpass>(dlsym(libvulkan, "vkCmdNextSubpass"));
-    vkCmdEndRenderPass = reinterpret_cast<PFN_vkCmdEndRenderPass>(dlsym(libvulkan, "vkCmdEndRenderPass"));
-    vkCmdExecuteCommands = reinterpret_cast<PFN_vkCmdExecuteCommands>(dlsym(libvulkan, "vkCmdExecuteCommands"));
-    vkDestroySurfaceKHR = reinterpret_cast<PFN_vkDestroySurfaceKHR>(dlsym(libvulkan, "vkDestroySurfaceKHR"));
-    vkGetPhysicalDeviceSurfaceSupportKHR =
-        reinterpret_cast<PFN_vkGetPhysicalDeviceSurfaceSupportKHR>(dlsym(libvulkan, "vkGetPhysicalDeviceSurfaceSupportKHR"));
-    vkGetPhysicalDeviceSurfaceCapabilitiesKHR = reinterpret_cast<PFN_vkGetPhysicalDeviceSurfaceCapabilitiesKHR>(
-        dlsym(libvulkan, "vkGetPhysicalDeviceSurfaceCapabilitiesKHR"));
-    vkGetPhysicalDeviceSurfaceFormatsKHR =
-        reinterpret_cast<PFN_vkGetPhysicalDeviceSurfaceFormatsKHR>(dlsym(libvulkan, "vkGetPhysicalDeviceSurfaceFormatsKHR"));
-    vkGetPhysicalDeviceSurfacePresentModesKHR = reinterpret_cast<PFN_vkGetPhysicalDeviceSurfacePresentModesKHR>(
-        dlsym(libvulkan, "vkGetPhysicalDeviceSurfacePresentModesKHR"));
-    vkCreateSwapchainKHR = reinterpret_cast<PFN_vkCreateSwapchainKHR>(dlsym(libvulkan, "vkCreateSwapchainKHR"));
-    vkDestroySwapchainKHR = reinterpret_cast<PFN_vkDestroySwapchainKHR>(dlsym(libvulkan, "vkDestroySwapchainKHR"));
-    vkGetSwapchainImagesKHR = reinterpret_cast<PFN_vkGetSwapchainImagesKHR>(dlsym(libvulkan, "vkGetSwapchainImagesKHR"));
-    vkAcquireNextImageKHR = reinterpret_cast<PFN_vkAcquireNextImageKHR>(dlsym(libvulkan, "vkAcquireNextImageKHR"));
-    vkQueuePresentKHR = reinterpret_cast<PFN_vkQueuePresentKHR>(dlsym(libvulkan, "vkQueuePresentKHR"));
-    vkGetPhysicalDeviceDisplayPropertiesKHR =
-        reinterpret_cast<PFN_vkGetPhysicalDeviceDisplayPropertiesKHR>(dlsym(libvulkan, "vkGetPhysicalDeviceDisplayPropertiesKHR"));
-    vkGetPhysicalDeviceDisplayPlanePropertiesKHR = reinterpret_cast<PFN_vkGetPhysicalDeviceDisplayPlanePropertiesKHR>(
-        dlsym(libvulkan, "vkGetPhysicalDeviceDisplayPlanePropertiesKHR"));
-    vkGetDisplayPlaneSupportedDisplaysKHR =
-        reinterpret_cast<PFN_vkGetDisplayPlaneSupportedDisplaysKHR>(dlsym(libvulkan, "vkGetDisplayPlaneSupportedDisplaysKHR"));
-    vkGetDisplayModePropertiesKHR =
-        reinterpret_cast<PFN_vkGetDisplayModePropertiesKHR>(dlsym(libvulkan, "vkGetDisplayModePropertiesKHR"));
-    vkCreateDisplayModeKHR = reinterpret_cast<PFN_vkCreateDisplayModeKHR>(dlsym(libvulkan, "vkCreateDisplayModeKHR"));
-    vkGetDisplayPlaneCapabilitiesKHR =
-        reinterpret_cast<PFN_vkGetDisplayPlaneCapabilitiesKHR>(dlsym(libvulkan, "vkGetDisplayPlaneCapabilitiesKHR"));
-    vkCreateDisplayPlaneSurfaceKHR =
-        reinterpret_cast<PFN_vkCreateDisplayPlaneSurfaceKHR>(dlsym(libvulkan, "vkCreateDisplayPlaneSurfaceKHR"));
-    vkCreateSharedSwapchainsKHR =
-        reinterpret_cast<PFN_vkCreateSharedSwapchainsKHR>(dlsym(libvulkan, "vkCreateSharedSwapchainsKHR"));
-
-#ifdef VK_USE_PLATFORM_XLIB_KHR
-    vkCreateXlibSurfaceKHR = reinterpret_cast<PFN_vkCreateXlibSurfaceKHR>(dlsym(libvulkan, "vkCreateXlibSurfaceKHR"));
-    vkGetPhysicalDeviceXlibPresentationSupportKHR = reinterpret_cast<PFN_vkGetPhysicalDeviceXlibPresentationSupportKHR>(
-        dlsym(libvulkan, "vkGetPhysicalDeviceXlibPresentationSupportKHR"));
+    typedef void* LIBHANDLE;
+    static LIBHANDLE LoadVulkanLibrary() {
+        LIBHANDLE lib = dlopen("libvulkan.so.1", RTLD_NOW | RTLD_LOCAL);
+        return lib ? lib : dlopen("libvulkan.so", RTLD_NOW | RTLD_LOCAL);
+    }
+    static PFN_vkVoidFunction GetSymbol(LIBHANDLE lib, const char* fn) { return (PFN_vkVoidFunction)dlsym(lib, fn); }
 #endif
 
-#ifdef VK_USE_PLATFORM_XCB_KHR
-    vkCreateXcbSurfaceKHR = reinterpret_cast<PFN_vkCreateXcbSurfaceKHR>(dlsym(libvulkan, "vkCreateXcbSurfaceKHR"));
-    vkGetPhysicalDeviceXcbPresentationSupportKHR = reinterpret_cast<PFN_vkGetPhysicalDeviceXcbPresentationSupportKHR>(
-        dlsym(libvulkan, "vkGetPhysicalDeviceXcbPresentationSupportKHR"));
-#endif
+enum { LEVEL_GLOBAL, LEVEL_INSTANCE, LEVEL_DEVICE };
 
-#ifdef VK_USE_PLATFORM_WAYLAND_KHR
-    vkCreateWaylandSurfaceKHR = reinterpret_cast<PFN_vkCreateWaylandSurfaceKHR>(dlsym(libvulkan, "vkCreateWaylandSurfaceKHR"));
-    vkGetPhysicalDeviceWaylandPresentationSupportKHR = reinterpret_cast<PFN_vkGetPhysicalDeviceWaylandPresentationSupportKHR>(
-        dlsym(libvulkan, "vkGetPhysicalDeviceWaylandPresentationSupportKHR"));
-#endif
+static LIBHANDLE                 libvulkan         = 0;
+static PFN_vkGetInstanceProcAddr loader_gipa       = 0;
+static PFN_vkGetDeviceProcAddr   loader_gdpa       = 0;
+static VkInstance                dispatch_instance = VK_NULL_HANDLE;
+static VkDevice                  dispatch_device   = VK_NULL_HANDLE;
+static PFN_vkGetInstanceProcAddr driver_gipa       = 0;  // in-process driver, instead of libvulkan
 
-#ifdef VK_USE_PLATFORM_MIR_KHR
-    vkCreateMirSurfaceKHR = reinterpret_cast<PFN_vkCreateMirSurfaceKHR>(dlsym(libvulkan, "vkCreateMirSurfaceKHR"));
-    vkGetPhysicalDeviceMirPresentationSupportKHR = reinterpret_cast<PFN_vkGetPhysicalDeviceMirPresentationSupportKHR>(
-        dlsym(libvulkan, "vkGetPhysicalDeviceMirPresentationSupportKHR"));
-#endif
+static PFN_vkVoidFunction DriverProc(const char* name);
 
-#ifdef VK_USE_PLATFORM_ANDROID_KHR
-    vkCreateAndroidSurfaceKHR = reinterpret_cast<PFN_vkCreateAndroidSurfaceKHR>(dlsym(libvulkan, "vkCreateAndroidSurfaceKHR"));
-#endif
+// Library exports: from the in-process driver if set, else from libvulkan.
+static PFN_vkVoidFunction LibraryProc(const char* name) {
+    return driver_gipa ? DriverProc(name) : GetSymbol(libvulkan, name);
+}
 
-#ifdef VK_USE_PLATFORM_WIN32_KHR
-    vkCreateWin32SurfaceKHR = reinterpret_cast<PFN_vkCreateWin32SurfaceKHR>(dlsym(libvulkan, "vkCreateWin32SurfaceKHR"));
-    vkGetPhysicalDeviceWin32PresentationSupportKHR = reinterpret_cast<PFN_vkGetPhysicalDeviceWin32PresentationSupportKHR>(
-        dlsym(libvulkan, "vkGetPhysicalDeviceWin32PresentationSupportKHR"));
-#endif
-    vkCreateDebugReportCallbackEXT = reinterpret_cast<PFN_vkCreateDebugReportCallbackEXT>(dlsym(libvulkan, "vkCreateDebugReportCallbackEXT"));
-    vkDestroyDebugReportCallbackEXT = reinterpret_cast<PFN_vkDestroyDebugReportCallbackEXT>(dlsym(libvulkan, "vkDestroyDebugReportCallbackEXT"));
-    vkDebugReportMessageEXT = reinterpret_cast<PFN_vkDebugReportMessageEXT>(dlsym(libvulkan, "vkDebugReportMessageEXT"));
+int InitVulkan(void) {
+    if (libvulkan || driver_gipa) return 1;
+    LIBHANDLE lib = LoadVulkanLibrary();
+    if (!lib) return 0;
+    loader_gipa = (PFN_vkGetInstanceProcAddr)GetSymbol(lib, "vkGetInstanceProcAddr");
+    loader_gdpa = (PFN_vkGetDeviceProcAddr)  GetSymbol(lib, "vkGetDeviceProcAddr");
+    libvulkan   = lib;
     return 1;
 }
 
-// No Vulkan support, do not set function addresses
-PFN_vkCreateInstance vkCreateInstance;
-PFN_vkDestroyInstance vkDestroyInstance;
-PFN_vkEnumeratePhysicalDevices vkEnumeratePhysicalDevices;
-PFN_vkGetPhysicalDeviceFeatures vkGetPhysicalDeviceFeatures;
-PFN_vkGetPhysicalDeviceFormatProperties vkGetPhysicalDeviceFormatProperties;
-PFN_vkGetPhysicalDeviceImageFormatProperties vkGetPhysicalDeviceImageFormatProperties;
-PFN_vkGetPhysicalDeviceProperties vkGetPhysicalDeviceProperties;
-PFN_vkGetPhysicalDeviceQueueFamilyProperties vkGetPhysicalDeviceQueueFamilyProperties;
-PFN_vkGetPhysicalDeviceMemoryProperties vkGetPhysicalDeviceMemoryProperties;
-PFN_vkGetInstanceProcAddr vkGetInstanceProcAddr;
-PFN_vkGetDeviceProcAddr vkGetDeviceProcAddr;
-PFN_vkCreateDevice vkCreateDevice;
-PFN_vkDestroyDevice vkDestroyDevice;
-PFN_vkEnumerateInstanceExtensionProperties vkEnumerateInstanceExtensionProperties;
-PFN_vkEnumerateDeviceExtensionProperties vkEnumerateDeviceExtensionProperties;
-PFN_vkEnumerateInstanceLayerProperties vkEnumerateInstanceLayerProperties;
-PFN_vkEnumerateDeviceLayerProperties vkEnumerateDeviceLayerProperties;
-PFN_vkGetDeviceQueue vkGetDeviceQueue;
-PFN_vkQueueSubmit vkQueueSubmit;
-PFN_vkQueueWaitIdle vkQueueWaitIdle;
-PFN_vkDeviceWaitIdle vkDeviceWaitIdle;
-PFN_vkAllocateMemory vkAllocateMemory;
-PFN_vkFreeMemory vkFreeMemory;
-PFN_vkMapMemory vkMapMemory;
-PFN_vkUnmapMemory vkUnmapMemory;
-PFN_vkFlushMappedMemoryRanges vkFlushMappedMemoryRanges;
-PFN_vkInvalidateMappedMemoryRanges vkInvalidateMappedMemoryRanges;
-PFN_vkGetDeviceMemoryCommitment vkGetDeviceMemoryCommitment;
-PFN_vkBindBufferMemory vkBindBufferMemory;
-PFN_vkBindImageMemory vkBindImageMemory;
-PFN_vkGetBufferMemoryRequirements vkGetBufferMemoryRequirements;
-PFN_vkGetImageMemoryRequirements vkGetImageMemoryRequirements;
-PFN_vkGetImageSparseMemoryRequirements vkGetImageSparseMemoryRequirements;
-PFN_vkGetPhysicalDeviceSparseImageFormatProperties vkGetPhysicalDeviceSparseImageFormatProperties;
-PFN_vkQueueBindSparse vkQueueBindSparse;
-PFN_vkCreateFence vkCreateFence;
-PFN_vkDestroyFence vkDestroyFence;
-PFN_vkResetFences vkResetFences;
-PFN_vkGetFenceStatus vkGetFenceStatus;
-PFN_vkWaitForFences vkWaitForFences;
-PFN_vkCreateSemaphore vkCreateSemaphore;
-PFN_vkDestroySemaphore vkDestroySemaphore;
-PFN_vkCreateEvent vkCreateEvent;
-PFN_vkDestroyEvent vkDestroyEvent;
-PFN_vkGetEventStatus vkGetEventStatus;
-PFN_vkSetEvent vkSetEvent;
-PFN_vkResetEvent vkResetEvent;
-PFN_vkCreateQueryPool vkCreateQueryPool;
-PFN_vkDestroyQueryPool vkDestroyQueryPool;
-PFN_vkGetQueryPoolResults vkGetQueryPoolResults;
-PFN_vkCreateBuffer vkCreateBuffer;
-PFN_vkDestroyBuffer vkDestroyBuffer;
-PFN_vkCreateBufferView vkCreateBufferView;
-PFN_vkDestroyBufferView vkDestroyBufferView;
-PFN_vkCreateImage vkCreateImage;
-PFN_vkDestroyImage vkDestroyImage;
-PFN_vkGetImageSubresourceLayout vkGetImageSubresourceLayout;
-PFN_vkCreateImageView vkCreateImageView;
-PFN_vkDestroyImageView vkDestroyImageView;
-PFN_vkCreateShaderModule vkCreateShaderModule;
-PFN_vkDestroyShaderModule vkDestroyShaderModule;
-PFN_vkCreatePipelineCache vkCreatePipelineCache;
-PFN_vkDestroyPipelineCache vkDestroyPipelineCache;
-PFN_vkGetPipelineCacheData vkGetPipelineCacheData;
-PFN_vkMergePipelineCaches vkMergePipelineCaches;
-PFN_vkCreateGraphicsPipelines vkCreateGraphicsPipelines;
-PFN_vkCreateComputePipelines vkCreateComputePipelines;
-PFN_vkDestroyPipeline vkDestroyPipeline;
-PFN_vkCreatePipelineLayout vkCreatePipelineLayout;
-PFN_vkDestroyPipelineLayout vkDestroyPipelineLayout;
-PFN_vkCreateSampler vkCreateSampler;
-PFN_vkDestroySampler vkDestroySampler;
-PFN_vkCreateDescriptorSetLayout vkCreateDescriptorSetLayout;
-PFN_vkDestroyDescriptorSetLayout vkDestroyDescriptorSetLayout;
-PFN_vkCreateDescriptorPool vkCreateDescriptorPool;
-PFN_vkDestroyDescriptorPool vkDestroyDescriptorPool;
-PFN_vkResetDescriptorPool vkResetDescriptorPool;
-PFN_vkAllocateDescriptorSets vkAllocateDescriptorSets;
-PFN_vkFreeDescriptorSets vkFreeDescriptorSets;
-PFN_vkUpdateDescriptorSets vkUpdateDescriptorSets;
-PFN_vkCreateFramebuffer vkCreateFramebuffer;
-PFN_vkDestroyFramebuffer vkDestroyFramebuffer;
-PFN_vkCreateRenderPass vkCreateRenderPass;
-PFN_vkDestroyRenderPass vkDestroyRenderPass;
-PFN_vkGetRenderAreaGranularity vkGetRenderAreaGranularity;
-PFN_vkCreateCommandPool vkCreateCommandPool;
-PFN_vkDestroyCommandPool vkDestroyCommandPool;
-PFN_vkResetCommandPool vkResetCommandPool;
-PFN_vkAllocateCommandBuffers vkAllocateCommandBuffers;
-PFN_vkFreeCommandBuffers vkFreeCommandBuffers;
-PFN_vkBeginCommandBuffer vkBeginCommandBuffer;
-PFN_vkEndCommandBuffer vkEndCommandBuffer;
-PFN_vkResetCommandBuffer vkResetCommandBuffer;
-PFN_vkCmdBindPipeline vkCmdBindPipeline;
-PFN_vkCmdSetViewport vkCmdSetViewport;
-PFN_vkCmdSetScissor vkCmdSetScissor;
-PFN_vkCmdSetLineWidth vkCmdSetLineWidth;
-PFN_vkCmdSetDepthBias vkCmdSetDepthBias;
-PFN_vkCmdSetBlendConstants vkCmdSetBlendConstants;
-PFN_vkCmdSetDepthBounds vkCmdSetDepthBounds;
-PFN_vkCmdSetStencilCompareMask vkCmdSetStencilCompareMask;
-PFN_vkCmdSetStencilWriteMask vkCmdSetStencilWriteMask;
-PFN_vkCmdSetStencilReference vkCmdSetStencilReference;
-PFN_vkCmdBindDescriptorSets vkCmdBindDescriptorSets;
-PFN_vkCmdBindIndexBuffer vkCmdBindIndexBuffer;
-PFN_vkCmdBindVertexBuffers vkCmdBindVertexBuffers;
-PFN_vkCmdDraw vkCmdDraw;
-PFN_vkCmdDrawIndexed vkCmdDrawIndexed;
-PFN_vkCmdDrawIndirect vkCmdDrawIndirect;
-PFN_vkCmdDrawIndexedIndirect vkCmdDrawIndexedIndirect;
-PFN_vkCmdDispatch vkCmdDispatch;
-PFN_vkCmdDispatchIndirect vkCmdDispatchIndirect;
-PFN_vkCmdCopyBuffer vkCmdCopyBuffer;
-PFN_vkCmdCopyImage vkCmdCopyImage;
-PFN_vkCmdBlitImage vkCmdBlitImage;
-PFN_vkCmdCopyBufferToImage vkCmdCopyBufferToImage;
-PFN_vkCmdCopyImageToBuffer vkCmdCopyImageToBuffer;
-PFN_vkCmdUpdateBuffer vkCmdUpdateBuffer;
-PFN_vkCmdFillBuffer vkCmdFillBuffer;
-PFN_vkCmdClearColorImage vkCmdClearColorImage;
-PFN_vkCmdClearDepthStencilImage vkCmdClearDepthStencilImage;
-PFN_vkCmdClearAttachments vkCmdClearAttachments;
-PFN_vkCmdResolveImage vkCmdResolveImage;
-PFN_vkCmdSetEvent vkCmdSetEvent;
-PFN_vkCmdResetEvent vkCmdResetEvent;
-PFN_vkCmdWaitEvents vkCmdWaitEvents;
-PFN_vkCmdPipelineBarrier vkCmdPipelineBarrier;
-PFN_vkCmdBeginQuery vkCmdBeginQuery;
-PFN_vkCmdEndQuery vkCmdEndQuery;
-PFN_vkCmdResetQueryPool vkCmdResetQueryPool;
-PFN_vkCmdWriteTimestamp vkCmdWriteTimestamp;
-PFN_vkCmdCopyQueryPoolResults vkCmdCopyQueryPoolResults;
-PFN_vkCmdPushConstants vkCmdPushConstants;
-PFN_vkCmdBeginRenderPass vkCmdBeginRenderPass;
-PFN_vkCmdNextSubpass vkCmdNextSubpass;
-PFN_vkCmdEndRenderPass vkCmdEndRenderPass;
-PFN_vkCmdExecuteCommands vkCmdExecuteCommands;
-PFN_vkDestroySurfaceKHR vkDestroySurfaceKHR;
-PFN_vkGetPhysicalDeviceSurfaceSupportKHR vkGetPhysicalDeviceSurfaceSupportKHR;
-PFN_vkGetPhysicalDeviceSurfaceCapabilitiesKHR vkGetPhysicalDeviceSurfaceCapabilitiesKHR;
-PFN_vkGetPhysicalDeviceSurfaceFormatsKHR vkGetPhysicalDeviceSurfaceFormatsKHR;
-PFN_vkGetPhysicalDeviceSurfacePresentModesKHR vkGetPhysicalDeviceSurfacePresentModesKHR;
-PFN_vkCreateSwapchainKHR vkCreateSwapchainKHR;
-PFN_vkDestroySwapchainKHR vkDestroySwapchainKHR;
-PFN_vkGetSwapchainImagesKHR vkGetSwapchainImagesKHR;
-PFN_vkAcquireNextImageKHR vkAcquireNextImageKHR;
-PFN_vkQueuePresentKHR vkQueuePresentKHR;
-PFN_vkGetPhysicalDeviceDisplayPropertiesKHR vkGetPhysicalDeviceDisplayPropertiesKHR;
-PFN_vkGetPhysicalDeviceDisplayPlanePropertiesKHR vkGetPhysicalDeviceDisplayPlanePropertiesKHR;
-PFN_vkGetDisplayPlaneSupportedDisplaysKHR vkGetDisplayPlaneSupportedDisplaysKHR;
-PFN_vkGetDisplayModePropertiesKHR vkGetDisplayModePropertiesKHR;
-PFN_vkCreateDisplayModeKHR vkCreateDisplayModeKHR;
-PFN_vkGetDisplayPlaneCapabilitiesKHR vkGetDisplayPlaneCapabilitiesKHR;
-PFN_vkCreateDisplayPlaneSurfaceKHR vkCreateDisplayPlaneSurfaceKHR;
-PFN_vkCreateSharedSwapchainsKHR vkCreateSharedSwapchainsKHR;
+//-------------------------------Tracing--------------------------------
+#define TRACE_COUNT  258     // number of functions
+#define TRACE_EVENTS (1 << 16)   // number of recent calls kept for TraceVulkanDump
+#define TRACE_TABLES 16          // number of dispatch tables that can be traced at once
 
-#ifdef VK_USE_PLATFORM_XLIB_KHR
-PFN_vkCreateXlibSurfaceKHR vkCreateXlibSurfaceKHR;
-PFN_vkGetPhysicalDeviceXlibPresentationSupportKHR vkGetPhysicalDeviceXlibPresentationSupportKHR;
+struct CTraceStat  { uint32_t calls; uint64_t time; };                     // time in nanoseconds
+struct CTraceEvent { uint32_t id; uint32_t frame; uint64_t start; uint64_t time; };
+struct CTraceTable { void* table; PFN_TraceVulkanTable swap; };
+
+// Per-thread counters: Only the owning thread writes to them, and they only ever grow, so
+// TraceVulkanNextFrame() can read them while the thread runs, and subtract the last frame's totals.
+// Blocks are never freed. When a thread exits, its block is handed on to the next new thread.
+struct CTraceThread {
+    std::atomic<uint64_t> calls[TRACE_COUNT];
+    std::atomic<uint64_t> time[TRACE_COUNT];
+    std::atomic<int>      in_use;
+    CTraceThread*         next;
+};
+
+struct CTraceThreadRef {  // releases the thread's block, when the thread exits
+    CTraceThread* block;
+    ~CTraceThreadRef() { if (block) block->in_use.store(0, std::memory_order_release); }
+};
+
+static int                        trace_enabled = 0;
+static PFN_vkVoidFunction         traced_procs[TRACE_COUNT];  // real functions, while the pointers point at thunks
+static PFN_vkVoidFunction         table_procs[TRACE_COUNT];   // real functions of the traced dispatch tables
+static CTraceTable                trace_tables[TRACE_TABLES];
+static std::atomic<CTraceThread*> trace_threads(nullptr);     // all per-thread blocks (push only)
+static thread_local CTraceThreadRef trace_thread = {};
+static uint64_t                   trace_total_calls[TRACE_COUNT];  // sum of all threads, at the end of the last frame
+static uint64_t                   trace_total_time[TRACE_COUNT];
+static CTraceStat                 trace_last[TRACE_COUNT];    // last completed frame
+static std::atomic<uint32_t>      trace_frame_index(0);
+static CTraceEvent*               trace_events = 0;           // ring buffer
+static std::atomic<uint64_t>      trace_event_count(0);
+
+static const char* trace_names[TRACE_COUNT] = {
+    "vkCreateInstance",
+    "vkDestroyInstance",
+    "vkEnumeratePhysicalDevices",
+    "vkGetPhysicalDeviceFeatures",
+    "vkGetPhysicalDeviceFormatProperties",
+    "vkGetPhysicalDeviceImageFormatProperties",
+    "vkGetPhysicalDeviceProperties",
+    "vkGetPhysicalDeviceQueueFamilyProperties",
+    "vkGetPhysicalDeviceMemoryProperties",
+    "vkGetInstanceProcAddr",
+    "vkGetDeviceProcAddr",
+    "vkCreateDevice",
+    "vkDestroyDevice",
+    "vkEnumerateInstanceExtensionProperties",
+    "vkEnumerateDeviceExtensionProperties",
+    "vkEnumerateInstanceLayerProperties",
+    "vkEnumerateDeviceLayerProperties",
+    "vkGetDeviceQueue",
+    "vkQueueSubmit",
+    "vkQueueWaitIdle",
+    "vkDeviceWaitIdle",
+    "vkAllocateMemory",
+    "vkFreeMemory",
+    "vkMapMemory",
+    "vkUnmapMemory",
+    "vkFlushMappedMemoryRanges",
+    "vkInvalidateMappedMemoryRanges",
+    "vkGetDeviceMemoryCommitment",
+    "vkBindBufferMemory",
+    "vkBindImageMemory",
+    "vkGetBufferMemoryRequirements",
+    "vkGetImageMemoryRequirements",
+    "vkGetImageSparseMemoryRequirements",
+    "vkGetPhysicalDeviceSparseImageFormatProperties",
+    "vkQueueBindSparse",
+    "vkCreateFence",
+    "vkDestroyFence",
+    "vkResetFences",
+    "vkGetFenceStatus",
+    "vkWaitForFences",
+    "vkCreateSemaphore",
+    "vkDestroySemaphore",
+    "vkCreateEvent",
+    "vkDestroyEvent",
+    "vkGetEventStatus",
+    "vkSetEvent",
+    "vkResetEvent",
+    "vkCreateQueryPool",
+    "vkDestroyQueryPool",
+    "vkGetQueryPoolResults",
+    "vkCreateBuffer",
+    "vkDestroyBuffer",
+    "vkCreateBufferView",
+    "vkDestroyBufferView",
+    "vkCreateImage",
+    "vkDestroyImage",
+    "vkGetImageSubresourceLayout",
+    "vkCreateImageView",
+    "vkDestroyImageView",
+    "vkCreateShaderModule",
+    "vkDestroyShaderModule",
+    "vkCreatePipelineCache",
+    "vkDestroyPipelineCache",
+    "vkGetPipelineCacheData",
+    "vkMergePipelineCaches",
+    "vkCreateGraphicsPipelines",
+    "vkCreateComputePipelines",
+    "vkDestroyPipeline",
+    "vkCreatePipelineLayout",
+    "vkDestroyPipelineLayout",
+    "vkCreateSampler",
+    "vkDestroySampler",
+    "vkCreateDescriptorSetLayout",
+    "vkDestroyDescriptorSetLayout",
+    "vkCreateDescriptorPool",
+    "vkDestroyDescriptorPool",
+    "vkResetDescriptorPool",
+    "vkAllocateDescriptorSets",
+    "vkFreeDescriptorSets",
+    "vkUpdateDescriptorSets",
+    "vkCreateFramebuffer",
+    "vkDestroyFramebuffer",
+    "vkCreateRenderPass",
+    "vkDestroyRenderPass",
+    "vkGetRenderAreaGranularity",
+    "vkCreateCommandPool",
+    "vkDestroyCommandPool",
+    "vkResetCommandPool",
+    "vkAllocateCommandBuffers",
+    "vkFreeCommandBuffers",
+    "vkBeginCommandBuffer",
+    "vkEndCommandBuffer",
+    "vkResetCommandBuffer",
+    "vkCmdBindPipeline",
+    "vkCmdSetViewport",
+    "vkCmdSetScissor",
+    "vkCmdSetLineWidth",
+    "vkCmdSetDepthBias",
+    "vkCmdSetBlendConstants",
+    "vkCmdSetDepthBounds",
+    "vkCmdSetStencilCompareMask",
+    "vkCmdSetStencilWriteMask",
+    "vkCmdSetStencilReference",
+    "vkCmdBindDescriptorSets",
+    "vkCmdBindIndexBuffer",
+    "vkCmdBindVertexBuffers",
+    "vkCmdDraw",
+    "vkCmdDrawIndexed",
+    "vkCmdDrawIndirect",
+    "vkCmdDrawIndexedIndirect",
+    "vkCmdDispatch",
+    "vkCmdDispatchIndirect",
+    "vkCmdCopyBuffer",
+    "vkCmdCopyImage",
+    "vkCmdBlitImage",
+    "vkCmdCopyBufferToImage",
+    "vkCmdCopyImageToBuffer",
+    "vkCmdUpdateBuffer",
+    "vkCmdFillBuffer",
+    "vkCmdClearColorImage",
+    "vkCmdClearDepthStencilImage",
+    "vkCmdClearAttachments",
+    "vkCmdResolveImage",
+    "vkCmdSetEvent",
+    "vkCmdResetEvent",
+    "vkCmdWaitEvents",
+    "vkCmdPipelineBarrier",
+    "vkCmdBeginQuery",
+    "vkCmdEndQuery",
+    "vkCmdResetQueryPool",
+    "vkCmdWriteTimestamp",
+    "vkCmdCopyQueryPoolResults",
+    "vkCmdPushConstants",
+    "vkCmdBeginRenderPass",
+    "vkCmdNextSubpass",
+    "vkCmdEndRenderPass",
+    "vkCmdExecuteCommands",
+    "vkDestroySurfaceKHR",
+    "vkGetPhysicalDeviceSurfaceSupportKHR",
+    "vkGetPhysicalDeviceSurfaceCapabilitiesKHR",
+    "vkGetPhysicalDeviceSurfaceFormatsKHR",
+    "vkGetPhysicalDeviceSurfacePresentModesKHR",
+    "vkCreateSwapchainKHR",
+    "vkDestroySwapchainKHR",
+    "vkGetSwapchainImagesKHR",
+    "vkAcquireNextImageKHR",
+    "vkQueuePresentKHR",
+    "vkGetPhysicalDeviceDisplayPropertiesKHR",
+    "vkGetPhysicalDeviceDisplayPlanePropertiesKHR",
+    "vkGetDisplayPlaneSupportedDisplaysKHR",
+    "vkGetDisplayModePropertiesKHR",
+    "vkCreateDisplayModeKHR",
+    "vkGetDisplayPlaneCapabilitiesKHR",
+    "vkCreateDisplayPlaneSurfaceKHR",
+    "vkCreateSharedSwapchainsKHR",
+    "vkCreateXlibSurfaceKHR",
+    "vkGetPhysicalDeviceXlibPresentationSupportKHR",
+    "vkCreateXcbSurfaceKHR",
+    "vkGetPhysicalDeviceXcbPresentationSupportKHR",
+    "vkCreateWaylandSurfaceKHR",
+    "vkGetPhysicalDeviceWaylandPresentationSupportKHR",
+    "vkCreateMirSurfaceKHR",
+    "vkGetPhysicalDeviceMirPresentationSupportKHR",
+    "vkCreateAndroidSurfaceKHR",
+    "vkCreateWin32SurfaceKHR",
+    "vkGetPhysicalDeviceWin32PresentationSupportKHR",
+    "vkGetPhysicalDeviceFeatures2KHR",
+    "vkGetPhysicalDeviceProperties2KHR",
+    "vkGetPhysicalDeviceFormatProperties2KHR",
+    "vkGetPhysicalDeviceImageFormatProperties2KHR",
+    "vkGetPhysicalDeviceQueueFamilyProperties2KHR",
+    "vkGetPhysicalDeviceMemoryProperties2KHR",
+    "vkGetPhysicalDeviceSparseImageFormatProperties2KHR",
+    "vkTrimCommandPoolKHR",
+    "vkGetPhysicalDeviceExternalBufferPropertiesKHR",
+    "vkGetMemoryWin32HandleKHR",
+    "vkGetMemoryWin32HandlePropertiesKHR",
+    "vkGetMemoryFdKHR",
+    "vkGetMemoryFdPropertiesKHR",
+    "vkGetPhysicalDeviceExternalSemaphorePropertiesKHR",
+    "vkImportSemaphoreWin32HandleKHR",
+    "vkGetSemaphoreWin32HandleKHR",
+    "vkImportSemaphoreFdKHR",
+    "vkGetSemaphoreFdKHR",
+    "vkCmdPushDescriptorSetKHR",
+    "vkCreateDescriptorUpdateTemplateKHR",
+    "vkDestroyDescriptorUpdateTemplateKHR",
+    "vkUpdateDescriptorSetWithTemplateKHR",
+    "vkCmdPushDescriptorSetWithTemplateKHR",
+    "vkGetSwapchainStatusKHR",
+    "vkGetPhysicalDeviceExternalFencePropertiesKHR",
+    "vkImportFenceWin32HandleKHR",
+    "vkGetFenceWin32HandleKHR",
+    "vkImportFenceFdKHR",
+    "vkGetFenceFdKHR",
+    "vkGetPhysicalDeviceSurfaceCapabilities2KHR",
+    "vkGetPhysicalDeviceSurfaceFormats2KHR",
+    "vkGetImageMemoryRequirements2KHR",
+    "vkGetBufferMemoryRequirements2KHR",
+    "vkGetImageSparseMemoryRequirements2KHR",
+    "vkCreateSamplerYcbcrConversionKHR",
+    "vkDestroySamplerYcbcrConversionKHR",
+    "vkBindBufferMemory2KHR",
+    "vkBindImageMemory2KHR",
+    "vkCreateDebugReportCallbackEXT",
+    "vkDestroyDebugReportCallbackEXT",
+    "vkDebugReportMessageEXT",
+    "vkDebugMarkerSetObjectTagEXT",
+    "vkDebugMarkerSetObjectNameEXT",
+    "vkCmdDebugMarkerBeginEXT",
+    "vkCmdDebugMarkerEndEXT",
+    "vkCmdDebugMarkerInsertEXT",
+    "vkCmdDrawIndirectCountAMD",
+    "vkCmdDrawIndexedIndirectCountAMD",
+    "vkGetShaderInfoAMD",
+    "vkGetPhysicalDeviceExternalImageFormatPropertiesNV",
+    "vkGetMemoryWin32HandleNV",
+    "vkGetDeviceGroupPeerMemoryFeaturesKHX",
+    "vkCmdSetDeviceMaskKHX",
+    "vkCmdDispatchBaseKHX",
+    "vkGetDeviceGroupPresentCapabilitiesKHX",
+    "vkGetDeviceGroupSurfacePresentModesKHX",
+    "vkGetPhysicalDevicePresentRectanglesKHX",
+    "vkAcquireNextImage2KHX",
+    "vkCreateViSurfaceNN",
+    "vkEnumeratePhysicalDeviceGroupsKHX",
+    "vkCmdProcessCommandsNVX",
+    "vkCmdReserveSpaceForCommandsNVX",
+    "vkCreateIndirectCommandsLayoutNVX",
+    "vkDestroyIndirectCommandsLayoutNVX",
+    "vkCreateObjectTableNVX",
+    "vkDestroyObjectTableNVX",
+    "vkRegisterObjectsNVX",
+    "vkUnregisterObjectsNVX",
+    "vkGetPhysicalDeviceGeneratedCommandsPropertiesNVX",
+    "vkCmdSetViewportWScalingNV",
+    "vkReleaseDisplayEXT",
+    "vkAcquireXlibDisplayEXT",
+    "vkGetRandROutputDisplayEXT",
+    "vkGetPhysicalDeviceSurfaceCapabilities2EXT",
+    "vkDisplayPowerControlEXT",
+    "vkRegisterDeviceEventEXT",
+    "vkRegisterDisplayEventEXT",
+    "vkGetSwapchainCounterEXT",
+    "vkGetRefreshCycleDurationGOOGLE",
+    "vkGetPastPresentationTimingGOOGLE",
+    "vkCmdSetDiscardRectangleEXT",
+    "vkSetHdrMetadataEXT",
+    "vkCreateIOSSurfaceMVK",
+    "vkCreateMacOSSurfaceMVK",
+    "vkCmdSetSampleLocationsEXT",
+    "vkGetPhysicalDeviceMultisamplePropertiesEXT",
+    "vkCreateValidationCacheEXT",
+    "vkDestroyValidationCacheEXT",
+    "vkMergeValidationCachesEXT",
+    "vkGetValidationCacheDataEXT",
+    "vkGetMemoryHostPointerPropertiesEXT",
+    "vkCmdWriteBufferMarkerAMD",
+};
+
+static uint64_t TraceTime(void) {
+#ifdef _WIN32
+    static LARGE_INTEGER freq = {};
+    if (!freq.QuadPart) QueryPerformanceFrequency(&freq);
+    LARGE_INTEGER t;
+    QueryPerformanceCounter(&t);
+    return (uint64_t)(t.QuadPart / freq.QuadPart) * 1000000000ull + (uint64_t)(t.QuadPart % freq.QuadPart) * 1000000000ull / freq.QuadPart;
+#else
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint64_t)t.tv_sec * 1000000000ull + (uint64_t)t.tv_nsec;
 #endif
+}
+
+static CTraceThread* TraceThread(void) {
+    CTraceThread* block = trace_thread.block;
+    if (block) return block;
+    for (block = trace_threads.load(std::memory_order_acquire); block; block = block->next) {  // reuse a free block
+        int in_use = 0;
+        if (block->in_use.compare_exchange_strong(in_use, 1, std::memory_order_acquire)) break;
+    }
+    if (!block) {
+        block = new CTraceThread();  // (zeroed)
+        block->in_use.store(1, std::memory_order_relaxed);
+        block->next = trace_threads.load(std::memory_order_relaxed);
+        while (!trace_threads.compare_exchange_weak(block->next, block, std::memory_order_release)) {}
+    }
+    trace_thread.block = block;
+    return block;
+}
+
+static void TraceCall(uint32_t id, uint64_t start) {
+    uint64_t time = TraceTime() - start;
+    CTraceThread* thread = TraceThread();  // Only this thread writes to its counters, so no atomic add is needed.
+    thread->calls[id].store(thread->calls[id].load(std::memory_order_relaxed) + 1,    std::memory_order_relaxed);
+    thread->time[id] .store(thread->time[id] .load(std::memory_order_relaxed) + time, std::memory_order_relaxed);
+    uint64_t index = trace_event_count.fetch_add(1, std::memory_order_relaxed);
+    CTraceEvent& event = trace_events[index % TRACE_EVENTS];
+    event.id    = id;
+    event.frame = trace_frame_index.load(std::memory_order_relaxed);
+    event.start = start;
+    event.time  = time;
+}
+
+// Find a function: from the current device or instance if set, else from the loader exports.
+// While tracing, the thunk stays in the slot, and the real function goes into traced_procs instead.
+static PFN_vkVoidFunction LoadProc(PFN_vkVoidFunction* slot, uint32_t id, const char* name, int level) {
+    if (!InitVulkan()) return 0;
+    PFN_vkVoidFunction fn = 0;
+    if (level == LEVEL_DEVICE && dispatch_device && loader_gdpa) fn = loader_gdpa(dispatch_device, name);
+    if (!fn && level != LEVEL_GLOBAL && dispatch_instance && loader_gipa) fn = loader_gipa(dispatch_instance, name);
+    if (!fn) fn = LibraryProc(name);                                  // loader export (trampoline)
+    if (!fn && level == LEVEL_GLOBAL && loader_gipa) fn = loader_gipa(VK_NULL_HANDLE, name);
+    if (fn) {                                                        // else keep the stub, to retry later
+        if (trace_enabled) traced_procs[id] = fn;
+        else               *slot            = fn;
+    }
+    return fn;
+}
 
+//-----------------------------Lazy stubs-------------------------------
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkCreateInstance(const VkInstanceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkInstance* pInstance) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCreateInstance, 0, "vkCreateInstance", LEVEL_GLOBAL);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkCreateInstance)fn)(pCreateInfo, pAllocator, pInstance);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkDestroyInstance(VkInstance instance, const VkAllocationCallbacks* pAllocator) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkDestroyInstance, 1, "vkDestroyInstance", LEVEL_INSTANCE);
+    if (!fn) return;
+    ((PFN_vkDestroyInstance)fn)(instance, pAllocator);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkEnumeratePhysicalDevices(VkInstance instance, uint32_t* pPhysicalDeviceCount, VkPhysicalDevice* pPhysicalDevices) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkEnumeratePhysicalDevices, 2, "vkEnumeratePhysicalDevices", LEVEL_INSTANCE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkEnumeratePhysicalDevices)fn)(instance, pPhysicalDeviceCount, pPhysicalDevices);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkGetPhysicalDeviceFeatures(VkPhysicalDevice physicalDevice, VkPhysicalDeviceFeatures* pFeatures) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetPhysicalDeviceFeatures, 3, "vkGetPhysicalDeviceFeatures", LEVEL_INSTANCE);
+    if (!fn) return;
+    ((PFN_vkGetPhysicalDeviceFeatures)fn)(physicalDevice, pFeatures);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkGetPhysicalDeviceFormatProperties(VkPhysicalDevice physicalDevice, VkFormat format, VkFormatProperties* pFormatProperties) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetPhysicalDeviceFormatProperties, 4, "vkGetPhysicalDeviceFormatProperties", LEVEL_INSTANCE);
+    if (!fn) return;
+    ((PFN_vkGetPhysicalDeviceFormatProperties)fn)(physicalDevice, format, pFormatProperties);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkGetPhysicalDeviceImageFormatProperties(VkPhysicalDevice physicalDevice, VkFormat format, VkImageType type, VkImageTiling tiling, VkImageUsageFlags usage, VkImageCreateFlags flags, VkImageFormatProperties* pImageFormatProperties) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetPhysicalDeviceImageFormatProperties, 5, "vkGetPhysicalDeviceImageFormatProperties", LEVEL_INSTANCE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkGetPhysicalDeviceImageFormatProperties)fn)(physicalDevice, format, type, tiling, usage, flags, pImageFormatProperties);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkGetPhysicalDeviceProperties(VkPhysicalDevice physicalDevice, VkPhysicalDeviceProperties* pProperties) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetPhysicalDeviceProperties, 6, "vkGetPhysicalDeviceProperties", LEVEL_INSTANCE);
+    if (!fn) return;
+    ((PFN_vkGetPhysicalDeviceProperties)fn)(physicalDevice, pProperties);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkGetPhysicalDeviceQueueFamilyProperties(VkPhysicalDevice physicalDevice, uint32_t* pQueueFamilyPropertyCount, VkQueueFamilyProperties* pQueueFamilyProperties) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetPhysicalDeviceQueueFamilyProperties, 7, "vkGetPhysicalDeviceQueueFamilyProperties", LEVEL_INSTANCE);
+    if (!fn) return;
+    ((PFN_vkGetPhysicalDeviceQueueFamilyProperties)fn)(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkGetPhysicalDeviceMemoryProperties(VkPhysicalDevice physicalDevice, VkPhysicalDeviceMemoryProperties* pMemoryProperties) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetPhysicalDeviceMemoryProperties, 8, "vkGetPhysicalDeviceMemoryProperties", LEVEL_INSTANCE);
+    if (!fn) return;
+    ((PFN_vkGetPhysicalDeviceMemoryProperties)fn)(physicalDevice, pMemoryProperties);
+}
+static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL Load_vkGetInstanceProcAddr(VkInstance instance, const char* pName) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetInstanceProcAddr, 9, "vkGetInstanceProcAddr", LEVEL_GLOBAL);
+    if (!fn) return 0;
+    return ((PFN_vkGetInstanceProcAddr)fn)(instance, pName);
+}
+static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL Load_vkGetDeviceProcAddr(VkDevice device, const char* pName) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetDeviceProcAddr, 10, "vkGetDeviceProcAddr", LEVEL_GLOBAL);
+    if (!fn) return 0;
+    return ((PFN_vkGetDeviceProcAddr)fn)(device, pName);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkCreateDevice(VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDevice* pDevice) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCreateDevice, 11, "vkCreateDevice", LEVEL_INSTANCE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkCreateDevice)fn)(physicalDevice, pCreateInfo, pAllocator, pDevice);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkDestroyDevice(VkDevice device, const VkAllocationCallbacks* pAllocator) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkDestroyDevice, 12, "vkDestroyDevice", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkDestroyDevice)fn)(device, pAllocator);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkEnumerateInstanceExtensionProperties(const char* pLayerName, uint32_t* pPropertyCount, VkExtensionProperties* pProperties) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkEnumerateInstanceExtensionProperties, 13, "vkEnumerateInstanceExtensionProperties", LEVEL_GLOBAL);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkEnumerateInstanceExtensionProperties)fn)(pLayerName, pPropertyCount, pProperties);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkEnumerateDeviceExtensionProperties(VkPhysicalDevice physicalDevice, const char* pLayerName, uint32_t* pPropertyCount, VkExtensionProperties* pProperties) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkEnumerateDeviceExtensionProperties, 14, "vkEnumerateDeviceExtensionProperties", LEVEL_INSTANCE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkEnumerateDeviceExtensionProperties)fn)(physicalDevice, pLayerName, pPropertyCount, pProperties);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkEnumerateInstanceLayerProperties(uint32_t* pPropertyCount, VkLayerProperties* pProperties) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkEnumerateInstanceLayerProperties, 15, "vkEnumerateInstanceLayerProperties", LEVEL_GLOBAL);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkEnumerateInstanceLayerProperties)fn)(pPropertyCount, pProperties);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkEnumerateDeviceLayerProperties(VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkLayerProperties* pProperties) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkEnumerateDeviceLayerProperties, 16, "vkEnumerateDeviceLayerProperties", LEVEL_INSTANCE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkEnumerateDeviceLayerProperties)fn)(physicalDevice, pPropertyCount, pProperties);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkGetDeviceQueue(VkDevice device, uint32_t queueFamilyIndex, uint32_t queueIndex, VkQueue* pQueue) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetDeviceQueue, 17, "vkGetDeviceQueue", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkGetDeviceQueue)fn)(device, queueFamilyIndex, queueIndex, pQueue);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkQueueSubmit, 18, "vkQueueSubmit", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkQueueSubmit)fn)(queue, submitCount, pSubmits, fence);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkQueueWaitIdle(VkQueue queue) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkQueueWaitIdle, 19, "vkQueueWaitIdle", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkQueueWaitIdle)fn)(queue);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkDeviceWaitIdle(VkDevice device) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkDeviceWaitIdle, 20, "vkDeviceWaitIdle", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkDeviceWaitIdle)fn)(device);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkAllocateMemory(VkDevice device, const VkMemoryAllocateInfo* pAllocateInfo, const VkAllocationCallbacks* pAllocator, VkDeviceMemory* pMemory) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkAllocateMemory, 21, "vkAllocateMemory", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkAllocateMemory)fn)(device, pAllocateInfo, pAllocator, pMemory);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkFreeMemory(VkDevice device, VkDeviceMemory memory, const VkAllocationCallbacks* pAllocator) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkFreeMemory, 22, "vkFreeMemory", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkFreeMemory)fn)(device, memory, pAllocator);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkMapMemory(VkDevice device, VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize size, VkMemoryMapFlags flags, void** ppData) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkMapMemory, 23, "vkMapMemory", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkMapMemory)fn)(device, memory, offset, size, flags, ppData);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkUnmapMemory(VkDevice device, VkDeviceMemory memory) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkUnmapMemory, 24, "vkUnmapMemory", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkUnmapMemory)fn)(device, memory);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkFlushMappedMemoryRanges(VkDevice device, uint32_t memoryRangeCount, const VkMappedMemoryRange* pMemoryRanges) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkFlushMappedMemoryRanges, 25, "vkFlushMappedMemoryRanges", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkFlushMappedMemoryRanges)fn)(device, memoryRangeCount, pMemoryRanges);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkInvalidateMappedMemoryRanges(VkDevice device, uint32_t memoryRangeCount, const VkMappedMemoryRange* pMemoryRanges) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkInvalidateMappedMemoryRanges, 26, "vkInvalidateMappedMemoryRanges", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkInvalidateMappedMemoryRanges)fn)(device, memoryRangeCount, pMemoryRanges);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkGetDeviceMemoryCommitment(VkDevice device, VkDeviceMemory memory, VkDeviceSize* pCommittedMemoryInBytes) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetDeviceMemoryCommitment, 27, "vkGetDeviceMemoryCommitment", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkGetDeviceMemoryCommitment)fn)(device, memory, pCommittedMemoryInBytes);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkBindBufferMemory(VkDevice device, VkBuffer buffer, VkDeviceMemory memory, VkDeviceSize memoryOffset) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkBindBufferMemory, 28, "vkBindBufferMemory", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkBindBufferMemory)fn)(device, buffer, memory, memoryOffset);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkBindImageMemory(VkDevice device, VkImage image, VkDeviceMemory memory, VkDeviceSize memoryOffset) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkBindImageMemory, 29, "vkBindImageMemory", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkBindImageMemory)fn)(device, image, memory, memoryOffset);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkGetBufferMemoryRequirements(VkDevice device, VkBuffer buffer, VkMemoryRequirements* pMemoryRequirements) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetBufferMemoryRequirements, 30, "vkGetBufferMemoryRequirements", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkGetBufferMemoryRequirements)fn)(device, buffer, pMemoryRequirements);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkGetImageMemoryRequirements(VkDevice device, VkImage image, VkMemoryRequirements* pMemoryRequirements) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetImageMemoryRequirements, 31, "vkGetImageMemoryRequirements", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkGetImageMemoryRequirements)fn)(device, image, pMemoryRequirements);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkGetImageSparseMemoryRequirements(VkDevice device, VkImage image, uint32_t* pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements* pSparseMemoryRequirements) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetImageSparseMemoryRequirements, 32, "vkGetImageSparseMemoryRequirements", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkGetImageSparseMemoryRequirements)fn)(device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkGetPhysicalDeviceSparseImageFormatProperties(VkPhysicalDevice physicalDevice, VkFormat format, VkImageType type, VkSampleCountFlagBits samples, VkImageUsageFlags usage, VkImageTiling tiling, uint32_t* pPropertyCount, VkSparseImageFormatProperties* pProperties) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetPhysicalDeviceSparseImageFormatProperties, 33, "vkGetPhysicalDeviceSparseImageFormatProperties", LEVEL_INSTANCE);
+    if (!fn) return;
+    ((PFN_vkGetPhysicalDeviceSparseImageFormatProperties)fn)(physicalDevice, format, type, samples, usage, tiling, pPropertyCount, pProperties);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkQueueBindSparse(VkQueue queue, uint32_t bindInfoCount, const VkBindSparseInfo* pBindInfo, VkFence fence) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkQueueBindSparse, 34, "vkQueueBindSparse", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkQueueBindSparse)fn)(queue, bindInfoCount, pBindInfo, fence);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkCreateFence(VkDevice device, const VkFenceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkFence* pFence) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCreateFence, 35, "vkCreateFence", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkCreateFence)fn)(device, pCreateInfo, pAllocator, pFence);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkDestroyFence(VkDevice device, VkFence fence, const VkAllocationCallbacks* pAllocator) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkDestroyFence, 36, "vkDestroyFence", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkDestroyFence)fn)(device, fence, pAllocator);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkResetFences(VkDevice device, uint32_t fenceCount, const VkFence* pFences) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkResetFences, 37, "vkResetFences", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkResetFences)fn)(device, fenceCount, pFences);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkGetFenceStatus(VkDevice device, VkFence fence) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetFenceStatus, 38, "vkGetFenceStatus", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkGetFenceStatus)fn)(device, fence);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkWaitForFences(VkDevice device, uint32_t fenceCount, const VkFence* pFences, VkBool32 waitAll, uint64_t timeout) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkWaitForFences, 39, "vkWaitForFences", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkWaitForFences)fn)(device, fenceCount, pFences, waitAll, timeout);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkCreateSemaphore(VkDevice device, const VkSemaphoreCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSemaphore* pSemaphore) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCreateSemaphore, 40, "vkCreateSemaphore", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkCreateSemaphore)fn)(device, pCreateInfo, pAllocator, pSemaphore);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkDestroySemaphore(VkDevice device, VkSemaphore semaphore, const VkAllocationCallbacks* pAllocator) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkDestroySemaphore, 41, "vkDestroySemaphore", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkDestroySemaphore)fn)(device, semaphore, pAllocator);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkCreateEvent(VkDevice device, const VkEventCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkEvent* pEvent) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCreateEvent, 42, "vkCreateEvent", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkCreateEvent)fn)(device, pCreateInfo, pAllocator, pEvent);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkDestroyEvent(VkDevice device, VkEvent event, const VkAllocationCallbacks* pAllocator) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkDestroyEvent, 43, "vkDestroyEvent", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkDestroyEvent)fn)(device, event, pAllocator);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkGetEventStatus(VkDevice device, VkEvent event) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetEventStatus, 44, "vkGetEventStatus", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkGetEventStatus)fn)(device, event);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkSetEvent(VkDevice device, VkEvent event) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkSetEvent, 45, "vkSetEvent", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkSetEvent)fn)(device, event);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkResetEvent(VkDevice device, VkEvent event) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkResetEvent, 46, "vkResetEvent", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkResetEvent)fn)(device, event);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkCreateQueryPool(VkDevice device, const VkQueryPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkQueryPool* pQueryPool) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCreateQueryPool, 47, "vkCreateQueryPool", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkCreateQueryPool)fn)(device, pCreateInfo, pAllocator, pQueryPool);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkDestroyQueryPool(VkDevice device, VkQueryPool queryPool, const VkAllocationCallbacks* pAllocator) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkDestroyQueryPool, 48, "vkDestroyQueryPool", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkDestroyQueryPool)fn)(device, queryPool, pAllocator);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkGetQueryPoolResults(VkDevice device, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, size_t dataSize, void* pData, VkDeviceSize stride, VkQueryResultFlags flags) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetQueryPoolResults, 49, "vkGetQueryPoolResults", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkGetQueryPoolResults)fn)(device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkCreateBuffer(VkDevice device, const VkBufferCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkBuffer* pBuffer) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCreateBuffer, 50, "vkCreateBuffer", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkCreateBuffer)fn)(device, pCreateInfo, pAllocator, pBuffer);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkDestroyBuffer(VkDevice device, VkBuffer buffer, const VkAllocationCallbacks* pAllocator) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkDestroyBuffer, 51, "vkDestroyBuffer", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkDestroyBuffer)fn)(device, buffer, pAllocator);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkCreateBufferView(VkDevice device, const VkBufferViewCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkBufferView* pView) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCreateBufferView, 52, "vkCreateBufferView", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkCreateBufferView)fn)(device, pCreateInfo, pAllocator, pView);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkDestroyBufferView(VkDevice device, VkBufferView bufferView, const VkAllocationCallbacks* pAllocator) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkDestroyBufferView, 53, "vkDestroyBufferView", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkDestroyBufferView)fn)(device, bufferView, pAllocator);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkCreateImage(VkDevice device, const VkImageCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkImage* pImage) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCreateImage, 54, "vkCreateImage", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkCreateImage)fn)(device, pCreateInfo, pAllocator, pImage);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkDestroyImage(VkDevice device, VkImage image, const VkAllocationCallbacks* pAllocator) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkDestroyImage, 55, "vkDestroyImage", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkDestroyImage)fn)(device, image, pAllocator);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkGetImageSubresourceLayout(VkDevice device, VkImage image, const VkImageSubresource* pSubresource, VkSubresourceLayout* pLayout) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetImageSubresourceLayout, 56, "vkGetImageSubresourceLayout", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkGetImageSubresourceLayout)fn)(device, image, pSubresource, pLayout);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkCreateImageView(VkDevice device, const VkImageViewCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkImageView* pView) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCreateImageView, 57, "vkCreateImageView", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkCreateImageView)fn)(device, pCreateInfo, pAllocator, pView);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkDestroyImageView(VkDevice device, VkImageView imageView, const VkAllocationCallbacks* pAllocator) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkDestroyImageView, 58, "vkDestroyImageView", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkDestroyImageView)fn)(device, imageView, pAllocator);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCreateShaderModule, 59, "vkCreateShaderModule", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkCreateShaderModule)fn)(device, pCreateInfo, pAllocator, pShaderModule);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkDestroyShaderModule(VkDevice device, VkShaderModule shaderModule, const VkAllocationCallbacks* pAllocator) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkDestroyShaderModule, 60, "vkDestroyShaderModule", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkDestroyShaderModule)fn)(device, shaderModule, pAllocator);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkCreatePipelineCache(VkDevice device, const VkPipelineCacheCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkPipelineCache* pPipelineCache) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCreatePipelineCache, 61, "vkCreatePipelineCache", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkCreatePipelineCache)fn)(device, pCreateInfo, pAllocator, pPipelineCache);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkDestroyPipelineCache(VkDevice device, VkPipelineCache pipelineCache, const VkAllocationCallbacks* pAllocator) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkDestroyPipelineCache, 62, "vkDestroyPipelineCache", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkDestroyPipelineCache)fn)(device, pipelineCache, pAllocator);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkGetPipelineCacheData(VkDevice device, VkPipelineCache pipelineCache, size_t* pDataSize, void* pData) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetPipelineCacheData, 63, "vkGetPipelineCacheData", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkGetPipelineCacheData)fn)(device, pipelineCache, pDataSize, pData);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkMergePipelineCaches(VkDevice device, VkPipelineCache dstCache, uint32_t srcCacheCount, const VkPipelineCache* pSrcCaches) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkMergePipelineCaches, 64, "vkMergePipelineCaches", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkMergePipelineCaches)fn)(device, dstCache, srcCacheCount, pSrcCaches);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkGraphicsPipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCreateGraphicsPipelines, 65, "vkCreateGraphicsPipelines", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkCreateGraphicsPipelines)fn)(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkCreateComputePipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkComputePipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCreateComputePipelines, 66, "vkCreateComputePipelines", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkCreateComputePipelines)fn)(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkDestroyPipeline(VkDevice device, VkPipeline pipeline, const VkAllocationCallbacks* pAllocator) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkDestroyPipeline, 67, "vkDestroyPipeline", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkDestroyPipeline)fn)(device, pipeline, pAllocator);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkCreatePipelineLayout(VkDevice device, const VkPipelineLayoutCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkPipelineLayout* pPipelineLayout) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCreatePipelineLayout, 68, "vkCreatePipelineLayout", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkCreatePipelineLayout)fn)(device, pCreateInfo, pAllocator, pPipelineLayout);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkDestroyPipelineLayout(VkDevice device, VkPipelineLayout pipelineLayout, const VkAllocationCallbacks* pAllocator) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkDestroyPipelineLayout, 69, "vkDestroyPipelineLayout", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkDestroyPipelineLayout)fn)(device, pipelineLayout, pAllocator);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkCreateSampler(VkDevice device, const VkSamplerCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSampler* pSampler) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCreateSampler, 70, "vkCreateSampler", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkCreateSampler)fn)(device, pCreateInfo, pAllocator, pSampler);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkDestroySampler(VkDevice device, VkSampler sampler, const VkAllocationCallbacks* pAllocator) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkDestroySampler, 71, "vkDestroySampler", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkDestroySampler)fn)(device, sampler, pAllocator);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkCreateDescriptorSetLayout(VkDevice device, const VkDescriptorSetLayoutCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorSetLayout* pSetLayout) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCreateDescriptorSetLayout, 72, "vkCreateDescriptorSetLayout", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkCreateDescriptorSetLayout)fn)(device, pCreateInfo, pAllocator, pSetLayout);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkDestroyDescriptorSetLayout(VkDevice device, VkDescriptorSetLayout descriptorSetLayout, const VkAllocationCallbacks* pAllocator) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkDestroyDescriptorSetLayout, 73, "vkDestroyDescriptorSetLayout", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkDestroyDescriptorSetLayout)fn)(device, descriptorSetLayout, pAllocator);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkCreateDescriptorPool(VkDevice device, const VkDescriptorPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorPool* pDescriptorPool) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCreateDescriptorPool, 74, "vkCreateDescriptorPool", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkCreateDescriptorPool)fn)(device, pCreateInfo, pAllocator, pDescriptorPool);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkDestroyDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool, const VkAllocationCallbacks* pAllocator) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkDestroyDescriptorPool, 75, "vkDestroyDescriptorPool", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkDestroyDescriptorPool)fn)(device, descriptorPool, pAllocator);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkResetDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool, VkDescriptorPoolResetFlags flags) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkResetDescriptorPool, 76, "vkResetDescriptorPool", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkResetDescriptorPool)fn)(device, descriptorPool, flags);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkAllocateDescriptorSets(VkDevice device, const VkDescriptorSetAllocateInfo* pAllocateInfo, VkDescriptorSet* pDescriptorSets) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkAllocateDescriptorSets, 77, "vkAllocateDescriptorSets", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkAllocateDescriptorSets)fn)(device, pAllocateInfo, pDescriptorSets);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkFreeDescriptorSets(VkDevice device, VkDescriptorPool descriptorPool, uint32_t descriptorSetCount, const VkDescriptorSet* pDescriptorSets) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkFreeDescriptorSets, 78, "vkFreeDescriptorSets", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkFreeDescriptorSets)fn)(device, descriptorPool, descriptorSetCount, pDescriptorSets);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkUpdateDescriptorSets(VkDevice device, uint32_t descriptorWriteCount, const VkWriteDescriptorSet* pDescriptorWrites, uint32_t descriptorCopyCount, const VkCopyDescriptorSet* pDescriptorCopies) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkUpdateDescriptorSets, 79, "vkUpdateDescriptorSets", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkUpdateDescriptorSets)fn)(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkCreateFramebuffer(VkDevice device, const VkFramebufferCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkFramebuffer* pFramebuffer) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCreateFramebuffer, 80, "vkCreateFramebuffer", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkCreateFramebuffer)fn)(device, pCreateInfo, pAllocator, pFramebuffer);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkDestroyFramebuffer(VkDevice device, VkFramebuffer framebuffer, const VkAllocationCallbacks* pAllocator) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkDestroyFramebuffer, 81, "vkDestroyFramebuffer", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkDestroyFramebuffer)fn)(device, framebuffer, pAllocator);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkCreateRenderPass(VkDevice device, const VkRenderPassCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCreateRenderPass, 82, "vkCreateRenderPass", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkCreateRenderPass)fn)(device, pCreateInfo, pAllocator, pRenderPass);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkDestroyRenderPass(VkDevice device, VkRenderPass renderPass, const VkAllocationCallbacks* pAllocator) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkDestroyRenderPass, 83, "vkDestroyRenderPass", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkDestroyRenderPass)fn)(device, renderPass, pAllocator);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkGetRenderAreaGranularity(VkDevice device, VkRenderPass renderPass, VkExtent2D* pGranularity) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetRenderAreaGranularity, 84, "vkGetRenderAreaGranularity", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkGetRenderAreaGranularity)fn)(device, renderPass, pGranularity);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkCreateCommandPool(VkDevice device, const VkCommandPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkCommandPool* pCommandPool) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCreateCommandPool, 85, "vkCreateCommandPool", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkCreateCommandPool)fn)(device, pCreateInfo, pAllocator, pCommandPool);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkDestroyCommandPool(VkDevice device, VkCommandPool commandPool, const VkAllocationCallbacks* pAllocator) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkDestroyCommandPool, 86, "vkDestroyCommandPool", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkDestroyCommandPool)fn)(device, commandPool, pAllocator);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkResetCommandPool(VkDevice device, VkCommandPool commandPool, VkCommandPoolResetFlags flags) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkResetCommandPool, 87, "vkResetCommandPool", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkResetCommandPool)fn)(device, commandPool, flags);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkAllocateCommandBuffers(VkDevice device, const VkCommandBufferAllocateInfo* pAllocateInfo, VkCommandBuffer* pCommandBuffers) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkAllocateCommandBuffers, 88, "vkAllocateCommandBuffers", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkAllocateCommandBuffers)fn)(device, pAllocateInfo, pCommandBuffers);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkFreeCommandBuffers(VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount, const VkCommandBuffer* pCommandBuffers) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkFreeCommandBuffers, 89, "vkFreeCommandBuffers", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkFreeCommandBuffers)fn)(device, commandPool, commandBufferCount, pCommandBuffers);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkBeginCommandBuffer(VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo* pBeginInfo) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkBeginCommandBuffer, 90, "vkBeginCommandBuffer", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkBeginCommandBuffer)fn)(commandBuffer, pBeginInfo);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkEndCommandBuffer(VkCommandBuffer commandBuffer) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkEndCommandBuffer, 91, "vkEndCommandBuffer", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkEndCommandBuffer)fn)(commandBuffer);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkResetCommandBuffer(VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flags) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkResetCommandBuffer, 92, "vkResetCommandBuffer", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkResetCommandBuffer)fn)(commandBuffer, flags);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdBindPipeline(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipeline pipeline) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdBindPipeline, 93, "vkCmdBindPipeline", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdBindPipeline)fn)(commandBuffer, pipelineBindPoint, pipeline);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdSetViewport(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount, const VkViewport* pViewports) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdSetViewport, 94, "vkCmdSetViewport", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdSetViewport)fn)(commandBuffer, firstViewport, viewportCount, pViewports);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdSetScissor(VkCommandBuffer commandBuffer, uint32_t firstScissor, uint32_t scissorCount, const VkRect2D* pScissors) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdSetScissor, 95, "vkCmdSetScissor", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdSetScissor)fn)(commandBuffer, firstScissor, scissorCount, pScissors);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdSetLineWidth(VkCommandBuffer commandBuffer, float lineWidth) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdSetLineWidth, 96, "vkCmdSetLineWidth", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdSetLineWidth)fn)(commandBuffer, lineWidth);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdSetDepthBias(VkCommandBuffer commandBuffer, float depthBiasConstantFactor, float depthBiasClamp, float depthBiasSlopeFactor) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdSetDepthBias, 97, "vkCmdSetDepthBias", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdSetDepthBias)fn)(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdSetBlendConstants(VkCommandBuffer commandBuffer, const float blendConstants[4]) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdSetBlendConstants, 98, "vkCmdSetBlendConstants", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdSetBlendConstants)fn)(commandBuffer, blendConstants);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdSetDepthBounds(VkCommandBuffer commandBuffer, float minDepthBounds, float maxDepthBounds) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdSetDepthBounds, 99, "vkCmdSetDepthBounds", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdSetDepthBounds)fn)(commandBuffer, minDepthBounds, maxDepthBounds);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdSetStencilCompareMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t compareMask) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdSetStencilCompareMask, 100, "vkCmdSetStencilCompareMask", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdSetStencilCompareMask)fn)(commandBuffer, faceMask, compareMask);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdSetStencilWriteMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t writeMask) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdSetStencilWriteMask, 101, "vkCmdSetStencilWriteMask", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdSetStencilWriteMask)fn)(commandBuffer, faceMask, writeMask);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdSetStencilReference(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t reference) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdSetStencilReference, 102, "vkCmdSetStencilReference", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdSetStencilReference)fn)(commandBuffer, faceMask, reference);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdBindDescriptorSets(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, uint32_t firstSet, uint32_t descriptorSetCount, const VkDescriptorSet* pDescriptorSets, uint32_t dynamicOffsetCount, const uint32_t* pDynamicOffsets) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdBindDescriptorSets, 103, "vkCmdBindDescriptorSets", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdBindDescriptorSets)fn)(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdBindIndexBuffer(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkIndexType indexType) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdBindIndexBuffer, 104, "vkCmdBindIndexBuffer", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdBindIndexBuffer)fn)(commandBuffer, buffer, offset, indexType);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdBindVertexBuffers(VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount, const VkBuffer* pBuffers, const VkDeviceSize* pOffsets) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdBindVertexBuffers, 105, "vkCmdBindVertexBuffers", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdBindVertexBuffers)fn)(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdDraw, 106, "vkCmdDraw", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdDraw)fn)(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdDrawIndexed(VkCommandBuffer commandBuffer, uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdDrawIndexed, 107, "vkCmdDrawIndexed", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdDrawIndexed)fn)(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdDrawIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdDrawIndirect, 108, "vkCmdDrawIndirect", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdDrawIndirect)fn)(commandBuffer, buffer, offset, drawCount, stride);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdDrawIndexedIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdDrawIndexedIndirect, 109, "vkCmdDrawIndexedIndirect", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdDrawIndexedIndirect)fn)(commandBuffer, buffer, offset, drawCount, stride);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdDispatch(VkCommandBuffer commandBuffer, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdDispatch, 110, "vkCmdDispatch", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdDispatch)fn)(commandBuffer, groupCountX, groupCountY, groupCountZ);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdDispatchIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdDispatchIndirect, 111, "vkCmdDispatchIndirect", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdDispatchIndirect)fn)(commandBuffer, buffer, offset);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer, uint32_t regionCount, const VkBufferCopy* pRegions) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdCopyBuffer, 112, "vkCmdCopyBuffer", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdCopyBuffer)fn)(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdCopyImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageCopy* pRegions) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdCopyImage, 113, "vkCmdCopyImage", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdCopyImage)fn)(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdBlitImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageBlit* pRegions, VkFilter filter) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdBlitImage, 114, "vkCmdBlitImage", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdBlitImage)fn)(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdCopyBufferToImage(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkBufferImageCopy* pRegions) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdCopyBufferToImage, 115, "vkCmdCopyBufferToImage", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdCopyBufferToImage)fn)(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdCopyImageToBuffer(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkBuffer dstBuffer, uint32_t regionCount, const VkBufferImageCopy* pRegions) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdCopyImageToBuffer, 116, "vkCmdCopyImageToBuffer", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdCopyImageToBuffer)fn)(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdUpdateBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize dataSize, const void* pData) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdUpdateBuffer, 117, "vkCmdUpdateBuffer", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdUpdateBuffer)fn)(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdFillBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize size, uint32_t data) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdFillBuffer, 118, "vkCmdFillBuffer", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdFillBuffer)fn)(commandBuffer, dstBuffer, dstOffset, size, data);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdClearColorImage(VkCommandBuffer commandBuffer, VkImage image, VkImageLayout imageLayout, const VkClearColorValue* pColor, uint32_t rangeCount, const VkImageSubresourceRange* pRanges) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdClearColorImage, 119, "vkCmdClearColorImage", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdClearColorImage)fn)(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdClearDepthStencilImage(VkCommandBuffer commandBuffer, VkImage image, VkImageLayout imageLayout, const VkClearDepthStencilValue* pDepthStencil, uint32_t rangeCount, const VkImageSubresourceRange* pRanges) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdClearDepthStencilImage, 120, "vkCmdClearDepthStencilImage", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdClearDepthStencilImage)fn)(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdClearAttachments(VkCommandBuffer commandBuffer, uint32_t attachmentCount, const VkClearAttachment* pAttachments, uint32_t rectCount, const VkClearRect* pRects) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdClearAttachments, 121, "vkCmdClearAttachments", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdClearAttachments)fn)(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdResolveImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageResolve* pRegions) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdResolveImage, 122, "vkCmdResolveImage", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdResolveImage)fn)(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdSetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdSetEvent, 123, "vkCmdSetEvent", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdSetEvent)fn)(commandBuffer, event, stageMask);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdResetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdResetEvent, 124, "vkCmdResetEvent", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdResetEvent)fn)(commandBuffer, event, stageMask);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdWaitEvents(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent* pEvents, VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask, uint32_t memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers, uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier* pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier* pImageMemoryBarriers) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdWaitEvents, 125, "vkCmdWaitEvents", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdWaitEvents)fn)(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdPipelineBarrier(VkCommandBuffer commandBuffer, VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask, VkDependencyFlags dependencyFlags, uint32_t memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers, uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier* pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier* pImageMemoryBarriers) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdPipelineBarrier, 126, "vkCmdPipelineBarrier", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdPipelineBarrier)fn)(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdBeginQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query, VkQueryControlFlags flags) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdBeginQuery, 127, "vkCmdBeginQuery", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdBeginQuery)fn)(commandBuffer, queryPool, query, flags);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdEndQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdEndQuery, 128, "vkCmdEndQuery", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdEndQuery)fn)(commandBuffer, queryPool, query);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdResetQueryPool(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdResetQueryPool, 129, "vkCmdResetQueryPool", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdResetQueryPool)fn)(commandBuffer, queryPool, firstQuery, queryCount);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdWriteTimestamp(VkCommandBuffer commandBuffer, VkPipelineStageFlagBits pipelineStage, VkQueryPool queryPool, uint32_t query) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdWriteTimestamp, 130, "vkCmdWriteTimestamp", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdWriteTimestamp)fn)(commandBuffer, pipelineStage, queryPool, query);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdCopyQueryPoolResults(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize stride, VkQueryResultFlags flags) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdCopyQueryPoolResults, 131, "vkCmdCopyQueryPoolResults", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdCopyQueryPoolResults)fn)(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdPushConstants(VkCommandBuffer commandBuffer, VkPipelineLayout layout, VkShaderStageFlags stageFlags, uint32_t offset, uint32_t size, const void* pValues) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdPushConstants, 132, "vkCmdPushConstants", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdPushConstants)fn)(commandBuffer, layout, stageFlags, offset, size, pValues);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo* pRenderPassBegin, VkSubpassContents contents) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdBeginRenderPass, 133, "vkCmdBeginRenderPass", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdBeginRenderPass)fn)(commandBuffer, pRenderPassBegin, contents);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdNextSubpass(VkCommandBuffer commandBuffer, VkSubpassContents contents) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdNextSubpass, 134, "vkCmdNextSubpass", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdNextSubpass)fn)(commandBuffer, contents);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdEndRenderPass(VkCommandBuffer commandBuffer) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdEndRenderPass, 135, "vkCmdEndRenderPass", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdEndRenderPass)fn)(commandBuffer);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t commandBufferCount, const VkCommandBuffer* pCommandBuffers) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdExecuteCommands, 136, "vkCmdExecuteCommands", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdExecuteCommands)fn)(commandBuffer, commandBufferCount, pCommandBuffers);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkDestroySurfaceKHR(VkInstance instance, VkSurfaceKHR surface, const VkAllocationCallbacks* pAllocator) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkDestroySurfaceKHR, 137, "vkDestroySurfaceKHR", LEVEL_INSTANCE);
+    if (!fn) return;
+    ((PFN_vkDestroySurfaceKHR)fn)(instance, surface, pAllocator);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkGetPhysicalDeviceSurfaceSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, VkSurfaceKHR surface, VkBool32* pSupported) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetPhysicalDeviceSurfaceSupportKHR, 138, "vkGetPhysicalDeviceSurfaceSupportKHR", LEVEL_INSTANCE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkGetPhysicalDeviceSurfaceSupportKHR)fn)(physicalDevice, queueFamilyIndex, surface, pSupported);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkGetPhysicalDeviceSurfaceCapabilitiesKHR(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, VkSurfaceCapabilitiesKHR* pSurfaceCapabilities) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetPhysicalDeviceSurfaceCapabilitiesKHR, 139, "vkGetPhysicalDeviceSurfaceCapabilitiesKHR", LEVEL_INSTANCE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkGetPhysicalDeviceSurfaceCapabilitiesKHR)fn)(physicalDevice, surface, pSurfaceCapabilities);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkGetPhysicalDeviceSurfaceFormatsKHR(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, uint32_t* pSurfaceFormatCount, VkSurfaceFormatKHR* pSurfaceFormats) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetPhysicalDeviceSurfaceFormatsKHR, 140, "vkGetPhysicalDeviceSurfaceFormatsKHR", LEVEL_INSTANCE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkGetPhysicalDeviceSurfaceFormatsKHR)fn)(physicalDevice, surface, pSurfaceFormatCount, pSurfaceFormats);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkGetPhysicalDeviceSurfacePresentModesKHR(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, uint32_t* pPresentModeCount, VkPresentModeKHR* pPresentModes) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetPhysicalDeviceSurfacePresentModesKHR, 141, "vkGetPhysicalDeviceSurfacePresentModesKHR", LEVEL_INSTANCE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkGetPhysicalDeviceSurfacePresentModesKHR)fn)(physicalDevice, surface, pPresentModeCount, pPresentModes);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkCreateSwapchainKHR(VkDevice device, const VkSwapchainCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchain) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCreateSwapchainKHR, 142, "vkCreateSwapchainKHR", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkCreateSwapchainKHR)fn)(device, pCreateInfo, pAllocator, pSwapchain);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkDestroySwapchainKHR(VkDevice device, VkSwapchainKHR swapchain, const VkAllocationCallbacks* pAllocator) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkDestroySwapchainKHR, 143, "vkDestroySwapchainKHR", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkDestroySwapchainKHR)fn)(device, swapchain, pAllocator);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkGetSwapchainImagesKHR(VkDevice device, VkSwapchainKHR swapchain, uint32_t* pSwapchainImageCount, VkImage* pSwapchainImages) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetSwapchainImagesKHR, 144, "vkGetSwapchainImagesKHR", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkGetSwapchainImagesKHR)fn)(device, swapchain, pSwapchainImageCount, pSwapchainImages);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkAcquireNextImageKHR(VkDevice device, VkSwapchainKHR swapchain, uint64_t timeout, VkSemaphore semaphore, VkFence fence, uint32_t* pImageIndex) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkAcquireNextImageKHR, 145, "vkAcquireNextImageKHR", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkAcquireNextImageKHR)fn)(device, swapchain, timeout, semaphore, fence, pImageIndex);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR* pPresentInfo) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkQueuePresentKHR, 146, "vkQueuePresentKHR", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkQueuePresentKHR)fn)(queue, pPresentInfo);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkGetPhysicalDeviceDisplayPropertiesKHR(VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkDisplayPropertiesKHR* pProperties) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetPhysicalDeviceDisplayPropertiesKHR, 147, "vkGetPhysicalDeviceDisplayPropertiesKHR", LEVEL_INSTANCE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkGetPhysicalDeviceDisplayPropertiesKHR)fn)(physicalDevice, pPropertyCount, pProperties);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkGetPhysicalDeviceDisplayPlanePropertiesKHR(VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkDisplayPlanePropertiesKHR* pProperties) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetPhysicalDeviceDisplayPlanePropertiesKHR, 148, "vkGetPhysicalDeviceDisplayPlanePropertiesKHR", LEVEL_INSTANCE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkGetPhysicalDeviceDisplayPlanePropertiesKHR)fn)(physicalDevice, pPropertyCount, pProperties);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkGetDisplayPlaneSupportedDisplaysKHR(VkPhysicalDevice physicalDevice, uint32_t planeIndex, uint32_t* pDisplayCount, VkDisplayKHR* pDisplays) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetDisplayPlaneSupportedDisplaysKHR, 149, "vkGetDisplayPlaneSupportedDisplaysKHR", LEVEL_INSTANCE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkGetDisplayPlaneSupportedDisplaysKHR)fn)(physicalDevice, planeIndex, pDisplayCount, pDisplays);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkGetDisplayModePropertiesKHR(VkPhysicalDevice physicalDevice, VkDisplayKHR display, uint32_t* pPropertyCount, VkDisplayModePropertiesKHR* pProperties) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetDisplayModePropertiesKHR, 150, "vkGetDisplayModePropertiesKHR", LEVEL_INSTANCE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkGetDisplayModePropertiesKHR)fn)(physicalDevice, display, pPropertyCount, pProperties);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkCreateDisplayModeKHR(VkPhysicalDevice physicalDevice, VkDisplayKHR display, const VkDisplayModeCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDisplayModeKHR* pMode) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCreateDisplayModeKHR, 151, "vkCreateDisplayModeKHR", LEVEL_INSTANCE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkCreateDisplayModeKHR)fn)(physicalDevice, display, pCreateInfo, pAllocator, pMode);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkGetDisplayPlaneCapabilitiesKHR(VkPhysicalDevice physicalDevice, VkDisplayModeKHR mode, uint32_t planeIndex, VkDisplayPlaneCapabilitiesKHR* pCapabilities) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetDisplayPlaneCapabilitiesKHR, 152, "vkGetDisplayPlaneCapabilitiesKHR", LEVEL_INSTANCE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkGetDisplayPlaneCapabilitiesKHR)fn)(physicalDevice, mode, planeIndex, pCapabilities);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkCreateDisplayPlaneSurfaceKHR(VkInstance instance, const VkDisplaySurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCreateDisplayPlaneSurfaceKHR, 153, "vkCreateDisplayPlaneSurfaceKHR", LEVEL_INSTANCE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkCreateDisplayPlaneSurfaceKHR)fn)(instance, pCreateInfo, pAllocator, pSurface);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkCreateSharedSwapchainsKHR(VkDevice device, uint32_t swapchainCount, const VkSwapchainCreateInfoKHR* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchains) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCreateSharedSwapchainsKHR, 154, "vkCreateSharedSwapchainsKHR", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkCreateSharedSwapchainsKHR)fn)(device, swapchainCount, pCreateInfos, pAllocator, pSwapchains);
+}
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkCreateXlibSurfaceKHR(VkInstance instance, const VkXlibSurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCreateXlibSurfaceKHR, 155, "vkCreateXlibSurfaceKHR", LEVEL_INSTANCE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkCreateXlibSurfaceKHR)fn)(instance, pCreateInfo, pAllocator, pSurface);
+}
+static VKAPI_ATTR VkBool32 VKAPI_CALL Load_vkGetPhysicalDeviceXlibPresentationSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, Display* dpy, VisualID visualID) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetPhysicalDeviceXlibPresentationSupportKHR, 156, "vkGetPhysicalDeviceXlibPresentationSupportKHR", LEVEL_INSTANCE);
+    if (!fn) return 0;
+    return ((PFN_vkGetPhysicalDeviceXlibPresentationSupportKHR)fn)(physicalDevice, queueFamilyIndex, dpy, visualID);
+}
+#endif
 #ifdef VK_USE_PLATFORM_XCB_KHR
-PFN_vkCreateXcbSurfaceKHR vkCreateXcbSurfaceKHR;
-PFN_vkGetPhysicalDeviceXcbPresentationSupportKHR vkGetPhysicalDeviceXcbPresentationSupportKHR;
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkCreateXcbSurfaceKHR(VkInstance instance, const VkXcbSurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCreateXcbSurfaceKHR, 157, "vkCreateXcbSurfaceKHR", LEVEL_INSTANCE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkCreateXcbSurfaceKHR)fn)(instance, pCreateInfo, pAllocator, pSurface);
+}
+static VKAPI_ATTR VkBool32 VKAPI_CALL Load_vkGetPhysicalDeviceXcbPresentationSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, xcb_connection_t* connection, xcb_visualid_t visual_id) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetPhysicalDeviceXcbPresentationSupportKHR, 158, "vkGetPhysicalDeviceXcbPresentationSupportKHR", LEVEL_INSTANCE);
+    if (!fn) return 0;
+    return ((PFN_vkGetPhysicalDeviceXcbPresentationSupportKHR)fn)(physicalDevice, queueFamilyIndex, connection, visual_id);
+}
 #endif
-
 #ifdef VK_USE_PLATFORM_WAYLAND_KHR
-PFN_vkCreateWaylandSurfaceKHR vkCreateWaylandSurfaceKHR;
-PFN_vkGetPhysicalDeviceWaylandPresentationSupportKHR vkGetPhysicalDeviceWaylandPresentationSupportKHR;
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkCreateWaylandSurfaceKHR(VkInstance instance, const VkWaylandSurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCreateWaylandSurfaceKHR, 159, "vkCreateWaylandSurfaceKHR", LEVEL_INSTANCE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkCreateWaylandSurfaceKHR)fn)(instance, pCreateInfo, pAllocator, pSurface);
+}
+static VKAPI_ATTR VkBool32 VKAPI_CALL Load_vkGetPhysicalDeviceWaylandPresentationSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, struct wl_display* display) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetPhysicalDeviceWaylandPresentationSupportKHR, 160, "vkGetPhysicalDeviceWaylandPresentationSupportKHR", LEVEL_INSTANCE);
+    if (!fn) return 0;
+    return ((PFN_vkGetPhysicalDeviceWaylandPresentationSupportKHR)fn)(physicalDevice, queueFamilyIndex, display);
+}
 #endif
-
 #ifdef VK_USE_PLATFORM_MIR_KHR
-PFN_vkCreateMirSurfaceKHR vkCreateMirSurfaceKHR;
-PFN_vkGetPhysicalDeviceMirPresentationSupportKHR vkGetPhysicalDeviceMirPresentationSupportKHR;
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkCreateMirSurfaceKHR(VkInstance instance, const VkMirSurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCreateMirSurfaceKHR, 161, "vkCreateMirSurfaceKHR", LEVEL_INSTANCE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkCreateMirSurfaceKHR)fn)(instance, pCreateInfo, pAllocator, pSurface);
+}
+static VKAPI_ATTR VkBool32 VKAPI_CALL Load_vkGetPhysicalDeviceMirPresentationSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, MirConnection* connection) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetPhysicalDeviceMirPresentationSupportKHR, 162, "vkGetPhysicalDeviceMirPresentationSupportKHR", LEVEL_INSTANCE);
+    if (!fn) return 0;
+    return ((PFN_vkGetPhysicalDeviceMirPresentationSupportKHR)fn)(physicalDevice, queueFamilyIndex, connection);
+}
 #endif
-
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
-PFN_vkCreateAndroidSurfaceKHR vkCreateAndroidSurfaceKHR;
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkCreateAndroidSurfaceKHR(VkInstance instance, const VkAndroidSurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCreateAndroidSurfaceKHR, 163, "vkCreateAndroidSurfaceKHR", LEVEL_INSTANCE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkCreateAndroidSurfaceKHR)fn)(instance, pCreateInfo, pAllocator, pSurface);
+}
 #endif
-
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-PFN_vkCreateWin32SurfaceKHR vkCreateWin32SurfaceKHR;
-PFN_vkGetPhysicalDeviceWin32PresentationSupportKHR vkGetPhysicalDeviceWin32PresentationSupportKHR;
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkCreateWin32SurfaceKHR(VkInstance instance, const VkWin32SurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCreateWin32SurfaceKHR, 164, "vkCreateWin32SurfaceKHR", LEVEL_INSTANCE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkCreateWin32SurfaceKHR)fn)(instance, pCreateInfo, pAllocator, pSurface);
+}
+static VKAPI_ATTR VkBool32 VKAPI_CALL Load_vkGetPhysicalDeviceWin32PresentationSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetPhysicalDeviceWin32PresentationSupportKHR, 165, "vkGetPhysicalDeviceWin32PresentationSupportKHR", LEVEL_INSTANCE);
+    if (!fn) return 0;
+    return ((PFN_vkGetPhysicalDeviceWin32PresentationSupportKHR)fn)(physicalDevice, queueFamilyIndex);
+}
+#endif
+static VKAPI_ATTR void VKAPI_CALL Load_vkGetPhysicalDeviceFeatures2KHR(VkPhysicalDevice physicalDevice, VkPhysicalDeviceFeatures2KHR* pFeatures) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetPhysicalDeviceFeatures2KHR, 166, "vkGetPhysicalDeviceFeatures2KHR", LEVEL_INSTANCE);
+    if (!fn) return;
+    ((PFN_vkGetPhysicalDeviceFeatures2KHR)fn)(physicalDevice, pFeatures);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkGetPhysicalDeviceProperties2KHR(VkPhysicalDevice physicalDevice, VkPhysicalDeviceProperties2KHR* pProperties) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetPhysicalDeviceProperties2KHR, 167, "vkGetPhysicalDeviceProperties2KHR", LEVEL_INSTANCE);
+    if (!fn) return;
+    ((PFN_vkGetPhysicalDeviceProperties2KHR)fn)(physicalDevice, pProperties);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkGetPhysicalDeviceFormatProperties2KHR(VkPhysicalDevice physicalDevice, VkFormat format, VkFormatProperties2KHR* pFormatProperties) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetPhysicalDeviceFormatProperties2KHR, 168, "vkGetPhysicalDeviceFormatProperties2KHR", LEVEL_INSTANCE);
+    if (!fn) return;
+    ((PFN_vkGetPhysicalDeviceFormatProperties2KHR)fn)(physicalDevice, format, pFormatProperties);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkGetPhysicalDeviceImageFormatProperties2KHR(VkPhysicalDevice physicalDevice, const VkPhysicalDeviceImageFormatInfo2KHR* pImageFormatInfo, VkImageFormatProperties2KHR* pImageFormatProperties) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetPhysicalDeviceImageFormatProperties2KHR, 169, "vkGetPhysicalDeviceImageFormatProperties2KHR", LEVEL_INSTANCE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkGetPhysicalDeviceImageFormatProperties2KHR)fn)(physicalDevice, pImageFormatInfo, pImageFormatProperties);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkGetPhysicalDeviceQueueFamilyProperties2KHR(VkPhysicalDevice physicalDevice, uint32_t* pQueueFamilyPropertyCount, VkQueueFamilyProperties2KHR* pQueueFamilyProperties) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetPhysicalDeviceQueueFamilyProperties2KHR, 170, "vkGetPhysicalDeviceQueueFamilyProperties2KHR", LEVEL_INSTANCE);
+    if (!fn) return;
+    ((PFN_vkGetPhysicalDeviceQueueFamilyProperties2KHR)fn)(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkGetPhysicalDeviceMemoryProperties2KHR(VkPhysicalDevice physicalDevice, VkPhysicalDeviceMemoryProperties2KHR* pMemoryProperties) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetPhysicalDeviceMemoryProperties2KHR, 171, "vkGetPhysicalDeviceMemoryProperties2KHR", LEVEL_INSTANCE);
+    if (!fn) return;
+    ((PFN_vkGetPhysicalDeviceMemoryProperties2KHR)fn)(physicalDevice, pMemoryProperties);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkGetPhysicalDeviceSparseImageFormatProperties2KHR(VkPhysicalDevice physicalDevice, const VkPhysicalDeviceSparseImageFormatInfo2KHR* pFormatInfo, uint32_t* pPropertyCount, VkSparseImageFormatProperties2KHR* pProperties) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetPhysicalDeviceSparseImageFormatProperties2KHR, 172, "vkGetPhysicalDeviceSparseImageFormatProperties2KHR", LEVEL_INSTANCE);
+    if (!fn) return;
+    ((PFN_vkGetPhysicalDeviceSparseImageFormatProperties2KHR)fn)(physicalDevice, pFormatInfo, pPropertyCount, pProperties);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkTrimCommandPoolKHR(VkDevice device, VkCommandPool commandPool, VkCommandPoolTrimFlagsKHR flags) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkTrimCommandPoolKHR, 173, "vkTrimCommandPoolKHR", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkTrimCommandPoolKHR)fn)(device, commandPool, flags);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkGetPhysicalDeviceExternalBufferPropertiesKHR(VkPhysicalDevice physicalDevice, const VkPhysicalDeviceExternalBufferInfoKHR* pExternalBufferInfo, VkExternalBufferPropertiesKHR* pExternalBufferProperties) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetPhysicalDeviceExternalBufferPropertiesKHR, 174, "vkGetPhysicalDeviceExternalBufferPropertiesKHR", LEVEL_INSTANCE);
+    if (!fn) return;
+    ((PFN_vkGetPhysicalDeviceExternalBufferPropertiesKHR)fn)(physicalDevice, pExternalBufferInfo, pExternalBufferProperties);
+}
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkGetMemoryWin32HandleKHR(VkDevice device, const VkMemoryGetWin32HandleInfoKHR* pGetWin32HandleInfo, HANDLE* pHandle) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetMemoryWin32HandleKHR, 175, "vkGetMemoryWin32HandleKHR", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkGetMemoryWin32HandleKHR)fn)(device, pGetWin32HandleInfo, pHandle);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkGetMemoryWin32HandlePropertiesKHR(VkDevice device, VkExternalMemoryHandleTypeFlagBitsKHR handleType, HANDLE handle, VkMemoryWin32HandlePropertiesKHR* pMemoryWin32HandleProperties) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetMemoryWin32HandlePropertiesKHR, 176, "vkGetMemoryWin32HandlePropertiesKHR", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkGetMemoryWin32HandlePropertiesKHR)fn)(device, handleType, handle, pMemoryWin32HandleProperties);
+}
+#endif
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkGetMemoryFdKHR(VkDevice device, const VkMemoryGetFdInfoKHR* pGetFdInfo, int* pFd) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetMemoryFdKHR, 177, "vkGetMemoryFdKHR", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkGetMemoryFdKHR)fn)(device, pGetFdInfo, pFd);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkGetMemoryFdPropertiesKHR(VkDevice device, VkExternalMemoryHandleTypeFlagBitsKHR handleType, int fd, VkMemoryFdPropertiesKHR* pMemoryFdProperties) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetMemoryFdPropertiesKHR, 178, "vkGetMemoryFdPropertiesKHR", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkGetMemoryFdPropertiesKHR)fn)(device, handleType, fd, pMemoryFdProperties);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR(VkPhysicalDevice physicalDevice, const VkPhysicalDeviceExternalSemaphoreInfoKHR* pExternalSemaphoreInfo, VkExternalSemaphorePropertiesKHR* pExternalSemaphoreProperties) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetPhysicalDeviceExternalSemaphorePropertiesKHR, 179, "vkGetPhysicalDeviceExternalSemaphorePropertiesKHR", LEVEL_INSTANCE);
+    if (!fn) return;
+    ((PFN_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR)fn)(physicalDevice, pExternalSemaphoreInfo, pExternalSemaphoreProperties);
+}
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkImportSemaphoreWin32HandleKHR(VkDevice device, const VkImportSemaphoreWin32HandleInfoKHR* pImportSemaphoreWin32HandleInfo) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkImportSemaphoreWin32HandleKHR, 180, "vkImportSemaphoreWin32HandleKHR", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkImportSemaphoreWin32HandleKHR)fn)(device, pImportSemaphoreWin32HandleInfo);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkGetSemaphoreWin32HandleKHR(VkDevice device, const VkSemaphoreGetWin32HandleInfoKHR* pGetWin32HandleInfo, HANDLE* pHandle) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetSemaphoreWin32HandleKHR, 181, "vkGetSemaphoreWin32HandleKHR", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkGetSemaphoreWin32HandleKHR)fn)(device, pGetWin32HandleInfo, pHandle);
+}
+#endif
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkImportSemaphoreFdKHR(VkDevice device, const VkImportSemaphoreFdInfoKHR* pImportSemaphoreFdInfo) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkImportSemaphoreFdKHR, 182, "vkImportSemaphoreFdKHR", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkImportSemaphoreFdKHR)fn)(device, pImportSemaphoreFdInfo);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkGetSemaphoreFdKHR(VkDevice device, const VkSemaphoreGetFdInfoKHR* pGetFdInfo, int* pFd) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetSemaphoreFdKHR, 183, "vkGetSemaphoreFdKHR", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkGetSemaphoreFdKHR)fn)(device, pGetFdInfo, pFd);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdPushDescriptorSetKHR(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, uint32_t set, uint32_t descriptorWriteCount, const VkWriteDescriptorSet* pDescriptorWrites) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdPushDescriptorSetKHR, 184, "vkCmdPushDescriptorSetKHR", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdPushDescriptorSetKHR)fn)(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkCreateDescriptorUpdateTemplateKHR(VkDevice device, const VkDescriptorUpdateTemplateCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorUpdateTemplateKHR* pDescriptorUpdateTemplate) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCreateDescriptorUpdateTemplateKHR, 185, "vkCreateDescriptorUpdateTemplateKHR", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkCreateDescriptorUpdateTemplateKHR)fn)(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkDestroyDescriptorUpdateTemplateKHR(VkDevice device, VkDescriptorUpdateTemplateKHR descriptorUpdateTemplate, const VkAllocationCallbacks* pAllocator) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkDestroyDescriptorUpdateTemplateKHR, 186, "vkDestroyDescriptorUpdateTemplateKHR", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkDestroyDescriptorUpdateTemplateKHR)fn)(device, descriptorUpdateTemplate, pAllocator);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkUpdateDescriptorSetWithTemplateKHR(VkDevice device, VkDescriptorSet descriptorSet, VkDescriptorUpdateTemplateKHR descriptorUpdateTemplate, const void* pData) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkUpdateDescriptorSetWithTemplateKHR, 187, "vkUpdateDescriptorSetWithTemplateKHR", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkUpdateDescriptorSetWithTemplateKHR)fn)(device, descriptorSet, descriptorUpdateTemplate, pData);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdPushDescriptorSetWithTemplateKHR(VkCommandBuffer commandBuffer, VkDescriptorUpdateTemplateKHR descriptorUpdateTemplate, VkPipelineLayout layout, uint32_t set, const void* pData) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdPushDescriptorSetWithTemplateKHR, 188, "vkCmdPushDescriptorSetWithTemplateKHR", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdPushDescriptorSetWithTemplateKHR)fn)(commandBuffer, descriptorUpdateTemplate, layout, set, pData);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkGetSwapchainStatusKHR(VkDevice device, VkSwapchainKHR swapchain) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetSwapchainStatusKHR, 189, "vkGetSwapchainStatusKHR", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkGetSwapchainStatusKHR)fn)(device, swapchain);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkGetPhysicalDeviceExternalFencePropertiesKHR(VkPhysicalDevice physicalDevice, const VkPhysicalDeviceExternalFenceInfoKHR* pExternalFenceInfo, VkExternalFencePropertiesKHR* pExternalFenceProperties) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetPhysicalDeviceExternalFencePropertiesKHR, 190, "vkGetPhysicalDeviceExternalFencePropertiesKHR", LEVEL_INSTANCE);
+    if (!fn) return;
+    ((PFN_vkGetPhysicalDeviceExternalFencePropertiesKHR)fn)(physicalDevice, pExternalFenceInfo, pExternalFenceProperties);
+}
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkImportFenceWin32HandleKHR(VkDevice device, const VkImportFenceWin32HandleInfoKHR* pImportFenceWin32HandleInfo) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkImportFenceWin32HandleKHR, 191, "vkImportFenceWin32HandleKHR", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkImportFenceWin32HandleKHR)fn)(device, pImportFenceWin32HandleInfo);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkGetFenceWin32HandleKHR(VkDevice device, const VkFenceGetWin32HandleInfoKHR* pGetWin32HandleInfo, HANDLE* pHandle) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetFenceWin32HandleKHR, 192, "vkGetFenceWin32HandleKHR", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkGetFenceWin32HandleKHR)fn)(device, pGetWin32HandleInfo, pHandle);
+}
 #endif
-PFN_vkCreateDebugReportCallbackEXT vkCreateDebugReportCallbackEXT;
-PFN_vkDestroyDebugReportCallbackEXT vkDestroyDebugReportCallbackEXT;
-PFN_vkDebugReportMessageEXT vkDebugReportMessageEXT;
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkImportFenceFdKHR(VkDevice device, const VkImportFenceFdInfoKHR* pImportFenceFdInfo) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkImportFenceFdKHR, 193, "vkImportFenceFdKHR", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkImportFenceFdKHR)fn)(device, pImportFenceFdInfo);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkGetFenceFdKHR(VkDevice device, const VkFenceGetFdInfoKHR* pGetFdInfo, int* pFd) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetFenceFdKHR, 194, "vkGetFenceFdKHR", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkGetFenceFdKHR)fn)(device, pGetFdInfo, pFd);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkGetPhysicalDeviceSurfaceCapabilities2KHR(VkPhysicalDevice physicalDevice, const VkPhysicalDeviceSurfaceInfo2KHR* pSurfaceInfo, VkSurfaceCapabilities2KHR* pSurfaceCapabilities) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetPhysicalDeviceSurfaceCapabilities2KHR, 195, "vkGetPhysicalDeviceSurfaceCapabilities2KHR", LEVEL_INSTANCE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkGetPhysicalDeviceSurfaceCapabilities2KHR)fn)(physicalDevice, pSurfaceInfo, pSurfaceCapabilities);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkGetPhysicalDeviceSurfaceFormats2KHR(VkPhysicalDevice physicalDevice, const VkPhysicalDeviceSurfaceInfo2KHR* pSurfaceInfo, uint32_t* pSurfaceFormatCount, VkSurfaceFormat2KHR* pSurfaceFormats) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetPhysicalDeviceSurfaceFormats2KHR, 196, "vkGetPhysicalDeviceSurfaceFormats2KHR", LEVEL_INSTANCE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkGetPhysicalDeviceSurfaceFormats2KHR)fn)(physicalDevice, pSurfaceInfo, pSurfaceFormatCount, pSurfaceFormats);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkGetImageMemoryRequirements2KHR(VkDevice device, const VkImageMemoryRequirementsInfo2KHR* pInfo, VkMemoryRequirements2KHR* pMemoryRequirements) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetImageMemoryRequirements2KHR, 197, "vkGetImageMemoryRequirements2KHR", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkGetImageMemoryRequirements2KHR)fn)(device, pInfo, pMemoryRequirements);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkGetBufferMemoryRequirements2KHR(VkDevice device, const VkBufferMemoryRequirementsInfo2KHR* pInfo, VkMemoryRequirements2KHR* pMemoryRequirements) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetBufferMemoryRequirements2KHR, 198, "vkGetBufferMemoryRequirements2KHR", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkGetBufferMemoryRequirements2KHR)fn)(device, pInfo, pMemoryRequirements);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkGetImageSparseMemoryRequirements2KHR(VkDevice device, const VkImageSparseMemoryRequirementsInfo2KHR* pInfo, uint32_t* pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements2KHR* pSparseMemoryRequirements) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetImageSparseMemoryRequirements2KHR, 199, "vkGetImageSparseMemoryRequirements2KHR", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkGetImageSparseMemoryRequirements2KHR)fn)(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkCreateSamplerYcbcrConversionKHR(VkDevice device, const VkSamplerYcbcrConversionCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSamplerYcbcrConversionKHR* pYcbcrConversion) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCreateSamplerYcbcrConversionKHR, 200, "vkCreateSamplerYcbcrConversionKHR", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkCreateSamplerYcbcrConversionKHR)fn)(device, pCreateInfo, pAllocator, pYcbcrConversion);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkDestroySamplerYcbcrConversionKHR(VkDevice device, VkSamplerYcbcrConversionKHR ycbcrConversion, const VkAllocationCallbacks* pAllocator) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkDestroySamplerYcbcrConversionKHR, 201, "vkDestroySamplerYcbcrConversionKHR", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkDestroySamplerYcbcrConversionKHR)fn)(device, ycbcrConversion, pAllocator);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkBindBufferMemory2KHR(VkDevice device, uint32_t bindInfoCount, const VkBindBufferMemoryInfoKHR* pBindInfos) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkBindBufferMemory2KHR, 202, "vkBindBufferMemory2KHR", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkBindBufferMemory2KHR)fn)(device, bindInfoCount, pBindInfos);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkBindImageMemory2KHR(VkDevice device, uint32_t bindInfoCount, const VkBindImageMemoryInfoKHR* pBindInfos) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkBindImageMemory2KHR, 203, "vkBindImageMemory2KHR", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkBindImageMemory2KHR)fn)(device, bindInfoCount, pBindInfos);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkCreateDebugReportCallbackEXT(VkInstance instance, const VkDebugReportCallbackCreateInfoEXT* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDebugReportCallbackEXT* pCallback) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCreateDebugReportCallbackEXT, 204, "vkCreateDebugReportCallbackEXT", LEVEL_INSTANCE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkCreateDebugReportCallbackEXT)fn)(instance, pCreateInfo, pAllocator, pCallback);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkDestroyDebugReportCallbackEXT(VkInstance instance, VkDebugReportCallbackEXT callback, const VkAllocationCallbacks* pAllocator) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkDestroyDebugReportCallbackEXT, 205, "vkDestroyDebugReportCallbackEXT", LEVEL_INSTANCE);
+    if (!fn) return;
+    ((PFN_vkDestroyDebugReportCallbackEXT)fn)(instance, callback, pAllocator);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkDebugReportMessageEXT(VkInstance instance, VkDebugReportFlagsEXT flags, VkDebugReportObjectTypeEXT objectType, uint64_t object, size_t location, int32_t messageCode, const char* pLayerPrefix, const char* pMessage) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkDebugReportMessageEXT, 206, "vkDebugReportMessageEXT", LEVEL_INSTANCE);
+    if (!fn) return;
+    ((PFN_vkDebugReportMessageEXT)fn)(instance, flags, objectType, object, location, messageCode, pLayerPrefix, pMessage);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkDebugMarkerSetObjectTagEXT(VkDevice device, const VkDebugMarkerObjectTagInfoEXT* pTagInfo) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkDebugMarkerSetObjectTagEXT, 207, "vkDebugMarkerSetObjectTagEXT", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkDebugMarkerSetObjectTagEXT)fn)(device, pTagInfo);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkDebugMarkerSetObjectNameEXT(VkDevice device, const VkDebugMarkerObjectNameInfoEXT* pNameInfo) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkDebugMarkerSetObjectNameEXT, 208, "vkDebugMarkerSetObjectNameEXT", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkDebugMarkerSetObjectNameEXT)fn)(device, pNameInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdDebugMarkerBeginEXT(VkCommandBuffer commandBuffer, const VkDebugMarkerMarkerInfoEXT* pMarkerInfo) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdDebugMarkerBeginEXT, 209, "vkCmdDebugMarkerBeginEXT", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdDebugMarkerBeginEXT)fn)(commandBuffer, pMarkerInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdDebugMarkerEndEXT(VkCommandBuffer commandBuffer) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdDebugMarkerEndEXT, 210, "vkCmdDebugMarkerEndEXT", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdDebugMarkerEndEXT)fn)(commandBuffer);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdDebugMarkerInsertEXT(VkCommandBuffer commandBuffer, const VkDebugMarkerMarkerInfoEXT* pMarkerInfo) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdDebugMarkerInsertEXT, 211, "vkCmdDebugMarkerInsertEXT", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdDebugMarkerInsertEXT)fn)(commandBuffer, pMarkerInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdDrawIndirectCountAMD(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdDrawIndirectCountAMD, 212, "vkCmdDrawIndirectCountAMD", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdDrawIndirectCountAMD)fn)(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdDrawIndexedIndirectCountAMD(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdDrawIndexedIndirectCountAMD, 213, "vkCmdDrawIndexedIndirectCountAMD", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdDrawIndexedIndirectCountAMD)fn)(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkGetShaderInfoAMD(VkDevice device, VkPipeline pipeline, VkShaderStageFlagBits shaderStage, VkShaderInfoTypeAMD infoType, size_t* pInfoSize, void* pInfo) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetShaderInfoAMD, 214, "vkGetShaderInfoAMD", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkGetShaderInfoAMD)fn)(device, pipeline, shaderStage, infoType, pInfoSize, pInfo);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkGetPhysicalDeviceExternalImageFormatPropertiesNV(VkPhysicalDevice physicalDevice, VkFormat format, VkImageType type, VkImageTiling tiling, VkImageUsageFlags usage, VkImageCreateFlags flags, VkExternalMemoryHandleTypeFlagsNV externalHandleType, VkExternalImageFormatPropertiesNV* pExternalImageFormatProperties) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetPhysicalDeviceExternalImageFormatPropertiesNV, 215, "vkGetPhysicalDeviceExternalImageFormatPropertiesNV", LEVEL_INSTANCE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkGetPhysicalDeviceExternalImageFormatPropertiesNV)fn)(physicalDevice, format, type, tiling, usage, flags, externalHandleType, pExternalImageFormatProperties);
+}
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkGetMemoryWin32HandleNV(VkDevice device, VkDeviceMemory memory, VkExternalMemoryHandleTypeFlagsNV handleType, HANDLE* pHandle) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetMemoryWin32HandleNV, 216, "vkGetMemoryWin32HandleNV", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkGetMemoryWin32HandleNV)fn)(device, memory, handleType, pHandle);
+}
+#endif
+static VKAPI_ATTR void VKAPI_CALL Load_vkGetDeviceGroupPeerMemoryFeaturesKHX(VkDevice device, uint32_t heapIndex, uint32_t localDeviceIndex, uint32_t remoteDeviceIndex, VkPeerMemoryFeatureFlagsKHX* pPeerMemoryFeatures) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetDeviceGroupPeerMemoryFeaturesKHX, 217, "vkGetDeviceGroupPeerMemoryFeaturesKHX", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkGetDeviceGroupPeerMemoryFeaturesKHX)fn)(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdSetDeviceMaskKHX(VkCommandBuffer commandBuffer, uint32_t deviceMask) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdSetDeviceMaskKHX, 218, "vkCmdSetDeviceMaskKHX", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdSetDeviceMaskKHX)fn)(commandBuffer, deviceMask);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdDispatchBaseKHX(VkCommandBuffer commandBuffer, uint32_t baseGroupX, uint32_t baseGroupY, uint32_t baseGroupZ, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdDispatchBaseKHX, 219, "vkCmdDispatchBaseKHX", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdDispatchBaseKHX)fn)(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkGetDeviceGroupPresentCapabilitiesKHX(VkDevice device, VkDeviceGroupPresentCapabilitiesKHX* pDeviceGroupPresentCapabilities) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetDeviceGroupPresentCapabilitiesKHX, 220, "vkGetDeviceGroupPresentCapabilitiesKHX", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkGetDeviceGroupPresentCapabilitiesKHX)fn)(device, pDeviceGroupPresentCapabilities);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkGetDeviceGroupSurfacePresentModesKHX(VkDevice device, VkSurfaceKHR surface, VkDeviceGroupPresentModeFlagsKHX* pModes) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetDeviceGroupSurfacePresentModesKHX, 221, "vkGetDeviceGroupSurfacePresentModesKHX", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkGetDeviceGroupSurfacePresentModesKHX)fn)(device, surface, pModes);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkGetPhysicalDevicePresentRectanglesKHX(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, uint32_t* pRectCount, VkRect2D* pRects) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetPhysicalDevicePresentRectanglesKHX, 222, "vkGetPhysicalDevicePresentRectanglesKHX", LEVEL_INSTANCE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkGetPhysicalDevicePresentRectanglesKHX)fn)(physicalDevice, surface, pRectCount, pRects);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkAcquireNextImage2KHX(VkDevice device, const VkAcquireNextImageInfoKHX* pAcquireInfo, uint32_t* pImageIndex) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkAcquireNextImage2KHX, 223, "vkAcquireNextImage2KHX", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkAcquireNextImage2KHX)fn)(device, pAcquireInfo, pImageIndex);
+}
+#ifdef VK_USE_PLATFORM_VI_NN
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkCreateViSurfaceNN(VkInstance instance, const VkViSurfaceCreateInfoNN* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCreateViSurfaceNN, 224, "vkCreateViSurfaceNN", LEVEL_INSTANCE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkCreateViSurfaceNN)fn)(instance, pCreateInfo, pAllocator, pSurface);
+}
+#endif
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkEnumeratePhysicalDeviceGroupsKHX(VkInstance instance, uint32_t* pPhysicalDeviceGroupCount, VkPhysicalDeviceGroupPropertiesKHX* pPhysicalDeviceGroupProperties) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkEnumeratePhysicalDeviceGroupsKHX, 225, "vkEnumeratePhysicalDeviceGroupsKHX", LEVEL_INSTANCE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkEnumeratePhysicalDeviceGroupsKHX)fn)(instance, pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdProcessCommandsNVX(VkCommandBuffer commandBuffer, const VkCmdProcessCommandsInfoNVX* pProcessCommandsInfo) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdProcessCommandsNVX, 226, "vkCmdProcessCommandsNVX", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdProcessCommandsNVX)fn)(commandBuffer, pProcessCommandsInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdReserveSpaceForCommandsNVX(VkCommandBuffer commandBuffer, const VkCmdReserveSpaceForCommandsInfoNVX* pReserveSpaceInfo) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdReserveSpaceForCommandsNVX, 227, "vkCmdReserveSpaceForCommandsNVX", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdReserveSpaceForCommandsNVX)fn)(commandBuffer, pReserveSpaceInfo);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkCreateIndirectCommandsLayoutNVX(VkDevice device, const VkIndirectCommandsLayoutCreateInfoNVX* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkIndirectCommandsLayoutNVX* pIndirectCommandsLayout) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCreateIndirectCommandsLayoutNVX, 228, "vkCreateIndirectCommandsLayoutNVX", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkCreateIndirectCommandsLayoutNVX)fn)(device, pCreateInfo, pAllocator, pIndirectCommandsLayout);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkDestroyIndirectCommandsLayoutNVX(VkDevice device, VkIndirectCommandsLayoutNVX indirectCommandsLayout, const VkAllocationCallbacks* pAllocator) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkDestroyIndirectCommandsLayoutNVX, 229, "vkDestroyIndirectCommandsLayoutNVX", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkDestroyIndirectCommandsLayoutNVX)fn)(device, indirectCommandsLayout, pAllocator);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkCreateObjectTableNVX(VkDevice device, const VkObjectTableCreateInfoNVX* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkObjectTableNVX* pObjectTable) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCreateObjectTableNVX, 230, "vkCreateObjectTableNVX", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkCreateObjectTableNVX)fn)(device, pCreateInfo, pAllocator, pObjectTable);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkDestroyObjectTableNVX(VkDevice device, VkObjectTableNVX objectTable, const VkAllocationCallbacks* pAllocator) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkDestroyObjectTableNVX, 231, "vkDestroyObjectTableNVX", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkDestroyObjectTableNVX)fn)(device, objectTable, pAllocator);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkRegisterObjectsNVX(VkDevice device, VkObjectTableNVX objectTable, uint32_t objectCount, const VkObjectTableEntryNVX* const* ppObjectTableEntries, const uint32_t* pObjectIndices) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkRegisterObjectsNVX, 232, "vkRegisterObjectsNVX", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkRegisterObjectsNVX)fn)(device, objectTable, objectCount, ppObjectTableEntries, pObjectIndices);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkUnregisterObjectsNVX(VkDevice device, VkObjectTableNVX objectTable, uint32_t objectCount, const VkObjectEntryTypeNVX* pObjectEntryTypes, const uint32_t* pObjectIndices) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkUnregisterObjectsNVX, 233, "vkUnregisterObjectsNVX", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkUnregisterObjectsNVX)fn)(device, objectTable, objectCount, pObjectEntryTypes, pObjectIndices);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkGetPhysicalDeviceGeneratedCommandsPropertiesNVX(VkPhysicalDevice physicalDevice, VkDeviceGeneratedCommandsFeaturesNVX* pFeatures, VkDeviceGeneratedCommandsLimitsNVX* pLimits) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetPhysicalDeviceGeneratedCommandsPropertiesNVX, 234, "vkGetPhysicalDeviceGeneratedCommandsPropertiesNVX", LEVEL_INSTANCE);
+    if (!fn) return;
+    ((PFN_vkGetPhysicalDeviceGeneratedCommandsPropertiesNVX)fn)(physicalDevice, pFeatures, pLimits);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdSetViewportWScalingNV(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount, const VkViewportWScalingNV* pViewportWScalings) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdSetViewportWScalingNV, 235, "vkCmdSetViewportWScalingNV", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdSetViewportWScalingNV)fn)(commandBuffer, firstViewport, viewportCount, pViewportWScalings);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkReleaseDisplayEXT(VkPhysicalDevice physicalDevice, VkDisplayKHR display) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkReleaseDisplayEXT, 236, "vkReleaseDisplayEXT", LEVEL_INSTANCE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkReleaseDisplayEXT)fn)(physicalDevice, display);
+}
+#ifdef VK_USE_PLATFORM_XLIB_XRANDR_EXT
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkAcquireXlibDisplayEXT(VkPhysicalDevice physicalDevice, Display* dpy, VkDisplayKHR display) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkAcquireXlibDisplayEXT, 237, "vkAcquireXlibDisplayEXT", LEVEL_INSTANCE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkAcquireXlibDisplayEXT)fn)(physicalDevice, dpy, display);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkGetRandROutputDisplayEXT(VkPhysicalDevice physicalDevice, Display* dpy, RROutput rrOutput, VkDisplayKHR* pDisplay) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetRandROutputDisplayEXT, 238, "vkGetRandROutputDisplayEXT", LEVEL_INSTANCE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkGetRandROutputDisplayEXT)fn)(physicalDevice, dpy, rrOutput, pDisplay);
+}
+#endif
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkGetPhysicalDeviceSurfaceCapabilities2EXT(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, VkSurfaceCapabilities2EXT* pSurfaceCapabilities) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetPhysicalDeviceSurfaceCapabilities2EXT, 239, "vkGetPhysicalDeviceSurfaceCapabilities2EXT", LEVEL_INSTANCE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkGetPhysicalDeviceSurfaceCapabilities2EXT)fn)(physicalDevice, surface, pSurfaceCapabilities);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkDisplayPowerControlEXT(VkDevice device, VkDisplayKHR display, const VkDisplayPowerInfoEXT* pDisplayPowerInfo) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkDisplayPowerControlEXT, 240, "vkDisplayPowerControlEXT", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkDisplayPowerControlEXT)fn)(device, display, pDisplayPowerInfo);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkRegisterDeviceEventEXT(VkDevice device, const VkDeviceEventInfoEXT* pDeviceEventInfo, const VkAllocationCallbacks* pAllocator, VkFence* pFence) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkRegisterDeviceEventEXT, 241, "vkRegisterDeviceEventEXT", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkRegisterDeviceEventEXT)fn)(device, pDeviceEventInfo, pAllocator, pFence);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkRegisterDisplayEventEXT(VkDevice device, VkDisplayKHR display, const VkDisplayEventInfoEXT* pDisplayEventInfo, const VkAllocationCallbacks* pAllocator, VkFence* pFence) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkRegisterDisplayEventEXT, 242, "vkRegisterDisplayEventEXT", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkRegisterDisplayEventEXT)fn)(device, display, pDisplayEventInfo, pAllocator, pFence);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkGetSwapchainCounterEXT(VkDevice device, VkSwapchainKHR swapchain, VkSurfaceCounterFlagBitsEXT counter, uint64_t* pCounterValue) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetSwapchainCounterEXT, 243, "vkGetSwapchainCounterEXT", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkGetSwapchainCounterEXT)fn)(device, swapchain, counter, pCounterValue);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkGetRefreshCycleDurationGOOGLE(VkDevice device, VkSwapchainKHR swapchain, VkRefreshCycleDurationGOOGLE* pDisplayTimingProperties) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetRefreshCycleDurationGOOGLE, 244, "vkGetRefreshCycleDurationGOOGLE", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkGetRefreshCycleDurationGOOGLE)fn)(device, swapchain, pDisplayTimingProperties);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkGetPastPresentationTimingGOOGLE(VkDevice device, VkSwapchainKHR swapchain, uint32_t* pPresentationTimingCount, VkPastPresentationTimingGOOGLE* pPresentationTimings) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetPastPresentationTimingGOOGLE, 245, "vkGetPastPresentationTimingGOOGLE", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkGetPastPresentationTimingGOOGLE)fn)(device, swapchain, pPresentationTimingCount, pPresentationTimings);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdSetDiscardRectangleEXT(VkCommandBuffer commandBuffer, uint32_t firstDiscardRectangle, uint32_t discardRectangleCount, const VkRect2D* pDiscardRectangles) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdSetDiscardRectangleEXT, 246, "vkCmdSetDiscardRectangleEXT", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdSetDiscardRectangleEXT)fn)(commandBuffer, firstDiscardRectangle, discardRectangleCount, pDiscardRectangles);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkSetHdrMetadataEXT(VkDevice device, uint32_t swapchainCount, const VkSwapchainKHR* pSwapchains, const VkHdrMetadataEXT* pMetadata) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkSetHdrMetadataEXT, 247, "vkSetHdrMetadataEXT", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkSetHdrMetadataEXT)fn)(device, swapchainCount, pSwapchains, pMetadata);
+}
+#ifdef VK_USE_PLATFORM_IOS_MVK
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkCreateIOSSurfaceMVK(VkInstance instance, const VkIOSSurfaceCreateInfoMVK* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCreateIOSSurfaceMVK, 248, "vkCreateIOSSurfaceMVK", LEVEL_INSTANCE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkCreateIOSSurfaceMVK)fn)(instance, pCreateInfo, pAllocator, pSurface);
+}
+#endif
+#ifdef VK_USE_PLATFORM_MACOS_MVK
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkCreateMacOSSurfaceMVK(VkInstance instance, const VkMacOSSurfaceCreateInfoMVK* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCreateMacOSSurfaceMVK, 249, "vkCreateMacOSSurfaceMVK", LEVEL_INSTANCE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkCreateMacOSSurfaceMVK)fn)(instance, pCreateInfo, pAllocator, pSurface);
+}
+#endif
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdSetSampleLocationsEXT(VkCommandBuffer commandBuffer, const VkSampleLocationsInfoEXT* pSampleLocationsInfo) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdSetSampleLocationsEXT, 250, "vkCmdSetSampleLocationsEXT", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdSetSampleLocationsEXT)fn)(commandBuffer, pSampleLocationsInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkGetPhysicalDeviceMultisamplePropertiesEXT(VkPhysicalDevice physicalDevice, VkSampleCountFlagBits samples, VkMultisamplePropertiesEXT* pMultisampleProperties) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetPhysicalDeviceMultisamplePropertiesEXT, 251, "vkGetPhysicalDeviceMultisamplePropertiesEXT", LEVEL_INSTANCE);
+    if (!fn) return;
+    ((PFN_vkGetPhysicalDeviceMultisamplePropertiesEXT)fn)(physicalDevice, samples, pMultisampleProperties);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkCreateValidationCacheEXT(VkDevice device, const VkValidationCacheCreateInfoEXT* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkValidationCacheEXT* pValidationCache) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCreateValidationCacheEXT, 252, "vkCreateValidationCacheEXT", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkCreateValidationCacheEXT)fn)(device, pCreateInfo, pAllocator, pValidationCache);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkDestroyValidationCacheEXT(VkDevice device, VkValidationCacheEXT validationCache, const VkAllocationCallbacks* pAllocator) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkDestroyValidationCacheEXT, 253, "vkDestroyValidationCacheEXT", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkDestroyValidationCacheEXT)fn)(device, validationCache, pAllocator);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkMergeValidationCachesEXT(VkDevice device, VkValidationCacheEXT dstCache, uint32_t srcCacheCount, const VkValidationCacheEXT* pSrcCaches) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkMergeValidationCachesEXT, 254, "vkMergeValidationCachesEXT", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkMergeValidationCachesEXT)fn)(device, dstCache, srcCacheCount, pSrcCaches);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkGetValidationCacheDataEXT(VkDevice device, VkValidationCacheEXT validationCache, size_t* pDataSize, void* pData) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetValidationCacheDataEXT, 255, "vkGetValidationCacheDataEXT", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkGetValidationCacheDataEXT)fn)(device, validationCache, pDataSize, pData);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Load_vkGetMemoryHostPointerPropertiesEXT(VkDevice device, VkExternalMemoryHandleTypeFlagBitsKHR handleType, const void* pHostPointer, VkMemoryHostPointerPropertiesEXT* pMemoryHostPointerProperties) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkGetMemoryHostPointerPropertiesEXT, 256, "vkGetMemoryHostPointerPropertiesEXT", LEVEL_DEVICE);
+    if (!fn) return VK_ERROR_INITIALIZATION_FAILED;
+    return ((PFN_vkGetMemoryHostPointerPropertiesEXT)fn)(device, handleType, pHostPointer, pMemoryHostPointerProperties);
+}
+static VKAPI_ATTR void VKAPI_CALL Load_vkCmdWriteBufferMarkerAMD(VkCommandBuffer commandBuffer, VkPipelineStageFlagBits pipelineStage, VkBuffer dstBuffer, VkDeviceSize dstOffset, uint32_t marker) {
+    PFN_vkVoidFunction fn = LoadProc((PFN_vkVoidFunction*)&vkCmdWriteBufferMarkerAMD, 257, "vkCmdWriteBufferMarkerAMD", LEVEL_DEVICE);
+    if (!fn) return;
+    ((PFN_vkCmdWriteBufferMarkerAMD)fn)(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker);
+}
+
+//-------------------------------No-ops---------------------------------
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkCreateInstance(const VkInstanceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkInstance* pInstance) { return VK_SUCCESS; }
+static VKAPI_ATTR void VKAPI_CALL Noop_vkDestroyInstance(VkInstance instance, const VkAllocationCallbacks* pAllocator) {}
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkEnumeratePhysicalDevices(VkInstance instance, uint32_t* pPhysicalDeviceCount, VkPhysicalDevice* pPhysicalDevices) { return VK_SUCCESS; }
+static VKAPI_ATTR void VKAPI_CALL Noop_vkGetPhysicalDeviceFeatures(VkPhysicalDevice physicalDevice, VkPhysicalDeviceFeatures* pFeatures) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkGetPhysicalDeviceFormatProperties(VkPhysicalDevice physicalDevice, VkFormat format, VkFormatProperties* pFormatProperties) {}
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkGetPhysicalDeviceImageFormatProperties(VkPhysicalDevice physicalDevice, VkFormat format, VkImageType type, VkImageTiling tiling, VkImageUsageFlags usage, VkImageCreateFlags flags, VkImageFormatProperties* pImageFormatProperties) { return VK_SUCCESS; }
+static VKAPI_ATTR void VKAPI_CALL Noop_vkGetPhysicalDeviceProperties(VkPhysicalDevice physicalDevice, VkPhysicalDeviceProperties* pProperties) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkGetPhysicalDeviceQueueFamilyProperties(VkPhysicalDevice physicalDevice, uint32_t* pQueueFamilyPropertyCount, VkQueueFamilyProperties* pQueueFamilyProperties) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkGetPhysicalDeviceMemoryProperties(VkPhysicalDevice physicalDevice, VkPhysicalDeviceMemoryProperties* pMemoryProperties) {}
+static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL Noop_vkGetInstanceProcAddr(VkInstance instance, const char* pName) { return 0; }
+static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL Noop_vkGetDeviceProcAddr(VkDevice device, const char* pName) { return 0; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkCreateDevice(VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDevice* pDevice) { return VK_SUCCESS; }
+static VKAPI_ATTR void VKAPI_CALL Noop_vkDestroyDevice(VkDevice device, const VkAllocationCallbacks* pAllocator) {}
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkEnumerateInstanceExtensionProperties(const char* pLayerName, uint32_t* pPropertyCount, VkExtensionProperties* pProperties) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkEnumerateDeviceExtensionProperties(VkPhysicalDevice physicalDevice, const char* pLayerName, uint32_t* pPropertyCount, VkExtensionProperties* pProperties) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkEnumerateInstanceLayerProperties(uint32_t* pPropertyCount, VkLayerProperties* pProperties) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkEnumerateDeviceLayerProperties(VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkLayerProperties* pProperties) { return VK_SUCCESS; }
+static VKAPI_ATTR void VKAPI_CALL Noop_vkGetDeviceQueue(VkDevice device, uint32_t queueFamilyIndex, uint32_t queueIndex, VkQueue* pQueue) {}
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkQueueWaitIdle(VkQueue queue) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkDeviceWaitIdle(VkDevice device) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkAllocateMemory(VkDevice device, const VkMemoryAllocateInfo* pAllocateInfo, const VkAllocationCallbacks* pAllocator, VkDeviceMemory* pMemory) { return VK_SUCCESS; }
+static VKAPI_ATTR void VKAPI_CALL Noop_vkFreeMemory(VkDevice device, VkDeviceMemory memory, const VkAllocationCallbacks* pAllocator) {}
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkMapMemory(VkDevice device, VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize size, VkMemoryMapFlags flags, void** ppData) { return VK_SUCCESS; }
+static VKAPI_ATTR void VKAPI_CALL Noop_vkUnmapMemory(VkDevice device, VkDeviceMemory memory) {}
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkFlushMappedMemoryRanges(VkDevice device, uint32_t memoryRangeCount, const VkMappedMemoryRange* pMemoryRanges) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkInvalidateMappedMemoryRanges(VkDevice device, uint32_t memoryRangeCount, const VkMappedMemoryRange* pMemoryRanges) { return VK_SUCCESS; }
+static VKAPI_ATTR void VKAPI_CALL Noop_vkGetDeviceMemoryCommitment(VkDevice device, VkDeviceMemory memory, VkDeviceSize* pCommittedMemoryInBytes) {}
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkBindBufferMemory(VkDevice device, VkBuffer buffer, VkDeviceMemory memory, VkDeviceSize memoryOffset) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkBindImageMemory(VkDevice device, VkImage image, VkDeviceMemory memory, VkDeviceSize memoryOffset) { return VK_SUCCESS; }
+static VKAPI_ATTR void VKAPI_CALL Noop_vkGetBufferMemoryRequirements(VkDevice device, VkBuffer buffer, VkMemoryRequirements* pMemoryRequirements) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkGetImageMemoryRequirements(VkDevice device, VkImage image, VkMemoryRequirements* pMemoryRequirements) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkGetImageSparseMemoryRequirements(VkDevice device, VkImage image, uint32_t* pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements* pSparseMemoryRequirements) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkGetPhysicalDeviceSparseImageFormatProperties(VkPhysicalDevice physicalDevice, VkFormat format, VkImageType type, VkSampleCountFlagBits samples, VkImageUsageFlags usage, VkImageTiling tiling, uint32_t* pPropertyCount, VkSparseImageFormatProperties* pProperties) {}
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkQueueBindSparse(VkQueue queue, uint32_t bindInfoCount, const VkBindSparseInfo* pBindInfo, VkFence fence) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkCreateFence(VkDevice device, const VkFenceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkFence* pFence) { return VK_SUCCESS; }
+static VKAPI_ATTR void VKAPI_CALL Noop_vkDestroyFence(VkDevice device, VkFence fence, const VkAllocationCallbacks* pAllocator) {}
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkResetFences(VkDevice device, uint32_t fenceCount, const VkFence* pFences) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkGetFenceStatus(VkDevice device, VkFence fence) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkWaitForFences(VkDevice device, uint32_t fenceCount, const VkFence* pFences, VkBool32 waitAll, uint64_t timeout) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkCreateSemaphore(VkDevice device, const VkSemaphoreCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSemaphore* pSemaphore) { return VK_SUCCESS; }
+static VKAPI_ATTR void VKAPI_CALL Noop_vkDestroySemaphore(VkDevice device, VkSemaphore semaphore, const VkAllocationCallbacks* pAllocator) {}
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkCreateEvent(VkDevice device, const VkEventCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkEvent* pEvent) { return VK_SUCCESS; }
+static VKAPI_ATTR void VKAPI_CALL Noop_vkDestroyEvent(VkDevice device, VkEvent event, const VkAllocationCallbacks* pAllocator) {}
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkGetEventStatus(VkDevice device, VkEvent event) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkSetEvent(VkDevice device, VkEvent event) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkResetEvent(VkDevice device, VkEvent event) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkCreateQueryPool(VkDevice device, const VkQueryPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkQueryPool* pQueryPool) { return VK_SUCCESS; }
+static VKAPI_ATTR void VKAPI_CALL Noop_vkDestroyQueryPool(VkDevice device, VkQueryPool queryPool, const VkAllocationCallbacks* pAllocator) {}
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkGetQueryPoolResults(VkDevice device, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, size_t dataSize, void* pData, VkDeviceSize stride, VkQueryResultFlags flags) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkCreateBuffer(VkDevice device, const VkBufferCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkBuffer* pBuffer) { return VK_SUCCESS; }
+static VKAPI_ATTR void VKAPI_CALL Noop_vkDestroyBuffer(VkDevice device, VkBuffer buffer, const VkAllocationCallbacks* pAllocator) {}
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkCreateBufferView(VkDevice device, const VkBufferViewCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkBufferView* pView) { return VK_SUCCESS; }
+static VKAPI_ATTR void VKAPI_CALL Noop_vkDestroyBufferView(VkDevice device, VkBufferView bufferView, const VkAllocationCallbacks* pAllocator) {}
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkCreateImage(VkDevice device, const VkImageCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkImage* pImage) { return VK_SUCCESS; }
+static VKAPI_ATTR void VKAPI_CALL Noop_vkDestroyImage(VkDevice device, VkImage image, const VkAllocationCallbacks* pAllocator) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkGetImageSubresourceLayout(VkDevice device, VkImage image, const VkImageSubresource* pSubresource, VkSubresourceLayout* pLayout) {}
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkCreateImageView(VkDevice device, const VkImageViewCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkImageView* pView) { return VK_SUCCESS; }
+static VKAPI_ATTR void VKAPI_CALL Noop_vkDestroyImageView(VkDevice device, VkImageView imageView, const VkAllocationCallbacks* pAllocator) {}
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule) { return VK_SUCCESS; }
+static VKAPI_ATTR void VKAPI_CALL Noop_vkDestroyShaderModule(VkDevice device, VkShaderModule shaderModule, const VkAllocationCallbacks* pAllocator) {}
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkCreatePipelineCache(VkDevice device, const VkPipelineCacheCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkPipelineCache* pPipelineCache) { return VK_SUCCESS; }
+static VKAPI_ATTR void VKAPI_CALL Noop_vkDestroyPipelineCache(VkDevice device, VkPipelineCache pipelineCache, const VkAllocationCallbacks* pAllocator) {}
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkGetPipelineCacheData(VkDevice device, VkPipelineCache pipelineCache, size_t* pDataSize, void* pData) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkMergePipelineCaches(VkDevice device, VkPipelineCache dstCache, uint32_t srcCacheCount, const VkPipelineCache* pSrcCaches) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkGraphicsPipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkCreateComputePipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkComputePipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) { return VK_SUCCESS; }
+static VKAPI_ATTR void VKAPI_CALL Noop_vkDestroyPipeline(VkDevice device, VkPipeline pipeline, const VkAllocationCallbacks* pAllocator) {}
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkCreatePipelineLayout(VkDevice device, const VkPipelineLayoutCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkPipelineLayout* pPipelineLayout) { return VK_SUCCESS; }
+static VKAPI_ATTR void VKAPI_CALL Noop_vkDestroyPipelineLayout(VkDevice device, VkPipelineLayout pipelineLayout, const VkAllocationCallbacks* pAllocator) {}
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkCreateSampler(VkDevice device, const VkSamplerCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSampler* pSampler) { return VK_SUCCESS; }
+static VKAPI_ATTR void VKAPI_CALL Noop_vkDestroySampler(VkDevice device, VkSampler sampler, const VkAllocationCallbacks* pAllocator) {}
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkCreateDescriptorSetLayout(VkDevice device, const VkDescriptorSetLayoutCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorSetLayout* pSetLayout) { return VK_SUCCESS; }
+static VKAPI_ATTR void VKAPI_CALL Noop_vkDestroyDescriptorSetLayout(VkDevice device, VkDescriptorSetLayout descriptorSetLayout, const VkAllocationCallbacks* pAllocator) {}
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkCreateDescriptorPool(VkDevice device, const VkDescriptorPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorPool* pDescriptorPool) { return VK_SUCCESS; }
+static VKAPI_ATTR void VKAPI_CALL Noop_vkDestroyDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool, const VkAllocationCallbacks* pAllocator) {}
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkResetDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool, VkDescriptorPoolResetFlags flags) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkAllocateDescriptorSets(VkDevice device, const VkDescriptorSetAllocateInfo* pAllocateInfo, VkDescriptorSet* pDescriptorSets) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkFreeDescriptorSets(VkDevice device, VkDescriptorPool descriptorPool, uint32_t descriptorSetCount, const VkDescriptorSet* pDescriptorSets) { return VK_SUCCESS; }
+static VKAPI_ATTR void VKAPI_CALL Noop_vkUpdateDescriptorSets(VkDevice device, uint32_t descriptorWriteCount, const VkWriteDescriptorSet* pDescriptorWrites, uint32_t descriptorCopyCount, const VkCopyDescriptorSet* pDescriptorCopies) {}
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkCreateFramebuffer(VkDevice device, const VkFramebufferCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkFramebuffer* pFramebuffer) { return VK_SUCCESS; }
+static VKAPI_ATTR void VKAPI_CALL Noop_vkDestroyFramebuffer(VkDevice device, VkFramebuffer framebuffer, const VkAllocationCallbacks* pAllocator) {}
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkCreateRenderPass(VkDevice device, const VkRenderPassCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass) { return VK_SUCCESS; }
+static VKAPI_ATTR void VKAPI_CALL Noop_vkDestroyRenderPass(VkDevice device, VkRenderPass renderPass, const VkAllocationCallbacks* pAllocator) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkGetRenderAreaGranularity(VkDevice device, VkRenderPass renderPass, VkExtent2D* pGranularity) {}
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkCreateCommandPool(VkDevice device, const VkCommandPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkCommandPool* pCommandPool) { return VK_SUCCESS; }
+static VKAPI_ATTR void VKAPI_CALL Noop_vkDestroyCommandPool(VkDevice device, VkCommandPool commandPool, const VkAllocationCallbacks* pAllocator) {}
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkResetCommandPool(VkDevice device, VkCommandPool commandPool, VkCommandPoolResetFlags flags) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkAllocateCommandBuffers(VkDevice device, const VkCommandBufferAllocateInfo* pAllocateInfo, VkCommandBuffer* pCommandBuffers) { return VK_SUCCESS; }
+static VKAPI_ATTR void VKAPI_CALL Noop_vkFreeCommandBuffers(VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount, const VkCommandBuffer* pCommandBuffers) {}
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkBeginCommandBuffer(VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo* pBeginInfo) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkEndCommandBuffer(VkCommandBuffer commandBuffer) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkResetCommandBuffer(VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flags) { return VK_SUCCESS; }
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdBindPipeline(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipeline pipeline) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdSetViewport(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount, const VkViewport* pViewports) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdSetScissor(VkCommandBuffer commandBuffer, uint32_t firstScissor, uint32_t scissorCount, const VkRect2D* pScissors) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdSetLineWidth(VkCommandBuffer commandBuffer, float lineWidth) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdSetDepthBias(VkCommandBuffer commandBuffer, float depthBiasConstantFactor, float depthBiasClamp, float depthBiasSlopeFactor) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdSetBlendConstants(VkCommandBuffer commandBuffer, const float blendConstants[4]) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdSetDepthBounds(VkCommandBuffer commandBuffer, float minDepthBounds, float maxDepthBounds) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdSetStencilCompareMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t compareMask) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdSetStencilWriteMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t writeMask) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdSetStencilReference(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t reference) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdBindDescriptorSets(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, uint32_t firstSet, uint32_t descriptorSetCount, const VkDescriptorSet* pDescriptorSets, uint32_t dynamicOffsetCount, const uint32_t* pDynamicOffsets) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdBindIndexBuffer(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkIndexType indexType) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdBindVertexBuffers(VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount, const VkBuffer* pBuffers, const VkDeviceSize* pOffsets) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdDrawIndexed(VkCommandBuffer commandBuffer, uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdDrawIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdDrawIndexedIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdDispatch(VkCommandBuffer commandBuffer, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdDispatchIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer, uint32_t regionCount, const VkBufferCopy* pRegions) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdCopyImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageCopy* pRegions) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdBlitImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageBlit* pRegions, VkFilter filter) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdCopyBufferToImage(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkBufferImageCopy* pRegions) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdCopyImageToBuffer(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkBuffer dstBuffer, uint32_t regionCount, const VkBufferImageCopy* pRegions) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdUpdateBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize dataSize, const void* pData) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdFillBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize size, uint32_t data) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdClearColorImage(VkCommandBuffer commandBuffer, VkImage image, VkImageLayout imageLayout, const VkClearColorValue* pColor, uint32_t rangeCount, const VkImageSubresourceRange* pRanges) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdClearDepthStencilImage(VkCommandBuffer commandBuffer, VkImage image, VkImageLayout imageLayout, const VkClearDepthStencilValue* pDepthStencil, uint32_t rangeCount, const VkImageSubresourceRange* pRanges) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdClearAttachments(VkCommandBuffer commandBuffer, uint32_t attachmentCount, const VkClearAttachment* pAttachments, uint32_t rectCount, const VkClearRect* pRects) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdResolveImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageResolve* pRegions) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdSetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdResetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdWaitEvents(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent* pEvents, VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask, uint32_t memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers, uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier* pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier* pImageMemoryBarriers) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdPipelineBarrier(VkCommandBuffer commandBuffer, VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask, VkDependencyFlags dependencyFlags, uint32_t memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers, uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier* pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier* pImageMemoryBarriers) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdBeginQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query, VkQueryControlFlags flags) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdEndQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdResetQueryPool(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdWriteTimestamp(VkCommandBuffer commandBuffer, VkPipelineStageFlagBits pipelineStage, VkQueryPool queryPool, uint32_t query) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdCopyQueryPoolResults(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize stride, VkQueryResultFlags flags) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdPushConstants(VkCommandBuffer commandBuffer, VkPipelineLayout layout, VkShaderStageFlags stageFlags, uint32_t offset, uint32_t size, const void* pValues) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo* pRenderPassBegin, VkSubpassContents contents) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdNextSubpass(VkCommandBuffer commandBuffer, VkSubpassContents contents) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdEndRenderPass(VkCommandBuffer commandBuffer) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t commandBufferCount, const VkCommandBuffer* pCommandBuffers) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkDestroySurfaceKHR(VkInstance instance, VkSurfaceKHR surface, const VkAllocationCallbacks* pAllocator) {}
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkGetPhysicalDeviceSurfaceSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, VkSurfaceKHR surface, VkBool32* pSupported) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkGetPhysicalDeviceSurfaceCapabilitiesKHR(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, VkSurfaceCapabilitiesKHR* pSurfaceCapabilities) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkGetPhysicalDeviceSurfaceFormatsKHR(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, uint32_t* pSurfaceFormatCount, VkSurfaceFormatKHR* pSurfaceFormats) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkGetPhysicalDeviceSurfacePresentModesKHR(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, uint32_t* pPresentModeCount, VkPresentModeKHR* pPresentModes) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkCreateSwapchainKHR(VkDevice device, const VkSwapchainCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchain) { return VK_SUCCESS; }
+static VKAPI_ATTR void VKAPI_CALL Noop_vkDestroySwapchainKHR(VkDevice device, VkSwapchainKHR swapchain, const VkAllocationCallbacks* pAllocator) {}
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkGetSwapchainImagesKHR(VkDevice device, VkSwapchainKHR swapchain, uint32_t* pSwapchainImageCount, VkImage* pSwapchainImages) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkAcquireNextImageKHR(VkDevice device, VkSwapchainKHR swapchain, uint64_t timeout, VkSemaphore semaphore, VkFence fence, uint32_t* pImageIndex) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR* pPresentInfo) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkGetPhysicalDeviceDisplayPropertiesKHR(VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkDisplayPropertiesKHR* pProperties) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkGetPhysicalDeviceDisplayPlanePropertiesKHR(VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkDisplayPlanePropertiesKHR* pProperties) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkGetDisplayPlaneSupportedDisplaysKHR(VkPhysicalDevice physicalDevice, uint32_t planeIndex, uint32_t* pDisplayCount, VkDisplayKHR* pDisplays) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkGetDisplayModePropertiesKHR(VkPhysicalDevice physicalDevice, VkDisplayKHR display, uint32_t* pPropertyCount, VkDisplayModePropertiesKHR* pProperties) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkCreateDisplayModeKHR(VkPhysicalDevice physicalDevice, VkDisplayKHR display, const VkDisplayModeCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDisplayModeKHR* pMode) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkGetDisplayPlaneCapabilitiesKHR(VkPhysicalDevice physicalDevice, VkDisplayModeKHR mode, uint32_t planeIndex, VkDisplayPlaneCapabilitiesKHR* pCapabilities) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkCreateDisplayPlaneSurfaceKHR(VkInstance instance, const VkDisplaySurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkCreateSharedSwapchainsKHR(VkDevice device, uint32_t swapchainCount, const VkSwapchainCreateInfoKHR* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchains) { return VK_SUCCESS; }
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkCreateXlibSurfaceKHR(VkInstance instance, const VkXlibSurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) { return VK_SUCCESS; }
+static VKAPI_ATTR VkBool32 VKAPI_CALL Noop_vkGetPhysicalDeviceXlibPresentationSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, Display* dpy, VisualID visualID) { return 0; }
+#endif
+#ifdef VK_USE_PLATFORM_XCB_KHR
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkCreateXcbSurfaceKHR(VkInstance instance, const VkXcbSurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) { return VK_SUCCESS; }
+static VKAPI_ATTR VkBool32 VKAPI_CALL Noop_vkGetPhysicalDeviceXcbPresentationSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, xcb_connection_t* connection, xcb_visualid_t visual_id) { return 0; }
+#endif
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkCreateWaylandSurfaceKHR(VkInstance instance, const VkWaylandSurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) { return VK_SUCCESS; }
+static VKAPI_ATTR VkBool32 VKAPI_CALL Noop_vkGetPhysicalDeviceWaylandPresentationSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, struct wl_display* display) { return 0; }
+#endif
+#ifdef VK_USE_PLATFORM_MIR_KHR
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkCreateMirSurfaceKHR(VkInstance instance, const VkMirSurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) { return VK_SUCCESS; }
+static VKAPI_ATTR VkBool32 VKAPI_CALL Noop_vkGetPhysicalDeviceMirPresentationSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, MirConnection* connection) { return 0; }
+#endif
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkCreateAndroidSurfaceKHR(VkInstance instance, const VkAndroidSurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) { return VK_SUCCESS; }
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkCreateWin32SurfaceKHR(VkInstance instance, const VkWin32SurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) { return VK_SUCCESS; }
+static VKAPI_ATTR VkBool32 VKAPI_CALL Noop_vkGetPhysicalDeviceWin32PresentationSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex) { return 0; }
+#endif
+static VKAPI_ATTR void VKAPI_CALL Noop_vkGetPhysicalDeviceFeatures2KHR(VkPhysicalDevice physicalDevice, VkPhysicalDeviceFeatures2KHR* pFeatures) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkGetPhysicalDeviceProperties2KHR(VkPhysicalDevice physicalDevice, VkPhysicalDeviceProperties2KHR* pProperties) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkGetPhysicalDeviceFormatProperties2KHR(VkPhysicalDevice physicalDevice, VkFormat format, VkFormatProperties2KHR* pFormatProperties) {}
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkGetPhysicalDeviceImageFormatProperties2KHR(VkPhysicalDevice physicalDevice, const VkPhysicalDeviceImageFormatInfo2KHR* pImageFormatInfo, VkImageFormatProperties2KHR* pImageFormatProperties) { return VK_SUCCESS; }
+static VKAPI_ATTR void VKAPI_CALL Noop_vkGetPhysicalDeviceQueueFamilyProperties2KHR(VkPhysicalDevice physicalDevice, uint32_t* pQueueFamilyPropertyCount, VkQueueFamilyProperties2KHR* pQueueFamilyProperties) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkGetPhysicalDeviceMemoryProperties2KHR(VkPhysicalDevice physicalDevice, VkPhysicalDeviceMemoryProperties2KHR* pMemoryProperties) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkGetPhysicalDeviceSparseImageFormatProperties2KHR(VkPhysicalDevice physicalDevice, const VkPhysicalDeviceSparseImageFormatInfo2KHR* pFormatInfo, uint32_t* pPropertyCount, VkSparseImageFormatProperties2KHR* pProperties) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkTrimCommandPoolKHR(VkDevice device, VkCommandPool commandPool, VkCommandPoolTrimFlagsKHR flags) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkGetPhysicalDeviceExternalBufferPropertiesKHR(VkPhysicalDevice physicalDevice, const VkPhysicalDeviceExternalBufferInfoKHR* pExternalBufferInfo, VkExternalBufferPropertiesKHR* pExternalBufferProperties) {}
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkGetMemoryWin32HandleKHR(VkDevice device, const VkMemoryGetWin32HandleInfoKHR* pGetWin32HandleInfo, HANDLE* pHandle) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkGetMemoryWin32HandlePropertiesKHR(VkDevice device, VkExternalMemoryHandleTypeFlagBitsKHR handleType, HANDLE handle, VkMemoryWin32HandlePropertiesKHR* pMemoryWin32HandleProperties) { return VK_SUCCESS; }
+#endif
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkGetMemoryFdKHR(VkDevice device, const VkMemoryGetFdInfoKHR* pGetFdInfo, int* pFd) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkGetMemoryFdPropertiesKHR(VkDevice device, VkExternalMemoryHandleTypeFlagBitsKHR handleType, int fd, VkMemoryFdPropertiesKHR* pMemoryFdProperties) { return VK_SUCCESS; }
+static VKAPI_ATTR void VKAPI_CALL Noop_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR(VkPhysicalDevice physicalDevice, const VkPhysicalDeviceExternalSemaphoreInfoKHR* pExternalSemaphoreInfo, VkExternalSemaphorePropertiesKHR* pExternalSemaphoreProperties) {}
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkImportSemaphoreWin32HandleKHR(VkDevice device, const VkImportSemaphoreWin32HandleInfoKHR* pImportSemaphoreWin32HandleInfo) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkGetSemaphoreWin32HandleKHR(VkDevice device, const VkSemaphoreGetWin32HandleInfoKHR* pGetWin32HandleInfo, HANDLE* pHandle) { return VK_SUCCESS; }
+#endif
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkImportSemaphoreFdKHR(VkDevice device, const VkImportSemaphoreFdInfoKHR* pImportSemaphoreFdInfo) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkGetSemaphoreFdKHR(VkDevice device, const VkSemaphoreGetFdInfoKHR* pGetFdInfo, int* pFd) { return VK_SUCCESS; }
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdPushDescriptorSetKHR(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, uint32_t set, uint32_t descriptorWriteCount, const VkWriteDescriptorSet* pDescriptorWrites) {}
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkCreateDescriptorUpdateTemplateKHR(VkDevice device, const VkDescriptorUpdateTemplateCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorUpdateTemplateKHR* pDescriptorUpdateTemplate) { return VK_SUCCESS; }
+static VKAPI_ATTR void VKAPI_CALL Noop_vkDestroyDescriptorUpdateTemplateKHR(VkDevice device, VkDescriptorUpdateTemplateKHR descriptorUpdateTemplate, const VkAllocationCallbacks* pAllocator) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkUpdateDescriptorSetWithTemplateKHR(VkDevice device, VkDescriptorSet descriptorSet, VkDescriptorUpdateTemplateKHR descriptorUpdateTemplate, const void* pData) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdPushDescriptorSetWithTemplateKHR(VkCommandBuffer commandBuffer, VkDescriptorUpdateTemplateKHR descriptorUpdateTemplate, VkPipelineLayout layout, uint32_t set, const void* pData) {}
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkGetSwapchainStatusKHR(VkDevice device, VkSwapchainKHR swapchain) { return VK_SUCCESS; }
+static VKAPI_ATTR void VKAPI_CALL Noop_vkGetPhysicalDeviceExternalFencePropertiesKHR(VkPhysicalDevice physicalDevice, const VkPhysicalDeviceExternalFenceInfoKHR* pExternalFenceInfo, VkExternalFencePropertiesKHR* pExternalFenceProperties) {}
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkImportFenceWin32HandleKHR(VkDevice device, const VkImportFenceWin32HandleInfoKHR* pImportFenceWin32HandleInfo) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkGetFenceWin32HandleKHR(VkDevice device, const VkFenceGetWin32HandleInfoKHR* pGetWin32HandleInfo, HANDLE* pHandle) { return VK_SUCCESS; }
+#endif
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkImportFenceFdKHR(VkDevice device, const VkImportFenceFdInfoKHR* pImportFenceFdInfo) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkGetFenceFdKHR(VkDevice device, const VkFenceGetFdInfoKHR* pGetFdInfo, int* pFd) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkGetPhysicalDeviceSurfaceCapabilities2KHR(VkPhysicalDevice physicalDevice, const VkPhysicalDeviceSurfaceInfo2KHR* pSurfaceInfo, VkSurfaceCapabilities2KHR* pSurfaceCapabilities) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkGetPhysicalDeviceSurfaceFormats2KHR(VkPhysicalDevice physicalDevice, const VkPhysicalDeviceSurfaceInfo2KHR* pSurfaceInfo, uint32_t* pSurfaceFormatCount, VkSurfaceFormat2KHR* pSurfaceFormats) { return VK_SUCCESS; }
+static VKAPI_ATTR void VKAPI_CALL Noop_vkGetImageMemoryRequirements2KHR(VkDevice device, const VkImageMemoryRequirementsInfo2KHR* pInfo, VkMemoryRequirements2KHR* pMemoryRequirements) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkGetBufferMemoryRequirements2KHR(VkDevice device, const VkBufferMemoryRequirementsInfo2KHR* pInfo, VkMemoryRequirements2KHR* pMemoryRequirements) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkGetImageSparseMemoryRequirements2KHR(VkDevice device, const VkImageSparseMemoryRequirementsInfo2KHR* pInfo, uint32_t* pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements2KHR* pSparseMemoryRequirements) {}
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkCreateSamplerYcbcrConversionKHR(VkDevice device, const VkSamplerYcbcrConversionCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSamplerYcbcrConversionKHR* pYcbcrConversion) { return VK_SUCCESS; }
+static VKAPI_ATTR void VKAPI_CALL Noop_vkDestroySamplerYcbcrConversionKHR(VkDevice device, VkSamplerYcbcrConversionKHR ycbcrConversion, const VkAllocationCallbacks* pAllocator) {}
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkBindBufferMemory2KHR(VkDevice device, uint32_t bindInfoCount, const VkBindBufferMemoryInfoKHR* pBindInfos) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkBindImageMemory2KHR(VkDevice device, uint32_t bindInfoCount, const VkBindImageMemoryInfoKHR* pBindInfos) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkCreateDebugReportCallbackEXT(VkInstance instance, const VkDebugReportCallbackCreateInfoEXT* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDebugReportCallbackEXT* pCallback) { return VK_SUCCESS; }
+static VKAPI_ATTR void VKAPI_CALL Noop_vkDestroyDebugReportCallbackEXT(VkInstance instance, VkDebugReportCallbackEXT callback, const VkAllocationCallbacks* pAllocator) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkDebugReportMessageEXT(VkInstance instance, VkDebugReportFlagsEXT flags, VkDebugReportObjectTypeEXT objectType, uint64_t object, size_t location, int32_t messageCode, const char* pLayerPrefix, const char* pMessage) {}
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkDebugMarkerSetObjectTagEXT(VkDevice device, const VkDebugMarkerObjectTagInfoEXT* pTagInfo) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkDebugMarkerSetObjectNameEXT(VkDevice device, const VkDebugMarkerObjectNameInfoEXT* pNameInfo) { return VK_SUCCESS; }
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdDebugMarkerBeginEXT(VkCommandBuffer commandBuffer, const VkDebugMarkerMarkerInfoEXT* pMarkerInfo) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdDebugMarkerEndEXT(VkCommandBuffer commandBuffer) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdDebugMarkerInsertEXT(VkCommandBuffer commandBuffer, const VkDebugMarkerMarkerInfoEXT* pMarkerInfo) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdDrawIndirectCountAMD(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdDrawIndexedIndirectCountAMD(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) {}
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkGetShaderInfoAMD(VkDevice device, VkPipeline pipeline, VkShaderStageFlagBits shaderStage, VkShaderInfoTypeAMD infoType, size_t* pInfoSize, void* pInfo) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkGetPhysicalDeviceExternalImageFormatPropertiesNV(VkPhysicalDevice physicalDevice, VkFormat format, VkImageType type, VkImageTiling tiling, VkImageUsageFlags usage, VkImageCreateFlags flags, VkExternalMemoryHandleTypeFlagsNV externalHandleType, VkExternalImageFormatPropertiesNV* pExternalImageFormatProperties) { return VK_SUCCESS; }
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkGetMemoryWin32HandleNV(VkDevice device, VkDeviceMemory memory, VkExternalMemoryHandleTypeFlagsNV handleType, HANDLE* pHandle) { return VK_SUCCESS; }
+#endif
+static VKAPI_ATTR void VKAPI_CALL Noop_vkGetDeviceGroupPeerMemoryFeaturesKHX(VkDevice device, uint32_t heapIndex, uint32_t localDeviceIndex, uint32_t remoteDeviceIndex, VkPeerMemoryFeatureFlagsKHX* pPeerMemoryFeatures) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdSetDeviceMaskKHX(VkCommandBuffer commandBuffer, uint32_t deviceMask) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdDispatchBaseKHX(VkCommandBuffer commandBuffer, uint32_t baseGroupX, uint32_t baseGroupY, uint32_t baseGroupZ, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) {}
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkGetDeviceGroupPresentCapabilitiesKHX(VkDevice device, VkDeviceGroupPresentCapabilitiesKHX* pDeviceGroupPresentCapabilities) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkGetDeviceGroupSurfacePresentModesKHX(VkDevice device, VkSurfaceKHR surface, VkDeviceGroupPresentModeFlagsKHX* pModes) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkGetPhysicalDevicePresentRectanglesKHX(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, uint32_t* pRectCount, VkRect2D* pRects) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkAcquireNextImage2KHX(VkDevice device, const VkAcquireNextImageInfoKHX* pAcquireInfo, uint32_t* pImageIndex) { return VK_SUCCESS; }
+#ifdef VK_USE_PLATFORM_VI_NN
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkCreateViSurfaceNN(VkInstance instance, const VkViSurfaceCreateInfoNN* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) { return VK_SUCCESS; }
+#endif
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkEnumeratePhysicalDeviceGroupsKHX(VkInstance instance, uint32_t* pPhysicalDeviceGroupCount, VkPhysicalDeviceGroupPropertiesKHX* pPhysicalDeviceGroupProperties) { return VK_SUCCESS; }
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdProcessCommandsNVX(VkCommandBuffer commandBuffer, const VkCmdProcessCommandsInfoNVX* pProcessCommandsInfo) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdReserveSpaceForCommandsNVX(VkCommandBuffer commandBuffer, const VkCmdReserveSpaceForCommandsInfoNVX* pReserveSpaceInfo) {}
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkCreateIndirectCommandsLayoutNVX(VkDevice device, const VkIndirectCommandsLayoutCreateInfoNVX* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkIndirectCommandsLayoutNVX* pIndirectCommandsLayout) { return VK_SUCCESS; }
+static VKAPI_ATTR void VKAPI_CALL Noop_vkDestroyIndirectCommandsLayoutNVX(VkDevice device, VkIndirectCommandsLayoutNVX indirectCommandsLayout, const VkAllocationCallbacks* pAllocator) {}
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkCreateObjectTableNVX(VkDevice device, const VkObjectTableCreateInfoNVX* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkObjectTableNVX* pObjectTable) { return VK_SUCCESS; }
+static VKAPI_ATTR void VKAPI_CALL Noop_vkDestroyObjectTableNVX(VkDevice device, VkObjectTableNVX objectTable, const VkAllocationCallbacks* pAllocator) {}
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkRegisterObjectsNVX(VkDevice device, VkObjectTableNVX objectTable, uint32_t objectCount, const VkObjectTableEntryNVX* const* ppObjectTableEntries, const uint32_t* pObjectIndices) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkUnregisterObjectsNVX(VkDevice device, VkObjectTableNVX objectTable, uint32_t objectCount, const VkObjectEntryTypeNVX* pObjectEntryTypes, const uint32_t* pObjectIndices) { return VK_SUCCESS; }
+static VKAPI_ATTR void VKAPI_CALL Noop_vkGetPhysicalDeviceGeneratedCommandsPropertiesNVX(VkPhysicalDevice physicalDevice, VkDeviceGeneratedCommandsFeaturesNVX* pFeatures, VkDeviceGeneratedCommandsLimitsNVX* pLimits) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdSetViewportWScalingNV(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount, const VkViewportWScalingNV* pViewportWScalings) {}
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkReleaseDisplayEXT(VkPhysicalDevice physicalDevice, VkDisplayKHR display) { return VK_SUCCESS; }
+#ifdef VK_USE_PLATFORM_XLIB_XRANDR_EXT
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkAcquireXlibDisplayEXT(VkPhysicalDevice physicalDevice, Display* dpy, VkDisplayKHR display) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkGetRandROutputDisplayEXT(VkPhysicalDevice physicalDevice, Display* dpy, RROutput rrOutput, VkDisplayKHR* pDisplay) { return VK_SUCCESS; }
+#endif
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkGetPhysicalDeviceSurfaceCapabilities2EXT(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, VkSurfaceCapabilities2EXT* pSurfaceCapabilities) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkDisplayPowerControlEXT(VkDevice device, VkDisplayKHR display, const VkDisplayPowerInfoEXT* pDisplayPowerInfo) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkRegisterDeviceEventEXT(VkDevice device, const VkDeviceEventInfoEXT* pDeviceEventInfo, const VkAllocationCallbacks* pAllocator, VkFence* pFence) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkRegisterDisplayEventEXT(VkDevice device, VkDisplayKHR display, const VkDisplayEventInfoEXT* pDisplayEventInfo, const VkAllocationCallbacks* pAllocator, VkFence* pFence) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkGetSwapchainCounterEXT(VkDevice device, VkSwapchainKHR swapchain, VkSurfaceCounterFlagBitsEXT counter, uint64_t* pCounterValue) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkGetRefreshCycleDurationGOOGLE(VkDevice device, VkSwapchainKHR swapchain, VkRefreshCycleDurationGOOGLE* pDisplayTimingProperties) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkGetPastPresentationTimingGOOGLE(VkDevice device, VkSwapchainKHR swapchain, uint32_t* pPresentationTimingCount, VkPastPresentationTimingGOOGLE* pPresentationTimings) { return VK_SUCCESS; }
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdSetDiscardRectangleEXT(VkCommandBuffer commandBuffer, uint32_t firstDiscardRectangle, uint32_t discardRectangleCount, const VkRect2D* pDiscardRectangles) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkSetHdrMetadataEXT(VkDevice device, uint32_t swapchainCount, const VkSwapchainKHR* pSwapchains, const VkHdrMetadataEXT* pMetadata) {}
+#ifdef VK_USE_PLATFORM_IOS_MVK
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkCreateIOSSurfaceMVK(VkInstance instance, const VkIOSSurfaceCreateInfoMVK* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) { return VK_SUCCESS; }
+#endif
+#ifdef VK_USE_PLATFORM_MACOS_MVK
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkCreateMacOSSurfaceMVK(VkInstance instance, const VkMacOSSurfaceCreateInfoMVK* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) { return VK_SUCCESS; }
+#endif
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdSetSampleLocationsEXT(VkCommandBuffer commandBuffer, const VkSampleLocationsInfoEXT* pSampleLocationsInfo) {}
+static VKAPI_ATTR void VKAPI_CALL Noop_vkGetPhysicalDeviceMultisamplePropertiesEXT(VkPhysicalDevice physicalDevice, VkSampleCountFlagBits samples, VkMultisamplePropertiesEXT* pMultisampleProperties) {}
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkCreateValidationCacheEXT(VkDevice device, const VkValidationCacheCreateInfoEXT* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkValidationCacheEXT* pValidationCache) { return VK_SUCCESS; }
+static VKAPI_ATTR void VKAPI_CALL Noop_vkDestroyValidationCacheEXT(VkDevice device, VkValidationCacheEXT validationCache, const VkAllocationCallbacks* pAllocator) {}
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkMergeValidationCachesEXT(VkDevice device, VkValidationCacheEXT dstCache, uint32_t srcCacheCount, const VkValidationCacheEXT* pSrcCaches) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkGetValidationCacheDataEXT(VkDevice device, VkValidationCacheEXT validationCache, size_t* pDataSize, void* pData) { return VK_SUCCESS; }
+static VKAPI_ATTR VkResult VKAPI_CALL Noop_vkGetMemoryHostPointerPropertiesEXT(VkDevice device, VkExternalMemoryHandleTypeFlagBitsKHR handleType, const void* pHostPointer, VkMemoryHostPointerPropertiesEXT* pMemoryHostPointerProperties) { return VK_SUCCESS; }
+static VKAPI_ATTR void VKAPI_CALL Noop_vkCmdWriteBufferMarkerAMD(VkCommandBuffer commandBuffer, VkPipelineStageFlagBits pipelineStage, VkBuffer dstBuffer, VkDeviceSize dstOffset, uint32_t marker) {}
+
+//-------------------------In-process driver----------------------------
+struct CNamedProc {
+    const char*        name;
+    PFN_vkVoidFunction proc;
+};
+
+static const CNamedProc noop_table[] = {
+    {"vkCreateInstance", (PFN_vkVoidFunction)Noop_vkCreateInstance},
+    {"vkDestroyInstance", (PFN_vkVoidFunction)Noop_vkDestroyInstance},
+    {"vkEnumeratePhysicalDevices", (PFN_vkVoidFunction)Noop_vkEnumeratePhysicalDevices},
+    {"vkGetPhysicalDeviceFeatures", (PFN_vkVoidFunction)Noop_vkGetPhysicalDeviceFeatures},
+    {"vkGetPhysicalDeviceFormatProperties", (PFN_vkVoidFunction)Noop_vkGetPhysicalDeviceFormatProperties},
+    {"vkGetPhysicalDeviceImageFormatProperties", (PFN_vkVoidFunction)Noop_vkGetPhysicalDeviceImageFormatProperties},
+    {"vkGetPhysicalDeviceProperties", (PFN_vkVoidFunction)Noop_vkGetPhysicalDeviceProperties},
+    {"vkGetPhysicalDeviceQueueFamilyProperties", (PFN_vkVoidFunction)Noop_vkGetPhysicalDeviceQueueFamilyProperties},
+    {"vkGetPhysicalDeviceMemoryProperties", (PFN_vkVoidFunction)Noop_vkGetPhysicalDeviceMemoryProperties},
+    {"vkGetInstanceProcAddr", (PFN_vkVoidFunction)Noop_vkGetInstanceProcAddr},
+    {"vkGetDeviceProcAddr", (PFN_vkVoidFunction)Noop_vkGetDeviceProcAddr},
+    {"vkCreateDevice", (PFN_vkVoidFunction)Noop_vkCreateDevice},
+    {"vkDestroyDevice", (PFN_vkVoidFunction)Noop_vkDestroyDevice},
+    {"vkEnumerateInstanceExtensionProperties", (PFN_vkVoidFunction)Noop_vkEnumerateInstanceExtensionProperties},
+    {"vkEnumerateDeviceExtensionProperties", (PFN_vkVoidFunction)Noop_vkEnumerateDeviceExtensionProperties},
+    {"vkEnumerateInstanceLayerProperties", (PFN_vkVoidFunction)Noop_vkEnumerateInstanceLayerProperties},
+    {"vkEnumerateDeviceLayerProperties", (PFN_vkVoidFunction)Noop_vkEnumerateDeviceLayerProperties},
+    {"vkGetDeviceQueue", (PFN_vkVoidFunction)Noop_vkGetDeviceQueue},
+    {"vkQueueSubmit", (PFN_vkVoidFunction)Noop_vkQueueSubmit},
+    {"vkQueueWaitIdle", (PFN_vkVoidFunction)Noop_vkQueueWaitIdle},
+    {"vkDeviceWaitIdle", (PFN_vkVoidFunction)Noop_vkDeviceWaitIdle},
+    {"vkAllocateMemory", (PFN_vkVoidFunction)Noop_vkAllocateMemory},
+    {"vkFreeMemory", (PFN_vkVoidFunction)Noop_vkFreeMemory},
+    {"vkMapMemory", (PFN_vkVoidFunction)Noop_vkMapMemory},
+    {"vkUnmapMemory", (PFN_vkVoidFunction)Noop_vkUnmapMemory},
+    {"vkFlushMappedMemoryRanges", (PFN_vkVoidFunction)Noop_vkFlushMappedMemoryRanges},
+    {"vkInvalidateMappedMemoryRanges", (PFN_vkVoidFunction)Noop_vkInvalidateMappedMemoryRanges},
+    {"vkGetDeviceMemoryCommitment", (PFN_vkVoidFunction)Noop_vkGetDeviceMemoryCommitment},
+    {"vkBindBufferMemory", (PFN_vkVoidFunction)Noop_vkBindBufferMemory},
+    {"vkBindImageMemory", (PFN_vkVoidFunction)Noop_vkBindImageMemory},
+    {"vkGetBufferMemoryRequirements", (PFN_vkVoidFunction)Noop_vkGetBufferMemoryRequirements},
+    {"vkGetImageMemoryRequirements", (PFN_vkVoidFunction)Noop_vkGetImageMemoryRequirements},
+    {"vkGetImageSparseMemoryRequirements", (PFN_vkVoidFunction)Noop_vkGetImageSparseMemoryRequirements},
+    {"vkGetPhysicalDeviceSparseImageFormatProperties", (PFN_vkVoidFunction)Noop_vkGetPhysicalDeviceSparseImageFormatProperties},
+    {"vkQueueBindSparse", (PFN_vkVoidFunction)Noop_vkQueueBindSparse},
+    {"vkCreateFence", (PFN_vkVoidFunction)Noop_vkCreateFence},
+    {"vkDestroyFence", (PFN_vkVoidFunction)Noop_vkDestroyFence},
+    {"vkResetFences", (PFN_vkVoidFunction)Noop_vkResetFences},
+    {"vkGetFenceStatus", (PFN_vkVoidFunction)Noop_vkGetFenceStatus},
+    {"vkWaitForFences", (PFN_vkVoidFunction)Noop_vkWaitForFences},
+    {"vkCreateSemaphore", (PFN_vkVoidFunction)Noop_vkCreateSemaphore},
+    {"vkDestroySemaphore", (PFN_vkVoidFunction)Noop_vkDestroySemaphore},
+    {"vkCreateEvent", (PFN_vkVoidFunction)Noop_vkCreateEvent},
+    {"vkDestroyEvent", (PFN_vkVoidFunction)Noop_vkDestroyEvent},
+    {"vkGetEventStatus", (PFN_vkVoidFunction)Noop_vkGetEventStatus},
+    {"vkSetEvent", (PFN_vkVoidFunction)Noop_vkSetEvent},
+    {"vkResetEvent", (PFN_vkVoidFunction)Noop_vkResetEvent},
+    {"vkCreateQueryPool", (PFN_vkVoidFunction)Noop_vkCreateQueryPool},
+    {"vkDestroyQueryPool", (PFN_vkVoidFunction)Noop_vkDestroyQueryPool},
+    {"vkGetQueryPoolResults", (PFN_vkVoidFunction)Noop_vkGetQueryPoolResults},
+    {"vkCreateBuffer", (PFN_vkVoidFunction)Noop_vkCreateBuffer},
+    {"vkDestroyBuffer", (PFN_vkVoidFunction)Noop_vkDestroyBuffer},
+    {"vkCreateBufferView", (PFN_vkVoidFunction)Noop_vkCreateBufferView},
+    {"vkDestroyBufferView", (PFN_vkVoidFunction)Noop_vkDestroyBufferView},
+    {"vkCreateImage", (PFN_vkVoidFunction)Noop_vkCreateImage},
+    {"vkDestroyImage", (PFN_vkVoidFunction)Noop_vkDestroyImage},
+    {"vkGetImageSubresourceLayout", (PFN_vkVoidFunction)Noop_vkGetImageSubresourceLayout},
+    {"vkCreateImageView", (PFN_vkVoidFunction)Noop_vkCreateImageView},
+    {"vkDestroyImageView", (PFN_vkVoidFunction)Noop_vkDestroyImageView},
+    {"vkCreateShaderModule", (PFN_vkVoidFunction)Noop_vkCreateShaderModule},
+    {"vkDestroyShaderModule", (PFN_vkVoidFunction)Noop_vkDestroyShaderModule},
+    {"vkCreatePipelineCache", (PFN_vkVoidFunction)Noop_vkCreatePipelineCache},
+    {"vkDestroyPipelineCache", (PFN_vkVoidFunction)Noop_vkDestroyPipelineCache},
+    {"vkGetPipelineCacheData", (PFN_vkVoidFunction)Noop_vkGetPipelineCacheData},
+    {"vkMergePipelineCaches", (PFN_vkVoidFunction)Noop_vkMergePipelineCaches},
+    {"vkCreateGraphicsPipelines", (PFN_vkVoidFunction)Noop_vkCreateGraphicsPipelines},
+    {"vkCreateComputePipelines", (PFN_vkVoidFunction)Noop_vkCreateComputePipelines},
+    {"vkDestroyPipeline", (PFN_vkVoidFunction)Noop_vkDestroyPipeline},
+    {"vkCreatePipelineLayout", (PFN_vkVoidFunction)Noop_vkCreatePipelineLayout},
+    {"vkDestroyPipelineLayout", (PFN_vkVoidFunction)Noop_vkDestroyPipelineLayout},
+    {"vkCreateSampler", (PFN_vkVoidFunction)Noop_vkCreateSampler},
+    {"vkDestroySampler", (PFN_vkVoidFunction)Noop_vkDestroySampler},
+    {"vkCreateDescriptorSetLayout", (PFN_vkVoidFunction)Noop_vkCreateDescriptorSetLayout},
+    {"vkDestroyDescriptorSetLayout", (PFN_vkVoidFunction)Noop_vkDestroyDescriptorSetLayout},
+    {"vkCreateDescriptorPool", (PFN_vkVoidFunction)Noop_vkCreateDescriptorPool},
+    {"vkDestroyDescriptorPool", (PFN_vkVoidFunction)Noop_vkDestroyDescriptorPool},
+    {"vkResetDescriptorPool", (PFN_vkVoidFunction)Noop_vkResetDescriptorPool},
+    {"vkAllocateDescriptorSets", (PFN_vkVoidFunction)Noop_vkAllocateDescriptorSets},
+    {"vkFreeDescriptorSets", (PFN_vkVoidFunction)Noop_vkFreeDescriptorSets},
+    {"vkUpdateDescriptorSets", (PFN_vkVoidFunction)Noop_vkUpdateDescriptorSets},
+    {"vkCreateFramebuffer", (PFN_vkVoidFunction)Noop_vkCreateFramebuffer},
+    {"vkDestroyFramebuffer", (PFN_vkVoidFunction)Noop_vkDestroyFramebuffer},
+    {"vkCreateRenderPass", (PFN_vkVoidFunction)Noop_vkCreateRenderPass},
+    {"vkDestroyRenderPass", (PFN_vkVoidFunction)Noop_vkDestroyRenderPass},
+    {"vkGetRenderAreaGranularity", (PFN_vkVoidFunction)Noop_vkGetRenderAreaGranularity},
+    {"vkCreateCommandPool", (PFN_vkVoidFunction)Noop_vkCreateCommandPool},
+    {"vkDestroyCommandPool", (PFN_vkVoidFunction)Noop_vkDestroyCommandPool},
+    {"vkResetCommandPool", (PFN_vkVoidFunction)Noop_vkResetCommandPool},
+    {"vkAllocateCommandBuffers", (PFN_vkVoidFunction)Noop_vkAllocateCommandBuffers},
+    {"vkFreeCommandBuffers", (PFN_vkVoidFunction)Noop_vkFreeCommandBuffers},
+    {"vkBeginCommandBuffer", (PFN_vkVoidFunction)Noop_vkBeginCommandBuffer},
+    {"vkEndCommandBuffer", (PFN_vkVoidFunction)Noop_vkEndCommandBuffer},
+    {"vkResetCommandBuffer", (PFN_vkVoidFunction)Noop_vkResetCommandBuffer},
+    {"vkCmdBindPipeline", (PFN_vkVoidFunction)Noop_vkCmdBindPipeline},
+    {"vkCmdSetViewport", (PFN_vkVoidFunction)Noop_vkCmdSetViewport},
+    {"vkCmdSetScissor", (PFN_vkVoidFunction)Noop_vkCmdSetScissor},
+    {"vkCmdSetLineWidth", (PFN_vkVoidFunction)Noop_vkCmdSetLineWidth},
+    {"vkCmdSetDepthBias", (PFN_vkVoidFunction)Noop_vkCmdSetDepthBias},
+    {"vkCmdSetBlendConstants", (PFN_vkVoidFunction)Noop_vkCmdSetBlendConstants},
+    {"vkCmdSetDepthBounds", (PFN_vkVoidFunction)Noop_vkCmdSetDepthBounds},
+    {"vkCmdSetStencilCompareMask", (PFN_vkVoidFunction)Noop_vkCmdSetStencilCompareMask},
+    {"vkCmdSetStencilWriteMask", (PFN_vkVoidFunction)Noop_vkCmdSetStencilWriteMask},
+    {"vkCmdSetStencilReference", (PFN_vkVoidFunction)Noop_vkCmdSetStencilReference},
+    {"vkCmdBindDescriptorSets", (PFN_vkVoidFunction)Noop_vkCmdBindDescriptorSets},
+    {"vkCmdBindIndexBuffer", (PFN_vkVoidFunction)Noop_vkCmdBindIndexBuffer},
+    {"vkCmdBindVertexBuffers", (PFN_vkVoidFunction)Noop_vkCmdBindVertexBuffers},
+    {"vkCmdDraw", (PFN_vkVoidFunction)Noop_vkCmdDraw},
+    {"vkCmdDrawIndexed", (PFN_vkVoidFunction)Noop_vkCmdDrawIndexed},
+    {"vkCmdDrawIndirect", (PFN_vkVoidFunction)Noop_vkCmdDrawIndirect},
+    {"vkCmdDrawIndexedIndirect", (PFN_vkVoidFunction)Noop_vkCmdDrawIndexedIndirect},
+    {"vkCmdDispatch", (PFN_vkVoidFunction)Noop_vkCmdDispatch},
+    {"vkCmdDispatchIndirect", (PFN_vkVoidFunction)Noop_vkCmdDispatchIndirect},
+    {"vkCmdCopyBuffer", (PFN_vkVoidFunction)Noop_vkCmdCopyBuffer},
+    {"vkCmdCopyImage", (PFN_vkVoidFunction)Noop_vkCmdCopyImage},
+    {"vkCmdBlitImage", (PFN_vkVoidFunction)Noop_vkCmdBlitImage},
+    {"vkCmdCopyBufferToImage", (PFN_vkVoidFunction)Noop_vkCmdCopyBufferToImage},
+    {"vkCmdCopyImageToBuffer", (PFN_vkVoidFunction)Noop_vkCmdCopyImageToBuffer},
+    {"vkCmdUpdateBuffer", (PFN_vkVoidFunction)Noop_vkCmdUpdateBuffer},
+    {"vkCmdFillBuffer", (PFN_vkVoidFunction)Noop_vkCmdFillBuffer},
+    {"vkCmdClearColorImage", (PFN_vkVoidFunction)Noop_vkCmdClearColorImage},
+    {"vkCmdClearDepthStencilImage", (PFN_vkVoidFunction)Noop_vkCmdClearDepthStencilImage},
+    {"vkCmdClearAttachments", (PFN_vkVoidFunction)Noop_vkCmdClearAttachments},
+    {"vkCmdResolveImage", (PFN_vkVoidFunction)Noop_vkCmdResolveImage},
+    {"vkCmdSetEvent", (PFN_vkVoidFunction)Noop_vkCmdSetEvent},
+    {"vkCmdResetEvent", (PFN_vkVoidFunction)Noop_vkCmdResetEvent},
+    {"vkCmdWaitEvents", (PFN_vkVoidFunction)Noop_vkCmdWaitEvents},
+    {"vkCmdPipelineBarrier", (PFN_vkVoidFunction)Noop_vkCmdPipelineBarrier},
+    {"vkCmdBeginQuery", (PFN_vkVoidFunction)Noop_vkCmdBeginQuery},
+    {"vkCmdEndQuery", (PFN_vkVoidFunction)Noop_vkCmdEndQuery},
+    {"vkCmdResetQueryPool", (PFN_vkVoidFunction)Noop_vkCmdResetQueryPool},
+    {"vkCmdWriteTimestamp", (PFN_vkVoidFunction)Noop_vkCmdWriteTimestamp},
+    {"vkCmdCopyQueryPoolResults", (PFN_vkVoidFunction)Noop_vkCmdCopyQueryPoolResults},
+    {"vkCmdPushConstants", (PFN_vkVoidFunction)Noop_vkCmdPushConstants},
+    {"vkCmdBeginRenderPass", (PFN_vkVoidFunction)Noop_vkCmdBeginRenderPass},
+    {"vkCmdNextSubpass", (PFN_vkVoidFunction)Noop_vkCmdNextSubpass},
+    {"vkCmdEndRenderPass", (PFN_vkVoidFunction)Noop_vkCmdEndRenderPass},
+    {"vkCmdExecuteCommands", (PFN_vkVoidFunction)Noop_vkCmdExecuteCommands},
+    {"vkDestroySurfaceKHR", (PFN_vkVoidFunction)Noop_vkDestroySurfaceKHR},
+    {"vkGetPhysicalDeviceSurfaceSupportKHR", (PFN_vkVoidFunction)Noop_vkGetPhysicalDeviceSurfaceSupportKHR},
+    {"vkGetPhysicalDeviceSurfaceCapabilitiesKHR", (PFN_vkVoidFunction)Noop_vkGetPhysicalDeviceSurfaceCapabilitiesKHR},
+    {"vkGetPhysicalDeviceSurfaceFormatsKHR", (PFN_vkVoidFunction)Noop_vkGetPhysicalDeviceSurfaceFormatsKHR},
+    {"vkGetPhysicalDeviceSurfacePresentModesKHR", (PFN_vkVoidFunction)Noop_vkGetPhysicalDeviceSurfacePresentModesKHR},
+    {"vkCreateSwapchainKHR", (PFN_vkVoidFunction)Noop_vkCreateSwapchainKHR},
+    {"vkDestroySwapchainKHR", (PFN_vkVoidFunction)Noop_vkDestroySwapchainKHR},
+    {"vkGetSwapchainImagesKHR", (PFN_vkVoidFunction)Noop_vkGetSwapchainImagesKHR},
+    {"vkAcquireNextImageKHR", (PFN_vkVoidFunction)Noop_vkAcquireNextImageKHR},
+    {"vkQueuePresentKHR", (PFN_vkVoidFunction)Noop_vkQueuePresentKHR},
+    {"vkGetPhysicalDeviceDisplayPropertiesKHR", (PFN_vkVoidFunction)Noop_vkGetPhysicalDeviceDisplayPropertiesKHR},
+    {"vkGetPhysicalDeviceDisplayPlanePropertiesKHR", (PFN_vkVoidFunction)Noop_vkGetPhysicalDeviceDisplayPlanePropertiesKHR},
+    {"vkGetDisplayPlaneSupportedDisplaysKHR", (PFN_vkVoidFunction)Noop_vkGetDisplayPlaneSupportedDisplaysKHR},
+    {"vkGetDisplayModePropertiesKHR", (PFN_vkVoidFunction)Noop_vkGetDisplayModePropertiesKHR},
+    {"vkCreateDisplayModeKHR", (PFN_vkVoidFunction)Noop_vkCreateDisplayModeKHR},
+    {"vkGetDisplayPlaneCapabilitiesKHR", (PFN_vkVoidFunction)Noop_vkGetDisplayPlaneCapabilitiesKHR},
+    {"vkCreateDisplayPlaneSurfaceKHR", (PFN_vkVoidFunction)Noop_vkCreateDisplayPlaneSurfaceKHR},
+    {"vkCreateSharedSwapchainsKHR", (PFN_vkVoidFunction)Noop_vkCreateSharedSwapchainsKHR},
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+    {"vkCreateXlibSurfaceKHR", (PFN_vkVoidFunction)Noop_vkCreateXlibSurfaceKHR},
+    {"vkGetPhysicalDeviceXlibPresentationSupportKHR", (PFN_vkVoidFunction)Noop_vkGetPhysicalDeviceXlibPresentationSupportKHR},
+#endif
+#ifdef VK_USE_PLATFORM_XCB_KHR
+    {"vkCreateXcbSurfaceKHR", (PFN_vkVoidFunction)Noop_vkCreateXcbSurfaceKHR},
+    {"vkGetPhysicalDeviceXcbPresentationSupportKHR", (PFN_vkVoidFunction)Noop_vkGetPhysicalDeviceXcbPresentationSupportKHR},
+#endif
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+    {"vkCreateWaylandSurfaceKHR", (PFN_vkVoidFunction)Noop_vkCreateWaylandSurfaceKHR},
+    {"vkGetPhysicalDeviceWaylandPresentationSupportKHR", (PFN_vkVoidFunction)Noop_vkGetPhysicalDeviceWaylandPresentationSupportKHR},
+#endif
+#ifdef VK_USE_PLATFORM_MIR_KHR
+    {"vkCreateMirSurfaceKHR", (PFN_vkVoidFunction)Noop_vkCreateMirSurfaceKHR},
+    {"vkGetPhysicalDeviceMirPresentationSupportKHR", (PFN_vkVoidFunction)Noop_vkGetPhysicalDeviceMirPresentationSupportKHR},
+#endif
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+    {"vkCreateAndroidSurfaceKHR", (PFN_vkVoidFunction)Noop_vkCreateAndroidSurfaceKHR},
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    {"vkCreateWin32SurfaceKHR", (PFN_vkVoidFunction)Noop_vkCreateWin32SurfaceKHR},
+    {"vkGetPhysicalDeviceWin32PresentationSupportKHR", (PFN_vkVoidFunction)Noop_vkGetPhysicalDeviceWin32PresentationSupportKHR},
+#endif
+    {"vkGetPhysicalDeviceFeatures2KHR", (PFN_vkVoidFunction)Noop_vkGetPhysicalDeviceFeatures2KHR},
+    {"vkGetPhysicalDeviceProperties2KHR", (PFN_vkVoidFunction)Noop_vkGetPhysicalDeviceProperties2KHR},
+    {"vkGetPhysicalDeviceFormatProperties2KHR", (PFN_vkVoidFunction)Noop_vkGetPhysicalDeviceFormatProperties2KHR},
+    {"vkGetPhysicalDeviceImageFormatProperties2KHR", (PFN_vkVoidFunction)Noop_vkGetPhysicalDeviceImageFormatProperties2KHR},
+    {"vkGetPhysicalDeviceQueueFamilyProperties2KHR", (PFN_vkVoidFunction)Noop_vkGetPhysicalDeviceQueueFamilyProperties2KHR},
+    {"vkGetPhysicalDeviceMemoryProperties2KHR", (PFN_vkVoidFunction)Noop_vkGetPhysicalDeviceMemoryProperties2KHR},
+    {"vkGetPhysicalDeviceSparseImageFormatProperties2KHR", (PFN_vkVoidFunction)Noop_vkGetPhysicalDeviceSparseImageFormatProperties2KHR},
+    {"vkTrimCommandPoolKHR", (PFN_vkVoidFunction)Noop_vkTrimCommandPoolKHR},
+    {"vkGetPhysicalDeviceExternalBufferPropertiesKHR", (PFN_vkVoidFunction)Noop_vkGetPhysicalDeviceExternalBufferPropertiesKHR},
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    {"vkGetMemoryWin32HandleKHR", (PFN_vkVoidFunction)Noop_vkGetMemoryWin32HandleKHR},
+    {"vkGetMemoryWin32HandlePropertiesKHR", (PFN_vkVoidFunction)Noop_vkGetMemoryWin32HandlePropertiesKHR},
+#endif
+    {"vkGetMemoryFdKHR", (PFN_vkVoidFunction)Noop_vkGetMemoryFdKHR},
+    {"vkGetMemoryFdPropertiesKHR", (PFN_vkVoidFunction)Noop_vkGetMemoryFdPropertiesKHR},
+    {"vkGetPhysicalDeviceExternalSemaphorePropertiesKHR", (PFN_vkVoidFunction)Noop_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR},
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    {"vkImportSemaphoreWin32HandleKHR", (PFN_vkVoidFunction)Noop_vkImportSemaphoreWin32HandleKHR},
+    {"vkGetSemaphoreWin32HandleKHR", (PFN_vkVoidFunction)Noop_vkGetSemaphoreWin32HandleKHR},
+#endif
+    {"vkImportSemaphoreFdKHR", (PFN_vkVoidFunction)Noop_vkImportSemaphoreFdKHR},
+    {"vkGetSemaphoreFdKHR", (PFN_vkVoidFunction)Noop_vkGetSemaphoreFdKHR},
+    {"vkCmdPushDescriptorSetKHR", (PFN_vkVoidFunction)Noop_vkCmdPushDescriptorSetKHR},
+    {"vkCreateDescriptorUpdateTemplateKHR", (PFN_vkVoidFunction)Noop_vkCreateDescriptorUpdateTemplateKHR},
+    {"vkDestroyDescriptorUpdateTemplateKHR", (PFN_vkVoidFunction)Noop_vkDestroyDescriptorUpdateTemplateKHR},
+    {"vkUpdateDescriptorSetWithTemplateKHR", (PFN_vkVoidFunction)Noop_vkUpdateDescriptorSetWithTemplateKHR},
+    {"vkCmdPushDescriptorSetWithTemplateKHR", (PFN_vkVoidFunction)Noop_vkCmdPushDescriptorSetWithTemplateKHR},
+    {"vkGetSwapchainStatusKHR", (PFN_vkVoidFunction)Noop_vkGetSwapchainStatusKHR},
+    {"vkGetPhysicalDeviceExternalFencePropertiesKHR", (PFN_vkVoidFunction)Noop_vkGetPhysicalDeviceExternalFencePropertiesKHR},
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    {"vkImportFenceWin32HandleKHR", (PFN_vkVoidFunction)Noop_vkImportFenceWin32HandleKHR},
+    {"vkGetFenceWin32HandleKHR", (PFN_vkVoidFunction)Noop_vkGetFenceWin32HandleKHR},
+#endif
+    {"vkImportFenceFdKHR", (PFN_vkVoidFunction)Noop_vkImportFenceFdKHR},
+    {"vkGetFenceFdKHR", (PFN_vkVoidFunction)Noop_vkGetFenceFdKHR},
+    {"vkGetPhysicalDeviceSurfaceCapabilities2KHR", (PFN_vkVoidFunction)Noop_vkGetPhysicalDeviceSurfaceCapabilities2KHR},
+    {"vkGetPhysicalDeviceSurfaceFormats2KHR", (PFN_vkVoidFunction)Noop_vkGetPhysicalDeviceSurfaceFormats2KHR},
+    {"vkGetImageMemoryRequirements2KHR", (PFN_vkVoidFunction)Noop_vkGetImageMemoryRequirements2KHR},
+    {"vkGetBufferMemoryRequirements2KHR", (PFN_vkVoidFunction)Noop_vkGetBufferMemoryRequirements2KHR},
+    {"vkGetImageSparseMemoryRequirements2KHR", (PFN_vkVoidFunction)Noop_vkGetImageSparseMemoryRequirements2KHR},
+    {"vkCreateSamplerYcbcrConversionKHR", (PFN_vkVoidFunction)Noop_vkCreateSamplerYcbcrConversionKHR},
+    {"vkDestroySamplerYcbcrConversionKHR", (PFN_vkVoidFunction)Noop_vkDestroySamplerYcbcrConversionKHR},
+    {"vkBindBufferMemory2KHR", (PFN_vkVoidFunction)Noop_vkBindBufferMemory2KHR},
+    {"vkBindImageMemory2KHR", (PFN_vkVoidFunction)Noop_vkBindImageMemory2KHR},
+    {"vkCreateDebugReportCallbackEXT", (PFN_vkVoidFunction)Noop_vkCreateDebugReportCallbackEXT},
+    {"vkDestroyDebugReportCallbackEXT", (PFN_vkVoidFunction)Noop_vkDestroyDebugReportCallbackEXT},
+    {"vkDebugReportMessageEXT", (PFN_vkVoidFunction)Noop_vkDebugReportMessageEXT},
+    {"vkDebugMarkerSetObjectTagEXT", (PFN_vkVoidFunction)Noop_vkDebugMarkerSetObjectTagEXT},
+    {"vkDebugMarkerSetObjectNameEXT", (PFN_vkVoidFunction)Noop_vkDebugMarkerSetObjectNameEXT},
+    {"vkCmdDebugMarkerBeginEXT", (PFN_vkVoidFunction)Noop_vkCmdDebugMarkerBeginEXT},
+    {"vkCmdDebugMarkerEndEXT", (PFN_vkVoidFunction)Noop_vkCmdDebugMarkerEndEXT},
+    {"vkCmdDebugMarkerInsertEXT", (PFN_vkVoidFunction)Noop_vkCmdDebugMarkerInsertEXT},
+    {"vkCmdDrawIndirectCountAMD", (PFN_vkVoidFunction)Noop_vkCmdDrawIndirectCountAMD},
+    {"vkCmdDrawIndexedIndirectCountAMD", (PFN_vkVoidFunction)Noop_vkCmdDrawIndexedIndirectCountAMD},
+    {"vkGetShaderInfoAMD", (PFN_vkVoidFunction)Noop_vkGetShaderInfoAMD},
+    {"vkGetPhysicalDeviceExternalImageFormatPropertiesNV", (PFN_vkVoidFunction)Noop_vkGetPhysicalDeviceExternalImageFormatPropertiesNV},
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    {"vkGetMemoryWin32HandleNV", (PFN_vkVoidFunction)Noop_vkGetMemoryWin32HandleNV},
+#endif
+    {"vkGetDeviceGroupPeerMemoryFeaturesKHX", (PFN_vkVoidFunction)Noop_vkGetDeviceGroupPeerMemoryFeaturesKHX},
+    {"vkCmdSetDeviceMaskKHX", (PFN_vkVoidFunction)Noop_vkCmdSetDeviceMaskKHX},
+    {"vkCmdDispatchBaseKHX", (PFN_vkVoidFunction)Noop_vkCmdDispatchBaseKHX},
+    {"vkGetDeviceGroupPresentCapabilitiesKHX", (PFN_vkVoidFunction)Noop_vkGetDeviceGroupPresentCapabilitiesKHX},
+    {"vkGetDeviceGroupSurfacePresentModesKHX", (PFN_vkVoidFunction)Noop_vkGetDeviceGroupSurfacePresentModesKHX},
+    {"vkGetPhysicalDevicePresentRectanglesKHX", (PFN_vkVoidFunction)Noop_vkGetPhysicalDevicePresentRectanglesKHX},
+    {"vkAcquireNextImage2KHX", (PFN_vkVoidFunction)Noop_vkAcquireNextImage2KHX},
+#ifdef VK_USE_PLATFORM_VI_NN
+    {"vkCreateViSurfaceNN", (PFN_vkVoidFunction)Noop_vkCreateViSurfaceNN},
+#endif
+    {"vkEnumeratePhysicalDeviceGroupsKHX", (PFN_vkVoidFunction)Noop_vkEnumeratePhysicalDeviceGroupsKHX},
+    {"vkCmdProcessCommandsNVX", (PFN_vkVoidFunction)Noop_vkCmdProcessCommandsNVX},
+    {"vkCmdReserveSpaceForCommandsNVX", (PFN_vkVoidFunction)Noop_vkCmdReserveSpaceForCommandsNVX},
+    {"vkCreateIndirectCommandsLayoutNVX", (PFN_vkVoidFunction)Noop_vkCreateIndirectCommandsLayoutNVX},
+    {"vkDestroyIndirectCommandsLayoutNVX", (PFN_vkVoidFunction)Noop_vkDestroyIndirectCommandsLayoutNVX},
+    {"vkCreateObjectTableNVX", (PFN_vkVoidFunction)Noop_vkCreateObjectTableNVX},
+    {"vkDestroyObjectTableNVX", (PFN_vkVoidFunction)Noop_vkDestroyObjectTableNVX},
+    {"vkRegisterObjectsNVX", (PFN_vkVoidFunction)Noop_vkRegisterObjectsNVX},
+    {"vkUnregisterObjectsNVX", (PFN_vkVoidFunction)Noop_vkUnregisterObjectsNVX},
+    {"vkGetPhysicalDeviceGeneratedCommandsPropertiesNVX", (PFN_vkVoidFunction)Noop_vkGetPhysicalDeviceGeneratedCommandsPropertiesNVX},
+    {"vkCmdSetViewportWScalingNV", (PFN_vkVoidFunction)Noop_vkCmdSetViewportWScalingNV},
+    {"vkReleaseDisplayEXT", (PFN_vkVoidFunction)Noop_vkReleaseDisplayEXT},
+#ifdef VK_USE_PLATFORM_XLIB_XRANDR_EXT
+    {"vkAcquireXlibDisplayEXT", (PFN_vkVoidFunction)Noop_vkAcquireXlibDisplayEXT},
+    {"vkGetRandROutputDisplayEXT", (PFN_vkVoidFunction)Noop_vkGetRandROutputDisplayEXT},
+#endif
+    {"vkGetPhysicalDeviceSurfaceCapabilities2EXT", (PFN_vkVoidFunction)Noop_vkGetPhysicalDeviceSurfaceCapabilities2EXT},
+    {"vkDisplayPowerControlEXT", (PFN_vkVoidFunction)Noop_vkDisplayPowerControlEXT},
+    {"vkRegisterDeviceEventEXT", (PFN_vkVoidFunction)Noop_vkRegisterDeviceEventEXT},
+    {"vkRegisterDisplayEventEXT", (PFN_vkVoidFunction)Noop_vkRegisterDisplayEventEXT},
+    {"vkGetSwapchainCounterEXT", (PFN_vkVoidFunction)Noop_vkGetSwapchainCounterEXT},
+    {"vkGetRefreshCycleDurationGOOGLE", (PFN_vkVoidFunction)Noop_vkGetRefreshCycleDurationGOOGLE},
+    {"vkGetPastPresentationTimingGOOGLE", (PFN_vkVoidFunction)Noop_vkGetPastPresentationTimingGOOGLE},
+    {"vkCmdSetDiscardRectangleEXT", (PFN_vkVoidFunction)Noop_vkCmdSetDiscardRectangleEXT},
+    {"vkSetHdrMetadataEXT", (PFN_vkVoidFunction)Noop_vkSetHdrMetadataEXT},
+#ifdef VK_USE_PLATFORM_IOS_MVK
+    {"vkCreateIOSSurfaceMVK", (PFN_vkVoidFunction)Noop_vkCreateIOSSurfaceMVK},
+#endif
+#ifdef VK_USE_PLATFORM_MACOS_MVK
+    {"vkCreateMacOSSurfaceMVK", (PFN_vkVoidFunction)Noop_vkCreateMacOSSurfaceMVK},
+#endif
+    {"vkCmdSetSampleLocationsEXT", (PFN_vkVoidFunction)Noop_vkCmdSetSampleLocationsEXT},
+    {"vkGetPhysicalDeviceMultisamplePropertiesEXT", (PFN_vkVoidFunction)Noop_vkGetPhysicalDeviceMultisamplePropertiesEXT},
+    {"vkCreateValidationCacheEXT", (PFN_vkVoidFunction)Noop_vkCreateValidationCacheEXT},
+    {"vkDestroyValidationCacheEXT", (PFN_vkVoidFunction)Noop_vkDestroyValidationCacheEXT},
+    {"vkMergeValidationCachesEXT", (PFN_vkVoidFunction)Noop_vkMergeValidationCachesEXT},
+    {"vkGetValidationCacheDataEXT", (PFN_vkVoidFunction)Noop_vkGetValidationCacheDataEXT},
+    {"vkGetMemoryHostPointerPropertiesEXT", (PFN_vkVoidFunction)Noop_vkGetMemoryHostPointerPropertiesEXT},
+    {"vkCmdWriteBufferMarkerAMD", (PFN_vkVoidFunction)Noop_vkCmdWriteBufferMarkerAMD},
+};
+
+static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL DriverGetInstanceProcAddr(VkInstance instance, const char* name) { return DriverProc(name); }
+static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL DriverGetDeviceProcAddr(VkDevice device, const char* name) { return DriverProc(name); }
+
+// The driver's own function, else a no-op. The wrapper answers the GetProcAddr functions itself,
+// so functions looked up through them also fall back to no-ops.
+static PFN_vkVoidFunction DriverProc(const char* name) {
+    if (!strcmp(name, "vkGetInstanceProcAddr")) return (PFN_vkVoidFunction)DriverGetInstanceProcAddr;
+    if (!strcmp(name, "vkGetDeviceProcAddr"))   return (PFN_vkVoidFunction)DriverGetDeviceProcAddr;
+    PFN_vkVoidFunction fn = driver_gipa(VK_NULL_HANDLE, name);
+    for (size_t i = 0; !fn && i < sizeof(noop_table) / sizeof(noop_table[0]); ++i)
+        if (!strcmp(name, noop_table[i].name)) fn = noop_table[i].proc;
+    return fn;
+}
+
+//-----------------------------Trace thunks-----------------------------
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkCreateInstance(const VkInstanceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkInstance* pInstance) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateInstance)traced_procs[0])(pCreateInfo, pAllocator, pInstance);
+    TraceCall(0, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkDestroyInstance(VkInstance instance, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDestroyInstance)traced_procs[1])(instance, pAllocator);
+    TraceCall(1, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkEnumeratePhysicalDevices(VkInstance instance, uint32_t* pPhysicalDeviceCount, VkPhysicalDevice* pPhysicalDevices) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkEnumeratePhysicalDevices)traced_procs[2])(instance, pPhysicalDeviceCount, pPhysicalDevices);
+    TraceCall(2, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkGetPhysicalDeviceFeatures(VkPhysicalDevice physicalDevice, VkPhysicalDeviceFeatures* pFeatures) {
+    uint64_t start = TraceTime();
+    ((PFN_vkGetPhysicalDeviceFeatures)traced_procs[3])(physicalDevice, pFeatures);
+    TraceCall(3, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkGetPhysicalDeviceFormatProperties(VkPhysicalDevice physicalDevice, VkFormat format, VkFormatProperties* pFormatProperties) {
+    uint64_t start = TraceTime();
+    ((PFN_vkGetPhysicalDeviceFormatProperties)traced_procs[4])(physicalDevice, format, pFormatProperties);
+    TraceCall(4, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkGetPhysicalDeviceImageFormatProperties(VkPhysicalDevice physicalDevice, VkFormat format, VkImageType type, VkImageTiling tiling, VkImageUsageFlags usage, VkImageCreateFlags flags, VkImageFormatProperties* pImageFormatProperties) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetPhysicalDeviceImageFormatProperties)traced_procs[5])(physicalDevice, format, type, tiling, usage, flags, pImageFormatProperties);
+    TraceCall(5, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkGetPhysicalDeviceProperties(VkPhysicalDevice physicalDevice, VkPhysicalDeviceProperties* pProperties) {
+    uint64_t start = TraceTime();
+    ((PFN_vkGetPhysicalDeviceProperties)traced_procs[6])(physicalDevice, pProperties);
+    TraceCall(6, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkGetPhysicalDeviceQueueFamilyProperties(VkPhysicalDevice physicalDevice, uint32_t* pQueueFamilyPropertyCount, VkQueueFamilyProperties* pQueueFamilyProperties) {
+    uint64_t start = TraceTime();
+    ((PFN_vkGetPhysicalDeviceQueueFamilyProperties)traced_procs[7])(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
+    TraceCall(7, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkGetPhysicalDeviceMemoryProperties(VkPhysicalDevice physicalDevice, VkPhysicalDeviceMemoryProperties* pMemoryProperties) {
+    uint64_t start = TraceTime();
+    ((PFN_vkGetPhysicalDeviceMemoryProperties)traced_procs[8])(physicalDevice, pMemoryProperties);
+    TraceCall(8, start);
+}
+static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL Trace_vkGetInstanceProcAddr(VkInstance instance, const char* pName) {
+    uint64_t start = TraceTime();
+    PFN_vkVoidFunction result = ((PFN_vkGetInstanceProcAddr)traced_procs[9])(instance, pName);
+    TraceCall(9, start);
+    return result;
+}
+static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL Trace_vkGetDeviceProcAddr(VkDevice device, const char* pName) {
+    uint64_t start = TraceTime();
+    PFN_vkVoidFunction result = ((PFN_vkGetDeviceProcAddr)traced_procs[10])(device, pName);
+    TraceCall(10, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkCreateDevice(VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDevice* pDevice) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateDevice)traced_procs[11])(physicalDevice, pCreateInfo, pAllocator, pDevice);
+    TraceCall(11, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkDestroyDevice(VkDevice device, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDestroyDevice)traced_procs[12])(device, pAllocator);
+    TraceCall(12, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkEnumerateInstanceExtensionProperties(const char* pLayerName, uint32_t* pPropertyCount, VkExtensionProperties* pProperties) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkEnumerateInstanceExtensionProperties)traced_procs[13])(pLayerName, pPropertyCount, pProperties);
+    TraceCall(13, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkEnumerateDeviceExtensionProperties(VkPhysicalDevice physicalDevice, const char* pLayerName, uint32_t* pPropertyCount, VkExtensionProperties* pProperties) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkEnumerateDeviceExtensionProperties)traced_procs[14])(physicalDevice, pLayerName, pPropertyCount, pProperties);
+    TraceCall(14, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkEnumerateInstanceLayerProperties(uint32_t* pPropertyCount, VkLayerProperties* pProperties) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkEnumerateInstanceLayerProperties)traced_procs[15])(pPropertyCount, pProperties);
+    TraceCall(15, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkEnumerateDeviceLayerProperties(VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkLayerProperties* pProperties) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkEnumerateDeviceLayerProperties)traced_procs[16])(physicalDevice, pPropertyCount, pProperties);
+    TraceCall(16, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkGetDeviceQueue(VkDevice device, uint32_t queueFamilyIndex, uint32_t queueIndex, VkQueue* pQueue) {
+    uint64_t start = TraceTime();
+    ((PFN_vkGetDeviceQueue)traced_procs[17])(device, queueFamilyIndex, queueIndex, pQueue);
+    TraceCall(17, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkQueueSubmit)traced_procs[18])(queue, submitCount, pSubmits, fence);
+    TraceCall(18, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkQueueWaitIdle(VkQueue queue) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkQueueWaitIdle)traced_procs[19])(queue);
+    TraceCall(19, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkDeviceWaitIdle(VkDevice device) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkDeviceWaitIdle)traced_procs[20])(device);
+    TraceCall(20, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkAllocateMemory(VkDevice device, const VkMemoryAllocateInfo* pAllocateInfo, const VkAllocationCallbacks* pAllocator, VkDeviceMemory* pMemory) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkAllocateMemory)traced_procs[21])(device, pAllocateInfo, pAllocator, pMemory);
+    TraceCall(21, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkFreeMemory(VkDevice device, VkDeviceMemory memory, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkFreeMemory)traced_procs[22])(device, memory, pAllocator);
+    TraceCall(22, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkMapMemory(VkDevice device, VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize size, VkMemoryMapFlags flags, void** ppData) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkMapMemory)traced_procs[23])(device, memory, offset, size, flags, ppData);
+    TraceCall(23, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkUnmapMemory(VkDevice device, VkDeviceMemory memory) {
+    uint64_t start = TraceTime();
+    ((PFN_vkUnmapMemory)traced_procs[24])(device, memory);
+    TraceCall(24, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkFlushMappedMemoryRanges(VkDevice device, uint32_t memoryRangeCount, const VkMappedMemoryRange* pMemoryRanges) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkFlushMappedMemoryRanges)traced_procs[25])(device, memoryRangeCount, pMemoryRanges);
+    TraceCall(25, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkInvalidateMappedMemoryRanges(VkDevice device, uint32_t memoryRangeCount, const VkMappedMemoryRange* pMemoryRanges) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkInvalidateMappedMemoryRanges)traced_procs[26])(device, memoryRangeCount, pMemoryRanges);
+    TraceCall(26, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkGetDeviceMemoryCommitment(VkDevice device, VkDeviceMemory memory, VkDeviceSize* pCommittedMemoryInBytes) {
+    uint64_t start = TraceTime();
+    ((PFN_vkGetDeviceMemoryCommitment)traced_procs[27])(device, memory, pCommittedMemoryInBytes);
+    TraceCall(27, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkBindBufferMemory(VkDevice device, VkBuffer buffer, VkDeviceMemory memory, VkDeviceSize memoryOffset) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkBindBufferMemory)traced_procs[28])(device, buffer, memory, memoryOffset);
+    TraceCall(28, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkBindImageMemory(VkDevice device, VkImage image, VkDeviceMemory memory, VkDeviceSize memoryOffset) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkBindImageMemory)traced_procs[29])(device, image, memory, memoryOffset);
+    TraceCall(29, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkGetBufferMemoryRequirements(VkDevice device, VkBuffer buffer, VkMemoryRequirements* pMemoryRequirements) {
+    uint64_t start = TraceTime();
+    ((PFN_vkGetBufferMemoryRequirements)traced_procs[30])(device, buffer, pMemoryRequirements);
+    TraceCall(30, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkGetImageMemoryRequirements(VkDevice device, VkImage image, VkMemoryRequirements* pMemoryRequirements) {
+    uint64_t start = TraceTime();
+    ((PFN_vkGetImageMemoryRequirements)traced_procs[31])(device, image, pMemoryRequirements);
+    TraceCall(31, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkGetImageSparseMemoryRequirements(VkDevice device, VkImage image, uint32_t* pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements* pSparseMemoryRequirements) {
+    uint64_t start = TraceTime();
+    ((PFN_vkGetImageSparseMemoryRequirements)traced_procs[32])(device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+    TraceCall(32, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkGetPhysicalDeviceSparseImageFormatProperties(VkPhysicalDevice physicalDevice, VkFormat format, VkImageType type, VkSampleCountFlagBits samples, VkImageUsageFlags usage, VkImageTiling tiling, uint32_t* pPropertyCount, VkSparseImageFormatProperties* pProperties) {
+    uint64_t start = TraceTime();
+    ((PFN_vkGetPhysicalDeviceSparseImageFormatProperties)traced_procs[33])(physicalDevice, format, type, samples, usage, tiling, pPropertyCount, pProperties);
+    TraceCall(33, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkQueueBindSparse(VkQueue queue, uint32_t bindInfoCount, const VkBindSparseInfo* pBindInfo, VkFence fence) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkQueueBindSparse)traced_procs[34])(queue, bindInfoCount, pBindInfo, fence);
+    TraceCall(34, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkCreateFence(VkDevice device, const VkFenceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkFence* pFence) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateFence)traced_procs[35])(device, pCreateInfo, pAllocator, pFence);
+    TraceCall(35, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkDestroyFence(VkDevice device, VkFence fence, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDestroyFence)traced_procs[36])(device, fence, pAllocator);
+    TraceCall(36, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkResetFences(VkDevice device, uint32_t fenceCount, const VkFence* pFences) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkResetFences)traced_procs[37])(device, fenceCount, pFences);
+    TraceCall(37, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkGetFenceStatus(VkDevice device, VkFence fence) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetFenceStatus)traced_procs[38])(device, fence);
+    TraceCall(38, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkWaitForFences(VkDevice device, uint32_t fenceCount, const VkFence* pFences, VkBool32 waitAll, uint64_t timeout) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkWaitForFences)traced_procs[39])(device, fenceCount, pFences, waitAll, timeout);
+    TraceCall(39, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkCreateSemaphore(VkDevice device, const VkSemaphoreCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSemaphore* pSemaphore) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateSemaphore)traced_procs[40])(device, pCreateInfo, pAllocator, pSemaphore);
+    TraceCall(40, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkDestroySemaphore(VkDevice device, VkSemaphore semaphore, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDestroySemaphore)traced_procs[41])(device, semaphore, pAllocator);
+    TraceCall(41, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkCreateEvent(VkDevice device, const VkEventCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkEvent* pEvent) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateEvent)traced_procs[42])(device, pCreateInfo, pAllocator, pEvent);
+    TraceCall(42, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkDestroyEvent(VkDevice device, VkEvent event, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDestroyEvent)traced_procs[43])(device, event, pAllocator);
+    TraceCall(43, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkGetEventStatus(VkDevice device, VkEvent event) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetEventStatus)traced_procs[44])(device, event);
+    TraceCall(44, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkSetEvent(VkDevice device, VkEvent event) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkSetEvent)traced_procs[45])(device, event);
+    TraceCall(45, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkResetEvent(VkDevice device, VkEvent event) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkResetEvent)traced_procs[46])(device, event);
+    TraceCall(46, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkCreateQueryPool(VkDevice device, const VkQueryPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkQueryPool* pQueryPool) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateQueryPool)traced_procs[47])(device, pCreateInfo, pAllocator, pQueryPool);
+    TraceCall(47, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkDestroyQueryPool(VkDevice device, VkQueryPool queryPool, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDestroyQueryPool)traced_procs[48])(device, queryPool, pAllocator);
+    TraceCall(48, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkGetQueryPoolResults(VkDevice device, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, size_t dataSize, void* pData, VkDeviceSize stride, VkQueryResultFlags flags) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetQueryPoolResults)traced_procs[49])(device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags);
+    TraceCall(49, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkCreateBuffer(VkDevice device, const VkBufferCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkBuffer* pBuffer) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateBuffer)traced_procs[50])(device, pCreateInfo, pAllocator, pBuffer);
+    TraceCall(50, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkDestroyBuffer(VkDevice device, VkBuffer buffer, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDestroyBuffer)traced_procs[51])(device, buffer, pAllocator);
+    TraceCall(51, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkCreateBufferView(VkDevice device, const VkBufferViewCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkBufferView* pView) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateBufferView)traced_procs[52])(device, pCreateInfo, pAllocator, pView);
+    TraceCall(52, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkDestroyBufferView(VkDevice device, VkBufferView bufferView, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDestroyBufferView)traced_procs[53])(device, bufferView, pAllocator);
+    TraceCall(53, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkCreateImage(VkDevice device, const VkImageCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkImage* pImage) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateImage)traced_procs[54])(device, pCreateInfo, pAllocator, pImage);
+    TraceCall(54, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkDestroyImage(VkDevice device, VkImage image, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDestroyImage)traced_procs[55])(device, image, pAllocator);
+    TraceCall(55, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkGetImageSubresourceLayout(VkDevice device, VkImage image, const VkImageSubresource* pSubresource, VkSubresourceLayout* pLayout) {
+    uint64_t start = TraceTime();
+    ((PFN_vkGetImageSubresourceLayout)traced_procs[56])(device, image, pSubresource, pLayout);
+    TraceCall(56, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkCreateImageView(VkDevice device, const VkImageViewCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkImageView* pView) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateImageView)traced_procs[57])(device, pCreateInfo, pAllocator, pView);
+    TraceCall(57, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkDestroyImageView(VkDevice device, VkImageView imageView, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDestroyImageView)traced_procs[58])(device, imageView, pAllocator);
+    TraceCall(58, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateShaderModule)traced_procs[59])(device, pCreateInfo, pAllocator, pShaderModule);
+    TraceCall(59, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkDestroyShaderModule(VkDevice device, VkShaderModule shaderModule, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDestroyShaderModule)traced_procs[60])(device, shaderModule, pAllocator);
+    TraceCall(60, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkCreatePipelineCache(VkDevice device, const VkPipelineCacheCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkPipelineCache* pPipelineCache) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreatePipelineCache)traced_procs[61])(device, pCreateInfo, pAllocator, pPipelineCache);
+    TraceCall(61, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkDestroyPipelineCache(VkDevice device, VkPipelineCache pipelineCache, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDestroyPipelineCache)traced_procs[62])(device, pipelineCache, pAllocator);
+    TraceCall(62, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkGetPipelineCacheData(VkDevice device, VkPipelineCache pipelineCache, size_t* pDataSize, void* pData) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetPipelineCacheData)traced_procs[63])(device, pipelineCache, pDataSize, pData);
+    TraceCall(63, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkMergePipelineCaches(VkDevice device, VkPipelineCache dstCache, uint32_t srcCacheCount, const VkPipelineCache* pSrcCaches) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkMergePipelineCaches)traced_procs[64])(device, dstCache, srcCacheCount, pSrcCaches);
+    TraceCall(64, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkGraphicsPipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateGraphicsPipelines)traced_procs[65])(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+    TraceCall(65, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkCreateComputePipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkComputePipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateComputePipelines)traced_procs[66])(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+    TraceCall(66, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkDestroyPipeline(VkDevice device, VkPipeline pipeline, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDestroyPipeline)traced_procs[67])(device, pipeline, pAllocator);
+    TraceCall(67, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkCreatePipelineLayout(VkDevice device, const VkPipelineLayoutCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkPipelineLayout* pPipelineLayout) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreatePipelineLayout)traced_procs[68])(device, pCreateInfo, pAllocator, pPipelineLayout);
+    TraceCall(68, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkDestroyPipelineLayout(VkDevice device, VkPipelineLayout pipelineLayout, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDestroyPipelineLayout)traced_procs[69])(device, pipelineLayout, pAllocator);
+    TraceCall(69, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkCreateSampler(VkDevice device, const VkSamplerCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSampler* pSampler) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateSampler)traced_procs[70])(device, pCreateInfo, pAllocator, pSampler);
+    TraceCall(70, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkDestroySampler(VkDevice device, VkSampler sampler, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDestroySampler)traced_procs[71])(device, sampler, pAllocator);
+    TraceCall(71, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkCreateDescriptorSetLayout(VkDevice device, const VkDescriptorSetLayoutCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorSetLayout* pSetLayout) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateDescriptorSetLayout)traced_procs[72])(device, pCreateInfo, pAllocator, pSetLayout);
+    TraceCall(72, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkDestroyDescriptorSetLayout(VkDevice device, VkDescriptorSetLayout descriptorSetLayout, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDestroyDescriptorSetLayout)traced_procs[73])(device, descriptorSetLayout, pAllocator);
+    TraceCall(73, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkCreateDescriptorPool(VkDevice device, const VkDescriptorPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorPool* pDescriptorPool) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateDescriptorPool)traced_procs[74])(device, pCreateInfo, pAllocator, pDescriptorPool);
+    TraceCall(74, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkDestroyDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDestroyDescriptorPool)traced_procs[75])(device, descriptorPool, pAllocator);
+    TraceCall(75, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkResetDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool, VkDescriptorPoolResetFlags flags) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkResetDescriptorPool)traced_procs[76])(device, descriptorPool, flags);
+    TraceCall(76, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkAllocateDescriptorSets(VkDevice device, const VkDescriptorSetAllocateInfo* pAllocateInfo, VkDescriptorSet* pDescriptorSets) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkAllocateDescriptorSets)traced_procs[77])(device, pAllocateInfo, pDescriptorSets);
+    TraceCall(77, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkFreeDescriptorSets(VkDevice device, VkDescriptorPool descriptorPool, uint32_t descriptorSetCount, const VkDescriptorSet* pDescriptorSets) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkFreeDescriptorSets)traced_procs[78])(device, descriptorPool, descriptorSetCount, pDescriptorSets);
+    TraceCall(78, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkUpdateDescriptorSets(VkDevice device, uint32_t descriptorWriteCount, const VkWriteDescriptorSet* pDescriptorWrites, uint32_t descriptorCopyCount, const VkCopyDescriptorSet* pDescriptorCopies) {
+    uint64_t start = TraceTime();
+    ((PFN_vkUpdateDescriptorSets)traced_procs[79])(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
+    TraceCall(79, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkCreateFramebuffer(VkDevice device, const VkFramebufferCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkFramebuffer* pFramebuffer) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateFramebuffer)traced_procs[80])(device, pCreateInfo, pAllocator, pFramebuffer);
+    TraceCall(80, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkDestroyFramebuffer(VkDevice device, VkFramebuffer framebuffer, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDestroyFramebuffer)traced_procs[81])(device, framebuffer, pAllocator);
+    TraceCall(81, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkCreateRenderPass(VkDevice device, const VkRenderPassCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateRenderPass)traced_procs[82])(device, pCreateInfo, pAllocator, pRenderPass);
+    TraceCall(82, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkDestroyRenderPass(VkDevice device, VkRenderPass renderPass, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDestroyRenderPass)traced_procs[83])(device, renderPass, pAllocator);
+    TraceCall(83, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkGetRenderAreaGranularity(VkDevice device, VkRenderPass renderPass, VkExtent2D* pGranularity) {
+    uint64_t start = TraceTime();
+    ((PFN_vkGetRenderAreaGranularity)traced_procs[84])(device, renderPass, pGranularity);
+    TraceCall(84, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkCreateCommandPool(VkDevice device, const VkCommandPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkCommandPool* pCommandPool) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateCommandPool)traced_procs[85])(device, pCreateInfo, pAllocator, pCommandPool);
+    TraceCall(85, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkDestroyCommandPool(VkDevice device, VkCommandPool commandPool, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDestroyCommandPool)traced_procs[86])(device, commandPool, pAllocator);
+    TraceCall(86, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkResetCommandPool(VkDevice device, VkCommandPool commandPool, VkCommandPoolResetFlags flags) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkResetCommandPool)traced_procs[87])(device, commandPool, flags);
+    TraceCall(87, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkAllocateCommandBuffers(VkDevice device, const VkCommandBufferAllocateInfo* pAllocateInfo, VkCommandBuffer* pCommandBuffers) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkAllocateCommandBuffers)traced_procs[88])(device, pAllocateInfo, pCommandBuffers);
+    TraceCall(88, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkFreeCommandBuffers(VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount, const VkCommandBuffer* pCommandBuffers) {
+    uint64_t start = TraceTime();
+    ((PFN_vkFreeCommandBuffers)traced_procs[89])(device, commandPool, commandBufferCount, pCommandBuffers);
+    TraceCall(89, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkBeginCommandBuffer(VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo* pBeginInfo) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkBeginCommandBuffer)traced_procs[90])(commandBuffer, pBeginInfo);
+    TraceCall(90, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkEndCommandBuffer(VkCommandBuffer commandBuffer) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkEndCommandBuffer)traced_procs[91])(commandBuffer);
+    TraceCall(91, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkResetCommandBuffer(VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flags) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkResetCommandBuffer)traced_procs[92])(commandBuffer, flags);
+    TraceCall(92, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdBindPipeline(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipeline pipeline) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdBindPipeline)traced_procs[93])(commandBuffer, pipelineBindPoint, pipeline);
+    TraceCall(93, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdSetViewport(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount, const VkViewport* pViewports) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdSetViewport)traced_procs[94])(commandBuffer, firstViewport, viewportCount, pViewports);
+    TraceCall(94, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdSetScissor(VkCommandBuffer commandBuffer, uint32_t firstScissor, uint32_t scissorCount, const VkRect2D* pScissors) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdSetScissor)traced_procs[95])(commandBuffer, firstScissor, scissorCount, pScissors);
+    TraceCall(95, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdSetLineWidth(VkCommandBuffer commandBuffer, float lineWidth) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdSetLineWidth)traced_procs[96])(commandBuffer, lineWidth);
+    TraceCall(96, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdSetDepthBias(VkCommandBuffer commandBuffer, float depthBiasConstantFactor, float depthBiasClamp, float depthBiasSlopeFactor) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdSetDepthBias)traced_procs[97])(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
+    TraceCall(97, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdSetBlendConstants(VkCommandBuffer commandBuffer, const float blendConstants[4]) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdSetBlendConstants)traced_procs[98])(commandBuffer, blendConstants);
+    TraceCall(98, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdSetDepthBounds(VkCommandBuffer commandBuffer, float minDepthBounds, float maxDepthBounds) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdSetDepthBounds)traced_procs[99])(commandBuffer, minDepthBounds, maxDepthBounds);
+    TraceCall(99, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdSetStencilCompareMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t compareMask) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdSetStencilCompareMask)traced_procs[100])(commandBuffer, faceMask, compareMask);
+    TraceCall(100, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdSetStencilWriteMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t writeMask) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdSetStencilWriteMask)traced_procs[101])(commandBuffer, faceMask, writeMask);
+    TraceCall(101, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdSetStencilReference(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t reference) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdSetStencilReference)traced_procs[102])(commandBuffer, faceMask, reference);
+    TraceCall(102, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdBindDescriptorSets(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, uint32_t firstSet, uint32_t descriptorSetCount, const VkDescriptorSet* pDescriptorSets, uint32_t dynamicOffsetCount, const uint32_t* pDynamicOffsets) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdBindDescriptorSets)traced_procs[103])(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
+    TraceCall(103, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdBindIndexBuffer(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkIndexType indexType) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdBindIndexBuffer)traced_procs[104])(commandBuffer, buffer, offset, indexType);
+    TraceCall(104, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdBindVertexBuffers(VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount, const VkBuffer* pBuffers, const VkDeviceSize* pOffsets) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdBindVertexBuffers)traced_procs[105])(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
+    TraceCall(105, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdDraw)traced_procs[106])(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
+    TraceCall(106, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdDrawIndexed(VkCommandBuffer commandBuffer, uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdDrawIndexed)traced_procs[107])(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
+    TraceCall(107, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdDrawIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdDrawIndirect)traced_procs[108])(commandBuffer, buffer, offset, drawCount, stride);
+    TraceCall(108, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdDrawIndexedIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdDrawIndexedIndirect)traced_procs[109])(commandBuffer, buffer, offset, drawCount, stride);
+    TraceCall(109, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdDispatch(VkCommandBuffer commandBuffer, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdDispatch)traced_procs[110])(commandBuffer, groupCountX, groupCountY, groupCountZ);
+    TraceCall(110, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdDispatchIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdDispatchIndirect)traced_procs[111])(commandBuffer, buffer, offset);
+    TraceCall(111, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer, uint32_t regionCount, const VkBufferCopy* pRegions) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdCopyBuffer)traced_procs[112])(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
+    TraceCall(112, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdCopyImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageCopy* pRegions) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdCopyImage)traced_procs[113])(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
+    TraceCall(113, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdBlitImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageBlit* pRegions, VkFilter filter) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdBlitImage)traced_procs[114])(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
+    TraceCall(114, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdCopyBufferToImage(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkBufferImageCopy* pRegions) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdCopyBufferToImage)traced_procs[115])(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
+    TraceCall(115, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdCopyImageToBuffer(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkBuffer dstBuffer, uint32_t regionCount, const VkBufferImageCopy* pRegions) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdCopyImageToBuffer)traced_procs[116])(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
+    TraceCall(116, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdUpdateBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize dataSize, const void* pData) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdUpdateBuffer)traced_procs[117])(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
+    TraceCall(117, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdFillBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize size, uint32_t data) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdFillBuffer)traced_procs[118])(commandBuffer, dstBuffer, dstOffset, size, data);
+    TraceCall(118, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdClearColorImage(VkCommandBuffer commandBuffer, VkImage image, VkImageLayout imageLayout, const VkClearColorValue* pColor, uint32_t rangeCount, const VkImageSubresourceRange* pRanges) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdClearColorImage)traced_procs[119])(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
+    TraceCall(119, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdClearDepthStencilImage(VkCommandBuffer commandBuffer, VkImage image, VkImageLayout imageLayout, const VkClearDepthStencilValue* pDepthStencil, uint32_t rangeCount, const VkImageSubresourceRange* pRanges) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdClearDepthStencilImage)traced_procs[120])(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
+    TraceCall(120, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdClearAttachments(VkCommandBuffer commandBuffer, uint32_t attachmentCount, const VkClearAttachment* pAttachments, uint32_t rectCount, const VkClearRect* pRects) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdClearAttachments)traced_procs[121])(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
+    TraceCall(121, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdResolveImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageResolve* pRegions) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdResolveImage)traced_procs[122])(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
+    TraceCall(122, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdSetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdSetEvent)traced_procs[123])(commandBuffer, event, stageMask);
+    TraceCall(123, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdResetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdResetEvent)traced_procs[124])(commandBuffer, event, stageMask);
+    TraceCall(124, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdWaitEvents(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent* pEvents, VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask, uint32_t memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers, uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier* pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier* pImageMemoryBarriers) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdWaitEvents)traced_procs[125])(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
+    TraceCall(125, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdPipelineBarrier(VkCommandBuffer commandBuffer, VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask, VkDependencyFlags dependencyFlags, uint32_t memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers, uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier* pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier* pImageMemoryBarriers) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdPipelineBarrier)traced_procs[126])(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
+    TraceCall(126, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdBeginQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query, VkQueryControlFlags flags) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdBeginQuery)traced_procs[127])(commandBuffer, queryPool, query, flags);
+    TraceCall(127, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdEndQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdEndQuery)traced_procs[128])(commandBuffer, queryPool, query);
+    TraceCall(128, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdResetQueryPool(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdResetQueryPool)traced_procs[129])(commandBuffer, queryPool, firstQuery, queryCount);
+    TraceCall(129, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdWriteTimestamp(VkCommandBuffer commandBuffer, VkPipelineStageFlagBits pipelineStage, VkQueryPool queryPool, uint32_t query) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdWriteTimestamp)traced_procs[130])(commandBuffer, pipelineStage, queryPool, query);
+    TraceCall(130, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdCopyQueryPoolResults(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize stride, VkQueryResultFlags flags) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdCopyQueryPoolResults)traced_procs[131])(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
+    TraceCall(131, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdPushConstants(VkCommandBuffer commandBuffer, VkPipelineLayout layout, VkShaderStageFlags stageFlags, uint32_t offset, uint32_t size, const void* pValues) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdPushConstants)traced_procs[132])(commandBuffer, layout, stageFlags, offset, size, pValues);
+    TraceCall(132, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo* pRenderPassBegin, VkSubpassContents contents) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdBeginRenderPass)traced_procs[133])(commandBuffer, pRenderPassBegin, contents);
+    TraceCall(133, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdNextSubpass(VkCommandBuffer commandBuffer, VkSubpassContents contents) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdNextSubpass)traced_procs[134])(commandBuffer, contents);
+    TraceCall(134, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdEndRenderPass(VkCommandBuffer commandBuffer) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdEndRenderPass)traced_procs[135])(commandBuffer);
+    TraceCall(135, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t commandBufferCount, const VkCommandBuffer* pCommandBuffers) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdExecuteCommands)traced_procs[136])(commandBuffer, commandBufferCount, pCommandBuffers);
+    TraceCall(136, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkDestroySurfaceKHR(VkInstance instance, VkSurfaceKHR surface, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDestroySurfaceKHR)traced_procs[137])(instance, surface, pAllocator);
+    TraceCall(137, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkGetPhysicalDeviceSurfaceSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, VkSurfaceKHR surface, VkBool32* pSupported) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetPhysicalDeviceSurfaceSupportKHR)traced_procs[138])(physicalDevice, queueFamilyIndex, surface, pSupported);
+    TraceCall(138, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkGetPhysicalDeviceSurfaceCapabilitiesKHR(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, VkSurfaceCapabilitiesKHR* pSurfaceCapabilities) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetPhysicalDeviceSurfaceCapabilitiesKHR)traced_procs[139])(physicalDevice, surface, pSurfaceCapabilities);
+    TraceCall(139, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkGetPhysicalDeviceSurfaceFormatsKHR(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, uint32_t* pSurfaceFormatCount, VkSurfaceFormatKHR* pSurfaceFormats) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetPhysicalDeviceSurfaceFormatsKHR)traced_procs[140])(physicalDevice, surface, pSurfaceFormatCount, pSurfaceFormats);
+    TraceCall(140, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkGetPhysicalDeviceSurfacePresentModesKHR(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, uint32_t* pPresentModeCount, VkPresentModeKHR* pPresentModes) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetPhysicalDeviceSurfacePresentModesKHR)traced_procs[141])(physicalDevice, surface, pPresentModeCount, pPresentModes);
+    TraceCall(141, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkCreateSwapchainKHR(VkDevice device, const VkSwapchainCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchain) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateSwapchainKHR)traced_procs[142])(device, pCreateInfo, pAllocator, pSwapchain);
+    TraceCall(142, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkDestroySwapchainKHR(VkDevice device, VkSwapchainKHR swapchain, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDestroySwapchainKHR)traced_procs[143])(device, swapchain, pAllocator);
+    TraceCall(143, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkGetSwapchainImagesKHR(VkDevice device, VkSwapchainKHR swapchain, uint32_t* pSwapchainImageCount, VkImage* pSwapchainImages) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetSwapchainImagesKHR)traced_procs[144])(device, swapchain, pSwapchainImageCount, pSwapchainImages);
+    TraceCall(144, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkAcquireNextImageKHR(VkDevice device, VkSwapchainKHR swapchain, uint64_t timeout, VkSemaphore semaphore, VkFence fence, uint32_t* pImageIndex) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkAcquireNextImageKHR)traced_procs[145])(device, swapchain, timeout, semaphore, fence, pImageIndex);
+    TraceCall(145, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR* pPresentInfo) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkQueuePresentKHR)traced_procs[146])(queue, pPresentInfo);
+    TraceCall(146, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkGetPhysicalDeviceDisplayPropertiesKHR(VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkDisplayPropertiesKHR* pProperties) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetPhysicalDeviceDisplayPropertiesKHR)traced_procs[147])(physicalDevice, pPropertyCount, pProperties);
+    TraceCall(147, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkGetPhysicalDeviceDisplayPlanePropertiesKHR(VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkDisplayPlanePropertiesKHR* pProperties) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetPhysicalDeviceDisplayPlanePropertiesKHR)traced_procs[148])(physicalDevice, pPropertyCount, pProperties);
+    TraceCall(148, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkGetDisplayPlaneSupportedDisplaysKHR(VkPhysicalDevice physicalDevice, uint32_t planeIndex, uint32_t* pDisplayCount, VkDisplayKHR* pDisplays) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetDisplayPlaneSupportedDisplaysKHR)traced_procs[149])(physicalDevice, planeIndex, pDisplayCount, pDisplays);
+    TraceCall(149, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkGetDisplayModePropertiesKHR(VkPhysicalDevice physicalDevice, VkDisplayKHR display, uint32_t* pPropertyCount, VkDisplayModePropertiesKHR* pProperties) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetDisplayModePropertiesKHR)traced_procs[150])(physicalDevice, display, pPropertyCount, pProperties);
+    TraceCall(150, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkCreateDisplayModeKHR(VkPhysicalDevice physicalDevice, VkDisplayKHR display, const VkDisplayModeCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDisplayModeKHR* pMode) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateDisplayModeKHR)traced_procs[151])(physicalDevice, display, pCreateInfo, pAllocator, pMode);
+    TraceCall(151, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkGetDisplayPlaneCapabilitiesKHR(VkPhysicalDevice physicalDevice, VkDisplayModeKHR mode, uint32_t planeIndex, VkDisplayPlaneCapabilitiesKHR* pCapabilities) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetDisplayPlaneCapabilitiesKHR)traced_procs[152])(physicalDevice, mode, planeIndex, pCapabilities);
+    TraceCall(152, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkCreateDisplayPlaneSurfaceKHR(VkInstance instance, const VkDisplaySurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateDisplayPlaneSurfaceKHR)traced_procs[153])(instance, pCreateInfo, pAllocator, pSurface);
+    TraceCall(153, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkCreateSharedSwapchainsKHR(VkDevice device, uint32_t swapchainCount, const VkSwapchainCreateInfoKHR* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchains) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateSharedSwapchainsKHR)traced_procs[154])(device, swapchainCount, pCreateInfos, pAllocator, pSwapchains);
+    TraceCall(154, start);
+    return result;
+}
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkCreateXlibSurfaceKHR(VkInstance instance, const VkXlibSurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateXlibSurfaceKHR)traced_procs[155])(instance, pCreateInfo, pAllocator, pSurface);
+    TraceCall(155, start);
+    return result;
+}
+static VKAPI_ATTR VkBool32 VKAPI_CALL Trace_vkGetPhysicalDeviceXlibPresentationSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, Display* dpy, VisualID visualID) {
+    uint64_t start = TraceTime();
+    VkBool32 result = ((PFN_vkGetPhysicalDeviceXlibPresentationSupportKHR)traced_procs[156])(physicalDevice, queueFamilyIndex, dpy, visualID);
+    TraceCall(156, start);
+    return result;
+}
+#endif
+#ifdef VK_USE_PLATFORM_XCB_KHR
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkCreateXcbSurfaceKHR(VkInstance instance, const VkXcbSurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateXcbSurfaceKHR)traced_procs[157])(instance, pCreateInfo, pAllocator, pSurface);
+    TraceCall(157, start);
+    return result;
+}
+static VKAPI_ATTR VkBool32 VKAPI_CALL Trace_vkGetPhysicalDeviceXcbPresentationSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, xcb_connection_t* connection, xcb_visualid_t visual_id) {
+    uint64_t start = TraceTime();
+    VkBool32 result = ((PFN_vkGetPhysicalDeviceXcbPresentationSupportKHR)traced_procs[158])(physicalDevice, queueFamilyIndex, connection, visual_id);
+    TraceCall(158, start);
+    return result;
+}
+#endif
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkCreateWaylandSurfaceKHR(VkInstance instance, const VkWaylandSurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateWaylandSurfaceKHR)traced_procs[159])(instance, pCreateInfo, pAllocator, pSurface);
+    TraceCall(159, start);
+    return result;
+}
+static VKAPI_ATTR VkBool32 VKAPI_CALL Trace_vkGetPhysicalDeviceWaylandPresentationSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, struct wl_display* display) {
+    uint64_t start = TraceTime();
+    VkBool32 result = ((PFN_vkGetPhysicalDeviceWaylandPresentationSupportKHR)traced_procs[160])(physicalDevice, queueFamilyIndex, display);
+    TraceCall(160, start);
+    return result;
+}
+#endif
+#ifdef VK_USE_PLATFORM_MIR_KHR
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkCreateMirSurfaceKHR(VkInstance instance, const VkMirSurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateMirSurfaceKHR)traced_procs[161])(instance, pCreateInfo, pAllocator, pSurface);
+    TraceCall(161, start);
+    return result;
+}
+static VKAPI_ATTR VkBool32 VKAPI_CALL Trace_vkGetPhysicalDeviceMirPresentationSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, MirConnection* connection) {
+    uint64_t start = TraceTime();
+    VkBool32 result = ((PFN_vkGetPhysicalDeviceMirPresentationSupportKHR)traced_procs[162])(physicalDevice, queueFamilyIndex, connection);
+    TraceCall(162, start);
+    return result;
+}
+#endif
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkCreateAndroidSurfaceKHR(VkInstance instance, const VkAndroidSurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateAndroidSurfaceKHR)traced_procs[163])(instance, pCreateInfo, pAllocator, pSurface);
+    TraceCall(163, start);
+    return result;
+}
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkCreateWin32SurfaceKHR(VkInstance instance, const VkWin32SurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateWin32SurfaceKHR)traced_procs[164])(instance, pCreateInfo, pAllocator, pSurface);
+    TraceCall(164, start);
+    return result;
+}
+static VKAPI_ATTR VkBool32 VKAPI_CALL Trace_vkGetPhysicalDeviceWin32PresentationSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex) {
+    uint64_t start = TraceTime();
+    VkBool32 result = ((PFN_vkGetPhysicalDeviceWin32PresentationSupportKHR)traced_procs[165])(physicalDevice, queueFamilyIndex);
+    TraceCall(165, start);
+    return result;
+}
+#endif
+static VKAPI_ATTR void VKAPI_CALL Trace_vkGetPhysicalDeviceFeatures2KHR(VkPhysicalDevice physicalDevice, VkPhysicalDeviceFeatures2KHR* pFeatures) {
+    uint64_t start = TraceTime();
+    ((PFN_vkGetPhysicalDeviceFeatures2KHR)traced_procs[166])(physicalDevice, pFeatures);
+    TraceCall(166, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkGetPhysicalDeviceProperties2KHR(VkPhysicalDevice physicalDevice, VkPhysicalDeviceProperties2KHR* pProperties) {
+    uint64_t start = TraceTime();
+    ((PFN_vkGetPhysicalDeviceProperties2KHR)traced_procs[167])(physicalDevice, pProperties);
+    TraceCall(167, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkGetPhysicalDeviceFormatProperties2KHR(VkPhysicalDevice physicalDevice, VkFormat format, VkFormatProperties2KHR* pFormatProperties) {
+    uint64_t start = TraceTime();
+    ((PFN_vkGetPhysicalDeviceFormatProperties2KHR)traced_procs[168])(physicalDevice, format, pFormatProperties);
+    TraceCall(168, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkGetPhysicalDeviceImageFormatProperties2KHR(VkPhysicalDevice physicalDevice, const VkPhysicalDeviceImageFormatInfo2KHR* pImageFormatInfo, VkImageFormatProperties2KHR* pImageFormatProperties) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetPhysicalDeviceImageFormatProperties2KHR)traced_procs[169])(physicalDevice, pImageFormatInfo, pImageFormatProperties);
+    TraceCall(169, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkGetPhysicalDeviceQueueFamilyProperties2KHR(VkPhysicalDevice physicalDevice, uint32_t* pQueueFamilyPropertyCount, VkQueueFamilyProperties2KHR* pQueueFamilyProperties) {
+    uint64_t start = TraceTime();
+    ((PFN_vkGetPhysicalDeviceQueueFamilyProperties2KHR)traced_procs[170])(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
+    TraceCall(170, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkGetPhysicalDeviceMemoryProperties2KHR(VkPhysicalDevice physicalDevice, VkPhysicalDeviceMemoryProperties2KHR* pMemoryProperties) {
+    uint64_t start = TraceTime();
+    ((PFN_vkGetPhysicalDeviceMemoryProperties2KHR)traced_procs[171])(physicalDevice, pMemoryProperties);
+    TraceCall(171, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkGetPhysicalDeviceSparseImageFormatProperties2KHR(VkPhysicalDevice physicalDevice, const VkPhysicalDeviceSparseImageFormatInfo2KHR* pFormatInfo, uint32_t* pPropertyCount, VkSparseImageFormatProperties2KHR* pProperties) {
+    uint64_t start = TraceTime();
+    ((PFN_vkGetPhysicalDeviceSparseImageFormatProperties2KHR)traced_procs[172])(physicalDevice, pFormatInfo, pPropertyCount, pProperties);
+    TraceCall(172, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkTrimCommandPoolKHR(VkDevice device, VkCommandPool commandPool, VkCommandPoolTrimFlagsKHR flags) {
+    uint64_t start = TraceTime();
+    ((PFN_vkTrimCommandPoolKHR)traced_procs[173])(device, commandPool, flags);
+    TraceCall(173, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkGetPhysicalDeviceExternalBufferPropertiesKHR(VkPhysicalDevice physicalDevice, const VkPhysicalDeviceExternalBufferInfoKHR* pExternalBufferInfo, VkExternalBufferPropertiesKHR* pExternalBufferProperties) {
+    uint64_t start = TraceTime();
+    ((PFN_vkGetPhysicalDeviceExternalBufferPropertiesKHR)traced_procs[174])(physicalDevice, pExternalBufferInfo, pExternalBufferProperties);
+    TraceCall(174, start);
+}
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkGetMemoryWin32HandleKHR(VkDevice device, const VkMemoryGetWin32HandleInfoKHR* pGetWin32HandleInfo, HANDLE* pHandle) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetMemoryWin32HandleKHR)traced_procs[175])(device, pGetWin32HandleInfo, pHandle);
+    TraceCall(175, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkGetMemoryWin32HandlePropertiesKHR(VkDevice device, VkExternalMemoryHandleTypeFlagBitsKHR handleType, HANDLE handle, VkMemoryWin32HandlePropertiesKHR* pMemoryWin32HandleProperties) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetMemoryWin32HandlePropertiesKHR)traced_procs[176])(device, handleType, handle, pMemoryWin32HandleProperties);
+    TraceCall(176, start);
+    return result;
+}
+#endif
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkGetMemoryFdKHR(VkDevice device, const VkMemoryGetFdInfoKHR* pGetFdInfo, int* pFd) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetMemoryFdKHR)traced_procs[177])(device, pGetFdInfo, pFd);
+    TraceCall(177, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkGetMemoryFdPropertiesKHR(VkDevice device, VkExternalMemoryHandleTypeFlagBitsKHR handleType, int fd, VkMemoryFdPropertiesKHR* pMemoryFdProperties) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetMemoryFdPropertiesKHR)traced_procs[178])(device, handleType, fd, pMemoryFdProperties);
+    TraceCall(178, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR(VkPhysicalDevice physicalDevice, const VkPhysicalDeviceExternalSemaphoreInfoKHR* pExternalSemaphoreInfo, VkExternalSemaphorePropertiesKHR* pExternalSemaphoreProperties) {
+    uint64_t start = TraceTime();
+    ((PFN_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR)traced_procs[179])(physicalDevice, pExternalSemaphoreInfo, pExternalSemaphoreProperties);
+    TraceCall(179, start);
+}
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkImportSemaphoreWin32HandleKHR(VkDevice device, const VkImportSemaphoreWin32HandleInfoKHR* pImportSemaphoreWin32HandleInfo) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkImportSemaphoreWin32HandleKHR)traced_procs[180])(device, pImportSemaphoreWin32HandleInfo);
+    TraceCall(180, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkGetSemaphoreWin32HandleKHR(VkDevice device, const VkSemaphoreGetWin32HandleInfoKHR* pGetWin32HandleInfo, HANDLE* pHandle) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetSemaphoreWin32HandleKHR)traced_procs[181])(device, pGetWin32HandleInfo, pHandle);
+    TraceCall(181, start);
+    return result;
+}
+#endif
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkImportSemaphoreFdKHR(VkDevice device, const VkImportSemaphoreFdInfoKHR* pImportSemaphoreFdInfo) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkImportSemaphoreFdKHR)traced_procs[182])(device, pImportSemaphoreFdInfo);
+    TraceCall(182, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkGetSemaphoreFdKHR(VkDevice device, const VkSemaphoreGetFdInfoKHR* pGetFdInfo, int* pFd) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetSemaphoreFdKHR)traced_procs[183])(device, pGetFdInfo, pFd);
+    TraceCall(183, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdPushDescriptorSetKHR(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, uint32_t set, uint32_t descriptorWriteCount, const VkWriteDescriptorSet* pDescriptorWrites) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdPushDescriptorSetKHR)traced_procs[184])(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
+    TraceCall(184, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkCreateDescriptorUpdateTemplateKHR(VkDevice device, const VkDescriptorUpdateTemplateCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorUpdateTemplateKHR* pDescriptorUpdateTemplate) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateDescriptorUpdateTemplateKHR)traced_procs[185])(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
+    TraceCall(185, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkDestroyDescriptorUpdateTemplateKHR(VkDevice device, VkDescriptorUpdateTemplateKHR descriptorUpdateTemplate, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDestroyDescriptorUpdateTemplateKHR)traced_procs[186])(device, descriptorUpdateTemplate, pAllocator);
+    TraceCall(186, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkUpdateDescriptorSetWithTemplateKHR(VkDevice device, VkDescriptorSet descriptorSet, VkDescriptorUpdateTemplateKHR descriptorUpdateTemplate, const void* pData) {
+    uint64_t start = TraceTime();
+    ((PFN_vkUpdateDescriptorSetWithTemplateKHR)traced_procs[187])(device, descriptorSet, descriptorUpdateTemplate, pData);
+    TraceCall(187, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdPushDescriptorSetWithTemplateKHR(VkCommandBuffer commandBuffer, VkDescriptorUpdateTemplateKHR descriptorUpdateTemplate, VkPipelineLayout layout, uint32_t set, const void* pData) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdPushDescriptorSetWithTemplateKHR)traced_procs[188])(commandBuffer, descriptorUpdateTemplate, layout, set, pData);
+    TraceCall(188, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkGetSwapchainStatusKHR(VkDevice device, VkSwapchainKHR swapchain) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetSwapchainStatusKHR)traced_procs[189])(device, swapchain);
+    TraceCall(189, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkGetPhysicalDeviceExternalFencePropertiesKHR(VkPhysicalDevice physicalDevice, const VkPhysicalDeviceExternalFenceInfoKHR* pExternalFenceInfo, VkExternalFencePropertiesKHR* pExternalFenceProperties) {
+    uint64_t start = TraceTime();
+    ((PFN_vkGetPhysicalDeviceExternalFencePropertiesKHR)traced_procs[190])(physicalDevice, pExternalFenceInfo, pExternalFenceProperties);
+    TraceCall(190, start);
+}
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkImportFenceWin32HandleKHR(VkDevice device, const VkImportFenceWin32HandleInfoKHR* pImportFenceWin32HandleInfo) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkImportFenceWin32HandleKHR)traced_procs[191])(device, pImportFenceWin32HandleInfo);
+    TraceCall(191, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkGetFenceWin32HandleKHR(VkDevice device, const VkFenceGetWin32HandleInfoKHR* pGetWin32HandleInfo, HANDLE* pHandle) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetFenceWin32HandleKHR)traced_procs[192])(device, pGetWin32HandleInfo, pHandle);
+    TraceCall(192, start);
+    return result;
+}
+#endif
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkImportFenceFdKHR(VkDevice device, const VkImportFenceFdInfoKHR* pImportFenceFdInfo) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkImportFenceFdKHR)traced_procs[193])(device, pImportFenceFdInfo);
+    TraceCall(193, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkGetFenceFdKHR(VkDevice device, const VkFenceGetFdInfoKHR* pGetFdInfo, int* pFd) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetFenceFdKHR)traced_procs[194])(device, pGetFdInfo, pFd);
+    TraceCall(194, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkGetPhysicalDeviceSurfaceCapabilities2KHR(VkPhysicalDevice physicalDevice, const VkPhysicalDeviceSurfaceInfo2KHR* pSurfaceInfo, VkSurfaceCapabilities2KHR* pSurfaceCapabilities) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetPhysicalDeviceSurfaceCapabilities2KHR)traced_procs[195])(physicalDevice, pSurfaceInfo, pSurfaceCapabilities);
+    TraceCall(195, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkGetPhysicalDeviceSurfaceFormats2KHR(VkPhysicalDevice physicalDevice, const VkPhysicalDeviceSurfaceInfo2KHR* pSurfaceInfo, uint32_t* pSurfaceFormatCount, VkSurfaceFormat2KHR* pSurfaceFormats) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetPhysicalDeviceSurfaceFormats2KHR)traced_procs[196])(physicalDevice, pSurfaceInfo, pSurfaceFormatCount, pSurfaceFormats);
+    TraceCall(196, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkGetImageMemoryRequirements2KHR(VkDevice device, const VkImageMemoryRequirementsInfo2KHR* pInfo, VkMemoryRequirements2KHR* pMemoryRequirements) {
+    uint64_t start = TraceTime();
+    ((PFN_vkGetImageMemoryRequirements2KHR)traced_procs[197])(device, pInfo, pMemoryRequirements);
+    TraceCall(197, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkGetBufferMemoryRequirements2KHR(VkDevice device, const VkBufferMemoryRequirementsInfo2KHR* pInfo, VkMemoryRequirements2KHR* pMemoryRequirements) {
+    uint64_t start = TraceTime();
+    ((PFN_vkGetBufferMemoryRequirements2KHR)traced_procs[198])(device, pInfo, pMemoryRequirements);
+    TraceCall(198, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkGetImageSparseMemoryRequirements2KHR(VkDevice device, const VkImageSparseMemoryRequirementsInfo2KHR* pInfo, uint32_t* pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements2KHR* pSparseMemoryRequirements) {
+    uint64_t start = TraceTime();
+    ((PFN_vkGetImageSparseMemoryRequirements2KHR)traced_procs[199])(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+    TraceCall(199, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkCreateSamplerYcbcrConversionKHR(VkDevice device, const VkSamplerYcbcrConversionCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSamplerYcbcrConversionKHR* pYcbcrConversion) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateSamplerYcbcrConversionKHR)traced_procs[200])(device, pCreateInfo, pAllocator, pYcbcrConversion);
+    TraceCall(200, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkDestroySamplerYcbcrConversionKHR(VkDevice device, VkSamplerYcbcrConversionKHR ycbcrConversion, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDestroySamplerYcbcrConversionKHR)traced_procs[201])(device, ycbcrConversion, pAllocator);
+    TraceCall(201, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkBindBufferMemory2KHR(VkDevice device, uint32_t bindInfoCount, const VkBindBufferMemoryInfoKHR* pBindInfos) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkBindBufferMemory2KHR)traced_procs[202])(device, bindInfoCount, pBindInfos);
+    TraceCall(202, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkBindImageMemory2KHR(VkDevice device, uint32_t bindInfoCount, const VkBindImageMemoryInfoKHR* pBindInfos) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkBindImageMemory2KHR)traced_procs[203])(device, bindInfoCount, pBindInfos);
+    TraceCall(203, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkCreateDebugReportCallbackEXT(VkInstance instance, const VkDebugReportCallbackCreateInfoEXT* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDebugReportCallbackEXT* pCallback) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateDebugReportCallbackEXT)traced_procs[204])(instance, pCreateInfo, pAllocator, pCallback);
+    TraceCall(204, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkDestroyDebugReportCallbackEXT(VkInstance instance, VkDebugReportCallbackEXT callback, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDestroyDebugReportCallbackEXT)traced_procs[205])(instance, callback, pAllocator);
+    TraceCall(205, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkDebugReportMessageEXT(VkInstance instance, VkDebugReportFlagsEXT flags, VkDebugReportObjectTypeEXT objectType, uint64_t object, size_t location, int32_t messageCode, const char* pLayerPrefix, const char* pMessage) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDebugReportMessageEXT)traced_procs[206])(instance, flags, objectType, object, location, messageCode, pLayerPrefix, pMessage);
+    TraceCall(206, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkDebugMarkerSetObjectTagEXT(VkDevice device, const VkDebugMarkerObjectTagInfoEXT* pTagInfo) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkDebugMarkerSetObjectTagEXT)traced_procs[207])(device, pTagInfo);
+    TraceCall(207, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkDebugMarkerSetObjectNameEXT(VkDevice device, const VkDebugMarkerObjectNameInfoEXT* pNameInfo) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkDebugMarkerSetObjectNameEXT)traced_procs[208])(device, pNameInfo);
+    TraceCall(208, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdDebugMarkerBeginEXT(VkCommandBuffer commandBuffer, const VkDebugMarkerMarkerInfoEXT* pMarkerInfo) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdDebugMarkerBeginEXT)traced_procs[209])(commandBuffer, pMarkerInfo);
+    TraceCall(209, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdDebugMarkerEndEXT(VkCommandBuffer commandBuffer) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdDebugMarkerEndEXT)traced_procs[210])(commandBuffer);
+    TraceCall(210, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdDebugMarkerInsertEXT(VkCommandBuffer commandBuffer, const VkDebugMarkerMarkerInfoEXT* pMarkerInfo) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdDebugMarkerInsertEXT)traced_procs[211])(commandBuffer, pMarkerInfo);
+    TraceCall(211, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdDrawIndirectCountAMD(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdDrawIndirectCountAMD)traced_procs[212])(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+    TraceCall(212, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdDrawIndexedIndirectCountAMD(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdDrawIndexedIndirectCountAMD)traced_procs[213])(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+    TraceCall(213, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkGetShaderInfoAMD(VkDevice device, VkPipeline pipeline, VkShaderStageFlagBits shaderStage, VkShaderInfoTypeAMD infoType, size_t* pInfoSize, void* pInfo) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetShaderInfoAMD)traced_procs[214])(device, pipeline, shaderStage, infoType, pInfoSize, pInfo);
+    TraceCall(214, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkGetPhysicalDeviceExternalImageFormatPropertiesNV(VkPhysicalDevice physicalDevice, VkFormat format, VkImageType type, VkImageTiling tiling, VkImageUsageFlags usage, VkImageCreateFlags flags, VkExternalMemoryHandleTypeFlagsNV externalHandleType, VkExternalImageFormatPropertiesNV* pExternalImageFormatProperties) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetPhysicalDeviceExternalImageFormatPropertiesNV)traced_procs[215])(physicalDevice, format, type, tiling, usage, flags, externalHandleType, pExternalImageFormatProperties);
+    TraceCall(215, start);
+    return result;
+}
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkGetMemoryWin32HandleNV(VkDevice device, VkDeviceMemory memory, VkExternalMemoryHandleTypeFlagsNV handleType, HANDLE* pHandle) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetMemoryWin32HandleNV)traced_procs[216])(device, memory, handleType, pHandle);
+    TraceCall(216, start);
+    return result;
+}
+#endif
+static VKAPI_ATTR void VKAPI_CALL Trace_vkGetDeviceGroupPeerMemoryFeaturesKHX(VkDevice device, uint32_t heapIndex, uint32_t localDeviceIndex, uint32_t remoteDeviceIndex, VkPeerMemoryFeatureFlagsKHX* pPeerMemoryFeatures) {
+    uint64_t start = TraceTime();
+    ((PFN_vkGetDeviceGroupPeerMemoryFeaturesKHX)traced_procs[217])(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
+    TraceCall(217, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdSetDeviceMaskKHX(VkCommandBuffer commandBuffer, uint32_t deviceMask) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdSetDeviceMaskKHX)traced_procs[218])(commandBuffer, deviceMask);
+    TraceCall(218, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdDispatchBaseKHX(VkCommandBuffer commandBuffer, uint32_t baseGroupX, uint32_t baseGroupY, uint32_t baseGroupZ, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdDispatchBaseKHX)traced_procs[219])(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
+    TraceCall(219, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkGetDeviceGroupPresentCapabilitiesKHX(VkDevice device, VkDeviceGroupPresentCapabilitiesKHX* pDeviceGroupPresentCapabilities) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetDeviceGroupPresentCapabilitiesKHX)traced_procs[220])(device, pDeviceGroupPresentCapabilities);
+    TraceCall(220, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkGetDeviceGroupSurfacePresentModesKHX(VkDevice device, VkSurfaceKHR surface, VkDeviceGroupPresentModeFlagsKHX* pModes) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetDeviceGroupSurfacePresentModesKHX)traced_procs[221])(device, surface, pModes);
+    TraceCall(221, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkGetPhysicalDevicePresentRectanglesKHX(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, uint32_t* pRectCount, VkRect2D* pRects) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetPhysicalDevicePresentRectanglesKHX)traced_procs[222])(physicalDevice, surface, pRectCount, pRects);
+    TraceCall(222, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkAcquireNextImage2KHX(VkDevice device, const VkAcquireNextImageInfoKHX* pAcquireInfo, uint32_t* pImageIndex) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkAcquireNextImage2KHX)traced_procs[223])(device, pAcquireInfo, pImageIndex);
+    TraceCall(223, start);
+    return result;
+}
+#ifdef VK_USE_PLATFORM_VI_NN
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkCreateViSurfaceNN(VkInstance instance, const VkViSurfaceCreateInfoNN* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateViSurfaceNN)traced_procs[224])(instance, pCreateInfo, pAllocator, pSurface);
+    TraceCall(224, start);
+    return result;
+}
+#endif
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkEnumeratePhysicalDeviceGroupsKHX(VkInstance instance, uint32_t* pPhysicalDeviceGroupCount, VkPhysicalDeviceGroupPropertiesKHX* pPhysicalDeviceGroupProperties) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkEnumeratePhysicalDeviceGroupsKHX)traced_procs[225])(instance, pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties);
+    TraceCall(225, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdProcessCommandsNVX(VkCommandBuffer commandBuffer, const VkCmdProcessCommandsInfoNVX* pProcessCommandsInfo) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdProcessCommandsNVX)traced_procs[226])(commandBuffer, pProcessCommandsInfo);
+    TraceCall(226, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdReserveSpaceForCommandsNVX(VkCommandBuffer commandBuffer, const VkCmdReserveSpaceForCommandsInfoNVX* pReserveSpaceInfo) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdReserveSpaceForCommandsNVX)traced_procs[227])(commandBuffer, pReserveSpaceInfo);
+    TraceCall(227, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkCreateIndirectCommandsLayoutNVX(VkDevice device, const VkIndirectCommandsLayoutCreateInfoNVX* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkIndirectCommandsLayoutNVX* pIndirectCommandsLayout) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateIndirectCommandsLayoutNVX)traced_procs[228])(device, pCreateInfo, pAllocator, pIndirectCommandsLayout);
+    TraceCall(228, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkDestroyIndirectCommandsLayoutNVX(VkDevice device, VkIndirectCommandsLayoutNVX indirectCommandsLayout, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDestroyIndirectCommandsLayoutNVX)traced_procs[229])(device, indirectCommandsLayout, pAllocator);
+    TraceCall(229, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkCreateObjectTableNVX(VkDevice device, const VkObjectTableCreateInfoNVX* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkObjectTableNVX* pObjectTable) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateObjectTableNVX)traced_procs[230])(device, pCreateInfo, pAllocator, pObjectTable);
+    TraceCall(230, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkDestroyObjectTableNVX(VkDevice device, VkObjectTableNVX objectTable, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDestroyObjectTableNVX)traced_procs[231])(device, objectTable, pAllocator);
+    TraceCall(231, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkRegisterObjectsNVX(VkDevice device, VkObjectTableNVX objectTable, uint32_t objectCount, const VkObjectTableEntryNVX* const* ppObjectTableEntries, const uint32_t* pObjectIndices) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkRegisterObjectsNVX)traced_procs[232])(device, objectTable, objectCount, ppObjectTableEntries, pObjectIndices);
+    TraceCall(232, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkUnregisterObjectsNVX(VkDevice device, VkObjectTableNVX objectTable, uint32_t objectCount, const VkObjectEntryTypeNVX* pObjectEntryTypes, const uint32_t* pObjectIndices) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkUnregisterObjectsNVX)traced_procs[233])(device, objectTable, objectCount, pObjectEntryTypes, pObjectIndices);
+    TraceCall(233, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkGetPhysicalDeviceGeneratedCommandsPropertiesNVX(VkPhysicalDevice physicalDevice, VkDeviceGeneratedCommandsFeaturesNVX* pFeatures, VkDeviceGeneratedCommandsLimitsNVX* pLimits) {
+    uint64_t start = TraceTime();
+    ((PFN_vkGetPhysicalDeviceGeneratedCommandsPropertiesNVX)traced_procs[234])(physicalDevice, pFeatures, pLimits);
+    TraceCall(234, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdSetViewportWScalingNV(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount, const VkViewportWScalingNV* pViewportWScalings) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdSetViewportWScalingNV)traced_procs[235])(commandBuffer, firstViewport, viewportCount, pViewportWScalings);
+    TraceCall(235, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkReleaseDisplayEXT(VkPhysicalDevice physicalDevice, VkDisplayKHR display) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkReleaseDisplayEXT)traced_procs[236])(physicalDevice, display);
+    TraceCall(236, start);
+    return result;
+}
+#ifdef VK_USE_PLATFORM_XLIB_XRANDR_EXT
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkAcquireXlibDisplayEXT(VkPhysicalDevice physicalDevice, Display* dpy, VkDisplayKHR display) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkAcquireXlibDisplayEXT)traced_procs[237])(physicalDevice, dpy, display);
+    TraceCall(237, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkGetRandROutputDisplayEXT(VkPhysicalDevice physicalDevice, Display* dpy, RROutput rrOutput, VkDisplayKHR* pDisplay) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetRandROutputDisplayEXT)traced_procs[238])(physicalDevice, dpy, rrOutput, pDisplay);
+    TraceCall(238, start);
+    return result;
+}
+#endif
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkGetPhysicalDeviceSurfaceCapabilities2EXT(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, VkSurfaceCapabilities2EXT* pSurfaceCapabilities) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetPhysicalDeviceSurfaceCapabilities2EXT)traced_procs[239])(physicalDevice, surface, pSurfaceCapabilities);
+    TraceCall(239, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkDisplayPowerControlEXT(VkDevice device, VkDisplayKHR display, const VkDisplayPowerInfoEXT* pDisplayPowerInfo) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkDisplayPowerControlEXT)traced_procs[240])(device, display, pDisplayPowerInfo);
+    TraceCall(240, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkRegisterDeviceEventEXT(VkDevice device, const VkDeviceEventInfoEXT* pDeviceEventInfo, const VkAllocationCallbacks* pAllocator, VkFence* pFence) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkRegisterDeviceEventEXT)traced_procs[241])(device, pDeviceEventInfo, pAllocator, pFence);
+    TraceCall(241, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkRegisterDisplayEventEXT(VkDevice device, VkDisplayKHR display, const VkDisplayEventInfoEXT* pDisplayEventInfo, const VkAllocationCallbacks* pAllocator, VkFence* pFence) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkRegisterDisplayEventEXT)traced_procs[242])(device, display, pDisplayEventInfo, pAllocator, pFence);
+    TraceCall(242, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkGetSwapchainCounterEXT(VkDevice device, VkSwapchainKHR swapchain, VkSurfaceCounterFlagBitsEXT counter, uint64_t* pCounterValue) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetSwapchainCounterEXT)traced_procs[243])(device, swapchain, counter, pCounterValue);
+    TraceCall(243, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkGetRefreshCycleDurationGOOGLE(VkDevice device, VkSwapchainKHR swapchain, VkRefreshCycleDurationGOOGLE* pDisplayTimingProperties) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetRefreshCycleDurationGOOGLE)traced_procs[244])(device, swapchain, pDisplayTimingProperties);
+    TraceCall(244, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkGetPastPresentationTimingGOOGLE(VkDevice device, VkSwapchainKHR swapchain, uint32_t* pPresentationTimingCount, VkPastPresentationTimingGOOGLE* pPresentationTimings) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetPastPresentationTimingGOOGLE)traced_procs[245])(device, swapchain, pPresentationTimingCount, pPresentationTimings);
+    TraceCall(245, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdSetDiscardRectangleEXT(VkCommandBuffer commandBuffer, uint32_t firstDiscardRectangle, uint32_t discardRectangleCount, const VkRect2D* pDiscardRectangles) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdSetDiscardRectangleEXT)traced_procs[246])(commandBuffer, firstDiscardRectangle, discardRectangleCount, pDiscardRectangles);
+    TraceCall(246, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkSetHdrMetadataEXT(VkDevice device, uint32_t swapchainCount, const VkSwapchainKHR* pSwapchains, const VkHdrMetadataEXT* pMetadata) {
+    uint64_t start = TraceTime();
+    ((PFN_vkSetHdrMetadataEXT)traced_procs[247])(device, swapchainCount, pSwapchains, pMetadata);
+    TraceCall(247, start);
+}
+#ifdef VK_USE_PLATFORM_IOS_MVK
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkCreateIOSSurfaceMVK(VkInstance instance, const VkIOSSurfaceCreateInfoMVK* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateIOSSurfaceMVK)traced_procs[248])(instance, pCreateInfo, pAllocator, pSurface);
+    TraceCall(248, start);
+    return result;
+}
+#endif
+#ifdef VK_USE_PLATFORM_MACOS_MVK
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkCreateMacOSSurfaceMVK(VkInstance instance, const VkMacOSSurfaceCreateInfoMVK* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateMacOSSurfaceMVK)traced_procs[249])(instance, pCreateInfo, pAllocator, pSurface);
+    TraceCall(249, start);
+    return result;
+}
+#endif
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdSetSampleLocationsEXT(VkCommandBuffer commandBuffer, const VkSampleLocationsInfoEXT* pSampleLocationsInfo) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdSetSampleLocationsEXT)traced_procs[250])(commandBuffer, pSampleLocationsInfo);
+    TraceCall(250, start);
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkGetPhysicalDeviceMultisamplePropertiesEXT(VkPhysicalDevice physicalDevice, VkSampleCountFlagBits samples, VkMultisamplePropertiesEXT* pMultisampleProperties) {
+    uint64_t start = TraceTime();
+    ((PFN_vkGetPhysicalDeviceMultisamplePropertiesEXT)traced_procs[251])(physicalDevice, samples, pMultisampleProperties);
+    TraceCall(251, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkCreateValidationCacheEXT(VkDevice device, const VkValidationCacheCreateInfoEXT* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkValidationCacheEXT* pValidationCache) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateValidationCacheEXT)traced_procs[252])(device, pCreateInfo, pAllocator, pValidationCache);
+    TraceCall(252, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkDestroyValidationCacheEXT(VkDevice device, VkValidationCacheEXT validationCache, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDestroyValidationCacheEXT)traced_procs[253])(device, validationCache, pAllocator);
+    TraceCall(253, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkMergeValidationCachesEXT(VkDevice device, VkValidationCacheEXT dstCache, uint32_t srcCacheCount, const VkValidationCacheEXT* pSrcCaches) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkMergeValidationCachesEXT)traced_procs[254])(device, dstCache, srcCacheCount, pSrcCaches);
+    TraceCall(254, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkGetValidationCacheDataEXT(VkDevice device, VkValidationCacheEXT validationCache, size_t* pDataSize, void* pData) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetValidationCacheDataEXT)traced_procs[255])(device, validationCache, pDataSize, pData);
+    TraceCall(255, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL Trace_vkGetMemoryHostPointerPropertiesEXT(VkDevice device, VkExternalMemoryHandleTypeFlagBitsKHR handleType, const void* pHostPointer, VkMemoryHostPointerPropertiesEXT* pMemoryHostPointerProperties) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetMemoryHostPointerPropertiesEXT)traced_procs[256])(device, handleType, pHostPointer, pMemoryHostPointerProperties);
+    TraceCall(256, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL Trace_vkCmdWriteBufferMarkerAMD(VkCommandBuffer commandBuffer, VkPipelineStageFlagBits pipelineStage, VkBuffer dstBuffer, VkDeviceSize dstOffset, uint32_t marker) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdWriteBufferMarkerAMD)traced_procs[257])(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker);
+    TraceCall(257, start);
+}
+
+//--------------------------Table trace thunks--------------------------
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkDestroyDevice(VkDevice device, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDestroyDevice)table_procs[12])(device, pAllocator);
+    TraceCall(12, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkGetDeviceQueue(VkDevice device, uint32_t queueFamilyIndex, uint32_t queueIndex, VkQueue* pQueue) {
+    uint64_t start = TraceTime();
+    ((PFN_vkGetDeviceQueue)table_procs[17])(device, queueFamilyIndex, queueIndex, pQueue);
+    TraceCall(17, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkQueueSubmit)table_procs[18])(queue, submitCount, pSubmits, fence);
+    TraceCall(18, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkQueueWaitIdle(VkQueue queue) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkQueueWaitIdle)table_procs[19])(queue);
+    TraceCall(19, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkDeviceWaitIdle(VkDevice device) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkDeviceWaitIdle)table_procs[20])(device);
+    TraceCall(20, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkAllocateMemory(VkDevice device, const VkMemoryAllocateInfo* pAllocateInfo, const VkAllocationCallbacks* pAllocator, VkDeviceMemory* pMemory) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkAllocateMemory)table_procs[21])(device, pAllocateInfo, pAllocator, pMemory);
+    TraceCall(21, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkFreeMemory(VkDevice device, VkDeviceMemory memory, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkFreeMemory)table_procs[22])(device, memory, pAllocator);
+    TraceCall(22, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkMapMemory(VkDevice device, VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize size, VkMemoryMapFlags flags, void** ppData) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkMapMemory)table_procs[23])(device, memory, offset, size, flags, ppData);
+    TraceCall(23, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkUnmapMemory(VkDevice device, VkDeviceMemory memory) {
+    uint64_t start = TraceTime();
+    ((PFN_vkUnmapMemory)table_procs[24])(device, memory);
+    TraceCall(24, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkFlushMappedMemoryRanges(VkDevice device, uint32_t memoryRangeCount, const VkMappedMemoryRange* pMemoryRanges) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkFlushMappedMemoryRanges)table_procs[25])(device, memoryRangeCount, pMemoryRanges);
+    TraceCall(25, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkInvalidateMappedMemoryRanges(VkDevice device, uint32_t memoryRangeCount, const VkMappedMemoryRange* pMemoryRanges) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkInvalidateMappedMemoryRanges)table_procs[26])(device, memoryRangeCount, pMemoryRanges);
+    TraceCall(26, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkGetDeviceMemoryCommitment(VkDevice device, VkDeviceMemory memory, VkDeviceSize* pCommittedMemoryInBytes) {
+    uint64_t start = TraceTime();
+    ((PFN_vkGetDeviceMemoryCommitment)table_procs[27])(device, memory, pCommittedMemoryInBytes);
+    TraceCall(27, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkBindBufferMemory(VkDevice device, VkBuffer buffer, VkDeviceMemory memory, VkDeviceSize memoryOffset) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkBindBufferMemory)table_procs[28])(device, buffer, memory, memoryOffset);
+    TraceCall(28, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkBindImageMemory(VkDevice device, VkImage image, VkDeviceMemory memory, VkDeviceSize memoryOffset) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkBindImageMemory)table_procs[29])(device, image, memory, memoryOffset);
+    TraceCall(29, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkGetBufferMemoryRequirements(VkDevice device, VkBuffer buffer, VkMemoryRequirements* pMemoryRequirements) {
+    uint64_t start = TraceTime();
+    ((PFN_vkGetBufferMemoryRequirements)table_procs[30])(device, buffer, pMemoryRequirements);
+    TraceCall(30, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkGetImageMemoryRequirements(VkDevice device, VkImage image, VkMemoryRequirements* pMemoryRequirements) {
+    uint64_t start = TraceTime();
+    ((PFN_vkGetImageMemoryRequirements)table_procs[31])(device, image, pMemoryRequirements);
+    TraceCall(31, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkGetImageSparseMemoryRequirements(VkDevice device, VkImage image, uint32_t* pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements* pSparseMemoryRequirements) {
+    uint64_t start = TraceTime();
+    ((PFN_vkGetImageSparseMemoryRequirements)table_procs[32])(device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+    TraceCall(32, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkQueueBindSparse(VkQueue queue, uint32_t bindInfoCount, const VkBindSparseInfo* pBindInfo, VkFence fence) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkQueueBindSparse)table_procs[34])(queue, bindInfoCount, pBindInfo, fence);
+    TraceCall(34, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkCreateFence(VkDevice device, const VkFenceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkFence* pFence) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateFence)table_procs[35])(device, pCreateInfo, pAllocator, pFence);
+    TraceCall(35, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkDestroyFence(VkDevice device, VkFence fence, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDestroyFence)table_procs[36])(device, fence, pAllocator);
+    TraceCall(36, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkResetFences(VkDevice device, uint32_t fenceCount, const VkFence* pFences) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkResetFences)table_procs[37])(device, fenceCount, pFences);
+    TraceCall(37, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkGetFenceStatus(VkDevice device, VkFence fence) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetFenceStatus)table_procs[38])(device, fence);
+    TraceCall(38, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkWaitForFences(VkDevice device, uint32_t fenceCount, const VkFence* pFences, VkBool32 waitAll, uint64_t timeout) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkWaitForFences)table_procs[39])(device, fenceCount, pFences, waitAll, timeout);
+    TraceCall(39, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkCreateSemaphore(VkDevice device, const VkSemaphoreCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSemaphore* pSemaphore) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateSemaphore)table_procs[40])(device, pCreateInfo, pAllocator, pSemaphore);
+    TraceCall(40, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkDestroySemaphore(VkDevice device, VkSemaphore semaphore, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDestroySemaphore)table_procs[41])(device, semaphore, pAllocator);
+    TraceCall(41, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkCreateEvent(VkDevice device, const VkEventCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkEvent* pEvent) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateEvent)table_procs[42])(device, pCreateInfo, pAllocator, pEvent);
+    TraceCall(42, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkDestroyEvent(VkDevice device, VkEvent event, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDestroyEvent)table_procs[43])(device, event, pAllocator);
+    TraceCall(43, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkGetEventStatus(VkDevice device, VkEvent event) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetEventStatus)table_procs[44])(device, event);
+    TraceCall(44, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkSetEvent(VkDevice device, VkEvent event) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkSetEvent)table_procs[45])(device, event);
+    TraceCall(45, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkResetEvent(VkDevice device, VkEvent event) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkResetEvent)table_procs[46])(device, event);
+    TraceCall(46, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkCreateQueryPool(VkDevice device, const VkQueryPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkQueryPool* pQueryPool) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateQueryPool)table_procs[47])(device, pCreateInfo, pAllocator, pQueryPool);
+    TraceCall(47, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkDestroyQueryPool(VkDevice device, VkQueryPool queryPool, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDestroyQueryPool)table_procs[48])(device, queryPool, pAllocator);
+    TraceCall(48, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkGetQueryPoolResults(VkDevice device, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, size_t dataSize, void* pData, VkDeviceSize stride, VkQueryResultFlags flags) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetQueryPoolResults)table_procs[49])(device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags);
+    TraceCall(49, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkCreateBuffer(VkDevice device, const VkBufferCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkBuffer* pBuffer) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateBuffer)table_procs[50])(device, pCreateInfo, pAllocator, pBuffer);
+    TraceCall(50, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkDestroyBuffer(VkDevice device, VkBuffer buffer, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDestroyBuffer)table_procs[51])(device, buffer, pAllocator);
+    TraceCall(51, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkCreateBufferView(VkDevice device, const VkBufferViewCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkBufferView* pView) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateBufferView)table_procs[52])(device, pCreateInfo, pAllocator, pView);
+    TraceCall(52, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkDestroyBufferView(VkDevice device, VkBufferView bufferView, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDestroyBufferView)table_procs[53])(device, bufferView, pAllocator);
+    TraceCall(53, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkCreateImage(VkDevice device, const VkImageCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkImage* pImage) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateImage)table_procs[54])(device, pCreateInfo, pAllocator, pImage);
+    TraceCall(54, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkDestroyImage(VkDevice device, VkImage image, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDestroyImage)table_procs[55])(device, image, pAllocator);
+    TraceCall(55, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkGetImageSubresourceLayout(VkDevice device, VkImage image, const VkImageSubresource* pSubresource, VkSubresourceLayout* pLayout) {
+    uint64_t start = TraceTime();
+    ((PFN_vkGetImageSubresourceLayout)table_procs[56])(device, image, pSubresource, pLayout);
+    TraceCall(56, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkCreateImageView(VkDevice device, const VkImageViewCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkImageView* pView) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateImageView)table_procs[57])(device, pCreateInfo, pAllocator, pView);
+    TraceCall(57, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkDestroyImageView(VkDevice device, VkImageView imageView, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDestroyImageView)table_procs[58])(device, imageView, pAllocator);
+    TraceCall(58, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateShaderModule)table_procs[59])(device, pCreateInfo, pAllocator, pShaderModule);
+    TraceCall(59, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkDestroyShaderModule(VkDevice device, VkShaderModule shaderModule, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDestroyShaderModule)table_procs[60])(device, shaderModule, pAllocator);
+    TraceCall(60, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkCreatePipelineCache(VkDevice device, const VkPipelineCacheCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkPipelineCache* pPipelineCache) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreatePipelineCache)table_procs[61])(device, pCreateInfo, pAllocator, pPipelineCache);
+    TraceCall(61, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkDestroyPipelineCache(VkDevice device, VkPipelineCache pipelineCache, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDestroyPipelineCache)table_procs[62])(device, pipelineCache, pAllocator);
+    TraceCall(62, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkGetPipelineCacheData(VkDevice device, VkPipelineCache pipelineCache, size_t* pDataSize, void* pData) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetPipelineCacheData)table_procs[63])(device, pipelineCache, pDataSize, pData);
+    TraceCall(63, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkMergePipelineCaches(VkDevice device, VkPipelineCache dstCache, uint32_t srcCacheCount, const VkPipelineCache* pSrcCaches) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkMergePipelineCaches)table_procs[64])(device, dstCache, srcCacheCount, pSrcCaches);
+    TraceCall(64, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkGraphicsPipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateGraphicsPipelines)table_procs[65])(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+    TraceCall(65, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkCreateComputePipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkComputePipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateComputePipelines)table_procs[66])(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+    TraceCall(66, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkDestroyPipeline(VkDevice device, VkPipeline pipeline, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDestroyPipeline)table_procs[67])(device, pipeline, pAllocator);
+    TraceCall(67, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkCreatePipelineLayout(VkDevice device, const VkPipelineLayoutCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkPipelineLayout* pPipelineLayout) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreatePipelineLayout)table_procs[68])(device, pCreateInfo, pAllocator, pPipelineLayout);
+    TraceCall(68, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkDestroyPipelineLayout(VkDevice device, VkPipelineLayout pipelineLayout, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDestroyPipelineLayout)table_procs[69])(device, pipelineLayout, pAllocator);
+    TraceCall(69, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkCreateSampler(VkDevice device, const VkSamplerCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSampler* pSampler) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateSampler)table_procs[70])(device, pCreateInfo, pAllocator, pSampler);
+    TraceCall(70, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkDestroySampler(VkDevice device, VkSampler sampler, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDestroySampler)table_procs[71])(device, sampler, pAllocator);
+    TraceCall(71, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkCreateDescriptorSetLayout(VkDevice device, const VkDescriptorSetLayoutCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorSetLayout* pSetLayout) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateDescriptorSetLayout)table_procs[72])(device, pCreateInfo, pAllocator, pSetLayout);
+    TraceCall(72, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkDestroyDescriptorSetLayout(VkDevice device, VkDescriptorSetLayout descriptorSetLayout, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDestroyDescriptorSetLayout)table_procs[73])(device, descriptorSetLayout, pAllocator);
+    TraceCall(73, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkCreateDescriptorPool(VkDevice device, const VkDescriptorPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorPool* pDescriptorPool) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateDescriptorPool)table_procs[74])(device, pCreateInfo, pAllocator, pDescriptorPool);
+    TraceCall(74, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkDestroyDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDestroyDescriptorPool)table_procs[75])(device, descriptorPool, pAllocator);
+    TraceCall(75, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkResetDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool, VkDescriptorPoolResetFlags flags) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkResetDescriptorPool)table_procs[76])(device, descriptorPool, flags);
+    TraceCall(76, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkAllocateDescriptorSets(VkDevice device, const VkDescriptorSetAllocateInfo* pAllocateInfo, VkDescriptorSet* pDescriptorSets) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkAllocateDescriptorSets)table_procs[77])(device, pAllocateInfo, pDescriptorSets);
+    TraceCall(77, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkFreeDescriptorSets(VkDevice device, VkDescriptorPool descriptorPool, uint32_t descriptorSetCount, const VkDescriptorSet* pDescriptorSets) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkFreeDescriptorSets)table_procs[78])(device, descriptorPool, descriptorSetCount, pDescriptorSets);
+    TraceCall(78, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkUpdateDescriptorSets(VkDevice device, uint32_t descriptorWriteCount, const VkWriteDescriptorSet* pDescriptorWrites, uint32_t descriptorCopyCount, const VkCopyDescriptorSet* pDescriptorCopies) {
+    uint64_t start = TraceTime();
+    ((PFN_vkUpdateDescriptorSets)table_procs[79])(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
+    TraceCall(79, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkCreateFramebuffer(VkDevice device, const VkFramebufferCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkFramebuffer* pFramebuffer) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateFramebuffer)table_procs[80])(device, pCreateInfo, pAllocator, pFramebuffer);
+    TraceCall(80, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkDestroyFramebuffer(VkDevice device, VkFramebuffer framebuffer, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDestroyFramebuffer)table_procs[81])(device, framebuffer, pAllocator);
+    TraceCall(81, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkCreateRenderPass(VkDevice device, const VkRenderPassCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateRenderPass)table_procs[82])(device, pCreateInfo, pAllocator, pRenderPass);
+    TraceCall(82, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkDestroyRenderPass(VkDevice device, VkRenderPass renderPass, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDestroyRenderPass)table_procs[83])(device, renderPass, pAllocator);
+    TraceCall(83, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkGetRenderAreaGranularity(VkDevice device, VkRenderPass renderPass, VkExtent2D* pGranularity) {
+    uint64_t start = TraceTime();
+    ((PFN_vkGetRenderAreaGranularity)table_procs[84])(device, renderPass, pGranularity);
+    TraceCall(84, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkCreateCommandPool(VkDevice device, const VkCommandPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkCommandPool* pCommandPool) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateCommandPool)table_procs[85])(device, pCreateInfo, pAllocator, pCommandPool);
+    TraceCall(85, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkDestroyCommandPool(VkDevice device, VkCommandPool commandPool, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDestroyCommandPool)table_procs[86])(device, commandPool, pAllocator);
+    TraceCall(86, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkResetCommandPool(VkDevice device, VkCommandPool commandPool, VkCommandPoolResetFlags flags) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkResetCommandPool)table_procs[87])(device, commandPool, flags);
+    TraceCall(87, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkAllocateCommandBuffers(VkDevice device, const VkCommandBufferAllocateInfo* pAllocateInfo, VkCommandBuffer* pCommandBuffers) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkAllocateCommandBuffers)table_procs[88])(device, pAllocateInfo, pCommandBuffers);
+    TraceCall(88, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkFreeCommandBuffers(VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount, const VkCommandBuffer* pCommandBuffers) {
+    uint64_t start = TraceTime();
+    ((PFN_vkFreeCommandBuffers)table_procs[89])(device, commandPool, commandBufferCount, pCommandBuffers);
+    TraceCall(89, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkBeginCommandBuffer(VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo* pBeginInfo) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkBeginCommandBuffer)table_procs[90])(commandBuffer, pBeginInfo);
+    TraceCall(90, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkEndCommandBuffer(VkCommandBuffer commandBuffer) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkEndCommandBuffer)table_procs[91])(commandBuffer);
+    TraceCall(91, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkResetCommandBuffer(VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flags) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkResetCommandBuffer)table_procs[92])(commandBuffer, flags);
+    TraceCall(92, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdBindPipeline(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipeline pipeline) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdBindPipeline)table_procs[93])(commandBuffer, pipelineBindPoint, pipeline);
+    TraceCall(93, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdSetViewport(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount, const VkViewport* pViewports) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdSetViewport)table_procs[94])(commandBuffer, firstViewport, viewportCount, pViewports);
+    TraceCall(94, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdSetScissor(VkCommandBuffer commandBuffer, uint32_t firstScissor, uint32_t scissorCount, const VkRect2D* pScissors) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdSetScissor)table_procs[95])(commandBuffer, firstScissor, scissorCount, pScissors);
+    TraceCall(95, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdSetLineWidth(VkCommandBuffer commandBuffer, float lineWidth) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdSetLineWidth)table_procs[96])(commandBuffer, lineWidth);
+    TraceCall(96, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdSetDepthBias(VkCommandBuffer commandBuffer, float depthBiasConstantFactor, float depthBiasClamp, float depthBiasSlopeFactor) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdSetDepthBias)table_procs[97])(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
+    TraceCall(97, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdSetBlendConstants(VkCommandBuffer commandBuffer, const float blendConstants[4]) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdSetBlendConstants)table_procs[98])(commandBuffer, blendConstants);
+    TraceCall(98, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdSetDepthBounds(VkCommandBuffer commandBuffer, float minDepthBounds, float maxDepthBounds) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdSetDepthBounds)table_procs[99])(commandBuffer, minDepthBounds, maxDepthBounds);
+    TraceCall(99, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdSetStencilCompareMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t compareMask) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdSetStencilCompareMask)table_procs[100])(commandBuffer, faceMask, compareMask);
+    TraceCall(100, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdSetStencilWriteMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t writeMask) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdSetStencilWriteMask)table_procs[101])(commandBuffer, faceMask, writeMask);
+    TraceCall(101, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdSetStencilReference(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t reference) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdSetStencilReference)table_procs[102])(commandBuffer, faceMask, reference);
+    TraceCall(102, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdBindDescriptorSets(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, uint32_t firstSet, uint32_t descriptorSetCount, const VkDescriptorSet* pDescriptorSets, uint32_t dynamicOffsetCount, const uint32_t* pDynamicOffsets) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdBindDescriptorSets)table_procs[103])(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
+    TraceCall(103, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdBindIndexBuffer(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkIndexType indexType) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdBindIndexBuffer)table_procs[104])(commandBuffer, buffer, offset, indexType);
+    TraceCall(104, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdBindVertexBuffers(VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount, const VkBuffer* pBuffers, const VkDeviceSize* pOffsets) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdBindVertexBuffers)table_procs[105])(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
+    TraceCall(105, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdDraw)table_procs[106])(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
+    TraceCall(106, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdDrawIndexed(VkCommandBuffer commandBuffer, uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdDrawIndexed)table_procs[107])(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
+    TraceCall(107, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdDrawIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdDrawIndirect)table_procs[108])(commandBuffer, buffer, offset, drawCount, stride);
+    TraceCall(108, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdDrawIndexedIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdDrawIndexedIndirect)table_procs[109])(commandBuffer, buffer, offset, drawCount, stride);
+    TraceCall(109, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdDispatch(VkCommandBuffer commandBuffer, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdDispatch)table_procs[110])(commandBuffer, groupCountX, groupCountY, groupCountZ);
+    TraceCall(110, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdDispatchIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdDispatchIndirect)table_procs[111])(commandBuffer, buffer, offset);
+    TraceCall(111, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer, uint32_t regionCount, const VkBufferCopy* pRegions) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdCopyBuffer)table_procs[112])(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
+    TraceCall(112, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdCopyImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageCopy* pRegions) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdCopyImage)table_procs[113])(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
+    TraceCall(113, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdBlitImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageBlit* pRegions, VkFilter filter) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdBlitImage)table_procs[114])(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
+    TraceCall(114, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdCopyBufferToImage(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkBufferImageCopy* pRegions) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdCopyBufferToImage)table_procs[115])(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
+    TraceCall(115, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdCopyImageToBuffer(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkBuffer dstBuffer, uint32_t regionCount, const VkBufferImageCopy* pRegions) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdCopyImageToBuffer)table_procs[116])(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
+    TraceCall(116, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdUpdateBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize dataSize, const void* pData) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdUpdateBuffer)table_procs[117])(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
+    TraceCall(117, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdFillBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize size, uint32_t data) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdFillBuffer)table_procs[118])(commandBuffer, dstBuffer, dstOffset, size, data);
+    TraceCall(118, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdClearColorImage(VkCommandBuffer commandBuffer, VkImage image, VkImageLayout imageLayout, const VkClearColorValue* pColor, uint32_t rangeCount, const VkImageSubresourceRange* pRanges) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdClearColorImage)table_procs[119])(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
+    TraceCall(119, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdClearDepthStencilImage(VkCommandBuffer commandBuffer, VkImage image, VkImageLayout imageLayout, const VkClearDepthStencilValue* pDepthStencil, uint32_t rangeCount, const VkImageSubresourceRange* pRanges) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdClearDepthStencilImage)table_procs[120])(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
+    TraceCall(120, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdClearAttachments(VkCommandBuffer commandBuffer, uint32_t attachmentCount, const VkClearAttachment* pAttachments, uint32_t rectCount, const VkClearRect* pRects) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdClearAttachments)table_procs[121])(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
+    TraceCall(121, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdResolveImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageResolve* pRegions) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdResolveImage)table_procs[122])(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
+    TraceCall(122, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdSetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdSetEvent)table_procs[123])(commandBuffer, event, stageMask);
+    TraceCall(123, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdResetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdResetEvent)table_procs[124])(commandBuffer, event, stageMask);
+    TraceCall(124, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdWaitEvents(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent* pEvents, VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask, uint32_t memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers, uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier* pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier* pImageMemoryBarriers) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdWaitEvents)table_procs[125])(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
+    TraceCall(125, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdPipelineBarrier(VkCommandBuffer commandBuffer, VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask, VkDependencyFlags dependencyFlags, uint32_t memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers, uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier* pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier* pImageMemoryBarriers) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdPipelineBarrier)table_procs[126])(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
+    TraceCall(126, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdBeginQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query, VkQueryControlFlags flags) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdBeginQuery)table_procs[127])(commandBuffer, queryPool, query, flags);
+    TraceCall(127, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdEndQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdEndQuery)table_procs[128])(commandBuffer, queryPool, query);
+    TraceCall(128, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdResetQueryPool(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdResetQueryPool)table_procs[129])(commandBuffer, queryPool, firstQuery, queryCount);
+    TraceCall(129, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdWriteTimestamp(VkCommandBuffer commandBuffer, VkPipelineStageFlagBits pipelineStage, VkQueryPool queryPool, uint32_t query) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdWriteTimestamp)table_procs[130])(commandBuffer, pipelineStage, queryPool, query);
+    TraceCall(130, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdCopyQueryPoolResults(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize stride, VkQueryResultFlags flags) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdCopyQueryPoolResults)table_procs[131])(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
+    TraceCall(131, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdPushConstants(VkCommandBuffer commandBuffer, VkPipelineLayout layout, VkShaderStageFlags stageFlags, uint32_t offset, uint32_t size, const void* pValues) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdPushConstants)table_procs[132])(commandBuffer, layout, stageFlags, offset, size, pValues);
+    TraceCall(132, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo* pRenderPassBegin, VkSubpassContents contents) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdBeginRenderPass)table_procs[133])(commandBuffer, pRenderPassBegin, contents);
+    TraceCall(133, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdNextSubpass(VkCommandBuffer commandBuffer, VkSubpassContents contents) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdNextSubpass)table_procs[134])(commandBuffer, contents);
+    TraceCall(134, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdEndRenderPass(VkCommandBuffer commandBuffer) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdEndRenderPass)table_procs[135])(commandBuffer);
+    TraceCall(135, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t commandBufferCount, const VkCommandBuffer* pCommandBuffers) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdExecuteCommands)table_procs[136])(commandBuffer, commandBufferCount, pCommandBuffers);
+    TraceCall(136, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkCreateSwapchainKHR(VkDevice device, const VkSwapchainCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchain) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateSwapchainKHR)table_procs[142])(device, pCreateInfo, pAllocator, pSwapchain);
+    TraceCall(142, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkDestroySwapchainKHR(VkDevice device, VkSwapchainKHR swapchain, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDestroySwapchainKHR)table_procs[143])(device, swapchain, pAllocator);
+    TraceCall(143, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkGetSwapchainImagesKHR(VkDevice device, VkSwapchainKHR swapchain, uint32_t* pSwapchainImageCount, VkImage* pSwapchainImages) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetSwapchainImagesKHR)table_procs[144])(device, swapchain, pSwapchainImageCount, pSwapchainImages);
+    TraceCall(144, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkAcquireNextImageKHR(VkDevice device, VkSwapchainKHR swapchain, uint64_t timeout, VkSemaphore semaphore, VkFence fence, uint32_t* pImageIndex) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkAcquireNextImageKHR)table_procs[145])(device, swapchain, timeout, semaphore, fence, pImageIndex);
+    TraceCall(145, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR* pPresentInfo) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkQueuePresentKHR)table_procs[146])(queue, pPresentInfo);
+    TraceCall(146, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkCreateSharedSwapchainsKHR(VkDevice device, uint32_t swapchainCount, const VkSwapchainCreateInfoKHR* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchains) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateSharedSwapchainsKHR)table_procs[154])(device, swapchainCount, pCreateInfos, pAllocator, pSwapchains);
+    TraceCall(154, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkTrimCommandPoolKHR(VkDevice device, VkCommandPool commandPool, VkCommandPoolTrimFlagsKHR flags) {
+    uint64_t start = TraceTime();
+    ((PFN_vkTrimCommandPoolKHR)table_procs[173])(device, commandPool, flags);
+    TraceCall(173, start);
+}
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkGetMemoryWin32HandleKHR(VkDevice device, const VkMemoryGetWin32HandleInfoKHR* pGetWin32HandleInfo, HANDLE* pHandle) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetMemoryWin32HandleKHR)table_procs[175])(device, pGetWin32HandleInfo, pHandle);
+    TraceCall(175, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkGetMemoryWin32HandlePropertiesKHR(VkDevice device, VkExternalMemoryHandleTypeFlagBitsKHR handleType, HANDLE handle, VkMemoryWin32HandlePropertiesKHR* pMemoryWin32HandleProperties) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetMemoryWin32HandlePropertiesKHR)table_procs[176])(device, handleType, handle, pMemoryWin32HandleProperties);
+    TraceCall(176, start);
+    return result;
+}
+#endif
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkGetMemoryFdKHR(VkDevice device, const VkMemoryGetFdInfoKHR* pGetFdInfo, int* pFd) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetMemoryFdKHR)table_procs[177])(device, pGetFdInfo, pFd);
+    TraceCall(177, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkGetMemoryFdPropertiesKHR(VkDevice device, VkExternalMemoryHandleTypeFlagBitsKHR handleType, int fd, VkMemoryFdPropertiesKHR* pMemoryFdProperties) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetMemoryFdPropertiesKHR)table_procs[178])(device, handleType, fd, pMemoryFdProperties);
+    TraceCall(178, start);
+    return result;
+}
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkImportSemaphoreWin32HandleKHR(VkDevice device, const VkImportSemaphoreWin32HandleInfoKHR* pImportSemaphoreWin32HandleInfo) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkImportSemaphoreWin32HandleKHR)table_procs[180])(device, pImportSemaphoreWin32HandleInfo);
+    TraceCall(180, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkGetSemaphoreWin32HandleKHR(VkDevice device, const VkSemaphoreGetWin32HandleInfoKHR* pGetWin32HandleInfo, HANDLE* pHandle) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetSemaphoreWin32HandleKHR)table_procs[181])(device, pGetWin32HandleInfo, pHandle);
+    TraceCall(181, start);
+    return result;
+}
+#endif
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkImportSemaphoreFdKHR(VkDevice device, const VkImportSemaphoreFdInfoKHR* pImportSemaphoreFdInfo) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkImportSemaphoreFdKHR)table_procs[182])(device, pImportSemaphoreFdInfo);
+    TraceCall(182, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkGetSemaphoreFdKHR(VkDevice device, const VkSemaphoreGetFdInfoKHR* pGetFdInfo, int* pFd) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetSemaphoreFdKHR)table_procs[183])(device, pGetFdInfo, pFd);
+    TraceCall(183, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdPushDescriptorSetKHR(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, uint32_t set, uint32_t descriptorWriteCount, const VkWriteDescriptorSet* pDescriptorWrites) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdPushDescriptorSetKHR)table_procs[184])(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
+    TraceCall(184, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkCreateDescriptorUpdateTemplateKHR(VkDevice device, const VkDescriptorUpdateTemplateCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorUpdateTemplateKHR* pDescriptorUpdateTemplate) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateDescriptorUpdateTemplateKHR)table_procs[185])(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
+    TraceCall(185, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkDestroyDescriptorUpdateTemplateKHR(VkDevice device, VkDescriptorUpdateTemplateKHR descriptorUpdateTemplate, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDestroyDescriptorUpdateTemplateKHR)table_procs[186])(device, descriptorUpdateTemplate, pAllocator);
+    TraceCall(186, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkUpdateDescriptorSetWithTemplateKHR(VkDevice device, VkDescriptorSet descriptorSet, VkDescriptorUpdateTemplateKHR descriptorUpdateTemplate, const void* pData) {
+    uint64_t start = TraceTime();
+    ((PFN_vkUpdateDescriptorSetWithTemplateKHR)table_procs[187])(device, descriptorSet, descriptorUpdateTemplate, pData);
+    TraceCall(187, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdPushDescriptorSetWithTemplateKHR(VkCommandBuffer commandBuffer, VkDescriptorUpdateTemplateKHR descriptorUpdateTemplate, VkPipelineLayout layout, uint32_t set, const void* pData) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdPushDescriptorSetWithTemplateKHR)table_procs[188])(commandBuffer, descriptorUpdateTemplate, layout, set, pData);
+    TraceCall(188, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkGetSwapchainStatusKHR(VkDevice device, VkSwapchainKHR swapchain) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetSwapchainStatusKHR)table_procs[189])(device, swapchain);
+    TraceCall(189, start);
+    return result;
+}
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkImportFenceWin32HandleKHR(VkDevice device, const VkImportFenceWin32HandleInfoKHR* pImportFenceWin32HandleInfo) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkImportFenceWin32HandleKHR)table_procs[191])(device, pImportFenceWin32HandleInfo);
+    TraceCall(191, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkGetFenceWin32HandleKHR(VkDevice device, const VkFenceGetWin32HandleInfoKHR* pGetWin32HandleInfo, HANDLE* pHandle) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetFenceWin32HandleKHR)table_procs[192])(device, pGetWin32HandleInfo, pHandle);
+    TraceCall(192, start);
+    return result;
+}
+#endif
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkImportFenceFdKHR(VkDevice device, const VkImportFenceFdInfoKHR* pImportFenceFdInfo) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkImportFenceFdKHR)table_procs[193])(device, pImportFenceFdInfo);
+    TraceCall(193, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkGetFenceFdKHR(VkDevice device, const VkFenceGetFdInfoKHR* pGetFdInfo, int* pFd) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetFenceFdKHR)table_procs[194])(device, pGetFdInfo, pFd);
+    TraceCall(194, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkGetImageMemoryRequirements2KHR(VkDevice device, const VkImageMemoryRequirementsInfo2KHR* pInfo, VkMemoryRequirements2KHR* pMemoryRequirements) {
+    uint64_t start = TraceTime();
+    ((PFN_vkGetImageMemoryRequirements2KHR)table_procs[197])(device, pInfo, pMemoryRequirements);
+    TraceCall(197, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkGetBufferMemoryRequirements2KHR(VkDevice device, const VkBufferMemoryRequirementsInfo2KHR* pInfo, VkMemoryRequirements2KHR* pMemoryRequirements) {
+    uint64_t start = TraceTime();
+    ((PFN_vkGetBufferMemoryRequirements2KHR)table_procs[198])(device, pInfo, pMemoryRequirements);
+    TraceCall(198, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkGetImageSparseMemoryRequirements2KHR(VkDevice device, const VkImageSparseMemoryRequirementsInfo2KHR* pInfo, uint32_t* pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements2KHR* pSparseMemoryRequirements) {
+    uint64_t start = TraceTime();
+    ((PFN_vkGetImageSparseMemoryRequirements2KHR)table_procs[199])(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+    TraceCall(199, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkCreateSamplerYcbcrConversionKHR(VkDevice device, const VkSamplerYcbcrConversionCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSamplerYcbcrConversionKHR* pYcbcrConversion) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateSamplerYcbcrConversionKHR)table_procs[200])(device, pCreateInfo, pAllocator, pYcbcrConversion);
+    TraceCall(200, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkDestroySamplerYcbcrConversionKHR(VkDevice device, VkSamplerYcbcrConversionKHR ycbcrConversion, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDestroySamplerYcbcrConversionKHR)table_procs[201])(device, ycbcrConversion, pAllocator);
+    TraceCall(201, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkBindBufferMemory2KHR(VkDevice device, uint32_t bindInfoCount, const VkBindBufferMemoryInfoKHR* pBindInfos) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkBindBufferMemory2KHR)table_procs[202])(device, bindInfoCount, pBindInfos);
+    TraceCall(202, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkBindImageMemory2KHR(VkDevice device, uint32_t bindInfoCount, const VkBindImageMemoryInfoKHR* pBindInfos) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkBindImageMemory2KHR)table_procs[203])(device, bindInfoCount, pBindInfos);
+    TraceCall(203, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkDebugMarkerSetObjectTagEXT(VkDevice device, const VkDebugMarkerObjectTagInfoEXT* pTagInfo) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkDebugMarkerSetObjectTagEXT)table_procs[207])(device, pTagInfo);
+    TraceCall(207, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkDebugMarkerSetObjectNameEXT(VkDevice device, const VkDebugMarkerObjectNameInfoEXT* pNameInfo) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkDebugMarkerSetObjectNameEXT)table_procs[208])(device, pNameInfo);
+    TraceCall(208, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdDebugMarkerBeginEXT(VkCommandBuffer commandBuffer, const VkDebugMarkerMarkerInfoEXT* pMarkerInfo) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdDebugMarkerBeginEXT)table_procs[209])(commandBuffer, pMarkerInfo);
+    TraceCall(209, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdDebugMarkerEndEXT(VkCommandBuffer commandBuffer) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdDebugMarkerEndEXT)table_procs[210])(commandBuffer);
+    TraceCall(210, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdDebugMarkerInsertEXT(VkCommandBuffer commandBuffer, const VkDebugMarkerMarkerInfoEXT* pMarkerInfo) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdDebugMarkerInsertEXT)table_procs[211])(commandBuffer, pMarkerInfo);
+    TraceCall(211, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdDrawIndirectCountAMD(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdDrawIndirectCountAMD)table_procs[212])(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+    TraceCall(212, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdDrawIndexedIndirectCountAMD(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdDrawIndexedIndirectCountAMD)table_procs[213])(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+    TraceCall(213, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkGetShaderInfoAMD(VkDevice device, VkPipeline pipeline, VkShaderStageFlagBits shaderStage, VkShaderInfoTypeAMD infoType, size_t* pInfoSize, void* pInfo) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetShaderInfoAMD)table_procs[214])(device, pipeline, shaderStage, infoType, pInfoSize, pInfo);
+    TraceCall(214, start);
+    return result;
+}
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkGetMemoryWin32HandleNV(VkDevice device, VkDeviceMemory memory, VkExternalMemoryHandleTypeFlagsNV handleType, HANDLE* pHandle) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetMemoryWin32HandleNV)table_procs[216])(device, memory, handleType, pHandle);
+    TraceCall(216, start);
+    return result;
+}
+#endif
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkGetDeviceGroupPeerMemoryFeaturesKHX(VkDevice device, uint32_t heapIndex, uint32_t localDeviceIndex, uint32_t remoteDeviceIndex, VkPeerMemoryFeatureFlagsKHX* pPeerMemoryFeatures) {
+    uint64_t start = TraceTime();
+    ((PFN_vkGetDeviceGroupPeerMemoryFeaturesKHX)table_procs[217])(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
+    TraceCall(217, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdSetDeviceMaskKHX(VkCommandBuffer commandBuffer, uint32_t deviceMask) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdSetDeviceMaskKHX)table_procs[218])(commandBuffer, deviceMask);
+    TraceCall(218, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdDispatchBaseKHX(VkCommandBuffer commandBuffer, uint32_t baseGroupX, uint32_t baseGroupY, uint32_t baseGroupZ, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdDispatchBaseKHX)table_procs[219])(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
+    TraceCall(219, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkGetDeviceGroupPresentCapabilitiesKHX(VkDevice device, VkDeviceGroupPresentCapabilitiesKHX* pDeviceGroupPresentCapabilities) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetDeviceGroupPresentCapabilitiesKHX)table_procs[220])(device, pDeviceGroupPresentCapabilities);
+    TraceCall(220, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkGetDeviceGroupSurfacePresentModesKHX(VkDevice device, VkSurfaceKHR surface, VkDeviceGroupPresentModeFlagsKHX* pModes) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetDeviceGroupSurfacePresentModesKHX)table_procs[221])(device, surface, pModes);
+    TraceCall(221, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkAcquireNextImage2KHX(VkDevice device, const VkAcquireNextImageInfoKHX* pAcquireInfo, uint32_t* pImageIndex) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkAcquireNextImage2KHX)table_procs[223])(device, pAcquireInfo, pImageIndex);
+    TraceCall(223, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdProcessCommandsNVX(VkCommandBuffer commandBuffer, const VkCmdProcessCommandsInfoNVX* pProcessCommandsInfo) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdProcessCommandsNVX)table_procs[226])(commandBuffer, pProcessCommandsInfo);
+    TraceCall(226, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdReserveSpaceForCommandsNVX(VkCommandBuffer commandBuffer, const VkCmdReserveSpaceForCommandsInfoNVX* pReserveSpaceInfo) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdReserveSpaceForCommandsNVX)table_procs[227])(commandBuffer, pReserveSpaceInfo);
+    TraceCall(227, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkCreateIndirectCommandsLayoutNVX(VkDevice device, const VkIndirectCommandsLayoutCreateInfoNVX* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkIndirectCommandsLayoutNVX* pIndirectCommandsLayout) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateIndirectCommandsLayoutNVX)table_procs[228])(device, pCreateInfo, pAllocator, pIndirectCommandsLayout);
+    TraceCall(228, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkDestroyIndirectCommandsLayoutNVX(VkDevice device, VkIndirectCommandsLayoutNVX indirectCommandsLayout, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDestroyIndirectCommandsLayoutNVX)table_procs[229])(device, indirectCommandsLayout, pAllocator);
+    TraceCall(229, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkCreateObjectTableNVX(VkDevice device, const VkObjectTableCreateInfoNVX* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkObjectTableNVX* pObjectTable) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateObjectTableNVX)table_procs[230])(device, pCreateInfo, pAllocator, pObjectTable);
+    TraceCall(230, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkDestroyObjectTableNVX(VkDevice device, VkObjectTableNVX objectTable, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDestroyObjectTableNVX)table_procs[231])(device, objectTable, pAllocator);
+    TraceCall(231, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkRegisterObjectsNVX(VkDevice device, VkObjectTableNVX objectTable, uint32_t objectCount, const VkObjectTableEntryNVX* const* ppObjectTableEntries, const uint32_t* pObjectIndices) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkRegisterObjectsNVX)table_procs[232])(device, objectTable, objectCount, ppObjectTableEntries, pObjectIndices);
+    TraceCall(232, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkUnregisterObjectsNVX(VkDevice device, VkObjectTableNVX objectTable, uint32_t objectCount, const VkObjectEntryTypeNVX* pObjectEntryTypes, const uint32_t* pObjectIndices) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkUnregisterObjectsNVX)table_procs[233])(device, objectTable, objectCount, pObjectEntryTypes, pObjectIndices);
+    TraceCall(233, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdSetViewportWScalingNV(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount, const VkViewportWScalingNV* pViewportWScalings) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdSetViewportWScalingNV)table_procs[235])(commandBuffer, firstViewport, viewportCount, pViewportWScalings);
+    TraceCall(235, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkDisplayPowerControlEXT(VkDevice device, VkDisplayKHR display, const VkDisplayPowerInfoEXT* pDisplayPowerInfo) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkDisplayPowerControlEXT)table_procs[240])(device, display, pDisplayPowerInfo);
+    TraceCall(240, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkRegisterDeviceEventEXT(VkDevice device, const VkDeviceEventInfoEXT* pDeviceEventInfo, const VkAllocationCallbacks* pAllocator, VkFence* pFence) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkRegisterDeviceEventEXT)table_procs[241])(device, pDeviceEventInfo, pAllocator, pFence);
+    TraceCall(241, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkRegisterDisplayEventEXT(VkDevice device, VkDisplayKHR display, const VkDisplayEventInfoEXT* pDisplayEventInfo, const VkAllocationCallbacks* pAllocator, VkFence* pFence) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkRegisterDisplayEventEXT)table_procs[242])(device, display, pDisplayEventInfo, pAllocator, pFence);
+    TraceCall(242, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkGetSwapchainCounterEXT(VkDevice device, VkSwapchainKHR swapchain, VkSurfaceCounterFlagBitsEXT counter, uint64_t* pCounterValue) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetSwapchainCounterEXT)table_procs[243])(device, swapchain, counter, pCounterValue);
+    TraceCall(243, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkGetRefreshCycleDurationGOOGLE(VkDevice device, VkSwapchainKHR swapchain, VkRefreshCycleDurationGOOGLE* pDisplayTimingProperties) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetRefreshCycleDurationGOOGLE)table_procs[244])(device, swapchain, pDisplayTimingProperties);
+    TraceCall(244, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkGetPastPresentationTimingGOOGLE(VkDevice device, VkSwapchainKHR swapchain, uint32_t* pPresentationTimingCount, VkPastPresentationTimingGOOGLE* pPresentationTimings) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetPastPresentationTimingGOOGLE)table_procs[245])(device, swapchain, pPresentationTimingCount, pPresentationTimings);
+    TraceCall(245, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdSetDiscardRectangleEXT(VkCommandBuffer commandBuffer, uint32_t firstDiscardRectangle, uint32_t discardRectangleCount, const VkRect2D* pDiscardRectangles) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdSetDiscardRectangleEXT)table_procs[246])(commandBuffer, firstDiscardRectangle, discardRectangleCount, pDiscardRectangles);
+    TraceCall(246, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkSetHdrMetadataEXT(VkDevice device, uint32_t swapchainCount, const VkSwapchainKHR* pSwapchains, const VkHdrMetadataEXT* pMetadata) {
+    uint64_t start = TraceTime();
+    ((PFN_vkSetHdrMetadataEXT)table_procs[247])(device, swapchainCount, pSwapchains, pMetadata);
+    TraceCall(247, start);
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdSetSampleLocationsEXT(VkCommandBuffer commandBuffer, const VkSampleLocationsInfoEXT* pSampleLocationsInfo) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdSetSampleLocationsEXT)table_procs[250])(commandBuffer, pSampleLocationsInfo);
+    TraceCall(250, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkCreateValidationCacheEXT(VkDevice device, const VkValidationCacheCreateInfoEXT* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkValidationCacheEXT* pValidationCache) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkCreateValidationCacheEXT)table_procs[252])(device, pCreateInfo, pAllocator, pValidationCache);
+    TraceCall(252, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkDestroyValidationCacheEXT(VkDevice device, VkValidationCacheEXT validationCache, const VkAllocationCallbacks* pAllocator) {
+    uint64_t start = TraceTime();
+    ((PFN_vkDestroyValidationCacheEXT)table_procs[253])(device, validationCache, pAllocator);
+    TraceCall(253, start);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkMergeValidationCachesEXT(VkDevice device, VkValidationCacheEXT dstCache, uint32_t srcCacheCount, const VkValidationCacheEXT* pSrcCaches) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkMergeValidationCachesEXT)table_procs[254])(device, dstCache, srcCacheCount, pSrcCaches);
+    TraceCall(254, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkGetValidationCacheDataEXT(VkDevice device, VkValidationCacheEXT validationCache, size_t* pDataSize, void* pData) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetValidationCacheDataEXT)table_procs[255])(device, validationCache, pDataSize, pData);
+    TraceCall(255, start);
+    return result;
+}
+static VKAPI_ATTR VkResult VKAPI_CALL TraceTable_vkGetMemoryHostPointerPropertiesEXT(VkDevice device, VkExternalMemoryHandleTypeFlagBitsKHR handleType, const void* pHostPointer, VkMemoryHostPointerPropertiesEXT* pMemoryHostPointerProperties) {
+    uint64_t start = TraceTime();
+    VkResult result = ((PFN_vkGetMemoryHostPointerPropertiesEXT)table_procs[256])(device, handleType, pHostPointer, pMemoryHostPointerProperties);
+    TraceCall(256, start);
+    return result;
+}
+static VKAPI_ATTR void VKAPI_CALL TraceTable_vkCmdWriteBufferMarkerAMD(VkCommandBuffer commandBuffer, VkPipelineStageFlagBits pipelineStage, VkBuffer dstBuffer, VkDeviceSize dstOffset, uint32_t marker) {
+    uint64_t start = TraceTime();
+    ((PFN_vkCmdWriteBufferMarkerAMD)table_procs[257])(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker);
+    TraceCall(257, start);
+}
+
+//--------------------------Function pointers---------------------------
+PFN_vkCreateInstance vkCreateInstance = Load_vkCreateInstance;
+PFN_vkDestroyInstance vkDestroyInstance = Load_vkDestroyInstance;
+PFN_vkEnumeratePhysicalDevices vkEnumeratePhysicalDevices = Load_vkEnumeratePhysicalDevices;
+PFN_vkGetPhysicalDeviceFeatures vkGetPhysicalDeviceFeatures = Load_vkGetPhysicalDeviceFeatures;
+PFN_vkGetPhysicalDeviceFormatProperties vkGetPhysicalDeviceFormatProperties = Load_vkGetPhysicalDeviceFormatProperties;
+PFN_vkGetPhysicalDeviceImageFormatProperties vkGetPhysicalDeviceImageFormatProperties = Load_vkGetPhysicalDeviceImageFormatProperties;
+PFN_vkGetPhysicalDeviceProperties vkGetPhysicalDeviceProperties = Load_vkGetPhysicalDeviceProperties;
+PFN_vkGetPhysicalDeviceQueueFamilyProperties vkGetPhysicalDeviceQueueFamilyProperties = Load_vkGetPhysicalDeviceQueueFamilyProperties;
+PFN_vkGetPhysicalDeviceMemoryProperties vkGetPhysicalDeviceMemoryProperties = Load_vkGetPhysicalDeviceMemoryProperties;
+PFN_vkGetInstanceProcAddr vkGetInstanceProcAddr = Load_vkGetInstanceProcAddr;
+PFN_vkGetDeviceProcAddr vkGetDeviceProcAddr = Load_vkGetDeviceProcAddr;
+PFN_vkCreateDevice vkCreateDevice = Load_vkCreateDevice;
+PFN_vkDestroyDevice vkDestroyDevice = Load_vkDestroyDevice;
+PFN_vkEnumerateInstanceExtensionProperties vkEnumerateInstanceExtensionProperties = Load_vkEnumerateInstanceExtensionProperties;
+PFN_vkEnumerateDeviceExtensionProperties vkEnumerateDeviceExtensionProperties = Load_vkEnumerateDeviceExtensionProperties;
+PFN_vkEnumerateInstanceLayerProperties vkEnumerateInstanceLayerProperties = Load_vkEnumerateInstanceLayerProperties;
+PFN_vkEnumerateDeviceLayerProperties vkEnumerateDeviceLayerProperties = Load_vkEnumerateDeviceLayerProperties;
+PFN_vkGetDeviceQueue vkGetDeviceQueue = Load_vkGetDeviceQueue;
+PFN_vkQueueSubmit vkQueueSubmit = Load_vkQueueSubmit;
+PFN_vkQueueWaitIdle vkQueueWaitIdle = Load_vkQueueWaitIdle;
+PFN_vkDeviceWaitIdle vkDeviceWaitIdle = Load_vkDeviceWaitIdle;
+PFN_vkAllocateMemory vkAllocateMemory = Load_vkAllocateMemory;
+PFN_vkFreeMemory vkFreeMemory = Load_vkFreeMemory;
+PFN_vkMapMemory vkMapMemory = Load_vkMapMemory;
+PFN_vkUnmapMemory vkUnmapMemory = Load_vkUnmapMemory;
+PFN_vkFlushMappedMemoryRanges vkFlushMappedMemoryRanges = Load_vkFlushMappedMemoryRanges;
+PFN_vkInvalidateMappedMemoryRanges vkInvalidateMappedMemoryRanges = Load_vkInvalidateMappedMemoryRanges;
+PFN_vkGetDeviceMemoryCommitment vkGetDeviceMemoryCommitment = Load_vkGetDeviceMemoryCommitment;
+PFN_vkBindBufferMemory vkBindBufferMemory = Load_vkBindBufferMemory;
+PFN_vkBindImageMemory vkBindImageMemory = Load_vkBindImageMemory;
+PFN_vkGetBufferMemoryRequirements vkGetBufferMemoryRequirements = Load_vkGetBufferMemoryRequirements;
+PFN_vkGetImageMemoryRequirements vkGetImageMemoryRequirements = Load_vkGetImageMemoryRequirements;
+PFN_vkGetImageSparseMemoryRequirements vkGetImageSparseMemoryRequirements = Load_vkGetImageSparseMemoryRequirements;
+PFN_vkGetPhysicalDeviceSparseImageFormatProperties vkGetPhysicalDeviceSparseImageFormatProperties = Load_vkGetPhysicalDeviceSparseImageFormatProperties;
+PFN_vkQueueBindSparse vkQueueBindSparse = Load_vkQueueBindSparse;
+PFN_vkCreateFence vkCreateFence = Load_vkCreateFence;
+PFN_vkDestroyFence vkDestroyFence = Load_vkDestroyFence;
+PFN_vkResetFences vkResetFences = Load_vkResetFences;
+PFN_vkGetFenceStatus vkGetFenceStatus = Load_vkGetFenceStatus;
+PFN_vkWaitForFences vkWaitForFences = Load_vkWaitForFences;
+PFN_vkCreateSemaphore vkCreateSemaphore = Load_vkCreateSemaphore;
+PFN_vkDestroySemaphore vkDestroySemaphore = Load_vkDestroySemaphore;
+PFN_vkCreateEvent vkCreateEvent = Load_vkCreateEvent;
+PFN_vkDestroyEvent vkDestroyEvent = Load_vkDestroyEvent;
+PFN_vkGetEventStatus vkGetEventStatus = Load_vkGetEventStatus;
+PFN_vkSetEvent vkSetEvent = Load_vkSetEvent;
+PFN_vkResetEvent vkResetEvent = Load_vkResetEvent;
+PFN_vkCreateQueryPool vkCreateQueryPool = Load_vkCreateQueryPool;
+PFN_vkDestroyQueryPool vkDestroyQueryPool = Load_vkDestroyQueryPool;
+PFN_vkGetQueryPoolResults vkGetQueryPoolResults = Load_vkGetQueryPoolResults;
+PFN_vkCreateBuffer vkCreateBuffer = Load_vkCreateBuffer;
+PFN_vkDestroyBuffer vkDestroyBuffer = Load_vkDestroyBuffer;
+PFN_vkCreateBufferView vkCreateBufferView = Load_vkCreateBufferView;
+PFN_vkDestroyBufferView vkDestroyBufferView = Load_vkDestroyBufferView;
+PFN_vkCreateImage vkCreateImage = Load_vkCreateImage;
+PFN_vkDestroyImage vkDestroyImage = Load_vkDestroyImage;
+PFN_vkGetImageSubresourceLayout vkGetImageSubresourceLayout = Load_vkGetImageSubresourceLayout;
+PFN_vkCreateImageView vkCreateImageView = Load_vkCreateImageView;
+PFN_vkDestroyImageView vkDestroyImageView = Load_vkDestroyImageView;
+PFN_vkCreateShaderModule vkCreateShaderModule = Load_vkCreateShaderModule;
+PFN_vkDestroyShaderModule vkDestroyShaderModule = Load_vkDestroyShaderModule;
+PFN_vkCreatePipelineCache vkCreatePipelineCache = Load_vkCreatePipelineCache;
+PFN_vkDestroyPipelineCache vkDestroyPipelineCache = Load_vkDestroyPipelineCache;
+PFN_vkGetPipelineCacheData vkGetPipelineCacheData = Load_vkGetPipelineCacheData;
+PFN_vkMergePipelineCaches vkMergePipelineCaches = Load_vkMergePipelineCaches;
+PFN_vkCreateGraphicsPipelines vkCreateGraphicsPipelines = Load_vkCreateGraphicsPipelines;
+PFN_vkCreateComputePipelines vkCreateComputePipelines = Load_vkCreateComputePipelines;
+PFN_vkDestroyPipeline vkDestroyPipeline = Load_vkDestroyPipeline;
+PFN_vkCreatePipelineLayout vkCreatePipelineLayout = Load_vkCreatePipelineLayout;
+PFN_vkDestroyPipelineLayout vkDestroyPipelineLayout = Load_vkDestroyPipelineLayout;
+PFN_vkCreateSampler vkCreateSampler = Load_vkCreateSampler;
+PFN_vkDestroySampler vkDestroySampler = Load_vkDestroySampler;
+PFN_vkCreateDescriptorSetLayout vkCreateDescriptorSetLayout = Load_vkCreateDescriptorSetLayout;
+PFN_vkDestroyDescriptorSetLayout vkDestroyDescriptorSetLayout = Load_vkDestroyDescriptorSetLayout;
+PFN_vkCreateDescriptorPool vkCreateDescriptorPool = Load_vkCreateDescriptorPool;
+PFN_vkDestroyDescriptorPool vkDestroyDescriptorPool = Load_vkDestroyDescriptorPool;
+PFN_vkResetDescriptorPool vkResetDescriptorPool = Load_vkResetDescriptorPool;
+PFN_vkAllocateDescriptorSets vkAllocateDescriptorSets = Load_vkAllocateDescriptorSets;
+PFN_vkFreeDescriptorSets vkFreeDescriptorSets = Load_vkFreeDescriptorSets;
+PFN_vkUpdateDescriptorSets vkUpdateDescriptorSets = Load_vkUpdateDescriptorSets;
+PFN_vkCreateFramebuffer vkCreateFramebuffer = Load_vkCreateFramebuffer;
+PFN_vkDestroyFramebuffer vkDestroyFramebuffer = Load_vkDestroyFramebuffer;
+PFN_vkCreateRenderPass vkCreateRenderPass = Load_vkCreateRenderPass;
+PFN_vkDestroyRenderPass vkDestroyRenderPass = Load_vkDestroyRenderPass;
+PFN_vkGetRenderAreaGranularity vkGetRenderAreaGranularity = Load_vkGetRenderAreaGranularity;
+PFN_vkCreateCommandPool vkCreateCommandPool = Load_vkCreateCommandPool;
+PFN_vkDestroyCommandPool vkDestroyCommandPool = Load_vkDestroyCommandPool;
+PFN_vkResetCommandPool vkResetCommandPool = Load_vkResetCommandPool;
+PFN_vkAllocateCommandBuffers vkAllocateCommandBuffers = Load_vkAllocateCommandBuffers;
+PFN_vkFreeCommandBuffers vkFreeCommandBuffers = Load_vkFreeCommandBuffers;
+PFN_vkBeginCommandBuffer vkBeginCommandBuffer = Load_vkBeginCommandBuffer;
+PFN_vkEndCommandBuffer vkEndCommandBuffer = Load_vkEndCommandBuffer;
+PFN_vkResetCommandBuffer vkResetCommandBuffer = Load_vkResetCommandBuffer;
+PFN_vkCmdBindPipeline vkCmdBindPipeline = Load_vkCmdBindPipeline;
+PFN_vkCmdSetViewport vkCmdSetViewport = Load_vkCmdSetViewport;
+PFN_vkCmdSetScissor vkCmdSetScissor = Load_vkCmdSetScissor;
+PFN_vkCmdSetLineWidth vkCmdSetLineWidth = Load_vkCmdSetLineWidth;
+PFN_vkCmdSetDepthBias vkCmdSetDepthBias = Load_vkCmdSetDepthBias;
+PFN_vkCmdSetBlendConstants vkCmdSetBlendConstants = Load_vkCmdSetBlendConstants;
+PFN_vkCmdSetDepthBounds vkCmdSetDepthBounds = Load_vkCmdSetDepthBounds;
+PFN_vkCmdSetStencilCompareMask vkCmdSetStencilCompareMask = Load_vkCmdSetStencilCompareMask;
+PFN_vkCmdSetStencilWriteMask vkCmdSetStencilWriteMask = Load_vkCmdSetStencilWriteMask;
+PFN_vkCmdSetStencilReference vkCmdSetStencilReference = Load_vkCmdSetStencilReference;
+PFN_vkCmdBindDescriptorSets vkCmdBindDescriptorSets = Load_vkCmdBindDescriptorSets;
+PFN_vkCmdBindIndexBuffer vkCmdBindIndexBuffer = Load_vkCmdBindIndexBuffer;
+PFN_vkCmdBindVertexBuffers vkCmdBindVertexBuffers = Load_vkCmdBindVertexBuffers;
+PFN_vkCmdDraw vkCmdDraw = Load_vkCmdDraw;
+PFN_vkCmdDrawIndexed vkCmdDrawIndexed = Load_vkCmdDrawIndexed;
+PFN_vkCmdDrawIndirect vkCmdDrawIndirect = Load_vkCmdDrawIndirect;
+PFN_vkCmdDrawIndexedIndirect vkCmdDrawIndexedIndirect = Load_vkCmdDrawIndexedIndirect;
+PFN_vkCmdDispatch vkCmdDispatch = Load_vkCmdDispatch;
+PFN_vkCmdDispatchIndirect vkCmdDispatchIndirect = Load_vkCmdDispatchIndirect;
+PFN_vkCmdCopyBuffer vkCmdCopyBuffer = Load_vkCmdCopyBuffer;
+PFN_vkCmdCopyImage vkCmdCopyImage = Load_vkCmdCopyImage;
+PFN_vkCmdBlitImage vkCmdBlitImage = Load_vkCmdBlitImage;
+PFN_vkCmdCopyBufferToImage vkCmdCopyBufferToImage = Load_vkCmdCopyBufferToImage;
+PFN_vkCmdCopyImageToBuffer vkCmdCopyImageToBuffer = Load_vkCmdCopyImageToBuffer;
+PFN_vkCmdUpdateBuffer vkCmdUpdateBuffer = Load_vkCmdUpdateBuffer;
+PFN_vkCmdFillBuffer vkCmdFillBuffer = Load_vkCmdFillBuffer;
+PFN_vkCmdClearColorImage vkCmdClearColorImage = Load_vkCmdClearColorImage;
+PFN_vkCmdClearDepthStencilImage vkCmdClearDepthStencilImage = Load_vkCmdClearDepthStencilImage;
+PFN_vkCmdClearAttachments vkCmdClearAttachments = Load_vkCmdClearAttachments;
+PFN_vkCmdResolveImage vkCmdResolveImage = Load_vkCmdResolveImage;
+PFN_vkCmdSetEvent vkCmdSetEvent = Load_vkCmdSetEvent;
+PFN_vkCmdResetEvent vkCmdResetEvent = Load_vkCmdResetEvent;
+PFN_vkCmdWaitEvents vkCmdWaitEvents = Load_vkCmdWaitEvents;
+PFN_vkCmdPipelineBarrier vkCmdPipelineBarrier = Load_vkCmdPipelineBarrier;
+PFN_vkCmdBeginQuery vkCmdBeginQuery = Load_vkCmdBeginQuery;
+PFN_vkCmdEndQuery vkCmdEndQuery = Load_vkCmdEndQuery;
+PFN_vkCmdResetQueryPool vkCmdResetQueryPool = Load_vkCmdResetQueryPool;
+PFN_vkCmdWriteTimestamp vkCmdWriteTimestamp = Load_vkCmdWriteTimestamp;
+PFN_vkCmdCopyQueryPoolResults vkCmdCopyQueryPoolResults = Load_vkCmdCopyQueryPoolResults;
+PFN_vkCmdPushConstants vkCmdPushConstants = Load_vkCmdPushConstants;
+PFN_vkCmdBeginRenderPass vkCmdBeginRenderPass = Load_vkCmdBeginRenderPass;
+PFN_vkCmdNextSubpass vkCmdNextSubpass = Load_vkCmdNextSubpass;
+PFN_vkCmdEndRenderPass vkCmdEndRenderPass = Load_vkCmdEndRenderPass;
+PFN_vkCmdExecuteCommands vkCmdExecuteCommands = Load_vkCmdExecuteCommands;
+PFN_vkDestroySurfaceKHR vkDestroySurfaceKHR = Load_vkDestroySurfaceKHR;
+PFN_vkGetPhysicalDeviceSurfaceSupportKHR vkGetPhysicalDeviceSurfaceSupportKHR = Load_vkGetPhysicalDeviceSurfaceSupportKHR;
+PFN_vkGetPhysicalDeviceSurfaceCapabilitiesKHR vkGetPhysicalDeviceSurfaceCapabilitiesKHR = Load_vkGetPhysicalDeviceSurfaceCapabilitiesKHR;
+PFN_vkGetPhysicalDeviceSurfaceFormatsKHR vkGetPhysicalDeviceSurfaceFormatsKHR = Load_vkGetPhysicalDeviceSurfaceFormatsKHR;
+PFN_vkGetPhysicalDeviceSurfacePresentModesKHR vkGetPhysicalDeviceSurfacePresentModesKHR = Load_vkGetPhysicalDeviceSurfacePresentModesKHR;
+PFN_vkCreateSwapchainKHR vkCreateSwapchainKHR = Load_vkCreateSwapchainKHR;
+PFN_vkDestroySwapchainKHR vkDestroySwapchainKHR = Load_vkDestroySwapchainKHR;
+PFN_vkGetSwapchainImagesKHR vkGetSwapchainImagesKHR = Load_vkGetSwapchainImagesKHR;
+PFN_vkAcquireNextImageKHR vkAcquireNextImageKHR = Load_vkAcquireNextImageKHR;
+PFN_vkQueuePresentKHR vkQueuePresentKHR = Load_vkQueuePresentKHR;
+PFN_vkGetPhysicalDeviceDisplayPropertiesKHR vkGetPhysicalDeviceDisplayPropertiesKHR = Load_vkGetPhysicalDeviceDisplayPropertiesKHR;
+PFN_vkGetPhysicalDeviceDisplayPlanePropertiesKHR vkGetPhysicalDeviceDisplayPlanePropertiesKHR = Load_vkGetPhysicalDeviceDisplayPlanePropertiesKHR;
+PFN_vkGetDisplayPlaneSupportedDisplaysKHR vkGetDisplayPlaneSupportedDisplaysKHR = Load_vkGetDisplayPlaneSupportedDisplaysKHR;
+PFN_vkGetDisplayModePropertiesKHR vkGetDisplayModePropertiesKHR = Load_vkGetDisplayModePropertiesKHR;
+PFN_vkCreateDisplayModeKHR vkCreateDisplayModeKHR = Load_vkCreateDisplayModeKHR;
+PFN_vkGetDisplayPlaneCapabilitiesKHR vkGetDisplayPlaneCapabilitiesKHR = Load_vkGetDisplayPlaneCapabilitiesKHR;
+PFN_vkCreateDisplayPlaneSurfaceKHR vkCreateDisplayPlaneSurfaceKHR = Load_vkCreateDisplayPlaneSurfaceKHR;
+PFN_vkCreateSharedSwapchainsKHR vkCreateSharedSwapchainsKHR = Load_vkCreateSharedSwapchainsKHR;
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+PFN_vkCreateXlibSurfaceKHR vkCreateXlibSurfaceKHR = Load_vkCreateXlibSurfaceKHR;
+PFN_vkGetPhysicalDeviceXlibPresentationSupportKHR vkGetPhysicalDeviceXlibPresentationSupportKHR = Load_vkGetPhysicalDeviceXlibPresentationSupportKHR;
+#endif
+#ifdef VK_USE_PLATFORM_XCB_KHR
+PFN_vkCreateXcbSurfaceKHR vkCreateXcbSurfaceKHR = Load_vkCreateXcbSurfaceKHR;
+PFN_vkGetPhysicalDeviceXcbPresentationSupportKHR vkGetPhysicalDeviceXcbPresentationSupportKHR = Load_vkGetPhysicalDeviceXcbPresentationSupportKHR;
+#endif
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+PFN_vkCreateWaylandSurfaceKHR vkCreateWaylandSurfaceKHR = Load_vkCreateWaylandSurfaceKHR;
+PFN_vkGetPhysicalDeviceWaylandPresentationSupportKHR vkGetPhysicalDeviceWaylandPresentationSupportKHR = Load_vkGetPhysicalDeviceWaylandPresentationSupportKHR;
+#endif
+#ifdef VK_USE_PLATFORM_MIR_KHR
+PFN_vkCreateMirSurfaceKHR vkCreateMirSurfaceKHR = Load_vkCreateMirSurfaceKHR;
+PFN_vkGetPhysicalDeviceMirPresentationSupportKHR vkGetPhysicalDeviceMirPresentationSupportKHR = Load_vkGetPhysicalDeviceMirPresentationSupportKHR;
+#endif
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+PFN_vkCreateAndroidSurfaceKHR vkCreateAndroidSurfaceKHR = Load_vkCreateAndroidSurfaceKHR;
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+PFN_vkCreateWin32SurfaceKHR vkCreateWin32SurfaceKHR = Load_vkCreateWin32SurfaceKHR;
+PFN_vkGetPhysicalDeviceWin32PresentationSupportKHR vkGetPhysicalDeviceWin32PresentationSupportKHR = Load_vkGetPhysicalDeviceWin32PresentationSupportKHR;
+#endif
+PFN_vkGetPhysicalDeviceFeatures2KHR vkGetPhysicalDeviceFeatures2KHR = Load_vkGetPhysicalDeviceFeatures2KHR;
+PFN_vkGetPhysicalDeviceProperties2KHR vkGetPhysicalDeviceProperties2KHR = Load_vkGetPhysicalDeviceProperties2KHR;
+PFN_vkGetPhysicalDeviceFormatProperties2KHR vkGetPhysicalDeviceFormatProperties2KHR = Load_vkGetPhysicalDeviceFormatProperties2KHR;
+PFN_vkGetPhysicalDeviceImageFormatProperties2KHR vkGetPhysicalDeviceImageFormatProperties2KHR = Load_vkGetPhysicalDeviceImageFormatProperties2KHR;
+PFN_vkGetPhysicalDeviceQueueFamilyProperties2KHR vkGetPhysicalDeviceQueueFamilyProperties2KHR = Load_vkGetPhysicalDeviceQueueFamilyProperties2KHR;
+PFN_vkGetPhysicalDeviceMemoryProperties2KHR vkGetPhysicalDeviceMemoryProperties2KHR = Load_vkGetPhysicalDeviceMemoryProperties2KHR;
+PFN_vkGetPhysicalDeviceSparseImageFormatProperties2KHR vkGetPhysicalDeviceSparseImageFormatProperties2KHR = Load_vkGetPhysicalDeviceSparseImageFormatProperties2KHR;
+PFN_vkTrimCommandPoolKHR vkTrimCommandPoolKHR = Load_vkTrimCommandPoolKHR;
+PFN_vkGetPhysicalDeviceExternalBufferPropertiesKHR vkGetPhysicalDeviceExternalBufferPropertiesKHR = Load_vkGetPhysicalDeviceExternalBufferPropertiesKHR;
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+PFN_vkGetMemoryWin32HandleKHR vkGetMemoryWin32HandleKHR = Load_vkGetMemoryWin32HandleKHR;
+PFN_vkGetMemoryWin32HandlePropertiesKHR vkGetMemoryWin32HandlePropertiesKHR = Load_vkGetMemoryWin32HandlePropertiesKHR;
+#endif
+PFN_vkGetMemoryFdKHR vkGetMemoryFdKHR = Load_vkGetMemoryFdKHR;
+PFN_vkGetMemoryFdPropertiesKHR vkGetMemoryFdPropertiesKHR = Load_vkGetMemoryFdPropertiesKHR;
+PFN_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR vkGetPhysicalDeviceExternalSemaphorePropertiesKHR = Load_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR;
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+PFN_vkImportSemaphoreWin32HandleKHR vkImportSemaphoreWin32HandleKHR = Load_vkImportSemaphoreWin32HandleKHR;
+PFN_vkGetSemaphoreWin32HandleKHR vkGetSemaphoreWin32HandleKHR = Load_vkGetSemaphoreWin32HandleKHR;
+#endif
+PFN_vkImportSemaphoreFdKHR vkImportSemaphoreFdKHR = Load_vkImportSemaphoreFdKHR;
+PFN_vkGetSemaphoreFdKHR vkGetSemaphoreFdKHR = Load_vkGetSemaphoreFdKHR;
+PFN_vkCmdPushDescriptorSetKHR vkCmdPushDescriptorSetKHR = Load_vkCmdPushDescriptorSetKHR;
+PFN_vkCreateDescriptorUpdateTemplateKHR vkCreateDescriptorUpdateTemplateKHR = Load_vkCreateDescriptorUpdateTemplateKHR;
+PFN_vkDestroyDescriptorUpdateTemplateKHR vkDestroyDescriptorUpdateTemplateKHR = Load_vkDestroyDescriptorUpdateTemplateKHR;
+PFN_vkUpdateDescriptorSetWithTemplateKHR vkUpdateDescriptorSetWithTemplateKHR = Load_vkUpdateDescriptorSetWithTemplateKHR;
+PFN_vkCmdPushDescriptorSetWithTemplateKHR vkCmdPushDescriptorSetWithTemplateKHR = Load_vkCmdPushDescriptorSetWithTemplateKHR;
+PFN_vkGetSwapchainStatusKHR vkGetSwapchainStatusKHR = Load_vkGetSwapchainStatusKHR;
+PFN_vkGetPhysicalDeviceExternalFencePropertiesKHR vkGetPhysicalDeviceExternalFencePropertiesKHR = Load_vkGetPhysicalDeviceExternalFencePropertiesKHR;
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+PFN_vkImportFenceWin32HandleKHR vkImportFenceWin32HandleKHR = Load_vkImportFenceWin32HandleKHR;
+PFN_vkGetFenceWin32HandleKHR vkGetFenceWin32HandleKHR = Load_vkGetFenceWin32HandleKHR;
+#endif
+PFN_vkImportFenceFdKHR vkImportFenceFdKHR = Load_vkImportFenceFdKHR;
+PFN_vkGetFenceFdKHR vkGetFenceFdKHR = Load_vkGetFenceFdKHR;
+PFN_vkGetPhysicalDeviceSurfaceCapabilities2KHR vkGetPhysicalDeviceSurfaceCapabilities2KHR = Load_vkGetPhysicalDeviceSurfaceCapabilities2KHR;
+PFN_vkGetPhysicalDeviceSurfaceFormats2KHR vkGetPhysicalDeviceSurfaceFormats2KHR = Load_vkGetPhysicalDeviceSurfaceFormats2KHR;
+PFN_vkGetImageMemoryRequirements2KHR vkGetImageMemoryRequirements2KHR = Load_vkGetImageMemoryRequirements2KHR;
+PFN_vkGetBufferMemoryRequirements2KHR vkGetBufferMemoryRequirements2KHR = Load_vkGetBufferMemoryRequirements2KHR;
+PFN_vkGetImageSparseMemoryRequirements2KHR vkGetImageSparseMemoryRequirements2KHR = Load_vkGetImageSparseMemoryRequirements2KHR;
+PFN_vkCreateSamplerYcbcrConversionKHR vkCreateSamplerYcbcrConversionKHR = Load_vkCreateSamplerYcbcrConversionKHR;
+PFN_vkDestroySamplerYcbcrConversionKHR vkDestroySamplerYcbcrConversionKHR = Load_vkDestroySamplerYcbcrConversionKHR;
+PFN_vkBindBufferMemory2KHR vkBindBufferMemory2KHR = Load_vkBindBufferMemory2KHR;
+PFN_vkBindImageMemory2KHR vkBindImageMemory2KHR = Load_vkBindImageMemory2KHR;
+PFN_vkCreateDebugReportCallbackEXT vkCreateDebugReportCallbackEXT = Load_vkCreateDebugReportCallbackEXT;
+PFN_vkDestroyDebugReportCallbackEXT vkDestroyDebugReportCallbackEXT = Load_vkDestroyDebugReportCallbackEXT;
+PFN_vkDebugReportMessageEXT vkDebugReportMessageEXT = Load_vkDebugReportMessageEXT;
+PFN_vkDebugMarkerSetObjectTagEXT vkDebugMarkerSetObjectTagEXT = Load_vkDebugMarkerSetObjectTagEXT;
+PFN_vkDebugMarkerSetObjectNameEXT vkDebugMarkerSetObjectNameEXT = Load_vkDebugMarkerSetObjectNameEXT;
+PFN_vkCmdDebugMarkerBeginEXT vkCmdDebugMarkerBeginEXT = Load_vkCmdDebugMarkerBeginEXT;
+PFN_vkCmdDebugMarkerEndEXT vkCmdDebugMarkerEndEXT = Load_vkCmdDebugMarkerEndEXT;
+PFN_vkCmdDebugMarkerInsertEXT vkCmdDebugMarkerInsertEXT = Load_vkCmdDebugMarkerInsertEXT;
+PFN_vkCmdDrawIndirectCountAMD vkCmdDrawIndirectCountAMD = Load_vkCmdDrawIndirectCountAMD;
+PFN_vkCmdDrawIndexedIndirectCountAMD vkCmdDrawIndexedIndirectCountAMD = Load_vkCmdDrawIndexedIndirectCountAMD;
+PFN_vkGetShaderInfoAMD vkGetShaderInfoAMD = Load_vkGetShaderInfoAMD;
+PFN_vkGetPhysicalDeviceExternalImageFormatPropertiesNV vkGetPhysicalDeviceExternalImageFormatPropertiesNV = Load_vkGetPhysicalDeviceExternalImageFormatPropertiesNV;
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+PFN_vkGetMemoryWin32HandleNV vkGetMemoryWin32HandleNV = Load_vkGetMemoryWin32HandleNV;
+#endif
+PFN_vkGetDeviceGroupPeerMemoryFeaturesKHX vkGetDeviceGroupPeerMemoryFeaturesKHX = Load_vkGetDeviceGroupPeerMemoryFeaturesKHX;
+PFN_vkCmdSetDeviceMaskKHX vkCmdSetDeviceMaskKHX = Load_vkCmdSetDeviceMaskKHX;
+PFN_vkCmdDispatchBaseKHX vkCmdDispatchBaseKHX = Load_vkCmdDispatchBaseKHX;
+PFN_vkGetDeviceGroupPresentCapabilitiesKHX vkGetDeviceGroupPresentCapabilitiesKHX = Load_vkGetDeviceGroupPresentCapabilitiesKHX;
+PFN_vkGetDeviceGroupSurfacePresentModesKHX vkGetDeviceGroupSurfacePresentModesKHX = Load_vkGetDeviceGroupSurfacePresentModesKHX;
+PFN_vkGetPhysicalDevicePresentRectanglesKHX vkGetPhysicalDevicePresentRectanglesKHX = Load_vkGetPhysicalDevicePresentRectanglesKHX;
+PFN_vkAcquireNextImage2KHX vkAcquireNextImage2KHX = Load_vkAcquireNextImage2KHX;
+#ifdef VK_USE_PLATFORM_VI_NN
+PFN_vkCreateViSurfaceNN vkCreateViSurfaceNN = Load_vkCreateViSurfaceNN;
+#endif
+PFN_vkEnumeratePhysicalDeviceGroupsKHX vkEnumeratePhysicalDeviceGroupsKHX = Load_vkEnumeratePhysicalDeviceGroupsKHX;
+PFN_vkCmdProcessCommandsNVX vkCmdProcessCommandsNVX = Load_vkCmdProcessCommandsNVX;
+PFN_vkCmdReserveSpaceForCommandsNVX vkCmdReserveSpaceForCommandsNVX = Load_vkCmdReserveSpaceForCommandsNVX;
+PFN_vkCreateIndirectCommandsLayoutNVX vkCreateIndirectCommandsLayoutNVX = Load_vkCreateIndirectCommandsLayoutNVX;
+PFN_vkDestroyIndirectCommandsLayoutNVX vkDestroyIndirectCommandsLayoutNVX = Load_vkDestroyIndirectCommandsLayoutNVX;
+PFN_vkCreateObjectTableNVX vkCreateObjectTableNVX = Load_vkCreateObjectTableNVX;
+PFN_vkDestroyObjectTableNVX vkDestroyObjectTableNVX = Load_vkDestroyObjectTableNVX;
+PFN_vkRegisterObjectsNVX vkRegisterObjectsNVX = Load_vkRegisterObjectsNVX;
+PFN_vkUnregisterObjectsNVX vkUnregisterObjectsNVX = Load_vkUnregisterObjectsNVX;
+PFN_vkGetPhysicalDeviceGeneratedCommandsPropertiesNVX vkGetPhysicalDeviceGeneratedCommandsPropertiesNVX = Load_vkGetPhysicalDeviceGeneratedCommandsPropertiesNVX;
+PFN_vkCmdSetViewportWScalingNV vkCmdSetViewportWScalingNV = Load_vkCmdSetViewportWScalingNV;
+PFN_vkReleaseDisplayEXT vkReleaseDisplayEXT = Load_vkReleaseDisplayEXT;
+#ifdef VK_USE_PLATFORM_XLIB_XRANDR_EXT
+PFN_vkAcquireXlibDisplayEXT vkAcquireXlibDisplayEXT = Load_vkAcquireXlibDisplayEXT;
+PFN_vkGetRandROutputDisplayEXT vkGetRandROutputDisplayEXT = Load_vkGetRandROutputDisplayEXT;
+#endif
+PFN_vkGetPhysicalDeviceSurfaceCapabilities2EXT vkGetPhysicalDeviceSurfaceCapabilities2EXT = Load_vkGetPhysicalDeviceSurfaceCapabilities2EXT;
+PFN_vkDisplayPowerControlEXT vkDisplayPowerControlEXT = Load_vkDisplayPowerControlEXT;
+PFN_vkRegisterDeviceEventEXT vkRegisterDeviceEventEXT = Load_vkRegisterDeviceEventEXT;
+PFN_vkRegisterDisplayEventEXT vkRegisterDisplayEventEXT = Load_vkRegisterDisplayEventEXT;
+PFN_vkGetSwapchainCounterEXT vkGetSwapchainCounterEXT = Load_vkGetSwapchainCounterEXT;
+PFN_vkGetRefreshCycleDurationGOOGLE vkGetRefreshCycleDurationGOOGLE = Load_vkGetRefreshCycleDurationGOOGLE;
+PFN_vkGetPastPresentationTimingGOOGLE vkGetPastPresentationTimingGOOGLE = Load_vkGetPastPresentationTimingGOOGLE;
+PFN_vkCmdSetDiscardRectangleEXT vkCmdSetDiscardRectangleEXT = Load_vkCmdSetDiscardRectangleEXT;
+PFN_vkSetHdrMetadataEXT vkSetHdrMetadataEXT = Load_vkSetHdrMetadataEXT;
+#ifdef VK_USE_PLATFORM_IOS_MVK
+PFN_vkCreateIOSSurfaceMVK vkCreateIOSSurfaceMVK = Load_vkCreateIOSSurfaceMVK;
+#endif
+#ifdef VK_USE_PLATFORM_MACOS_MVK
+PFN_vkCreateMacOSSurfaceMVK vkCreateMacOSSurfaceMVK = Load_vkCreateMacOSSurfaceMVK;
+#endif
+PFN_vkCmdSetSampleLocationsEXT vkCmdSetSampleLocationsEXT = Load_vkCmdSetSampleLocationsEXT;
+PFN_vkGetPhysicalDeviceMultisamplePropertiesEXT vkGetPhysicalDeviceMultisamplePropertiesEXT = Load_vkGetPhysicalDeviceMultisamplePropertiesEXT;
+PFN_vkCreateValidationCacheEXT vkCreateValidationCacheEXT = Load_vkCreateValidationCacheEXT;
+PFN_vkDestroyValidationCacheEXT vkDestroyValidationCacheEXT = Load_vkDestroyValidationCacheEXT;
+PFN_vkMergeValidationCachesEXT vkMergeValidationCachesEXT = Load_vkMergeValidationCachesEXT;
+PFN_vkGetValidationCacheDataEXT vkGetValidationCacheDataEXT = Load_vkGetValidationCacheDataEXT;
+PFN_vkGetMemoryHostPointerPropertiesEXT vkGetMemoryHostPointerPropertiesEXT = Load_vkGetMemoryHostPointerPropertiesEXT;
+PFN_vkCmdWriteBufferMarkerAMD vkCmdWriteBufferMarkerAMD = Load_vkCmdWriteBufferMarkerAMD;
+
+//-----------------------------Proc table-------------------------------
+struct CProcEntry {
+    PFN_vkVoidFunction* slot;
+    PFN_vkVoidFunction  stub;
+    PFN_vkVoidFunction  trace;
+    uint32_t            id;
+    int                 level;
+};
+
+static const CProcEntry proc_table[] = {
+    {(PFN_vkVoidFunction*)&vkCreateInstance, (PFN_vkVoidFunction)Load_vkCreateInstance, (PFN_vkVoidFunction)Trace_vkCreateInstance, 0, LEVEL_GLOBAL},
+    {(PFN_vkVoidFunction*)&vkDestroyInstance, (PFN_vkVoidFunction)Load_vkDestroyInstance, (PFN_vkVoidFunction)Trace_vkDestroyInstance, 1, LEVEL_INSTANCE},
+    {(PFN_vkVoidFunction*)&vkEnumeratePhysicalDevices, (PFN_vkVoidFunction)Load_vkEnumeratePhysicalDevices, (PFN_vkVoidFunction)Trace_vkEnumeratePhysicalDevices, 2, LEVEL_INSTANCE},
+    {(PFN_vkVoidFunction*)&vkGetPhysicalDeviceFeatures, (PFN_vkVoidFunction)Load_vkGetPhysicalDeviceFeatures, (PFN_vkVoidFunction)Trace_vkGetPhysicalDeviceFeatures, 3, LEVEL_INSTANCE},
+    {(PFN_vkVoidFunction*)&vkGetPhysicalDeviceFormatProperties, (PFN_vkVoidFunction)Load_vkGetPhysicalDeviceFormatProperties, (PFN_vkVoidFunction)Trace_vkGetPhysicalDeviceFormatProperties, 4, LEVEL_INSTANCE},
+    {(PFN_vkVoidFunction*)&vkGetPhysicalDeviceImageFormatProperties, (PFN_vkVoidFunction)Load_vkGetPhysicalDeviceImageFormatProperties, (PFN_vkVoidFunction)Trace_vkGetPhysicalDeviceImageFormatProperties, 5, LEVEL_INSTANCE},
+    {(PFN_vkVoidFunction*)&vkGetPhysicalDeviceProperties, (PFN_vkVoidFunction)Load_vkGetPhysicalDeviceProperties, (PFN_vkVoidFunction)Trace_vkGetPhysicalDeviceProperties, 6, LEVEL_INSTANCE},
+    {(PFN_vkVoidFunction*)&vkGetPhysicalDeviceQueueFamilyProperties, (PFN_vkVoidFunction)Load_vkGetPhysicalDeviceQueueFamilyProperties, (PFN_vkVoidFunction)Trace_vkGetPhysicalDeviceQueueFamilyProperties, 7, LEVEL_INSTANCE},
+    {(PFN_vkVoidFunction*)&vkGetPhysicalDeviceMemoryProperties, (PFN_vkVoidFunction)Load_vkGetPhysicalDeviceMemoryProperties, (PFN_vkVoidFunction)Trace_vkGetPhysicalDeviceMemoryProperties, 8, LEVEL_INSTANCE},
+    {(PFN_vkVoidFunction*)&vkGetInstanceProcAddr, (PFN_vkVoidFunction)Load_vkGetInstanceProcAddr, (PFN_vkVoidFunction)Trace_vkGetInstanceProcAddr, 9, LEVEL_GLOBAL},
+    {(PFN_vkVoidFunction*)&vkGetDeviceProcAddr, (PFN_vkVoidFunction)Load_vkGetDeviceProcAddr, (PFN_vkVoidFunction)Trace_vkGetDeviceProcAddr, 10, LEVEL_GLOBAL},
+    {(PFN_vkVoidFunction*)&vkCreateDevice, (PFN_vkVoidFunction)Load_vkCreateDevice, (PFN_vkVoidFunction)Trace_vkCreateDevice, 11, LEVEL_INSTANCE},
+    {(PFN_vkVoidFunction*)&vkDestroyDevice, (PFN_vkVoidFunction)Load_vkDestroyDevice, (PFN_vkVoidFunction)Trace_vkDestroyDevice, 12, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkEnumerateInstanceExtensionProperties, (PFN_vkVoidFunction)Load_vkEnumerateInstanceExtensionProperties, (PFN_vkVoidFunction)Trace_vkEnumerateInstanceExtensionProperties, 13, LEVEL_GLOBAL},
+    {(PFN_vkVoidFunction*)&vkEnumerateDeviceExtensionProperties, (PFN_vkVoidFunction)Load_vkEnumerateDeviceExtensionProperties, (PFN_vkVoidFunction)Trace_vkEnumerateDeviceExtensionProperties, 14, LEVEL_INSTANCE},
+    {(PFN_vkVoidFunction*)&vkEnumerateInstanceLayerProperties, (PFN_vkVoidFunction)Load_vkEnumerateInstanceLayerProperties, (PFN_vkVoidFunction)Trace_vkEnumerateInstanceLayerProperties, 15, LEVEL_GLOBAL},
+    {(PFN_vkVoidFunction*)&vkEnumerateDeviceLayerProperties, (PFN_vkVoidFunction)Load_vkEnumerateDeviceLayerProperties, (PFN_vkVoidFunction)Trace_vkEnumerateDeviceLayerProperties, 16, LEVEL_INSTANCE},
+    {(PFN_vkVoidFunction*)&vkGetDeviceQueue, (PFN_vkVoidFunction)Load_vkGetDeviceQueue, (PFN_vkVoidFunction)Trace_vkGetDeviceQueue, 17, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkQueueSubmit, (PFN_vkVoidFunction)Load_vkQueueSubmit, (PFN_vkVoidFunction)Trace_vkQueueSubmit, 18, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkQueueWaitIdle, (PFN_vkVoidFunction)Load_vkQueueWaitIdle, (PFN_vkVoidFunction)Trace_vkQueueWaitIdle, 19, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkDeviceWaitIdle, (PFN_vkVoidFunction)Load_vkDeviceWaitIdle, (PFN_vkVoidFunction)Trace_vkDeviceWaitIdle, 20, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkAllocateMemory, (PFN_vkVoidFunction)Load_vkAllocateMemory, (PFN_vkVoidFunction)Trace_vkAllocateMemory, 21, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkFreeMemory, (PFN_vkVoidFunction)Load_vkFreeMemory, (PFN_vkVoidFunction)Trace_vkFreeMemory, 22, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkMapMemory, (PFN_vkVoidFunction)Load_vkMapMemory, (PFN_vkVoidFunction)Trace_vkMapMemory, 23, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkUnmapMemory, (PFN_vkVoidFunction)Load_vkUnmapMemory, (PFN_vkVoidFunction)Trace_vkUnmapMemory, 24, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkFlushMappedMemoryRanges, (PFN_vkVoidFunction)Load_vkFlushMappedMemoryRanges, (PFN_vkVoidFunction)Trace_vkFlushMappedMemoryRanges, 25, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkInvalidateMappedMemoryRanges, (PFN_vkVoidFunction)Load_vkInvalidateMappedMemoryRanges, (PFN_vkVoidFunction)Trace_vkInvalidateMappedMemoryRanges, 26, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkGetDeviceMemoryCommitment, (PFN_vkVoidFunction)Load_vkGetDeviceMemoryCommitment, (PFN_vkVoidFunction)Trace_vkGetDeviceMemoryCommitment, 27, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkBindBufferMemory, (PFN_vkVoidFunction)Load_vkBindBufferMemory, (PFN_vkVoidFunction)Trace_vkBindBufferMemory, 28, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkBindImageMemory, (PFN_vkVoidFunction)Load_vkBindImageMemory, (PFN_vkVoidFunction)Trace_vkBindImageMemory, 29, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkGetBufferMemoryRequirements, (PFN_vkVoidFunction)Load_vkGetBufferMemoryRequirements, (PFN_vkVoidFunction)Trace_vkGetBufferMemoryRequirements, 30, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkGetImageMemoryRequirements, (PFN_vkVoidFunction)Load_vkGetImageMemoryRequirements, (PFN_vkVoidFunction)Trace_vkGetImageMemoryRequirements, 31, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkGetImageSparseMemoryRequirements, (PFN_vkVoidFunction)Load_vkGetImageSparseMemoryRequirements, (PFN_vkVoidFunction)Trace_vkGetImageSparseMemoryRequirements, 32, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkGetPhysicalDeviceSparseImageFormatProperties, (PFN_vkVoidFunction)Load_vkGetPhysicalDeviceSparseImageFormatProperties, (PFN_vkVoidFunction)Trace_vkGetPhysicalDeviceSparseImageFormatProperties, 33, LEVEL_INSTANCE},
+    {(PFN_vkVoidFunction*)&vkQueueBindSparse, (PFN_vkVoidFunction)Load_vkQueueBindSparse, (PFN_vkVoidFunction)Trace_vkQueueBindSparse, 34, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCreateFence, (PFN_vkVoidFunction)Load_vkCreateFence, (PFN_vkVoidFunction)Trace_vkCreateFence, 35, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkDestroyFence, (PFN_vkVoidFunction)Load_vkDestroyFence, (PFN_vkVoidFunction)Trace_vkDestroyFence, 36, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkResetFences, (PFN_vkVoidFunction)Load_vkResetFences, (PFN_vkVoidFunction)Trace_vkResetFences, 37, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkGetFenceStatus, (PFN_vkVoidFunction)Load_vkGetFenceStatus, (PFN_vkVoidFunction)Trace_vkGetFenceStatus, 38, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkWaitForFences, (PFN_vkVoidFunction)Load_vkWaitForFences, (PFN_vkVoidFunction)Trace_vkWaitForFences, 39, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCreateSemaphore, (PFN_vkVoidFunction)Load_vkCreateSemaphore, (PFN_vkVoidFunction)Trace_vkCreateSemaphore, 40, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkDestroySemaphore, (PFN_vkVoidFunction)Load_vkDestroySemaphore, (PFN_vkVoidFunction)Trace_vkDestroySemaphore, 41, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCreateEvent, (PFN_vkVoidFunction)Load_vkCreateEvent, (PFN_vkVoidFunction)Trace_vkCreateEvent, 42, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkDestroyEvent, (PFN_vkVoidFunction)Load_vkDestroyEvent, (PFN_vkVoidFunction)Trace_vkDestroyEvent, 43, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkGetEventStatus, (PFN_vkVoidFunction)Load_vkGetEventStatus, (PFN_vkVoidFunction)Trace_vkGetEventStatus, 44, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkSetEvent, (PFN_vkVoidFunction)Load_vkSetEvent, (PFN_vkVoidFunction)Trace_vkSetEvent, 45, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkResetEvent, (PFN_vkVoidFunction)Load_vkResetEvent, (PFN_vkVoidFunction)Trace_vkResetEvent, 46, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCreateQueryPool, (PFN_vkVoidFunction)Load_vkCreateQueryPool, (PFN_vkVoidFunction)Trace_vkCreateQueryPool, 47, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkDestroyQueryPool, (PFN_vkVoidFunction)Load_vkDestroyQueryPool, (PFN_vkVoidFunction)Trace_vkDestroyQueryPool, 48, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkGetQueryPoolResults, (PFN_vkVoidFunction)Load_vkGetQueryPoolResults, (PFN_vkVoidFunction)Trace_vkGetQueryPoolResults, 49, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCreateBuffer, (PFN_vkVoidFunction)Load_vkCreateBuffer, (PFN_vkVoidFunction)Trace_vkCreateBuffer, 50, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkDestroyBuffer, (PFN_vkVoidFunction)Load_vkDestroyBuffer, (PFN_vkVoidFunction)Trace_vkDestroyBuffer, 51, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCreateBufferView, (PFN_vkVoidFunction)Load_vkCreateBufferView, (PFN_vkVoidFunction)Trace_vkCreateBufferView, 52, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkDestroyBufferView, (PFN_vkVoidFunction)Load_vkDestroyBufferView, (PFN_vkVoidFunction)Trace_vkDestroyBufferView, 53, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCreateImage, (PFN_vkVoidFunction)Load_vkCreateImage, (PFN_vkVoidFunction)Trace_vkCreateImage, 54, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkDestroyImage, (PFN_vkVoidFunction)Load_vkDestroyImage, (PFN_vkVoidFunction)Trace_vkDestroyImage, 55, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkGetImageSubresourceLayout, (PFN_vkVoidFunction)Load_vkGetImageSubresourceLayout, (PFN_vkVoidFunction)Trace_vkGetImageSubresourceLayout, 56, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCreateImageView, (PFN_vkVoidFunction)Load_vkCreateImageView, (PFN_vkVoidFunction)Trace_vkCreateImageView, 57, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkDestroyImageView, (PFN_vkVoidFunction)Load_vkDestroyImageView, (PFN_vkVoidFunction)Trace_vkDestroyImageView, 58, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCreateShaderModule, (PFN_vkVoidFunction)Load_vkCreateShaderModule, (PFN_vkVoidFunction)Trace_vkCreateShaderModule, 59, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkDestroyShaderModule, (PFN_vkVoidFunction)Load_vkDestroyShaderModule, (PFN_vkVoidFunction)Trace_vkDestroyShaderModule, 60, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCreatePipelineCache, (PFN_vkVoidFunction)Load_vkCreatePipelineCache, (PFN_vkVoidFunction)Trace_vkCreatePipelineCache, 61, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkDestroyPipelineCache, (PFN_vkVoidFunction)Load_vkDestroyPipelineCache, (PFN_vkVoidFunction)Trace_vkDestroyPipelineCache, 62, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkGetPipelineCacheData, (PFN_vkVoidFunction)Load_vkGetPipelineCacheData, (PFN_vkVoidFunction)Trace_vkGetPipelineCacheData, 63, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkMergePipelineCaches, (PFN_vkVoidFunction)Load_vkMergePipelineCaches, (PFN_vkVoidFunction)Trace_vkMergePipelineCaches, 64, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCreateGraphicsPipelines, (PFN_vkVoidFunction)Load_vkCreateGraphicsPipelines, (PFN_vkVoidFunction)Trace_vkCreateGraphicsPipelines, 65, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCreateComputePipelines, (PFN_vkVoidFunction)Load_vkCreateComputePipelines, (PFN_vkVoidFunction)Trace_vkCreateComputePipelines, 66, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkDestroyPipeline, (PFN_vkVoidFunction)Load_vkDestroyPipeline, (PFN_vkVoidFunction)Trace_vkDestroyPipeline, 67, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCreatePipelineLayout, (PFN_vkVoidFunction)Load_vkCreatePipelineLayout, (PFN_vkVoidFunction)Trace_vkCreatePipelineLayout, 68, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkDestroyPipelineLayout, (PFN_vkVoidFunction)Load_vkDestroyPipelineLayout, (PFN_vkVoidFunction)Trace_vkDestroyPipelineLayout, 69, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCreateSampler, (PFN_vkVoidFunction)Load_vkCreateSampler, (PFN_vkVoidFunction)Trace_vkCreateSampler, 70, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkDestroySampler, (PFN_vkVoidFunction)Load_vkDestroySampler, (PFN_vkVoidFunction)Trace_vkDestroySampler, 71, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCreateDescriptorSetLayout, (PFN_vkVoidFunction)Load_vkCreateDescriptorSetLayout, (PFN_vkVoidFunction)Trace_vkCreateDescriptorSetLayout, 72, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkDestroyDescriptorSetLayout, (PFN_vkVoidFunction)Load_vkDestroyDescriptorSetLayout, (PFN_vkVoidFunction)Trace_vkDestroyDescriptorSetLayout, 73, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCreateDescriptorPool, (PFN_vkVoidFunction)Load_vkCreateDescriptorPool, (PFN_vkVoidFunction)Trace_vkCreateDescriptorPool, 74, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkDestroyDescriptorPool, (PFN_vkVoidFunction)Load_vkDestroyDescriptorPool, (PFN_vkVoidFunction)Trace_vkDestroyDescriptorPool, 75, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkResetDescriptorPool, (PFN_vkVoidFunction)Load_vkResetDescriptorPool, (PFN_vkVoidFunction)Trace_vkResetDescriptorPool, 76, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkAllocateDescriptorSets, (PFN_vkVoidFunction)Load_vkAllocateDescriptorSets, (PFN_vkVoidFunction)Trace_vkAllocateDescriptorSets, 77, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkFreeDescriptorSets, (PFN_vkVoidFunction)Load_vkFreeDescriptorSets, (PFN_vkVoidFunction)Trace_vkFreeDescriptorSets, 78, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkUpdateDescriptorSets, (PFN_vkVoidFunction)Load_vkUpdateDescriptorSets, (PFN_vkVoidFunction)Trace_vkUpdateDescriptorSets, 79, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCreateFramebuffer, (PFN_vkVoidFunction)Load_vkCreateFramebuffer, (PFN_vkVoidFunction)Trace_vkCreateFramebuffer, 80, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkDestroyFramebuffer, (PFN_vkVoidFunction)Load_vkDestroyFramebuffer, (PFN_vkVoidFunction)Trace_vkDestroyFramebuffer, 81, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCreateRenderPass, (PFN_vkVoidFunction)Load_vkCreateRenderPass, (PFN_vkVoidFunction)Trace_vkCreateRenderPass, 82, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkDestroyRenderPass, (PFN_vkVoidFunction)Load_vkDestroyRenderPass, (PFN_vkVoidFunction)Trace_vkDestroyRenderPass, 83, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkGetRenderAreaGranularity, (PFN_vkVoidFunction)Load_vkGetRenderAreaGranularity, (PFN_vkVoidFunction)Trace_vkGetRenderAreaGranularity, 84, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCreateCommandPool, (PFN_vkVoidFunction)Load_vkCreateCommandPool, (PFN_vkVoidFunction)Trace_vkCreateCommandPool, 85, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkDestroyCommandPool, (PFN_vkVoidFunction)Load_vkDestroyCommandPool, (PFN_vkVoidFunction)Trace_vkDestroyCommandPool, 86, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkResetCommandPool, (PFN_vkVoidFunction)Load_vkResetCommandPool, (PFN_vkVoidFunction)Trace_vkResetCommandPool, 87, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkAllocateCommandBuffers, (PFN_vkVoidFunction)Load_vkAllocateCommandBuffers, (PFN_vkVoidFunction)Trace_vkAllocateCommandBuffers, 88, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkFreeCommandBuffers, (PFN_vkVoidFunction)Load_vkFreeCommandBuffers, (PFN_vkVoidFunction)Trace_vkFreeCommandBuffers, 89, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkBeginCommandBuffer, (PFN_vkVoidFunction)Load_vkBeginCommandBuffer, (PFN_vkVoidFunction)Trace_vkBeginCommandBuffer, 90, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkEndCommandBuffer, (PFN_vkVoidFunction)Load_vkEndCommandBuffer, (PFN_vkVoidFunction)Trace_vkEndCommandBuffer, 91, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkResetCommandBuffer, (PFN_vkVoidFunction)Load_vkResetCommandBuffer, (PFN_vkVoidFunction)Trace_vkResetCommandBuffer, 92, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdBindPipeline, (PFN_vkVoidFunction)Load_vkCmdBindPipeline, (PFN_vkVoidFunction)Trace_vkCmdBindPipeline, 93, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdSetViewport, (PFN_vkVoidFunction)Load_vkCmdSetViewport, (PFN_vkVoidFunction)Trace_vkCmdSetViewport, 94, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdSetScissor, (PFN_vkVoidFunction)Load_vkCmdSetScissor, (PFN_vkVoidFunction)Trace_vkCmdSetScissor, 95, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdSetLineWidth, (PFN_vkVoidFunction)Load_vkCmdSetLineWidth, (PFN_vkVoidFunction)Trace_vkCmdSetLineWidth, 96, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdSetDepthBias, (PFN_vkVoidFunction)Load_vkCmdSetDepthBias, (PFN_vkVoidFunction)Trace_vkCmdSetDepthBias, 97, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdSetBlendConstants, (PFN_vkVoidFunction)Load_vkCmdSetBlendConstants, (PFN_vkVoidFunction)Trace_vkCmdSetBlendConstants, 98, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdSetDepthBounds, (PFN_vkVoidFunction)Load_vkCmdSetDepthBounds, (PFN_vkVoidFunction)Trace_vkCmdSetDepthBounds, 99, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdSetStencilCompareMask, (PFN_vkVoidFunction)Load_vkCmdSetStencilCompareMask, (PFN_vkVoidFunction)Trace_vkCmdSetStencilCompareMask, 100, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdSetStencilWriteMask, (PFN_vkVoidFunction)Load_vkCmdSetStencilWriteMask, (PFN_vkVoidFunction)Trace_vkCmdSetStencilWriteMask, 101, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdSetStencilReference, (PFN_vkVoidFunction)Load_vkCmdSetStencilReference, (PFN_vkVoidFunction)Trace_vkCmdSetStencilReference, 102, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdBindDescriptorSets, (PFN_vkVoidFunction)Load_vkCmdBindDescriptorSets, (PFN_vkVoidFunction)Trace_vkCmdBindDescriptorSets, 103, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdBindIndexBuffer, (PFN_vkVoidFunction)Load_vkCmdBindIndexBuffer, (PFN_vkVoidFunction)Trace_vkCmdBindIndexBuffer, 104, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdBindVertexBuffers, (PFN_vkVoidFunction)Load_vkCmdBindVertexBuffers, (PFN_vkVoidFunction)Trace_vkCmdBindVertexBuffers, 105, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdDraw, (PFN_vkVoidFunction)Load_vkCmdDraw, (PFN_vkVoidFunction)Trace_vkCmdDraw, 106, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdDrawIndexed, (PFN_vkVoidFunction)Load_vkCmdDrawIndexed, (PFN_vkVoidFunction)Trace_vkCmdDrawIndexed, 107, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdDrawIndirect, (PFN_vkVoidFunction)Load_vkCmdDrawIndirect, (PFN_vkVoidFunction)Trace_vkCmdDrawIndirect, 108, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdDrawIndexedIndirect, (PFN_vkVoidFunction)Load_vkCmdDrawIndexedIndirect, (PFN_vkVoidFunction)Trace_vkCmdDrawIndexedIndirect, 109, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdDispatch, (PFN_vkVoidFunction)Load_vkCmdDispatch, (PFN_vkVoidFunction)Trace_vkCmdDispatch, 110, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdDispatchIndirect, (PFN_vkVoidFunction)Load_vkCmdDispatchIndirect, (PFN_vkVoidFunction)Trace_vkCmdDispatchIndirect, 111, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdCopyBuffer, (PFN_vkVoidFunction)Load_vkCmdCopyBuffer, (PFN_vkVoidFunction)Trace_vkCmdCopyBuffer, 112, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdCopyImage, (PFN_vkVoidFunction)Load_vkCmdCopyImage, (PFN_vkVoidFunction)Trace_vkCmdCopyImage, 113, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdBlitImage, (PFN_vkVoidFunction)Load_vkCmdBlitImage, (PFN_vkVoidFunction)Trace_vkCmdBlitImage, 114, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdCopyBufferToImage, (PFN_vkVoidFunction)Load_vkCmdCopyBufferToImage, (PFN_vkVoidFunction)Trace_vkCmdCopyBufferToImage, 115, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdCopyImageToBuffer, (PFN_vkVoidFunction)Load_vkCmdCopyImageToBuffer, (PFN_vkVoidFunction)Trace_vkCmdCopyImageToBuffer, 116, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdUpdateBuffer, (PFN_vkVoidFunction)Load_vkCmdUpdateBuffer, (PFN_vkVoidFunction)Trace_vkCmdUpdateBuffer, 117, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdFillBuffer, (PFN_vkVoidFunction)Load_vkCmdFillBuffer, (PFN_vkVoidFunction)Trace_vkCmdFillBuffer, 118, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdClearColorImage, (PFN_vkVoidFunction)Load_vkCmdClearColorImage, (PFN_vkVoidFunction)Trace_vkCmdClearColorImage, 119, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdClearDepthStencilImage, (PFN_vkVoidFunction)Load_vkCmdClearDepthStencilImage, (PFN_vkVoidFunction)Trace_vkCmdClearDepthStencilImage, 120, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdClearAttachments, (PFN_vkVoidFunction)Load_vkCmdClearAttachments, (PFN_vkVoidFunction)Trace_vkCmdClearAttachments, 121, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdResolveImage, (PFN_vkVoidFunction)Load_vkCmdResolveImage, (PFN_vkVoidFunction)Trace_vkCmdResolveImage, 122, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdSetEvent, (PFN_vkVoidFunction)Load_vkCmdSetEvent, (PFN_vkVoidFunction)Trace_vkCmdSetEvent, 123, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdResetEvent, (PFN_vkVoidFunction)Load_vkCmdResetEvent, (PFN_vkVoidFunction)Trace_vkCmdResetEvent, 124, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdWaitEvents, (PFN_vkVoidFunction)Load_vkCmdWaitEvents, (PFN_vkVoidFunction)Trace_vkCmdWaitEvents, 125, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdPipelineBarrier, (PFN_vkVoidFunction)Load_vkCmdPipelineBarrier, (PFN_vkVoidFunction)Trace_vkCmdPipelineBarrier, 126, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdBeginQuery, (PFN_vkVoidFunction)Load_vkCmdBeginQuery, (PFN_vkVoidFunction)Trace_vkCmdBeginQuery, 127, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdEndQuery, (PFN_vkVoidFunction)Load_vkCmdEndQuery, (PFN_vkVoidFunction)Trace_vkCmdEndQuery, 128, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdResetQueryPool, (PFN_vkVoidFunction)Load_vkCmdResetQueryPool, (PFN_vkVoidFunction)Trace_vkCmdResetQueryPool, 129, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdWriteTimestamp, (PFN_vkVoidFunction)Load_vkCmdWriteTimestamp, (PFN_vkVoidFunction)Trace_vkCmdWriteTimestamp, 130, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdCopyQueryPoolResults, (PFN_vkVoidFunction)Load_vkCmdCopyQueryPoolResults, (PFN_vkVoidFunction)Trace_vkCmdCopyQueryPoolResults, 131, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdPushConstants, (PFN_vkVoidFunction)Load_vkCmdPushConstants, (PFN_vkVoidFunction)Trace_vkCmdPushConstants, 132, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdBeginRenderPass, (PFN_vkVoidFunction)Load_vkCmdBeginRenderPass, (PFN_vkVoidFunction)Trace_vkCmdBeginRenderPass, 133, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdNextSubpass, (PFN_vkVoidFunction)Load_vkCmdNextSubpass, (PFN_vkVoidFunction)Trace_vkCmdNextSubpass, 134, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdEndRenderPass, (PFN_vkVoidFunction)Load_vkCmdEndRenderPass, (PFN_vkVoidFunction)Trace_vkCmdEndRenderPass, 135, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdExecuteCommands, (PFN_vkVoidFunction)Load_vkCmdExecuteCommands, (PFN_vkVoidFunction)Trace_vkCmdExecuteCommands, 136, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkDestroySurfaceKHR, (PFN_vkVoidFunction)Load_vkDestroySurfaceKHR, (PFN_vkVoidFunction)Trace_vkDestroySurfaceKHR, 137, LEVEL_INSTANCE},
+    {(PFN_vkVoidFunction*)&vkGetPhysicalDeviceSurfaceSupportKHR, (PFN_vkVoidFunction)Load_vkGetPhysicalDeviceSurfaceSupportKHR, (PFN_vkVoidFunction)Trace_vkGetPhysicalDeviceSurfaceSupportKHR, 138, LEVEL_INSTANCE},
+    {(PFN_vkVoidFunction*)&vkGetPhysicalDeviceSurfaceCapabilitiesKHR, (PFN_vkVoidFunction)Load_vkGetPhysicalDeviceSurfaceCapabilitiesKHR, (PFN_vkVoidFunction)Trace_vkGetPhysicalDeviceSurfaceCapabilitiesKHR, 139, LEVEL_INSTANCE},
+    {(PFN_vkVoidFunction*)&vkGetPhysicalDeviceSurfaceFormatsKHR, (PFN_vkVoidFunction)Load_vkGetPhysicalDeviceSurfaceFormatsKHR, (PFN_vkVoidFunction)Trace_vkGetPhysicalDeviceSurfaceFormatsKHR, 140, LEVEL_INSTANCE},
+    {(PFN_vkVoidFunction*)&vkGetPhysicalDeviceSurfacePresentModesKHR, (PFN_vkVoidFunction)Load_vkGetPhysicalDeviceSurfacePresentModesKHR, (PFN_vkVoidFunction)Trace_vkGetPhysicalDeviceSurfacePresentModesKHR, 141, LEVEL_INSTANCE},
+    {(PFN_vkVoidFunction*)&vkCreateSwapchainKHR, (PFN_vkVoidFunction)Load_vkCreateSwapchainKHR, (PFN_vkVoidFunction)Trace_vkCreateSwapchainKHR, 142, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkDestroySwapchainKHR, (PFN_vkVoidFunction)Load_vkDestroySwapchainKHR, (PFN_vkVoidFunction)Trace_vkDestroySwapchainKHR, 143, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkGetSwapchainImagesKHR, (PFN_vkVoidFunction)Load_vkGetSwapchainImagesKHR, (PFN_vkVoidFunction)Trace_vkGetSwapchainImagesKHR, 144, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkAcquireNextImageKHR, (PFN_vkVoidFunction)Load_vkAcquireNextImageKHR, (PFN_vkVoidFunction)Trace_vkAcquireNextImageKHR, 145, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkQueuePresentKHR, (PFN_vkVoidFunction)Load_vkQueuePresentKHR, (PFN_vkVoidFunction)Trace_vkQueuePresentKHR, 146, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkGetPhysicalDeviceDisplayPropertiesKHR, (PFN_vkVoidFunction)Load_vkGetPhysicalDeviceDisplayPropertiesKHR, (PFN_vkVoidFunction)Trace_vkGetPhysicalDeviceDisplayPropertiesKHR, 147, LEVEL_INSTANCE},
+    {(PFN_vkVoidFunction*)&vkGetPhysicalDeviceDisplayPlanePropertiesKHR, (PFN_vkVoidFunction)Load_vkGetPhysicalDeviceDisplayPlanePropertiesKHR, (PFN_vkVoidFunction)Trace_vkGetPhysicalDeviceDisplayPlanePropertiesKHR, 148, LEVEL_INSTANCE},
+    {(PFN_vkVoidFunction*)&vkGetDisplayPlaneSupportedDisplaysKHR, (PFN_vkVoidFunction)Load_vkGetDisplayPlaneSupportedDisplaysKHR, (PFN_vkVoidFunction)Trace_vkGetDisplayPlaneSupportedDisplaysKHR, 149, LEVEL_INSTANCE},
+    {(PFN_vkVoidFunction*)&vkGetDisplayModePropertiesKHR, (PFN_vkVoidFunction)Load_vkGetDisplayModePropertiesKHR, (PFN_vkVoidFunction)Trace_vkGetDisplayModePropertiesKHR, 150, LEVEL_INSTANCE},
+    {(PFN_vkVoidFunction*)&vkCreateDisplayModeKHR, (PFN_vkVoidFunction)Load_vkCreateDisplayModeKHR, (PFN_vkVoidFunction)Trace_vkCreateDisplayModeKHR, 151, LEVEL_INSTANCE},
+    {(PFN_vkVoidFunction*)&vkGetDisplayPlaneCapabilitiesKHR, (PFN_vkVoidFunction)Load_vkGetDisplayPlaneCapabilitiesKHR, (PFN_vkVoidFunction)Trace_vkGetDisplayPlaneCapabilitiesKHR, 152, LEVEL_INSTANCE},
+    {(PFN_vkVoidFunction*)&vkCreateDisplayPlaneSurfaceKHR, (PFN_vkVoidFunction)Load_vkCreateDisplayPlaneSurfaceKHR, (PFN_vkVoidFunction)Trace_vkCreateDisplayPlaneSurfaceKHR, 153, LEVEL_INSTANCE},
+    {(PFN_vkVoidFunction*)&vkCreateSharedSwapchainsKHR, (PFN_vkVoidFunction)Load_vkCreateSharedSwapchainsKHR, (PFN_vkVoidFunction)Trace_vkCreateSharedSwapchainsKHR, 154, LEVEL_DEVICE},
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+    {(PFN_vkVoidFunction*)&vkCreateXlibSurfaceKHR, (PFN_vkVoidFunction)Load_vkCreateXlibSurfaceKHR, (PFN_vkVoidFunction)Trace_vkCreateXlibSurfaceKHR, 155, LEVEL_INSTANCE},
+    {(PFN_vkVoidFunction*)&vkGetPhysicalDeviceXlibPresentationSupportKHR, (PFN_vkVoidFunction)Load_vkGetPhysicalDeviceXlibPresentationSupportKHR, (PFN_vkVoidFunction)Trace_vkGetPhysicalDeviceXlibPresentationSupportKHR, 156, LEVEL_INSTANCE},
+#endif
+#ifdef VK_USE_PLATFORM_XCB_KHR
+    {(PFN_vkVoidFunction*)&vkCreateXcbSurfaceKHR, (PFN_vkVoidFunction)Load_vkCreateXcbSurfaceKHR, (PFN_vkVoidFunction)Trace_vkCreateXcbSurfaceKHR, 157, LEVEL_INSTANCE},
+    {(PFN_vkVoidFunction*)&vkGetPhysicalDeviceXcbPresentationSupportKHR, (PFN_vkVoidFunction)Load_vkGetPhysicalDeviceXcbPresentationSupportKHR, (PFN_vkVoidFunction)Trace_vkGetPhysicalDeviceXcbPresentationSupportKHR, 158, LEVEL_INSTANCE},
+#endif
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+    {(PFN_vkVoidFunction*)&vkCreateWaylandSurfaceKHR, (PFN_vkVoidFunction)Load_vkCreateWaylandSurfaceKHR, (PFN_vkVoidFunction)Trace_vkCreateWaylandSurfaceKHR, 159, LEVEL_INSTANCE},
+    {(PFN_vkVoidFunction*)&vkGetPhysicalDeviceWaylandPresentationSupportKHR, (PFN_vkVoidFunction)Load_vkGetPhysicalDeviceWaylandPresentationSupportKHR, (PFN_vkVoidFunction)Trace_vkGetPhysicalDeviceWaylandPresentationSupportKHR, 160, LEVEL_INSTANCE},
+#endif
+#ifdef VK_USE_PLATFORM_MIR_KHR
+    {(PFN_vkVoidFunction*)&vkCreateMirSurfaceKHR, (PFN_vkVoidFunction)Load_vkCreateMirSurfaceKHR, (PFN_vkVoidFunction)Trace_vkCreateMirSurfaceKHR, 161, LEVEL_INSTANCE},
+    {(PFN_vkVoidFunction*)&vkGetPhysicalDeviceMirPresentationSupportKHR, (PFN_vkVoidFunction)Load_vkGetPhysicalDeviceMirPresentationSupportKHR, (PFN_vkVoidFunction)Trace_vkGetPhysicalDeviceMirPresentationSupportKHR, 162, LEVEL_INSTANCE},
+#endif
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+    {(PFN_vkVoidFunction*)&vkCreateAndroidSurfaceKHR, (PFN_vkVoidFunction)Load_vkCreateAndroidSurfaceKHR, (PFN_vkVoidFunction)Trace_vkCreateAndroidSurfaceKHR, 163, LEVEL_INSTANCE},
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    {(PFN_vkVoidFunction*)&vkCreateWin32SurfaceKHR, (PFN_vkVoidFunction)Load_vkCreateWin32SurfaceKHR, (PFN_vkVoidFunction)Trace_vkCreateWin32SurfaceKHR, 164, LEVEL_INSTANCE},
+    {(PFN_vkVoidFunction*)&vkGetPhysicalDeviceWin32PresentationSupportKHR, (PFN_vkVoidFunction)Load_vkGetPhysicalDeviceWin32PresentationSupportKHR, (PFN_vkVoidFunction)Trace_vkGetPhysicalDeviceWin32PresentationSupportKHR, 165, LEVEL_INSTANCE},
+#endif
+    {(PFN_vkVoidFunction*)&vkGetPhysicalDeviceFeatures2KHR, (PFN_vkVoidFunction)Load_vkGetPhysicalDeviceFeatures2KHR, (PFN_vkVoidFunction)Trace_vkGetPhysicalDeviceFeatures2KHR, 166, LEVEL_INSTANCE},
+    {(PFN_vkVoidFunction*)&vkGetPhysicalDeviceProperties2KHR, (PFN_vkVoidFunction)Load_vkGetPhysicalDeviceProperties2KHR, (PFN_vkVoidFunction)Trace_vkGetPhysicalDeviceProperties2KHR, 167, LEVEL_INSTANCE},
+    {(PFN_vkVoidFunction*)&vkGetPhysicalDeviceFormatProperties2KHR, (PFN_vkVoidFunction)Load_vkGetPhysicalDeviceFormatProperties2KHR, (PFN_vkVoidFunction)Trace_vkGetPhysicalDeviceFormatProperties2KHR, 168, LEVEL_INSTANCE},
+    {(PFN_vkVoidFunction*)&vkGetPhysicalDeviceImageFormatProperties2KHR, (PFN_vkVoidFunction)Load_vkGetPhysicalDeviceImageFormatProperties2KHR, (PFN_vkVoidFunction)Trace_vkGetPhysicalDeviceImageFormatProperties2KHR, 169, LEVEL_INSTANCE},
+    {(PFN_vkVoidFunction*)&vkGetPhysicalDeviceQueueFamilyProperties2KHR, (PFN_vkVoidFunction)Load_vkGetPhysicalDeviceQueueFamilyProperties2KHR, (PFN_vkVoidFunction)Trace_vkGetPhysicalDeviceQueueFamilyProperties2KHR, 170, LEVEL_INSTANCE},
+    {(PFN_vkVoidFunction*)&vkGetPhysicalDeviceMemoryProperties2KHR, (PFN_vkVoidFunction)Load_vkGetPhysicalDeviceMemoryProperties2KHR, (PFN_vkVoidFunction)Trace_vkGetPhysicalDeviceMemoryProperties2KHR, 171, LEVEL_INSTANCE},
+    {(PFN_vkVoidFunction*)&vkGetPhysicalDeviceSparseImageFormatProperties2KHR, (PFN_vkVoidFunction)Load_vkGetPhysicalDeviceSparseImageFormatProperties2KHR, (PFN_vkVoidFunction)Trace_vkGetPhysicalDeviceSparseImageFormatProperties2KHR, 172, LEVEL_INSTANCE},
+    {(PFN_vkVoidFunction*)&vkTrimCommandPoolKHR, (PFN_vkVoidFunction)Load_vkTrimCommandPoolKHR, (PFN_vkVoidFunction)Trace_vkTrimCommandPoolKHR, 173, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkGetPhysicalDeviceExternalBufferPropertiesKHR, (PFN_vkVoidFunction)Load_vkGetPhysicalDeviceExternalBufferPropertiesKHR, (PFN_vkVoidFunction)Trace_vkGetPhysicalDeviceExternalBufferPropertiesKHR, 174, LEVEL_INSTANCE},
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    {(PFN_vkVoidFunction*)&vkGetMemoryWin32HandleKHR, (PFN_vkVoidFunction)Load_vkGetMemoryWin32HandleKHR, (PFN_vkVoidFunction)Trace_vkGetMemoryWin32HandleKHR, 175, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkGetMemoryWin32HandlePropertiesKHR, (PFN_vkVoidFunction)Load_vkGetMemoryWin32HandlePropertiesKHR, (PFN_vkVoidFunction)Trace_vkGetMemoryWin32HandlePropertiesKHR, 176, LEVEL_DEVICE},
+#endif
+    {(PFN_vkVoidFunction*)&vkGetMemoryFdKHR, (PFN_vkVoidFunction)Load_vkGetMemoryFdKHR, (PFN_vkVoidFunction)Trace_vkGetMemoryFdKHR, 177, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkGetMemoryFdPropertiesKHR, (PFN_vkVoidFunction)Load_vkGetMemoryFdPropertiesKHR, (PFN_vkVoidFunction)Trace_vkGetMemoryFdPropertiesKHR, 178, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkGetPhysicalDeviceExternalSemaphorePropertiesKHR, (PFN_vkVoidFunction)Load_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR, (PFN_vkVoidFunction)Trace_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR, 179, LEVEL_INSTANCE},
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    {(PFN_vkVoidFunction*)&vkImportSemaphoreWin32HandleKHR, (PFN_vkVoidFunction)Load_vkImportSemaphoreWin32HandleKHR, (PFN_vkVoidFunction)Trace_vkImportSemaphoreWin32HandleKHR, 180, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkGetSemaphoreWin32HandleKHR, (PFN_vkVoidFunction)Load_vkGetSemaphoreWin32HandleKHR, (PFN_vkVoidFunction)Trace_vkGetSemaphoreWin32HandleKHR, 181, LEVEL_DEVICE},
+#endif
+    {(PFN_vkVoidFunction*)&vkImportSemaphoreFdKHR, (PFN_vkVoidFunction)Load_vkImportSemaphoreFdKHR, (PFN_vkVoidFunction)Trace_vkImportSemaphoreFdKHR, 182, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkGetSemaphoreFdKHR, (PFN_vkVoidFunction)Load_vkGetSemaphoreFdKHR, (PFN_vkVoidFunction)Trace_vkGetSemaphoreFdKHR, 183, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdPushDescriptorSetKHR, (PFN_vkVoidFunction)Load_vkCmdPushDescriptorSetKHR, (PFN_vkVoidFunction)Trace_vkCmdPushDescriptorSetKHR, 184, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCreateDescriptorUpdateTemplateKHR, (PFN_vkVoidFunction)Load_vkCreateDescriptorUpdateTemplateKHR, (PFN_vkVoidFunction)Trace_vkCreateDescriptorUpdateTemplateKHR, 185, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkDestroyDescriptorUpdateTemplateKHR, (PFN_vkVoidFunction)Load_vkDestroyDescriptorUpdateTemplateKHR, (PFN_vkVoidFunction)Trace_vkDestroyDescriptorUpdateTemplateKHR, 186, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkUpdateDescriptorSetWithTemplateKHR, (PFN_vkVoidFunction)Load_vkUpdateDescriptorSetWithTemplateKHR, (PFN_vkVoidFunction)Trace_vkUpdateDescriptorSetWithTemplateKHR, 187, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdPushDescriptorSetWithTemplateKHR, (PFN_vkVoidFunction)Load_vkCmdPushDescriptorSetWithTemplateKHR, (PFN_vkVoidFunction)Trace_vkCmdPushDescriptorSetWithTemplateKHR, 188, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkGetSwapchainStatusKHR, (PFN_vkVoidFunction)Load_vkGetSwapchainStatusKHR, (PFN_vkVoidFunction)Trace_vkGetSwapchainStatusKHR, 189, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkGetPhysicalDeviceExternalFencePropertiesKHR, (PFN_vkVoidFunction)Load_vkGetPhysicalDeviceExternalFencePropertiesKHR, (PFN_vkVoidFunction)Trace_vkGetPhysicalDeviceExternalFencePropertiesKHR, 190, LEVEL_INSTANCE},
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    {(PFN_vkVoidFunction*)&vkImportFenceWin32HandleKHR, (PFN_vkVoidFunction)Load_vkImportFenceWin32HandleKHR, (PFN_vkVoidFunction)Trace_vkImportFenceWin32HandleKHR, 191, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkGetFenceWin32HandleKHR, (PFN_vkVoidFunction)Load_vkGetFenceWin32HandleKHR, (PFN_vkVoidFunction)Trace_vkGetFenceWin32HandleKHR, 192, LEVEL_DEVICE},
+#endif
+    {(PFN_vkVoidFunction*)&vkImportFenceFdKHR, (PFN_vkVoidFunction)Load_vkImportFenceFdKHR, (PFN_vkVoidFunction)Trace_vkImportFenceFdKHR, 193, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkGetFenceFdKHR, (PFN_vkVoidFunction)Load_vkGetFenceFdKHR, (PFN_vkVoidFunction)Trace_vkGetFenceFdKHR, 194, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkGetPhysicalDeviceSurfaceCapabilities2KHR, (PFN_vkVoidFunction)Load_vkGetPhysicalDeviceSurfaceCapabilities2KHR, (PFN_vkVoidFunction)Trace_vkGetPhysicalDeviceSurfaceCapabilities2KHR, 195, LEVEL_INSTANCE},
+    {(PFN_vkVoidFunction*)&vkGetPhysicalDeviceSurfaceFormats2KHR, (PFN_vkVoidFunction)Load_vkGetPhysicalDeviceSurfaceFormats2KHR, (PFN_vkVoidFunction)Trace_vkGetPhysicalDeviceSurfaceFormats2KHR, 196, LEVEL_INSTANCE},
+    {(PFN_vkVoidFunction*)&vkGetImageMemoryRequirements2KHR, (PFN_vkVoidFunction)Load_vkGetImageMemoryRequirements2KHR, (PFN_vkVoidFunction)Trace_vkGetImageMemoryRequirements2KHR, 197, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkGetBufferMemoryRequirements2KHR, (PFN_vkVoidFunction)Load_vkGetBufferMemoryRequirements2KHR, (PFN_vkVoidFunction)Trace_vkGetBufferMemoryRequirements2KHR, 198, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkGetImageSparseMemoryRequirements2KHR, (PFN_vkVoidFunction)Load_vkGetImageSparseMemoryRequirements2KHR, (PFN_vkVoidFunction)Trace_vkGetImageSparseMemoryRequirements2KHR, 199, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCreateSamplerYcbcrConversionKHR, (PFN_vkVoidFunction)Load_vkCreateSamplerYcbcrConversionKHR, (PFN_vkVoidFunction)Trace_vkCreateSamplerYcbcrConversionKHR, 200, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkDestroySamplerYcbcrConversionKHR, (PFN_vkVoidFunction)Load_vkDestroySamplerYcbcrConversionKHR, (PFN_vkVoidFunction)Trace_vkDestroySamplerYcbcrConversionKHR, 201, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkBindBufferMemory2KHR, (PFN_vkVoidFunction)Load_vkBindBufferMemory2KHR, (PFN_vkVoidFunction)Trace_vkBindBufferMemory2KHR, 202, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkBindImageMemory2KHR, (PFN_vkVoidFunction)Load_vkBindImageMemory2KHR, (PFN_vkVoidFunction)Trace_vkBindImageMemory2KHR, 203, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCreateDebugReportCallbackEXT, (PFN_vkVoidFunction)Load_vkCreateDebugReportCallbackEXT, (PFN_vkVoidFunction)Trace_vkCreateDebugReportCallbackEXT, 204, LEVEL_INSTANCE},
+    {(PFN_vkVoidFunction*)&vkDestroyDebugReportCallbackEXT, (PFN_vkVoidFunction)Load_vkDestroyDebugReportCallbackEXT, (PFN_vkVoidFunction)Trace_vkDestroyDebugReportCallbackEXT, 205, LEVEL_INSTANCE},
+    {(PFN_vkVoidFunction*)&vkDebugReportMessageEXT, (PFN_vkVoidFunction)Load_vkDebugReportMessageEXT, (PFN_vkVoidFunction)Trace_vkDebugReportMessageEXT, 206, LEVEL_INSTANCE},
+    {(PFN_vkVoidFunction*)&vkDebugMarkerSetObjectTagEXT, (PFN_vkVoidFunction)Load_vkDebugMarkerSetObjectTagEXT, (PFN_vkVoidFunction)Trace_vkDebugMarkerSetObjectTagEXT, 207, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkDebugMarkerSetObjectNameEXT, (PFN_vkVoidFunction)Load_vkDebugMarkerSetObjectNameEXT, (PFN_vkVoidFunction)Trace_vkDebugMarkerSetObjectNameEXT, 208, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdDebugMarkerBeginEXT, (PFN_vkVoidFunction)Load_vkCmdDebugMarkerBeginEXT, (PFN_vkVoidFunction)Trace_vkCmdDebugMarkerBeginEXT, 209, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdDebugMarkerEndEXT, (PFN_vkVoidFunction)Load_vkCmdDebugMarkerEndEXT, (PFN_vkVoidFunction)Trace_vkCmdDebugMarkerEndEXT, 210, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdDebugMarkerInsertEXT, (PFN_vkVoidFunction)Load_vkCmdDebugMarkerInsertEXT, (PFN_vkVoidFunction)Trace_vkCmdDebugMarkerInsertEXT, 211, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdDrawIndirectCountAMD, (PFN_vkVoidFunction)Load_vkCmdDrawIndirectCountAMD, (PFN_vkVoidFunction)Trace_vkCmdDrawIndirectCountAMD, 212, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdDrawIndexedIndirectCountAMD, (PFN_vkVoidFunction)Load_vkCmdDrawIndexedIndirectCountAMD, (PFN_vkVoidFunction)Trace_vkCmdDrawIndexedIndirectCountAMD, 213, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkGetShaderInfoAMD, (PFN_vkVoidFunction)Load_vkGetShaderInfoAMD, (PFN_vkVoidFunction)Trace_vkGetShaderInfoAMD, 214, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkGetPhysicalDeviceExternalImageFormatPropertiesNV, (PFN_vkVoidFunction)Load_vkGetPhysicalDeviceExternalImageFormatPropertiesNV, (PFN_vkVoidFunction)Trace_vkGetPhysicalDeviceExternalImageFormatPropertiesNV, 215, LEVEL_INSTANCE},
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    {(PFN_vkVoidFunction*)&vkGetMemoryWin32HandleNV, (PFN_vkVoidFunction)Load_vkGetMemoryWin32HandleNV, (PFN_vkVoidFunction)Trace_vkGetMemoryWin32HandleNV, 216, LEVEL_DEVICE},
+#endif
+    {(PFN_vkVoidFunction*)&vkGetDeviceGroupPeerMemoryFeaturesKHX, (PFN_vkVoidFunction)Load_vkGetDeviceGroupPeerMemoryFeaturesKHX, (PFN_vkVoidFunction)Trace_vkGetDeviceGroupPeerMemoryFeaturesKHX, 217, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdSetDeviceMaskKHX, (PFN_vkVoidFunction)Load_vkCmdSetDeviceMaskKHX, (PFN_vkVoidFunction)Trace_vkCmdSetDeviceMaskKHX, 218, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdDispatchBaseKHX, (PFN_vkVoidFunction)Load_vkCmdDispatchBaseKHX, (PFN_vkVoidFunction)Trace_vkCmdDispatchBaseKHX, 219, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkGetDeviceGroupPresentCapabilitiesKHX, (PFN_vkVoidFunction)Load_vkGetDeviceGroupPresentCapabilitiesKHX, (PFN_vkVoidFunction)Trace_vkGetDeviceGroupPresentCapabilitiesKHX, 220, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkGetDeviceGroupSurfacePresentModesKHX, (PFN_vkVoidFunction)Load_vkGetDeviceGroupSurfacePresentModesKHX, (PFN_vkVoidFunction)Trace_vkGetDeviceGroupSurfacePresentModesKHX, 221, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkGetPhysicalDevicePresentRectanglesKHX, (PFN_vkVoidFunction)Load_vkGetPhysicalDevicePresentRectanglesKHX, (PFN_vkVoidFunction)Trace_vkGetPhysicalDevicePresentRectanglesKHX, 222, LEVEL_INSTANCE},
+    {(PFN_vkVoidFunction*)&vkAcquireNextImage2KHX, (PFN_vkVoidFunction)Load_vkAcquireNextImage2KHX, (PFN_vkVoidFunction)Trace_vkAcquireNextImage2KHX, 223, LEVEL_DEVICE},
+#ifdef VK_USE_PLATFORM_VI_NN
+    {(PFN_vkVoidFunction*)&vkCreateViSurfaceNN, (PFN_vkVoidFunction)Load_vkCreateViSurfaceNN, (PFN_vkVoidFunction)Trace_vkCreateViSurfaceNN, 224, LEVEL_INSTANCE},
+#endif
+    {(PFN_vkVoidFunction*)&vkEnumeratePhysicalDeviceGroupsKHX, (PFN_vkVoidFunction)Load_vkEnumeratePhysicalDeviceGroupsKHX, (PFN_vkVoidFunction)Trace_vkEnumeratePhysicalDeviceGroupsKHX, 225, LEVEL_INSTANCE},
+    {(PFN_vkVoidFunction*)&vkCmdProcessCommandsNVX, (PFN_vkVoidFunction)Load_vkCmdProcessCommandsNVX, (PFN_vkVoidFunction)Trace_vkCmdProcessCommandsNVX, 226, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdReserveSpaceForCommandsNVX, (PFN_vkVoidFunction)Load_vkCmdReserveSpaceForCommandsNVX, (PFN_vkVoidFunction)Trace_vkCmdReserveSpaceForCommandsNVX, 227, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCreateIndirectCommandsLayoutNVX, (PFN_vkVoidFunction)Load_vkCreateIndirectCommandsLayoutNVX, (PFN_vkVoidFunction)Trace_vkCreateIndirectCommandsLayoutNVX, 228, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkDestroyIndirectCommandsLayoutNVX, (PFN_vkVoidFunction)Load_vkDestroyIndirectCommandsLayoutNVX, (PFN_vkVoidFunction)Trace_vkDestroyIndirectCommandsLayoutNVX, 229, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCreateObjectTableNVX, (PFN_vkVoidFunction)Load_vkCreateObjectTableNVX, (PFN_vkVoidFunction)Trace_vkCreateObjectTableNVX, 230, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkDestroyObjectTableNVX, (PFN_vkVoidFunction)Load_vkDestroyObjectTableNVX, (PFN_vkVoidFunction)Trace_vkDestroyObjectTableNVX, 231, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkRegisterObjectsNVX, (PFN_vkVoidFunction)Load_vkRegisterObjectsNVX, (PFN_vkVoidFunction)Trace_vkRegisterObjectsNVX, 232, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkUnregisterObjectsNVX, (PFN_vkVoidFunction)Load_vkUnregisterObjectsNVX, (PFN_vkVoidFunction)Trace_vkUnregisterObjectsNVX, 233, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkGetPhysicalDeviceGeneratedCommandsPropertiesNVX, (PFN_vkVoidFunction)Load_vkGetPhysicalDeviceGeneratedCommandsPropertiesNVX, (PFN_vkVoidFunction)Trace_vkGetPhysicalDeviceGeneratedCommandsPropertiesNVX, 234, LEVEL_INSTANCE},
+    {(PFN_vkVoidFunction*)&vkCmdSetViewportWScalingNV, (PFN_vkVoidFunction)Load_vkCmdSetViewportWScalingNV, (PFN_vkVoidFunction)Trace_vkCmdSetViewportWScalingNV, 235, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkReleaseDisplayEXT, (PFN_vkVoidFunction)Load_vkReleaseDisplayEXT, (PFN_vkVoidFunction)Trace_vkReleaseDisplayEXT, 236, LEVEL_INSTANCE},
+#ifdef VK_USE_PLATFORM_XLIB_XRANDR_EXT
+    {(PFN_vkVoidFunction*)&vkAcquireXlibDisplayEXT, (PFN_vkVoidFunction)Load_vkAcquireXlibDisplayEXT, (PFN_vkVoidFunction)Trace_vkAcquireXlibDisplayEXT, 237, LEVEL_INSTANCE},
+    {(PFN_vkVoidFunction*)&vkGetRandROutputDisplayEXT, (PFN_vkVoidFunction)Load_vkGetRandROutputDisplayEXT, (PFN_vkVoidFunction)Trace_vkGetRandROutputDisplayEXT, 238, LEVEL_INSTANCE},
+#endif
+    {(PFN_vkVoidFunction*)&vkGetPhysicalDeviceSurfaceCapabilities2EXT, (PFN_vkVoidFunction)Load_vkGetPhysicalDeviceSurfaceCapabilities2EXT, (PFN_vkVoidFunction)Trace_vkGetPhysicalDeviceSurfaceCapabilities2EXT, 239, LEVEL_INSTANCE},
+    {(PFN_vkVoidFunction*)&vkDisplayPowerControlEXT, (PFN_vkVoidFunction)Load_vkDisplayPowerControlEXT, (PFN_vkVoidFunction)Trace_vkDisplayPowerControlEXT, 240, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkRegisterDeviceEventEXT, (PFN_vkVoidFunction)Load_vkRegisterDeviceEventEXT, (PFN_vkVoidFunction)Trace_vkRegisterDeviceEventEXT, 241, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkRegisterDisplayEventEXT, (PFN_vkVoidFunction)Load_vkRegisterDisplayEventEXT, (PFN_vkVoidFunction)Trace_vkRegisterDisplayEventEXT, 242, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkGetSwapchainCounterEXT, (PFN_vkVoidFunction)Load_vkGetSwapchainCounterEXT, (PFN_vkVoidFunction)Trace_vkGetSwapchainCounterEXT, 243, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkGetRefreshCycleDurationGOOGLE, (PFN_vkVoidFunction)Load_vkGetRefreshCycleDurationGOOGLE, (PFN_vkVoidFunction)Trace_vkGetRefreshCycleDurationGOOGLE, 244, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkGetPastPresentationTimingGOOGLE, (PFN_vkVoidFunction)Load_vkGetPastPresentationTimingGOOGLE, (PFN_vkVoidFunction)Trace_vkGetPastPresentationTimingGOOGLE, 245, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdSetDiscardRectangleEXT, (PFN_vkVoidFunction)Load_vkCmdSetDiscardRectangleEXT, (PFN_vkVoidFunction)Trace_vkCmdSetDiscardRectangleEXT, 246, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkSetHdrMetadataEXT, (PFN_vkVoidFunction)Load_vkSetHdrMetadataEXT, (PFN_vkVoidFunction)Trace_vkSetHdrMetadataEXT, 247, LEVEL_DEVICE},
+#ifdef VK_USE_PLATFORM_IOS_MVK
+    {(PFN_vkVoidFunction*)&vkCreateIOSSurfaceMVK, (PFN_vkVoidFunction)Load_vkCreateIOSSurfaceMVK, (PFN_vkVoidFunction)Trace_vkCreateIOSSurfaceMVK, 248, LEVEL_INSTANCE},
+#endif
+#ifdef VK_USE_PLATFORM_MACOS_MVK
+    {(PFN_vkVoidFunction*)&vkCreateMacOSSurfaceMVK, (PFN_vkVoidFunction)Load_vkCreateMacOSSurfaceMVK, (PFN_vkVoidFunction)Trace_vkCreateMacOSSurfaceMVK, 249, LEVEL_INSTANCE},
+#endif
+    {(PFN_vkVoidFunction*)&vkCmdSetSampleLocationsEXT, (PFN_vkVoidFunction)Load_vkCmdSetSampleLocationsEXT, (PFN_vkVoidFunction)Trace_vkCmdSetSampleLocationsEXT, 250, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkGetPhysicalDeviceMultisamplePropertiesEXT, (PFN_vkVoidFunction)Load_vkGetPhysicalDeviceMultisamplePropertiesEXT, (PFN_vkVoidFunction)Trace_vkGetPhysicalDeviceMultisamplePropertiesEXT, 251, LEVEL_INSTANCE},
+    {(PFN_vkVoidFunction*)&vkCreateValidationCacheEXT, (PFN_vkVoidFunction)Load_vkCreateValidationCacheEXT, (PFN_vkVoidFunction)Trace_vkCreateValidationCacheEXT, 252, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkDestroyValidationCacheEXT, (PFN_vkVoidFunction)Load_vkDestroyValidationCacheEXT, (PFN_vkVoidFunction)Trace_vkDestroyValidationCacheEXT, 253, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkMergeValidationCachesEXT, (PFN_vkVoidFunction)Load_vkMergeValidationCachesEXT, (PFN_vkVoidFunction)Trace_vkMergeValidationCachesEXT, 254, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkGetValidationCacheDataEXT, (PFN_vkVoidFunction)Load_vkGetValidationCacheDataEXT, (PFN_vkVoidFunction)Trace_vkGetValidationCacheDataEXT, 255, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkGetMemoryHostPointerPropertiesEXT, (PFN_vkVoidFunction)Load_vkGetMemoryHostPointerPropertiesEXT, (PFN_vkVoidFunction)Trace_vkGetMemoryHostPointerPropertiesEXT, 256, LEVEL_DEVICE},
+    {(PFN_vkVoidFunction*)&vkCmdWriteBufferMarkerAMD, (PFN_vkVoidFunction)Load_vkCmdWriteBufferMarkerAMD, (PFN_vkVoidFunction)Trace_vkCmdWriteBufferMarkerAMD, 257, LEVEL_DEVICE},
+};
+
+struct CTableThunk {
+    uint32_t           id;
+    PFN_vkVoidFunction trace;
+};
+
+static const CTableThunk table_thunk_table[] = {
+    {12, (PFN_vkVoidFunction)TraceTable_vkDestroyDevice},
+    {17, (PFN_vkVoidFunction)TraceTable_vkGetDeviceQueue},
+    {18, (PFN_vkVoidFunction)TraceTable_vkQueueSubmit},
+    {19, (PFN_vkVoidFunction)TraceTable_vkQueueWaitIdle},
+    {20, (PFN_vkVoidFunction)TraceTable_vkDeviceWaitIdle},
+    {21, (PFN_vkVoidFunction)TraceTable_vkAllocateMemory},
+    {22, (PFN_vkVoidFunction)TraceTable_vkFreeMemory},
+    {23, (PFN_vkVoidFunction)TraceTable_vkMapMemory},
+    {24, (PFN_vkVoidFunction)TraceTable_vkUnmapMemory},
+    {25, (PFN_vkVoidFunction)TraceTable_vkFlushMappedMemoryRanges},
+    {26, (PFN_vkVoidFunction)TraceTable_vkInvalidateMappedMemoryRanges},
+    {27, (PFN_vkVoidFunction)TraceTable_vkGetDeviceMemoryCommitment},
+    {28, (PFN_vkVoidFunction)TraceTable_vkBindBufferMemory},
+    {29, (PFN_vkVoidFunction)TraceTable_vkBindImageMemory},
+    {30, (PFN_vkVoidFunction)TraceTable_vkGetBufferMemoryRequirements},
+    {31, (PFN_vkVoidFunction)TraceTable_vkGetImageMemoryRequirements},
+    {32, (PFN_vkVoidFunction)TraceTable_vkGetImageSparseMemoryRequirements},
+    {34, (PFN_vkVoidFunction)TraceTable_vkQueueBindSparse},
+    {35, (PFN_vkVoidFunction)TraceTable_vkCreateFence},
+    {36, (PFN_vkVoidFunction)TraceTable_vkDestroyFence},
+    {37, (PFN_vkVoidFunction)TraceTable_vkResetFences},
+    {38, (PFN_vkVoidFunction)TraceTable_vkGetFenceStatus},
+    {39, (PFN_vkVoidFunction)TraceTable_vkWaitForFences},
+    {40, (PFN_vkVoidFunction)TraceTable_vkCreateSemaphore},
+    {41, (PFN_vkVoidFunction)TraceTable_vkDestroySemaphore},
+    {42, (PFN_vkVoidFunction)TraceTable_vkCreateEvent},
+    {43, (PFN_vkVoidFunction)TraceTable_vkDestroyEvent},
+    {44, (PFN_vkVoidFunction)TraceTable_vkGetEventStatus},
+    {45, (PFN_vkVoidFunction)TraceTable_vkSetEvent},
+    {46, (PFN_vkVoidFunction)TraceTable_vkResetEvent},
+    {47, (PFN_vkVoidFunction)TraceTable_vkCreateQueryPool},
+    {48, (PFN_vkVoidFunction)TraceTable_vkDestroyQueryPool},
+    {49, (PFN_vkVoidFunction)TraceTable_vkGetQueryPoolResults},
+    {50, (PFN_vkVoidFunction)TraceTable_vkCreateBuffer},
+    {51, (PFN_vkVoidFunction)TraceTable_vkDestroyBuffer},
+    {52, (PFN_vkVoidFunction)TraceTable_vkCreateBufferView},
+    {53, (PFN_vkVoidFunction)TraceTable_vkDestroyBufferView},
+    {54, (PFN_vkVoidFunction)TraceTable_vkCreateImage},
+    {55, (PFN_vkVoidFunction)TraceTable_vkDestroyImage},
+    {56, (PFN_vkVoidFunction)TraceTable_vkGetImageSubresourceLayout},
+    {57, (PFN_vkVoidFunction)TraceTable_vkCreateImageView},
+    {58, (PFN_vkVoidFunction)TraceTable_vkDestroyImageView},
+    {59, (PFN_vkVoidFunction)TraceTable_vkCreateShaderModule},
+    {60, (PFN_vkVoidFunction)TraceTable_vkDestroyShaderModule},
+    {61, (PFN_vkVoidFunction)TraceTable_vkCreatePipelineCache},
+    {62, (PFN_vkVoidFunction)TraceTable_vkDestroyPipelineCache},
+    {63, (PFN_vkVoidFunction)TraceTable_vkGetPipelineCacheData},
+    {64, (PFN_vkVoidFunction)TraceTable_vkMergePipelineCaches},
+    {65, (PFN_vkVoidFunction)TraceTable_vkCreateGraphicsPipelines},
+    {66, (PFN_vkVoidFunction)TraceTable_vkCreateComputePipelines},
+    {67, (PFN_vkVoidFunction)TraceTable_vkDestroyPipeline},
+    {68, (PFN_vkVoidFunction)TraceTable_vkCreatePipelineLayout},
+    {69, (PFN_vkVoidFunction)TraceTable_vkDestroyPipelineLayout},
+    {70, (PFN_vkVoidFunction)TraceTable_vkCreateSampler},
+    {71, (PFN_vkVoidFunction)TraceTable_vkDestroySampler},
+    {72, (PFN_vkVoidFunction)TraceTable_vkCreateDescriptorSetLayout},
+    {73, (PFN_vkVoidFunction)TraceTable_vkDestroyDescriptorSetLayout},
+    {74, (PFN_vkVoidFunction)TraceTable_vkCreateDescriptorPool},
+    {75, (PFN_vkVoidFunction)TraceTable_vkDestroyDescriptorPool},
+    {76, (PFN_vkVoidFunction)TraceTable_vkResetDescriptorPool},
+    {77, (PFN_vkVoidFunction)TraceTable_vkAllocateDescriptorSets},
+    {78, (PFN_vkVoidFunction)TraceTable_vkFreeDescriptorSets},
+    {79, (PFN_vkVoidFunction)TraceTable_vkUpdateDescriptorSets},
+    {80, (PFN_vkVoidFunction)TraceTable_vkCreateFramebuffer},
+    {81, (PFN_vkVoidFunction)TraceTable_vkDestroyFramebuffer},
+    {82, (PFN_vkVoidFunction)TraceTable_vkCreateRenderPass},
+    {83, (PFN_vkVoidFunction)TraceTable_vkDestroyRenderPass},
+    {84, (PFN_vkVoidFunction)TraceTable_vkGetRenderAreaGranularity},
+    {85, (PFN_vkVoidFunction)TraceTable_vkCreateCommandPool},
+    {86, (PFN_vkVoidFunction)TraceTable_vkDestroyCommandPool},
+    {87, (PFN_vkVoidFunction)TraceTable_vkResetCommandPool},
+    {88, (PFN_vkVoidFunction)TraceTable_vkAllocateCommandBuffers},
+    {89, (PFN_vkVoidFunction)TraceTable_vkFreeCommandBuffers},
+    {90, (PFN_vkVoidFunction)TraceTable_vkBeginCommandBuffer},
+    {91, (PFN_vkVoidFunction)TraceTable_vkEndCommandBuffer},
+    {92, (PFN_vkVoidFunction)TraceTable_vkResetCommandBuffer},
+    {93, (PFN_vkVoidFunction)TraceTable_vkCmdBindPipeline},
+    {94, (PFN_vkVoidFunction)TraceTable_vkCmdSetViewport},
+    {95, (PFN_vkVoidFunction)TraceTable_vkCmdSetScissor},
+    {96, (PFN_vkVoidFunction)TraceTable_vkCmdSetLineWidth},
+    {97, (PFN_vkVoidFunction)TraceTable_vkCmdSetDepthBias},
+    {98, (PFN_vkVoidFunction)TraceTable_vkCmdSetBlendConstants},
+    {99, (PFN_vkVoidFunction)TraceTable_vkCmdSetDepthBounds},
+    {100, (PFN_vkVoidFunction)TraceTable_vkCmdSetStencilCompareMask},
+    {101, (PFN_vkVoidFunction)TraceTable_vkCmdSetStencilWriteMask},
+    {102, (PFN_vkVoidFunction)TraceTable_vkCmdSetStencilReference},
+    {103, (PFN_vkVoidFunction)TraceTable_vkCmdBindDescriptorSets},
+    {104, (PFN_vkVoidFunction)TraceTable_vkCmdBindIndexBuffer},
+    {105, (PFN_vkVoidFunction)TraceTable_vkCmdBindVertexBuffers},
+    {106, (PFN_vkVoidFunction)TraceTable_vkCmdDraw},
+    {107, (PFN_vkVoidFunction)TraceTable_vkCmdDrawIndexed},
+    {108, (PFN_vkVoidFunction)TraceTable_vkCmdDrawIndirect},
+    {109, (PFN_vkVoidFunction)TraceTable_vkCmdDrawIndexedIndirect},
+    {110, (PFN_vkVoidFunction)TraceTable_vkCmdDispatch},
+    {111, (PFN_vkVoidFunction)TraceTable_vkCmdDispatchIndirect},
+    {112, (PFN_vkVoidFunction)TraceTable_vkCmdCopyBuffer},
+    {113, (PFN_vkVoidFunction)TraceTable_vkCmdCopyImage},
+    {114, (PFN_vkVoidFunction)TraceTable_vkCmdBlitImage},
+    {115, (PFN_vkVoidFunction)TraceTable_vkCmdCopyBufferToImage},
+    {116, (PFN_vkVoidFunction)TraceTable_vkCmdCopyImageToBuffer},
+    {117, (PFN_vkVoidFunction)TraceTable_vkCmdUpdateBuffer},
+    {118, (PFN_vkVoidFunction)TraceTable_vkCmdFillBuffer},
+    {119, (PFN_vkVoidFunction)TraceTable_vkCmdClearColorImage},
+    {120, (PFN_vkVoidFunction)TraceTable_vkCmdClearDepthStencilImage},
+    {121, (PFN_vkVoidFunction)TraceTable_vkCmdClearAttachments},
+    {122, (PFN_vkVoidFunction)TraceTable_vkCmdResolveImage},
+    {123, (PFN_vkVoidFunction)TraceTable_vkCmdSetEvent},
+    {124, (PFN_vkVoidFunction)TraceTable_vkCmdResetEvent},
+    {125, (PFN_vkVoidFunction)TraceTable_vkCmdWaitEvents},
+    {126, (PFN_vkVoidFunction)TraceTable_vkCmdPipelineBarrier},
+    {127, (PFN_vkVoidFunction)TraceTable_vkCmdBeginQuery},
+    {128, (PFN_vkVoidFunction)TraceTable_vkCmdEndQuery},
+    {129, (PFN_vkVoidFunction)TraceTable_vkCmdResetQueryPool},
+    {130, (PFN_vkVoidFunction)TraceTable_vkCmdWriteTimestamp},
+    {131, (PFN_vkVoidFunction)TraceTable_vkCmdCopyQueryPoolResults},
+    {132, (PFN_vkVoidFunction)TraceTable_vkCmdPushConstants},
+    {133, (PFN_vkVoidFunction)TraceTable_vkCmdBeginRenderPass},
+    {134, (PFN_vkVoidFunction)TraceTable_vkCmdNextSubpass},
+    {135, (PFN_vkVoidFunction)TraceTable_vkCmdEndRenderPass},
+    {136, (PFN_vkVoidFunction)TraceTable_vkCmdExecuteCommands},
+    {142, (PFN_vkVoidFunction)TraceTable_vkCreateSwapchainKHR},
+    {143, (PFN_vkVoidFunction)TraceTable_vkDestroySwapchainKHR},
+    {144, (PFN_vkVoidFunction)TraceTable_vkGetSwapchainImagesKHR},
+    {145, (PFN_vkVoidFunction)TraceTable_vkAcquireNextImageKHR},
+    {146, (PFN_vkVoidFunction)TraceTable_vkQueuePresentKHR},
+    {154, (PFN_vkVoidFunction)TraceTable_vkCreateSharedSwapchainsKHR},
+    {173, (PFN_vkVoidFunction)TraceTable_vkTrimCommandPoolKHR},
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    {175, (PFN_vkVoidFunction)TraceTable_vkGetMemoryWin32HandleKHR},
+    {176, (PFN_vkVoidFunction)TraceTable_vkGetMemoryWin32HandlePropertiesKHR},
+#endif
+    {177, (PFN_vkVoidFunction)TraceTable_vkGetMemoryFdKHR},
+    {178, (PFN_vkVoidFunction)TraceTable_vkGetMemoryFdPropertiesKHR},
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    {180, (PFN_vkVoidFunction)TraceTable_vkImportSemaphoreWin32HandleKHR},
+    {181, (PFN_vkVoidFunction)TraceTable_vkGetSemaphoreWin32HandleKHR},
+#endif
+    {182, (PFN_vkVoidFunction)TraceTable_vkImportSemaphoreFdKHR},
+    {183, (PFN_vkVoidFunction)TraceTable_vkGetSemaphoreFdKHR},
+    {184, (PFN_vkVoidFunction)TraceTable_vkCmdPushDescriptorSetKHR},
+    {185, (PFN_vkVoidFunction)TraceTable_vkCreateDescriptorUpdateTemplateKHR},
+    {186, (PFN_vkVoidFunction)TraceTable_vkDestroyDescriptorUpdateTemplateKHR},
+    {187, (PFN_vkVoidFunction)TraceTable_vkUpdateDescriptorSetWithTemplateKHR},
+    {188, (PFN_vkVoidFunction)TraceTable_vkCmdPushDescriptorSetWithTemplateKHR},
+    {189, (PFN_vkVoidFunction)TraceTable_vkGetSwapchainStatusKHR},
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    {191, (PFN_vkVoidFunction)TraceTable_vkImportFenceWin32HandleKHR},
+    {192, (PFN_vkVoidFunction)TraceTable_vkGetFenceWin32HandleKHR},
+#endif
+    {193, (PFN_vkVoidFunction)TraceTable_vkImportFenceFdKHR},
+    {194, (PFN_vkVoidFunction)TraceTable_vkGetFenceFdKHR},
+    {197, (PFN_vkVoidFunction)TraceTable_vkGetImageMemoryRequirements2KHR},
+    {198, (PFN_vkVoidFunction)TraceTable_vkGetBufferMemoryRequirements2KHR},
+    {199, (PFN_vkVoidFunction)TraceTable_vkGetImageSparseMemoryRequirements2KHR},
+    {200, (PFN_vkVoidFunction)TraceTable_vkCreateSamplerYcbcrConversionKHR},
+    {201, (PFN_vkVoidFunction)TraceTable_vkDestroySamplerYcbcrConversionKHR},
+    {202, (PFN_vkVoidFunction)TraceTable_vkBindBufferMemory2KHR},
+    {203, (PFN_vkVoidFunction)TraceTable_vkBindImageMemory2KHR},
+    {207, (PFN_vkVoidFunction)TraceTable_vkDebugMarkerSetObjectTagEXT},
+    {208, (PFN_vkVoidFunction)TraceTable_vkDebugMarkerSetObjectNameEXT},
+    {209, (PFN_vkVoidFunction)TraceTable_vkCmdDebugMarkerBeginEXT},
+    {210, (PFN_vkVoidFunction)TraceTable_vkCmdDebugMarkerEndEXT},
+    {211, (PFN_vkVoidFunction)TraceTable_vkCmdDebugMarkerInsertEXT},
+    {212, (PFN_vkVoidFunction)TraceTable_vkCmdDrawIndirectCountAMD},
+    {213, (PFN_vkVoidFunction)TraceTable_vkCmdDrawIndexedIndirectCountAMD},
+    {214, (PFN_vkVoidFunction)TraceTable_vkGetShaderInfoAMD},
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    {216, (PFN_vkVoidFunction)TraceTable_vkGetMemoryWin32HandleNV},
+#endif
+    {217, (PFN_vkVoidFunction)TraceTable_vkGetDeviceGroupPeerMemoryFeaturesKHX},
+    {218, (PFN_vkVoidFunction)TraceTable_vkCmdSetDeviceMaskKHX},
+    {219, (PFN_vkVoidFunction)TraceTable_vkCmdDispatchBaseKHX},
+    {220, (PFN_vkVoidFunction)TraceTable_vkGetDeviceGroupPresentCapabilitiesKHX},
+    {221, (PFN_vkVoidFunction)TraceTable_vkGetDeviceGroupSurfacePresentModesKHX},
+    {223, (PFN_vkVoidFunction)TraceTable_vkAcquireNextImage2KHX},
+    {226, (PFN_vkVoidFunction)TraceTable_vkCmdProcessCommandsNVX},
+    {227, (PFN_vkVoidFunction)TraceTable_vkCmdReserveSpaceForCommandsNVX},
+    {228, (PFN_vkVoidFunction)TraceTable_vkCreateIndirectCommandsLayoutNVX},
+    {229, (PFN_vkVoidFunction)TraceTable_vkDestroyIndirectCommandsLayoutNVX},
+    {230, (PFN_vkVoidFunction)TraceTable_vkCreateObjectTableNVX},
+    {231, (PFN_vkVoidFunction)TraceTable_vkDestroyObjectTableNVX},
+    {232, (PFN_vkVoidFunction)TraceTable_vkRegisterObjectsNVX},
+    {233, (PFN_vkVoidFunction)TraceTable_vkUnregisterObjectsNVX},
+    {235, (PFN_vkVoidFunction)TraceTable_vkCmdSetViewportWScalingNV},
+    {240, (PFN_vkVoidFunction)TraceTable_vkDisplayPowerControlEXT},
+    {241, (PFN_vkVoidFunction)TraceTable_vkRegisterDeviceEventEXT},
+    {242, (PFN_vkVoidFunction)TraceTable_vkRegisterDisplayEventEXT},
+    {243, (PFN_vkVoidFunction)TraceTable_vkGetSwapchainCounterEXT},
+    {244, (PFN_vkVoidFunction)TraceTable_vkGetRefreshCycleDurationGOOGLE},
+    {245, (PFN_vkVoidFunction)TraceTable_vkGetPastPresentationTimingGOOGLE},
+    {246, (PFN_vkVoidFunction)TraceTable_vkCmdSetDiscardRectangleEXT},
+    {247, (PFN_vkVoidFunction)TraceTable_vkSetHdrMetadataEXT},
+    {250, (PFN_vkVoidFunction)TraceTable_vkCmdSetSampleLocationsEXT},
+    {252, (PFN_vkVoidFunction)TraceTable_vkCreateValidationCacheEXT},
+    {253, (PFN_vkVoidFunction)TraceTable_vkDestroyValidationCacheEXT},
+    {254, (PFN_vkVoidFunction)TraceTable_vkMergeValidationCachesEXT},
+    {255, (PFN_vkVoidFunction)TraceTable_vkGetValidationCacheDataEXT},
+    {256, (PFN_vkVoidFunction)TraceTable_vkGetMemoryHostPointerPropertiesEXT},
+    {257, (PFN_vkVoidFunction)TraceTable_vkCmdWriteBufferMarkerAMD},
+};
+
+// Reset all pointers at or above the given level to their stubs, so they get re-resolved on next call.
+static void ResetProcs(int level) {
+    for (size_t i = 0; i < sizeof(proc_table) / sizeof(proc_table[0]); ++i) {
+        const CProcEntry& proc = proc_table[i];
+        if (proc.level < level) continue;
+        if (trace_enabled) traced_procs[proc.id] = proc.stub;
+        else               *proc.slot            = proc.stub;
+    }
+}
+
+void InitVulkanInstance(VkInstance instance) {
+    dispatch_instance = instance;
+    dispatch_device   = VK_NULL_HANDLE;
+    ResetProcs(LEVEL_INSTANCE);
+}
+
+void InitVulkanDevice(VkDevice device) {
+    dispatch_device = device;
+    ResetProcs(LEVEL_DEVICE);
+}
+
+void InitVulkanDriver(PFN_vkGetInstanceProcAddr driver) {
+    driver_gipa = driver;
+    loader_gipa = driver ? DriverGetInstanceProcAddr : 0;
+    loader_gdpa = driver ? DriverGetDeviceProcAddr   : 0;
+    ResetProcs(LEVEL_GLOBAL);
+}
+
+//-------------------------------Tracing--------------------------------
+// Swap each pointer with its thunk. (Not thread-safe: don't toggle while other threads call Vulkan.)
+void TraceVulkan(int enable) {
+    if (!enable == !trace_enabled) return;
+    if (enable && !trace_events) {
+        trace_events = (CTraceEvent*)calloc(TRACE_EVENTS, sizeof(CTraceEvent));
+        if (!trace_events) return;
+    }
+    for (size_t i = 0; i < sizeof(proc_table) / sizeof(proc_table[0]); ++i) {
+        const CProcEntry& proc = proc_table[i];
+        if (enable) { traced_procs[proc.id] = *proc.slot;  *proc.slot = proc.trace; }
+        else        { *proc.slot = traced_procs[proc.id]; }
+    }
+    for (int i = 0; i < TRACE_TABLES; ++i)
+        if (trace_tables[i].table) trace_tables[i].swap(trace_tables[i].table, enable);
+    trace_enabled = enable;
+}
+
+int TraceVulkanEnabled(void) { return trace_enabled; }
+
+void TraceVulkanNextFrame(void) {
+    if (!trace_enabled) return;
+    uint64_t calls[TRACE_COUNT] = {};
+    uint64_t time [TRACE_COUNT] = {};
+    for (CTraceThread* thread = trace_threads.load(std::memory_order_acquire); thread; thread = thread->next) {
+        for (uint32_t i = 0; i < TRACE_COUNT; ++i) {
+            calls[i] += thread->calls[i].load(std::memory_order_relaxed);
+            time[i]  += thread->time[i] .load(std::memory_order_relaxed);
+        }
+    }
+    for (uint32_t i = 0; i < TRACE_COUNT; ++i) {
+        trace_last[i].calls  = (uint32_t)(calls[i] - trace_total_calls[i]);
+        trace_last[i].time   = time[i] - trace_total_time[i];
+        trace_total_calls[i] = calls[i];
+        trace_total_time[i]  = time[i];
+    }
+    trace_frame_index.fetch_add(1, std::memory_order_relaxed);
+}
+
+//---------------------------Dispatch tables----------------------------
+void TraceVulkanAddTable(void* table, PFN_TraceVulkanTable swap) {
+    int slot = -1;
+    for (int i = 0; i < TRACE_TABLES && slot < 0; ++i) if (trace_tables[i].table == table) slot = i;
+    for (int i = 0; i < TRACE_TABLES && slot < 0; ++i) if (!trace_tables[i].table) slot = i;
+    if (slot < 0) return;  // too many tables: calls through this one are not traced
+    trace_tables[slot].table = table;
+    trace_tables[slot].swap  = swap;
+    if (trace_enabled) swap(table, 1);
+}
+
+void TraceVulkanRemoveTable(void* table) {
+    int count = 0;
+    for (int i = 0; i < TRACE_TABLES; ++i) {
+        if (trace_tables[i].table == table) trace_tables[i].table = 0;
+        if (trace_tables[i].table) count++;
+    }
+    if (!count) memset(table_procs, 0, sizeof(table_procs));  // The next device may be on another driver.
+}
+
+// Point a table entry at its thunk, or back at the real function.
+// All traced tables share one real function per entry, so a table whose entry points at another
+// function, (eg: a second device, on another driver) keeps that entry untraced.
+void TraceVulkanSwap(PFN_vkVoidFunction* entry, const char* name, int enable) {
+    if (!*entry) return;  // (extension not enabled)
+    for (size_t i = 0; i < sizeof(table_thunk_table) / sizeof(table_thunk_table[0]); ++i) {
+        const CTableThunk& thunk = table_thunk_table[i];
+        if (strcmp(trace_names[thunk.id], name)) continue;
+        PFN_vkVoidFunction& real = table_procs[thunk.id];
+        if (!enable) {
+            if (*entry == thunk.trace) *entry = real;
+        } else if (*entry != thunk.trace && (!real || real == *entry)) {
+            real   = *entry;
+            *entry = thunk.trace;
+        }
+        return;
+    }
+}
+
+static int CompareTraceTime(const void* a, const void* b) {
+    uint64_t ta = trace_last[*(const uint32_t*)a].time;
+    uint64_t tb = trace_last[*(const uint32_t*)b].time;
+    return (ta < tb) - (ta > tb);  // descending
+}
+
+void TraceVulkanPrint(int top_n) {
+    uint32_t order[TRACE_COUNT];
+    uint32_t calls = 0;
+    uint64_t time  = 0;
+    for (uint32_t i = 0; i < TRACE_COUNT; ++i) {
+        order[i] = i;
+        calls += trace_last[i].calls;
+        time  += trace_last[i].time;
+    }
+    qsort(order, TRACE_COUNT, sizeof(order[0]), CompareTraceTime);
+    printf("Vulkan calls in frame %u: %u calls, %.3f ms\n", trace_frame_index ? trace_frame_index - 1 : 0, calls, time / 1e6);
+    printf("\t%-40s %8s %10s %9s\n", "Function", "Calls", "Total(us)", "Avg(ns)");
+    for (int i = 0; i < top_n && i < TRACE_COUNT; ++i) {
+        const CTraceStat& stat = trace_last[order[i]];
+        if (!stat.calls) break;
+        printf("\t%-40s %8u %10.1f %9u\n", trace_names[order[i]], stat.calls, stat.time / 1e3, (uint32_t)(stat.time / stat.calls));
+    }
+}
+
+/* Binary trace format: (native byte order)
+ *   char     magic[4] = "VKTR"
+ *   uint32_t version  = 1
+ *   uint32_t name_count, followed by name_count null-terminated function names. (indexed by id)
+ *   uint32_t event_count, followed by event_count records of:
+ *     { uint32_t id; uint32_t frame; uint64_t start; uint64_t time; }  // start and time in nanoseconds
+ *   Events are in call order. Only the most recent TRACE_EVENTS calls are kept.
+ */
+int TraceVulkanDump(const char* filename) {
+    FILE* file = fopen(filename, "wb");
+    if (!file) return 0;
+    const uint32_t version = 1, name_count = TRACE_COUNT;
+    fwrite("VKTR", 1, 4, file);
+    fwrite(&version, sizeof(version), 1, file);
+    fwrite(&name_count, sizeof(name_count), 1, file);
+    for (uint32_t i = 0; i < TRACE_COUNT; ++i) fwrite(trace_names[i], 1, strlen(trace_names[i]) + 1, file);
+    uint64_t first = (trace_event_count > TRACE_EVENTS) ? trace_event_count - TRACE_EVENTS : 0;
+    uint32_t event_count = (uint32_t)(trace_event_count - first);
+    fwrite(&event_count, sizeof(event_count), 1, file);
+    for (uint64_t i = first; i < trace_event_count; ++i) {
+        const CTraceEvent& event = trace_events[i % TRACE_EVENTS];
+        fwrite(&event.id, sizeof(event.id), 1, file);
+        fwrite(&event.frame, sizeof(event.frame), 1, file);
+        fwrite(&event.start, sizeof(event.start), 1, file);
+        fwrite(&event.time, sizeof(event.time), 1, file);
+    }
+    int ok = !ferror(file);
+    fclose(file);
+    return ok;
+}
 
 #ifdef __cplusplus
 }
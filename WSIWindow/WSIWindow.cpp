@@ -24,9 +24,17 @@
 #include "window_android.h"
 #include "window_win32.h"
 #include "window_xcb.h"
+#include "window_headless.h"
+#include "NullDriver.h"
+#include "CProfiler.h"
 //==============================================================
 
 WSIWindow::WSIWindow(const char* title, const uint width, const uint height) {
+    if (NullDriverActive()) {  // No GPU to present with, so don't open an OS window.
+        LOGI("PLATFORM: HEADLESS\n");
+        pimpl = new Window_headless(title, width, height);
+        return;
+    }
 #ifdef VK_USE_PLATFORM_XCB_KHR
     LOGI("PLATFORM: XCB\n");
     pimpl = new Window_xcb(title, width, height);
@@ -68,6 +76,7 @@ void WSIWindow::Close() { pimpl->Close(); }
 EventType WSIWindow::GetEvent(bool wait_for_event) { return pimpl->GetEvent(wait_for_event); }
 
 bool WSIWindow::ProcessEvents(bool wait_for_event) {
+    PROFILE_ZONE("ProcessEvents");
     EventType e = pimpl->GetEvent(wait_for_event);
     while (e.tag != EventType::NONE) {
     // Calling the event handlers
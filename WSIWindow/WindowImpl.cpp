@@ -25,6 +25,8 @@
 */
 
 #include "WindowImpl.h"
+#include <memory>
+#include <mutex>
 
 //--Events--
 EventType WindowImpl::MouseEvent(eAction action, int16_t x, int16_t y, uint8_t btn) {
@@ -79,7 +81,76 @@ EventType WindowImpl::CloseEvent() {
 void WindowImpl::TextInput(bool enabled) { textinput = enabled; }
 
 bool CSurface::CanPresent(VkPhysicalDevice gpu, uint32_t queue_family) const {
-    VkBool32 can_present = false;
-    VKERRCHECK(vkGetPhysicalDeviceSurfaceSupportKHR(gpu, queue_family, surface, &can_present));
-    return !!can_present;
+    return CSurfaceInfo::Get(gpu, surface).CanPresent(queue_family);
 }
+
+//--CSurfaceInfo--
+static std::vector<std::unique_ptr<CSurfaceInfo>> surface_cache;
+static std::mutex surface_cache_lock;
+
+CSurfaceInfo::CSurfaceInfo(VkPhysicalDevice gpu, VkSurfaceKHR surface)
+    : gpu(gpu), surface(surface), caps_valid(false), formats_valid(false), modes_valid(false), caps() {}
+
+CSurfaceInfo& CSurfaceInfo::Get(VkPhysicalDevice gpu, VkSurfaceKHR surface) {
+    std::lock_guard<std::mutex> guard(surface_cache_lock);
+    for (auto& info : surface_cache) if (info->gpu == gpu && info->surface == surface) return *info;
+    surface_cache.emplace_back(new CSurfaceInfo(gpu, surface));
+    return *surface_cache.back();
+}
+
+void CSurfaceInfo::Forget(VkSurfaceKHR surface) {
+    std::lock_guard<std::mutex> guard(surface_cache_lock);
+    for (size_t i = surface_cache.size(); i-- > 0;)
+        if (surface_cache[i]->surface == surface) surface_cache.erase(surface_cache.begin() + i);
+}
+
+// The getters fill the cache under surface_cache_lock, so they may be called from any thread.
+VkSurfaceCapabilitiesKHR CSurfaceInfo::Capabilities() {  // returns a copy, since Invalidate() lets the next call overwrite it
+    std::lock_guard<std::mutex> guard(surface_cache_lock);
+    if (!caps_valid) VKERRCHECK(vkGetPhysicalDeviceSurfaceCapabilitiesKHR(gpu, surface, &caps));
+    caps_valid = true;
+    return caps;
+}
+
+const std::vector<VkSurfaceFormatKHR>& CSurfaceInfo::Formats() {  // filled once, so the reference stays valid
+    std::lock_guard<std::mutex> guard(surface_cache_lock);
+    if (!formats_valid) {
+        uint32_t count = 0;
+        VKERRCHECK(vkGetPhysicalDeviceSurfaceFormatsKHR(gpu, surface, &count, nullptr));
+        formats.resize(count);
+        VKERRCHECK(vkGetPhysicalDeviceSurfaceFormatsKHR(gpu, surface, &count, formats.data()));
+        formats.resize(count);
+        formats_valid = true;
+    }
+    return formats;
+}
+
+const std::vector<VkPresentModeKHR>& CSurfaceInfo::PresentModes() {
+    std::lock_guard<std::mutex> guard(surface_cache_lock);
+    if (!modes_valid) {
+        uint32_t count = 0;
+        VKERRCHECK(vkGetPhysicalDeviceSurfacePresentModesKHR(gpu, surface, &count, nullptr));
+        modes.resize(count);
+        VKERRCHECK(vkGetPhysicalDeviceSurfacePresentModesKHR(gpu, surface, &count, modes.data()));
+        modes.resize(count);
+        modes_valid = true;
+    }
+    return modes;
+}
+
+bool CSurfaceInfo::CanPresent(uint32_t queue_family) {
+    std::lock_guard<std::mutex> guard(surface_cache_lock);
+    if (queue_family >= support.size()) support.resize(queue_family + 1, -1);
+    if (support[queue_family] < 0) {
+        VkBool32 can_present = false;
+        VKERRCHECK(vkGetPhysicalDeviceSurfaceSupportKHR(gpu, queue_family, surface, &can_present));
+        support[queue_family] = can_present ? 1 : 0;
+    }
+    return support[queue_family] == 1;
+}
+
+void CSurfaceInfo::Invalidate() {  // Only the caps (extent, image counts) change on resize. Formats, present modes
+    std::lock_guard<std::mutex> guard(surface_cache_lock);
+    caps_valid = false;            // and queue-family support stay cached, for the life of the surface.
+}
+//----------------
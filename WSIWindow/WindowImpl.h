@@ -24,6 +24,9 @@
 * WindowImpl is the abstraction layer base class for the platform-specific windowing code.
 * CSurface Contains the vulkan Surface.
 * Before creating a queue, use CanPresent() to check if the surface can present to the given queue type.
+* CSurfaceInfo caches the surface capabilities, formats, present modes and queue-family support, per (gpu, surface).
+* Call Invalidate() on window resize or VK_ERROR_OUT_OF_DATE_KHR, and the next Capabilities() call will fetch fresh values.
+* Its functions are thread-safe. (The cache is filled under a lock.)
 *--------------------------------------------------------------------------
 */
 
@@ -103,6 +106,27 @@ class CMTouch{
     }
 };
 //==============================================================
+//=========================CSurfaceInfo=========================
+class CSurfaceInfo {                                                           // Cached surface queries
+    VkPhysicalDevice gpu;
+    VkSurfaceKHR     surface;
+    bool caps_valid, formats_valid, modes_valid;
+    VkSurfaceCapabilitiesKHR         caps;
+    std::vector<VkSurfaceFormatKHR>  formats;
+    std::vector<VkPresentModeKHR>    modes;
+    std::vector<int8_t>              support;                                  // per queue-family: -1=unknown 0=no 1=yes
+    CSurfaceInfo(VkPhysicalDevice gpu, VkSurfaceKHR surface);
+
+  public:
+    static CSurfaceInfo& Get(VkPhysicalDevice gpu, VkSurfaceKHR surface);      // Returns the shared cache entry
+    static void Forget(VkSurfaceKHR surface);                                  // Drop entries, before destroying the surface
+    VkSurfaceCapabilitiesKHR               Capabilities();                     // Returns a copy, so it can't change under the caller
+    const std::vector<VkSurfaceFormatKHR>& Formats();
+    const std::vector<VkPresentModeKHR>&   PresentModes();
+    bool CanPresent(uint32_t queue_family);
+    void Invalidate();                                                         // Re-query caps on next use
+};
+//==============================================================
 //===========================CSurface===========================
 class CSurface {                                                               // Vulkan Surface
   protected:
@@ -137,7 +161,7 @@ class WindowImpl :public CSurface {
     struct shape_t { int16_t x; int16_t y; uint16_t width; uint16_t height; } shape = {};  // window shape
 
     WindowImpl() : running(false), textinput(false), has_focus(false){}
-    virtual ~WindowImpl() { if(surface) vkDestroySurfaceKHR(instance, surface,NULL); surface = 0; }
+    virtual ~WindowImpl() { if(surface) { CSurfaceInfo::Forget(surface); vkDestroySurfaceKHR(instance, surface, HostAllocator()); } surface = 0; }
     virtual void Close() { eventFIFO.push(CloseEvent()); }
     virtual void CreateSurface(VkInstance instance) = 0;
     virtual bool CanPresent(VkPhysicalDevice gpu, uint32_t queue_family) = 0;  // Checks if window can present the given queue type.
@@ -74,7 +74,7 @@ class Window_android : public WindowImpl {
         android_createInfo.pNext  = NULL;
         android_createInfo.flags  = 0;
         android_createInfo.window = app->window;
-        VKERRCHECK(vkCreateAndroidSurfaceKHR(instance, &android_createInfo, NULL, &surface));
+        VKERRCHECK(vkCreateAndroidSurfaceKHR(instance, &android_createInfo, HostAllocator(), &surface));
         LOGI("Vulkan Surface created\n");
     }
 
@@ -0,0 +1,72 @@
+/*
+*--------------------------------------------------------------------------
+* Copyright (c) 2017 Rene Lindsay
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*
+* Author: Rene Lindsay <rjklindsay@gmail.com>
+*
+*--------------------------------------------------------------------------
+*  Window_headless has no OS window, and produces no input events.
+*  It is used with the null driver, (see NullDriver.h) to run the app without a display or GPU.
+*  Its surface is created with vkCreateDisplayPlaneSurfaceKHR, which the null driver accepts
+*  without a real display, and it keeps running until Close() is called.
+*/
+
+//==========================HEADLESS============================
+#ifndef WINDOW_HEADLESS
+#define WINDOW_HEADLESS
+
+#include "WindowImpl.h"
+
+class Window_headless : public WindowImpl {
+    void SetTitle(const char* title) {}
+    void SetWinPos (uint x, uint y) { shape.x = (int16_t)x;      shape.y = (int16_t)y; }
+    void SetWinSize(uint w, uint h) { shape.width = (uint16_t)w; shape.height = (uint16_t)h; }
+    void CreateSurface(VkInstance instance);
+
+  public:
+    Window_headless(const char* title, uint width, uint height);
+    EventType GetEvent(bool wait_for_event = false);
+    bool CanPresent(VkPhysicalDevice gpu, uint32_t queue_family) { return CSurface::CanPresent(gpu, queue_family); }
+};
+//==============================================================
+
+//====================HEADLESS IMPLEMENTATION===================
+Window_headless::Window_headless(const char* title, uint width, uint height) {
+    shape.width  = width;
+    shape.height = height;
+    running      = true;
+    has_focus    = true;
+    LOGI("Creating Headless-Window...\n");
+}
+
+void Window_headless::CreateSurface(VkInstance instance) {
+    if (surface) return;
+    this->instance = instance;
+    VkDisplaySurfaceCreateInfoKHR create_info = {};
+    create_info.sType       = VK_STRUCTURE_TYPE_DISPLAY_SURFACE_CREATE_INFO_KHR;
+    create_info.transform   = VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR;
+    create_info.alphaMode   = VK_DISPLAY_PLANE_ALPHA_OPAQUE_BIT_KHR;
+    create_info.imageExtent = {shape.width, shape.height};
+    VKERRCHECK(vkCreateDisplayPlaneSurfaceKHR(instance, &create_info, HostAllocator(), &surface));
+    LOGI("Vulkan Surface created\n");
+}
+
+EventType Window_headless::GetEvent(bool wait_for_event) {  // Never blocks: there are no OS events to wait for.
+    if (!eventFIFO.isEmpty()) return *eventFIFO.pop();
+    return {EventType::NONE};
+}
+//==============================================================
+
+#endif
@@ -149,7 +149,7 @@ void Window_win32::CreateSurface(VkInstance instance) {
     win32_createInfo.flags     = 0;
     win32_createInfo.hinstance = hInstance;
     win32_createInfo.hwnd      = hWnd;
-    VKERRCHECK(vkCreateWin32SurfaceKHR(instance, &win32_createInfo, NULL, &surface));
+    VKERRCHECK(vkCreateWin32SurfaceKHR(instance, &win32_createInfo, HostAllocator(), &surface));
     LOGI("Vulkan Surface created\n");
 }
 
@@ -231,7 +231,7 @@ void Window_xcb::CreateSurface(VkInstance instance) {
     xcb_createInfo.flags      = 0;
     xcb_createInfo.connection = xcb_connection;
     xcb_createInfo.window     = xcb_window;
-    VKERRCHECK(vkCreateXcbSurfaceKHR(instance, &xcb_createInfo, NULL, &surface));
+    VKERRCHECK(vkCreateXcbSurfaceKHR(instance, &xcb_createInfo, HostAllocator(), &surface));
     LOGI("Vulkan Surface created\n");
 }
 